@@ -0,0 +1,54 @@
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include <stdint.h>
+
+// Cooperative timers and multi-step actions, run from the main loop.
+// A flow that used to block ("show message, delay, reset, delay, re-advertise") is written as a step
+// function instead: each call runs one step and returns how long to wait before the next one, so
+// the loop keeps sampling sensors, servicing BLE and drawing in between.
+
+#define ASYNC_MAX_TASKS 8
+#define ASYNC_DONE      UINT32_MAX   // returned by a step function when the flow is finished
+
+typedef uint8_t AsyncId;             // 0 = none
+/**
+ * @brief One step of a flow. step counts from 0.
+ * @return Milliseconds until the next step, or ASYNC_DONE.
+ */
+typedef uint32_t (*AsyncStepFn)(uint8_t step);
+
+/**
+ * @brief Starts a flow; its step 0 runs from asyncService() after delayMs.
+ * @param name Shown in the log; a flow with the same name that is still running is not started twice.
+ * @return Id of the (new or already running) flow, 0 if all slots are busy.
+ */
+AsyncId asyncRun(const char *name, AsyncStepFn fn, uint32_t delayMs = 0);
+
+/**
+ * @brief One-shot timer: calls fn once after delayMs.
+ */
+AsyncId asyncAfter(const char *name, uint32_t delayMs, void (*fn)());
+
+/**
+ * @brief Stops a flow before its next step.
+ */
+void asyncCancel(AsyncId id);
+
+/**
+ * @brief True while the flow is scheduled.
+ */
+bool asyncRunning(AsyncId id);
+
+/**
+ * @brief Runs the steps that are due. Call every loop.
+ */
+void asyncService();
+
+/**
+ * @brief Milliseconds until the next step is due (UINT32_MAX if nothing is scheduled); the frame
+ * governor does not wait past it.
+ */
+uint32_t asyncMsUntilNext();
+
+#endif // ASYNC_H
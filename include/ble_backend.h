@@ -0,0 +1,68 @@
+#ifndef BLE_BACKEND_H
+#define BLE_BACKEND_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Thin seam between the SuperCompass BLE protocol (bluetooth.cpp) and the BLE stack.
+// Exactly one backend is compiled in:
+//   ble_backend_bluedroid.cpp  - Arduino BLEDevice/BLEServer classes (default)
+//   ble_backend_nimble.cpp     - NimBLE-Arduino, build with -DSUPERCOMPASS_USE_NIMBLE
+//   ble_backend_loopback.cpp   - no radio, scripted fake central, build with -DSUPERCOMPASS_BLE_LOOPBACK
+// The protocol layer never touches stack types; it addresses characteristics by BleChar.
+
+#define SERVICE_UUID               "e393c3ca-4e9f-4d5c-bba0-37e53272f8b3"
+#define TARGET_CHAR_UUID           "78afdeb8-a315-4030-8337-629d4e021306"
+#define LOCATIONS_LIST_CHAR_UUID   "cdefa4dc-b73e-4865-b35f-fafa76914afb"
+#define LOCATIONS_MODIFY_CHAR_UUID "c660ca7d-b7ea-4c13-84fe-74dd8a11814d"
+#define CURRENT_POSITION_CHAR_UUID "b5439cfa-7d1b-4e82-8a81-f5d84a276dc2"
+// New READY/status characteristic UUID (randomly generated)
+#define READY_CHAR_UUID            "8a3de9c1-5b06-4d8f-9c0b-f2d7b5b0f9aa"
+// Binary telemetry stream (heading, fix, nav solution)
+#define TELEMETRY_CHAR_UUID        "3f1c0a52-8e4b-4c7d-9a2e-6b0d5f7e1c44"
+
+// Characteristics of the SuperCompass service
+enum class BleChar : uint8_t {
+    Target = 0,          // READ | WRITE | NOTIFY
+    Ready,               // READ | NOTIFY
+    Telemetry,           // READ | WRITE | NOTIFY
+    LocationsList,       // READ | NOTIFY
+    LocationsModify,     // WRITE
+    CurrentPosition,     // WRITE
+    Count
+};
+
+// ---- Implemented by the backend ----
+
+// Create the server, service and characteristics. Does not start advertising.
+void bleBackendInit(const char *deviceName);
+// Start (or restart) advertising the service with the preferred connection parameters
+void bleBackendStartAdvertising();
+// Set the value returned to READs
+void bleBackendSetValue(BleChar ch, const uint8_t *data, size_t len);
+// Set the value and send a notification to the connected client
+void bleBackendNotify(BleChar ch, const uint8_t *data, size_t len);
+// True when the connected client enabled notifications on this characteristic
+bool bleBackendIsSubscribed(BleChar ch);
+// Drop the current connection (if any)
+void bleBackendDisconnect();
+// Ask the central for new parameters. Intervals in 1.25 ms units, timeout in 10 ms units.
+void bleBackendRequestConnParams(uint16_t minInterval, uint16_t maxInterval, uint16_t latency, uint16_t timeout);
+// Short stack name for logs / diagnostics
+const char *bleBackendName();
+
+// ---- Implemented by the protocol layer, called from the BLE stack task ----
+
+void bleOnConnect();
+void bleOnDisconnect();
+// Client wrote to a WRITE characteristic
+void bleOnWrite(BleChar ch, const uint8_t *data, size_t len);
+// Client is about to read; the protocol may refresh the value via bleBackendSetValue()
+void bleOnRead(BleChar ch);
+
+#ifdef SUPERCOMPASS_BLE_LOOPBACK
+// Loopback backend only: replay the benchmark scenarios through the protocol layer and print a report
+void bleLoopbackRunScenarios();
+#endif
+
+#endif // BLE_BACKEND_H
@@ -0,0 +1,143 @@
+#ifndef BLE_PROTOCOL_H
+#define BLE_PROTOCOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <ArduinoJson.h>
+#include "ble_backend.h"
+#include "location_store.h"
+
+// Hardware-free half of the SuperCompass BLE protocol: the inbound/outbound queues, decoding of
+// client writes and the locations chunk scheduler. bluetooth.cpp connects it to the backend and
+// the app state; [env:native] drives it with a scripted central (test/test_ble_protocol).
+
+// ---------------- BLE Reliability / Stats (Step 2) ----------------
+struct BleStats {
+    uint32_t hb = 0;              // heartbeat counter
+    uint32_t rxParseErrors = 0;   // JSON / decode failures
+    uint32_t queueOverflow = 0;   // inbound + outbound queue overflows
+    uint32_t notifyErrors = 0;    // notification send failures (future use)
+    uint32_t jsonPosPackets = 0;  // JSON position packets processed
+    uint32_t binaryPosPackets = 0;// binary position packets processed
+    uint32_t telemetryFrames = 0; // telemetry frames queued for notify
+    uint32_t telemetrySkipped = 0;// telemetry frames dropped to leave room for other notifications
+    uint32_t inboundDrops = 0;    // writes rejected because the inbound queue was full
+    uint32_t outboundDrops = 0;   // notifications rejected because the outbound queue was full
+    uint32_t inboundProcessed = 0;// inbound messages handled in checkBLEStatus()
+    uint32_t notifies = 0;        // notifications handed to the backend
+    uint32_t parseCount = 0;      // deserializeJson() calls on inbound messages
+    uint32_t parseUsTotal = 0;    // time spent in those calls (us)
+    uint32_t parseUsMax = 0;      // slowest single parse (us)
+};
+extern BleStats g_bleStats;
+
+// Protocol counters (queues, drops, inbound JSON parse cost), used by the loopback benchmark
+struct BleProtocolStats {
+    uint32_t rxParseErrors;     // malformed or oversize writes
+    uint32_t inboundDrops;      // writes lost to a full inbound queue
+    uint32_t outboundDrops;     // notifications lost to a full outbound queue
+    uint32_t inboundProcessed;  // inbound messages handled
+    uint32_t notifies;          // notifications sent
+    uint8_t inboundHighWater;   // deepest inbound queue fill
+    uint8_t outboundHighWater;  // deepest outbound queue fill
+    uint8_t queueSize;          // slots per queue (one is always kept free)
+    uint32_t parseCount;        // inbound JSON parses
+    uint32_t parseUsTotal;      // total parse time (us)
+    uint32_t parseUsMax;        // slowest parse (us)
+};
+BleProtocolStats getBleProtocolStats();
+// Clear the counters and high-water marks (heartbeat counter is kept)
+void resetBleProtocolStats();
+
+// ---------------- Inbound Message Queue (Step 3) ----------------
+// Writes are copied here in the BLE callback and parsed later from the main loop.
+namespace BLEInbound {
+    enum class Type : uint8_t { Target=0, LocationsModify=1, Position=2 };
+    struct Msg { Type type; uint8_t len; uint32_t rxTime; char data[128]; }; // rxTime = millis() at callback
+    static constexpr uint8_t QSIZE = 8;      // ring buffer size
+    static constexpr uint8_t MAX_LEN = 120;  // longer writes are rejected as parse errors
+    extern volatile uint32_t lastRxTime;     // millis() of the last accepted write (link activity)
+    extern uint8_t highWater;                // deepest queue fill seen
+
+    bool enqueue(Type t, const char* src, size_t len);
+    bool dequeue(Msg &out);
+    bool empty();
+}
+
+// ---------------- Outbound Notification Queue (Step 5) ----------------
+// Notifications are sent one per main loop pass so a sync never bursts the link.
+namespace BLEOutbound {
+    static constexpr uint8_t MAX_LEN = 180;  // < MTU-3 if MTU 185; longer notifications are rejected
+    struct Msg { BleChar ch; uint8_t len; uint8_t data[MAX_LEN]; };
+    static constexpr uint8_t QSIZE = 8;
+    extern uint8_t highWater;     // deepest queue fill seen
+
+    bool enqueue(BleChar ch, const uint8_t* buf, size_t len);
+    bool dequeue(Msg &out);
+    // One slot is always kept empty to tell full from empty
+    uint8_t freeSlots();
+    bool empty();
+    // Drops everything queued (client gone: the frames are stale and would never be sent)
+    void clear();
+}
+
+// Inbound JSON parse with timing (per-message cost shows up in the stats / loopback report)
+DeserializationError parseInbound(JsonDocument &doc, const BLEInbound::Msg &msg);
+
+// What a client write asks for, validated and range checked. Applying it to the target, the
+// location store and the position source is left to the caller.
+struct BleCommand {
+    enum class Kind : uint8_t {
+        None = 0,       // malformed or invalid write (already counted and logged)
+        Target,         // name (if hasName), lat, lon
+        AddLocation,    // name, lat, lon
+        EditLocation,   // index, name, lat/lon when hasLat/hasLon (index is not range checked)
+        DeleteLocation, // index (not range checked)
+        ExportJson,
+        ImportJson,
+        ResetStats,
+        Position        // lat, lon, accuracyM, fixTime (local millis())
+    };
+    Kind kind = Kind::None;
+    char name[BLEInbound::MAX_LEN + 1] = "";
+    bool hasName = false;
+    double lat = 0, lon = 0;
+    bool hasLat = false, hasLon = false;
+    int index = -1;
+    float accuracyM = 0;
+    uint32_t fixTime = 0;
+};
+
+/**
+ * @brief Decodes one queued write (JSON or the binary position frames).
+ * @param msg Message taken from BLEInbound.
+ * @param cmd Filled in; cmd.kind is None when the write is unusable.
+ * @return true when cmd holds something to apply.
+ */
+bool bleDecodeInbound(const BLEInbound::Msg &msg, BleCommand &cmd);
+
+// ---------------- Locations Chunk Sending (Step 6) ----------------
+// The locations list is sent as small JSON chunks through the outbound queue:
+// {"items":[{"name","lat","lon"},...],"chunk":seq,"first":index,"count":locations,"final":bool}
+// A chunk holds as many locations as fit one notification (at most PER_CHUNK); a name too long
+// to fit even alone is cut short. 'first' is the store index of items[0], 'count' the list size.
+namespace BLELocationsSync {
+    static constexpr uint8_t PER_CHUNK = 3;                       // keep JSON small
+    static constexpr size_t CHUNK_MAX = BLEOutbound::MAX_LEN + 1; // chunk buffer incl. terminator
+
+    // Start over with a snapshot of 'total' locations
+    void start(uint16_t total);
+    bool inProgress();
+    /**
+     * @brief Builds the next chunk and queues it for notify while a client is connected.
+     *        One chunk per call; it waits while the outbound queue has no free slot and is
+     *        only advanced once the chunk is queued.
+     * @param store Locations to send (the sync ends early if it shrank).
+     * @param connected Whether a client is connected (chunks are only queued then).
+     * @param out Receives the chunk JSON (CHUNK_MAX bytes), for the READ value.
+     * @return Chunk length, or 0 when nothing was built this call.
+     */
+    size_t next(const LocationStore &store, bool connected, char *out);
+}
+
+#endif // BLE_PROTOCOL_H
@@ -0,0 +1,32 @@
+#ifndef BLE_SCENARIOS_H
+#define BLE_SCENARIOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ble_backend.h"
+
+// Scripted client traffic for the BLE protocol benchmarks. The loopback backend replays it on the
+// device through bleOnWrite(); test/test_ble_protocol replays it against the protocol unit on the host.
+// A scenario writes 'count' messages, 'burst' of them per main loop pass (writes arriving faster
+// than checkBLEStatus() runs), then keeps pumping until the queues and any locations sync drained.
+
+#define BLE_SCENARIO_MAX_WRITE 120
+
+struct BleScenario {
+    const char *name;
+    uint16_t count;
+    uint8_t burst;
+    /**
+     * @brief Builds write i of the scenario.
+     * @param now millis() at the time of the write (binary position frames carry a phone timestamp).
+     * @param ch Receives the characteristic written.
+     * @param buf Receives the payload (BLE_SCENARIO_MAX_WRITE bytes).
+     * @return Payload length.
+     */
+    size_t (*build)(uint16_t i, uint32_t now, BleChar &ch, uint8_t *buf);
+};
+
+extern const BleScenario BLE_SCENARIOS[];
+extern const size_t BLE_SCENARIO_COUNT;
+
+#endif // BLE_SCENARIOS_H
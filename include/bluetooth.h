@@ -3,6 +3,7 @@
 
 #include "globals_and_includes.h"
 #include "ui/drawing.h"
+#include "ble_protocol.h" // queues, decoding, protocol stats
 
 void setupBLE();
 void notifySavedLocationsChange();
@@ -17,5 +18,25 @@ void publishTargetCharacteristic();
 // Publish READY state (true when device finished initializing data)
 void publishReady(bool ready);
 
+// Latest navigation solution, handed to the telemetry stream once per loop.
+// Magnetometer, HDOP, satellites and speed are sampled inside bluetooth.cpp.
+struct NavTelemetry {
+    double headingDeg;          // smoothed true heading (0-360)
+    bool fixValid;              // lat/lon below are usable
+    bool fixFromBle;            // fix came from the phone instead of the internal GPS
+    double lat;
+    double lon;
+    bool targetBearingValid;    // target set and fix valid
+    double targetBearingDeg;    // bearing from fix to target (0-360)
+};
+
+// Store the latest nav sample; it is coalesced and sent at the client-selected rate
+void updateTelemetrySample(const NavTelemetry &sample);
+// Longest main loop period that keeps BLE flowing: 0 while there is inbound work, or outbound work
+// (queue, locations sync) for a connected client,
+// half the telemetry period while a client is subscribed, UINT32_MAX when BLE needs nothing
+uint32_t bleMaxLoopPeriodMs();
+
+
 
 #endif // BLUETOOTH_H
\ No newline at end of file
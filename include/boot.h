@@ -0,0 +1,40 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stdint.h>
+
+// Boot sequencing and profiling.
+// setup() only brings up what the first compass frame needs (display, sensors, NVS settings).
+// Storage, saved locations, the location index and BLE are started by bootStartDeferredInit(),
+// on a background task, so the compass is on screen while they load.
+
+/**
+ * @brief Records a boot stage with the time since reset. Safe to call from any task; stages after
+ * the table is full are dropped.
+ */
+void bootMark(const char *stage);
+
+/**
+ * @brief True when this boot is the fast path (button wake from deep sleep, or SUPERCOMPASS_FAST_BOOT).
+ * The fast path skips waiting for the USB serial monitor.
+ */
+bool bootIsFast();
+
+/**
+ * @brief Mounts storage, loads the saved locations, builds the location index and starts BLE.
+ * @param async true: runs on a background task; false: runs to completion before returning.
+ */
+void bootStartDeferredInit(bool async);
+
+/**
+ * @brief True once the deferred init has finished (saved locations and BLE are usable).
+ */
+bool bootDataReady();
+
+/**
+ * @brief Call from loop(): marks the first frame, reports a storage failure and prints the boot
+ * summary once both the first frame and the deferred init are done.
+ */
+void bootService();
+
+#endif // BOOT_H
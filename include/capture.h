@@ -0,0 +1,29 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stdint.h>
+
+// Screen capture over USB serial, for checking rendering changes against reference images.
+// Built with -DSUPERCOMPASS_CAPTURE (env m5stack-stamps3-capture); otherwise captureService() is empty.
+//
+// Commands, one per line on the USB serial console:
+//   cap        the canvas as it is on screen now
+//   cap all    every page rendered from scratch (compass at fixed headings), from the compass page
+//
+// Each frame is sent as text lines between the log output, so tools/capture_to_png.py can pick
+// it out of a normal monitor session:
+//   CAP BEGIN <name> <width> <height> <render us>
+//   CAP <base64 of RLE triples: run length - 1, RGB565 big endian>
+//   CAP END <pixel count>
+// "cap all" ends with CAP DONE. The render time covers page->render() only, not the transfer.
+//
+// The pages without live data (compass at the fixed headings, menu, settings) have reference
+// frames in test/golden/; this fails if any of them differs:
+//   tools/capture_to_png.py --port /dev/ttyACM0 -o captures/ --golden test/golden/
+
+/**
+ * @brief Reads capture commands from Serial and sends the requested frames; call every loop.
+ */
+void captureService();
+
+#endif // CAPTURE_H
@@ -0,0 +1,61 @@
+#ifndef FRAME_GOVERNOR_H
+#define FRAME_GOVERNOR_H
+
+#include <stdint.h>
+
+// Frame pacing for the main loop.
+// The loop runs at full rate (capped at GOV_ACTIVE_PERIOD_MS) while the picture changes or input
+// arrives, and drops to GOV_IDLE_PERIOD_MS / GOV_DOZE_PERIOD_MS loops once heading, arrow and UI
+// state have been still for a while. Between loops the task blocks on the input interrupts, so a
+// knob turn or button press ends the wait at once and ramps straight back to Active.
+// BLE can only shorten the period: a subscribed telemetry client or queued BLE work sets a cap
+// (bleMaxLoopPeriodMs()), and a GATT write ends the wait (inputWake()) without counting as activity.
+//
+// With SUPERCOMPASS_LIGHT_SLEEP the idle waits use light sleep (timer + encoder/button GPIO wake)
+// while no BLE client is connected. Off by default: USB serial disconnects and BLE advertising and
+// GPS characters received during the sleep are lost.
+
+#define GOV_ACTIVE_PERIOD_MS   16      // ~60 FPS cap
+#define GOV_IDLE_PERIOD_MS     200     // 5 FPS
+#define GOV_DOZE_PERIOD_MS     1000    // 1 FPS
+#define GOV_IDLE_AFTER_MS      1500    // still this long: Active -> Idle
+#define GOV_DOZE_AFTER_MS      30000   // still this long: Idle -> Doze (not while a BLE client is connected)
+
+enum class GovMode : uint8_t { Active, Idle, Doze, Count };
+
+// What the page stack did this loop
+enum class FrameResult : uint8_t {
+    None,       // nothing to redraw
+    Refresh,    // periodic refresh of live data only
+    Changed,    // page state, input, animation or overlay changed the picture
+};
+
+struct GovModeStats {
+    uint32_t timeMs;        // time spent in the mode
+    uint32_t sleepMs;       // of which blocked or light-sleeping
+    uint32_t frames;        // frames pushed
+    float fps;
+    float estCurrentMa;     // modeled from awake/sleep share and backlight, the Dial has no current sense
+};
+
+/**
+ * @brief Call at the very end of loop(): records the frame and waits until the next loop slot of the
+ * current mode (or until input arrives).
+ * @param loopStartMs millis() at the top of this loop iteration.
+ */
+void governorEndLoop(FrameResult frame, uint32_t loopStartMs);
+
+/**
+ * @brief Forces Active (e.g. something outside the page stack wants smooth updates).
+ */
+void governorWake();
+
+GovMode governorMode();
+const char *governorModeName(GovMode mode);
+
+/**
+ * @brief Totals since boot for one mode.
+ */
+GovModeStats governorStats(GovMode mode);
+
+#endif // FRAME_GOVERNOR_H
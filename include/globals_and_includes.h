@@ -46,21 +46,8 @@ extern double smoothedHeadingX;
 extern double smoothedHeadingY;
 extern bool firstHeadingReading;
 
-extern bool menuActive;
-extern bool savedLocationsMenuActive;
-extern bool settingsMenuActive; // Settings page active
-
-// For popup notifications
-extern bool popupActive;
-extern uint32_t popupEndTime;
-extern String popupMessage;
-extern uint16_t popupTextColor;
-extern uint16_t popupBgColor;
-extern bool gpsinfoActive;
-
-// Encoder Variables
-static int encoder_click_accumulator = 0;
-const int ENCODER_COUNTS_PER_DETENT = 4;
+// Last raw magnetometer sample (updated by calculateRawTrueHeading)
+extern int lastMagX, lastMagY, lastMagZ;
 
 extern bool targetIsSet;
 
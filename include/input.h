@@ -0,0 +1,76 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+
+// Unified input: encoder, button and touch as one timestamped event queue.
+// The encoder is decoded in a GPIO interrupt (the M5Dial library encoder is not started), which
+// pushes whole detents into a lock-free single-producer ring, so counts are never lost while a
+// frame is drawing. inputPoll() moves them into the event queue together with the button and touch
+// events of M5.update(). Pages drain the queue with inputNext().
+
+#define INPUT_ENCODER_PIN_A     40   // same order as the M5Dial library encoder (clockwise = +)
+#define INPUT_ENCODER_PIN_B     41
+#define INPUT_BUTTON_PIN        42   // BtnA; only used as a wake source, M5Unified still debounces it
+#define INPUT_COUNTS_PER_DETENT 4
+#define INPUT_QUEUE_SIZE        16
+#define INPUT_LONG_PRESS_MS     2000
+
+enum class InputType : uint8_t {
+    Rotate,       // detents / steps / velocity
+    Press,        // button went down (M5.BtnA.wasPressed)
+    Hold,         // button held past the M5Unified hold time
+    LongPress,    // button held for INPUT_LONG_PRESS_MS, sent once per press
+    Tap,          // touch click at x / y (only when touch is enabled)
+};
+
+struct InputEvent {
+    InputType type;
+    int8_t detents;       // Rotate: + clockwise, - counter-clockwise
+    int8_t steps;         // Rotate: detents with acceleration applied (for long lists and values)
+    uint16_t velocity;    // Rotate: detents per second (0 for the first detent after a pause)
+    int16_t x, y;         // Tap
+    uint32_t timeMs;
+};
+
+/**
+ * @brief Attaches the encoder and button interrupts. Call once after M5Dial.begin().
+ */
+void inputBegin();
+
+/**
+ * @brief Collects encoder detents from the ISR ring and the button/touch events of this loop.
+ * Call right after M5.update().
+ */
+void inputPoll();
+
+/**
+ * @brief Takes the oldest pending event.
+ * @return false when the queue is empty.
+ */
+bool inputNext(InputEvent &ev);
+
+/**
+ * @brief millis() of the newest event queued by inputPoll() (0 before the first one).
+ */
+uint32_t inputLastEventMs();
+
+/**
+ * @brief Drops pending events (page changes, so a burst meant for one page does not leak into the next).
+ */
+void inputFlush();
+
+/**
+ * @brief Blocks the calling task until the encoder or button interrupt fires, inputWake() is called,
+ * or timeoutMs passes.
+ * Touch is not interrupt driven; it is picked up by the next inputPoll() after the timeout.
+ * @return true if woken by input.
+ */
+bool inputWaitForEvent(uint32_t timeoutMs);
+
+/**
+ * @brief Ends a pending inputWaitForEvent() early (task context, e.g. the BLE host task).
+ */
+void inputWake();
+
+#endif // INPUT_H
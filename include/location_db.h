@@ -0,0 +1,49 @@
+#ifndef LOCATION_DB_H
+#define LOCATION_DB_H
+
+#include <stdint.h>
+#include "location_store.h"
+
+// Append-only log of location edits on the filesystem (/locations.db).
+// Each edit is one fixed 64-byte record with its own CRC32, so an add, rename or delete costs
+// a single small append instead of rewriting the whole list. Replaying the log in order rebuilds
+// the LocationStore; a periodic compaction rewrites the log as one "add" per live entry.
+
+#define LOCATION_DB_FILE "/locations.db"
+
+/**
+ * @brief Rebuilds the store by replaying the log.
+ * Replay stops at the first short or corrupt record (e.g. power loss mid-write); the
+ * damaged tail is dropped by compacting right away. Intact records the store rejects (full,
+ * index out of range) are skipped and logged.
+ * @param store Store to fill (cleared first).
+ * @return false if there is no log yet (caller imports JSON or loads defaults).
+ */
+bool locationDbLoad(LocationStore &store);
+
+/**
+ * @brief Logs an add. Call after store.add() succeeded.
+ */
+bool locationDbAppendAdd(const char *name, double lat, double lon);
+
+/**
+ * @brief Logs a rename/move of entry index. Call after store.update() succeeded.
+ */
+bool locationDbAppendUpdate(uint16_t index, const char *name, double lat, double lon);
+
+/**
+ * @brief Logs removal of entry index. Call after store.remove() succeeded.
+ */
+bool locationDbAppendRemove(uint16_t index);
+
+/**
+ * @brief Rewrites the log as a snapshot of the store (temp file + rename).
+ */
+bool locationDbCompact(const LocationStore &store);
+
+/**
+ * @brief Compacts when dead records outweigh live ones. Cheap to call after every edit.
+ */
+void locationDbMaybeCompact(const LocationStore &store);
+
+#endif // LOCATION_DB_H
@@ -0,0 +1,48 @@
+#ifndef LOCATION_INDEX_H
+#define LOCATION_INDEX_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "location_store.h"
+
+// Latitude-sorted index over a LocationStore.
+// Queries binary-search the reference latitude and walk outward, stopping as soon as the
+// latitude gap alone exceeds what is still needed, so only nearby entries get a distance
+// computed. Distances use a local flat-earth approximation (fine for ranking and for
+// radii up to a few hundred km).
+class LocationIndex {
+public:
+    /**
+     * @brief Re-sorts the index if the store changed since the last call (O(n log n), edits only).
+     */
+    void sync(const LocationStore &store);
+
+    /**
+     * @brief The n entries closest to (lat, lon), nearest first.
+     * @param out Receives store indices; must hold n entries.
+     * @return Number of entries written (min(n, store size)).
+     */
+    size_t nearest(const LocationStore &store, double lat, double lon, size_t n, uint16_t *out);
+
+    /**
+     * @brief All entries within radiusM of (lat, lon), in latitude order.
+     * @param out Receives store indices, at most maxOut; nullptr to only count.
+     * @return Number of matching entries (written to out unless it is nullptr).
+     */
+    size_t within(const LocationStore &store, double lat, double lon, float radiusM, uint16_t *out, size_t maxOut);
+
+    /**
+     * @brief Approximate ground distance in meters from (lat, lon) to store entry i.
+     */
+    static float distanceM(const LocationStore &store, size_t i, double lat, double lon);
+
+private:
+    size_t lowerBound(const LocationStore &store, int32_t latE7) const;
+
+    uint16_t order_[LOCATION_STORE_MAX];
+    uint16_t count_ = 0;
+    uint32_t revision_ = 0;
+    bool built_ = false;
+};
+
+#endif // LOCATION_INDEX_H
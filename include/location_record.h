@@ -0,0 +1,53 @@
+#ifndef LOCATION_RECORD_H
+#define LOCATION_RECORD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "location_store.h"
+
+// Record format of the location log (location_db.h), without the file handling, so the encoding
+// and replay rules can be checked on the host.
+
+enum DbOp : uint8_t {
+    DB_OP_ADD = 1,
+    DB_OP_UPDATE = 2,
+    DB_OP_REMOVE = 3,
+};
+
+// One log entry, little-endian as stored on flash
+struct DbRecord {
+    uint8_t op;
+    uint8_t nameLen;
+    uint16_t index;     // UPDATE / REMOVE target
+    int32_t latE7;
+    int32_t lonE7;
+    char name[48];      // not NUL-terminated when nameLen == 48
+    uint32_t crc;       // CRC32 of all bytes above
+};
+static_assert(sizeof(DbRecord) == 64, "DbRecord must stay 64 bytes");
+static_assert(LOCATION_NAME_MAX_LEN <= sizeof(((DbRecord*)0)->name), "name field too small");
+
+// Outcome of replaying one record
+enum class DbReplay : uint8_t {
+    Applied,
+    Rejected,   // intact, but the store refused it (full, index out of range, unknown op)
+    Corrupt,    // CRC mismatch
+};
+
+/**
+ * @brief Fills a record and its CRC.
+ * @param name nullptr for REMOVE.
+ */
+void locationRecordFill(DbRecord &r, DbOp op, uint16_t index, const char *name, double lat, double lon);
+
+/**
+ * @brief Checks the record's CRC and applies it to the store.
+ */
+DbReplay locationRecordApply(LocationStore &store, const DbRecord &r);
+
+/**
+ * @brief CRC32 (IEEE, as in zlib) of the record's bytes before the crc field.
+ */
+uint32_t locationRecordCrc(const DbRecord &r);
+
+#endif // LOCATION_RECORD_H
@@ -0,0 +1,69 @@
+#ifndef LOCATION_STORE_H
+#define LOCATION_STORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Capacity is fixed at build time so memory use does not depend on what the phone sends.
+// Per record: 4 (lat) + 4 (lon) + 2 (name offset) bytes, names share one pool.
+#ifndef LOCATION_STORE_MAX
+#define LOCATION_STORE_MAX 1024
+#endif
+#ifndef LOCATION_STORE_NAME_POOL
+#define LOCATION_STORE_NAME_POOL 12288
+#endif
+// Longer names are truncated on add/update
+#define LOCATION_NAME_MAX_LEN 47
+
+// Structure for a saved location (a view: name points into the store's pool and is only
+// valid until the store is modified)
+typedef struct {
+    const char* name;
+    double lat;
+    double lon;
+} SavedLocation;
+
+// Saved locations as parallel arrays of E7 coordinates (~1 cm resolution) plus a packed,
+// NUL-separated name pool. The pool never holds garbage: removing or renaming an entry
+// closes the gap immediately, so add() only fails when the list is genuinely full.
+class LocationStore {
+public:
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    size_t capacity() const { return LOCATION_STORE_MAX; }
+    size_t poolUsed() const { return poolUsed_; }
+    size_t poolSize() const { return LOCATION_STORE_NAME_POOL; }
+    // Changes on every modification; unique across stores, so copies keep a matching value
+    uint32_t revision() const { return revision_; }
+
+    // Location at index i (no bounds check, like std::vector)
+    SavedLocation operator[](size_t i) const;
+    const char* name(size_t i) const { return pool_ + nameOff_[i]; }
+    double lat(size_t i) const { return latE7_[i] / 1e7; }
+    double lon(size_t i) const { return lonE7_[i] / 1e7; }
+    int32_t latE7(size_t i) const { return latE7_[i]; }
+    int32_t lonE7(size_t i) const { return lonE7_[i]; }
+
+    // Returns false when the record table or the name pool is full
+    bool add(const char* name, double lat, double lon);
+    // Replace name and coordinates of entry i; false if i is out of range or the name does not fit
+    bool update(size_t i, const char* name, double lat, double lon);
+    // Remove entry i and compact the name pool
+    bool remove(size_t i);
+    void clear();
+
+private:
+    void removeName(size_t i);
+    bool appendName(size_t i, const char* name);
+    void touch();
+
+    int32_t latE7_[LOCATION_STORE_MAX];
+    int32_t lonE7_[LOCATION_STORE_MAX];
+    uint16_t nameOff_[LOCATION_STORE_MAX];
+    uint16_t count_ = 0;
+    uint16_t poolUsed_ = 0;
+    uint32_t revision_ = 0;
+    char pool_[LOCATION_STORE_NAME_POOL];
+};
+
+#endif // LOCATION_STORE_H
@@ -0,0 +1,81 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+#include <Arduino.h>
+
+// Leveled, tagged logging for code that runs every frame or on the BLE stack task.
+// Levels above SUPERCOMPASS_LOG_LEVEL compile to nothing (arguments are not evaluated).
+// Enabled lines are formatted into a RAM ring and written to Serial by a low-priority task,
+// so a slow or absent USB host never stalls the caller; when the ring is full lines are dropped
+// and counted instead.
+//
+//   LOGI("ble", "client connected");
+//   LOGD_EVERY(5000, "ble", "position age %lu ms", age);   // at most once per 5 s per call site
+
+#define LOG_LEVEL_NONE    0
+#define LOG_LEVEL_ERROR   1
+#define LOG_LEVEL_WARN    2
+#define LOG_LEVEL_INFO    3
+#define LOG_LEVEL_DEBUG   4
+
+// Override per build, e.g. -DSUPERCOMPASS_LOG_LEVEL=4 for debug output
+#ifndef SUPERCOMPASS_LOG_LEVEL
+#define SUPERCOMPASS_LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+/**
+ * @brief Starts the drain task. Lines logged earlier are kept in the ring and written then.
+ */
+void logBegin();
+
+/**
+ * @brief Writes everything still in the ring to Serial from the calling task (before deep sleep).
+ */
+void logFlush();
+
+/**
+ * @brief Formats one line into the ring. Use the LOGx macros instead, so disabled levels vanish.
+ */
+void logWrite(char level, const char *tag, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+// Runs 'call' at most once per 'ms' for this call site
+#define LOG_RATE_LIMITED_(ms, call) do { \
+        static uint32_t logLast_ = 0; static bool logSeen_ = false; \
+        uint32_t logNow_ = millis(); \
+        if (!logSeen_ || logNow_ - logLast_ >= (uint32_t)(ms)) { logSeen_ = true; logLast_ = logNow_; call; } \
+    } while (0)
+
+#define LOG_NOTHING_() do {} while (0)
+
+#if SUPERCOMPASS_LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOGE(tag, fmt, ...) logWrite('E', tag, fmt, ##__VA_ARGS__)
+#else
+#define LOGE(tag, fmt, ...) LOG_NOTHING_()
+#endif
+
+#if SUPERCOMPASS_LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOGW(tag, fmt, ...) logWrite('W', tag, fmt, ##__VA_ARGS__)
+#define LOGW_EVERY(ms, tag, fmt, ...) LOG_RATE_LIMITED_(ms, logWrite('W', tag, fmt, ##__VA_ARGS__))
+#else
+#define LOGW(tag, fmt, ...) LOG_NOTHING_()
+#define LOGW_EVERY(ms, tag, fmt, ...) LOG_NOTHING_()
+#endif
+
+#if SUPERCOMPASS_LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOGI(tag, fmt, ...) logWrite('I', tag, fmt, ##__VA_ARGS__)
+#define LOGI_EVERY(ms, tag, fmt, ...) LOG_RATE_LIMITED_(ms, logWrite('I', tag, fmt, ##__VA_ARGS__))
+#else
+#define LOGI(tag, fmt, ...) LOG_NOTHING_()
+#define LOGI_EVERY(ms, tag, fmt, ...) LOG_NOTHING_()
+#endif
+
+#if SUPERCOMPASS_LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOGD(tag, fmt, ...) logWrite('D', tag, fmt, ##__VA_ARGS__)
+#define LOGD_EVERY(ms, tag, fmt, ...) LOG_RATE_LIMITED_(ms, logWrite('D', tag, fmt, ##__VA_ARGS__))
+#else
+#define LOGD(tag, fmt, ...) LOG_NOTHING_()
+#define LOGD_EVERY(ms, tag, fmt, ...) LOG_NOTHING_()
+#endif
+
+#endif // LOG_H
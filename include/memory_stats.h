@@ -0,0 +1,51 @@
+#ifndef MEMORY_STATS_H
+#define MEMORY_STATS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Heap, PSRAM and task stack headroom, sampled once per MEMSTATS_PERIOD_MS from the main loop.
+// Shown on the diagnostics page and sent in the READY/heartbeat JSON.
+
+#define MEMSTATS_PERIOD_MS   1000
+#define MEMSTATS_HISTORY     60      // samples kept for the trend graph (one minute)
+#define MEMSTATS_MAX_TASKS   8
+
+struct MemStats {
+    uint32_t heapFree;      // internal 8-bit capable heap, bytes
+    uint32_t heapMinFree;   // lowest heapFree since boot
+    uint32_t heapLargest;   // largest allocatable block
+    uint8_t fragPct;        // 100 - largest/free, in percent
+    uint32_t psramSize;     // 0 without PSRAM
+    uint32_t psramFree;
+    uint32_t stackMinFree;  // smallest stack high-water mark over the watched tasks, bytes
+};
+
+struct TaskStackInfo {
+    const char *name;
+    uint32_t freeMin;       // stack high-water mark (bytes never used)
+};
+
+/**
+ * @brief Takes a sample if MEMSTATS_PERIOD_MS has passed; call every loop.
+ */
+void memStatsService();
+
+/**
+ * @brief Latest sample (sampled on first use if none was taken yet).
+ */
+const MemStats &memStatsCurrent();
+
+/**
+ * @brief Stack high-water marks of the watched tasks that currently exist.
+ * @return Number of entries written (at most max).
+ */
+size_t memStatsTasks(TaskStackInfo *out, size_t max);
+
+/**
+ * @brief Heap-free history in KB, oldest first.
+ * @return Number of samples written (at most max).
+ */
+size_t memStatsHistory(uint16_t *outKb, size_t max);
+
+#endif // MEMORY_STATS_H
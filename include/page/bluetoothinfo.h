@@ -2,11 +2,14 @@
 #define BLUETOOTHINFO_H
 
 #include "globals_and_includes.h"
+#include "ui/page_stack.h"
 
 void showBluetoothInfoPage();
 void handleBluetoothInfoInput();
-void resetBluetooth();
+void resetBluetooth(); // asynchronous: message, BLE restart, re-advertise
 void disconnectBluetooth();
 
+extern const Page bluetoothInfoPage;
+
 
 #endif // BLUETOETOOTHINFO_H
@@ -0,0 +1,17 @@
+#ifndef COMPASS_PAGE_H
+#define COMPASS_PAGE_H
+
+#include "globals_and_includes.h"
+#include "ui/page_stack.h"
+
+// Navigation screen: compass rose, target arrow and target name. Root of the page stack.
+extern const Page compassPage;
+
+/**
+ * @brief Sets the heading drawn by the next render, for screen captures at fixed headings.
+ * The frame is drawn as if there were no fix and no target, so it only depends on the heading
+ * (tools/capture_to_png.py compares it against test/golden/). The next update goes back to live data.
+ */
+void compassPreview(double headingDeg);
+
+#endif // COMPASS_PAGE_H
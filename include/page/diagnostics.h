@@ -0,0 +1,13 @@
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include "globals_and_includes.h"
+#include "ui/page_stack.h"
+
+// Memory/stack headroom page (data from memory_stats.h)
+void drawDiagnosticsPage(M5Canvas &canvas, int centerX, int centerY);
+void handleDiagnosticsInput();
+
+extern const Page diagnosticsPage;
+
+#endif // DIAGNOSTICS_H
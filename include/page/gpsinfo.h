@@ -3,6 +3,7 @@
 
 #include <M5GFX.h> 
 #include "globals_and_includes.h"
+#include "ui/page_stack.h"
 
  
 
@@ -28,6 +29,8 @@ bool hasFix() ;
 void drawGpsInfoPage(M5Canvas &canvas, int centerX, int centerY); 
 void handleGpsInfoInput(); 
 
+extern const Page gpsInfoPage;
+
 extern double latitude_;
 extern double longitude_;
 extern double altitude_;
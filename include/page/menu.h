@@ -5,6 +5,7 @@
 #include "globals_and_includes.h"
 #include "saved_locations.h"
 #include "page/settings.h"
+#include "ui/page_stack.h"
 
 
 
@@ -19,7 +20,6 @@ typedef struct {
 extern MenuItem menuItems[];
 extern int numMenuItems;
 extern int selectedMenuItemIndex;
-extern bool settingsMenuActive;
 extern bool soundEnabled;
 extern bool touchEnabled;
 
@@ -29,6 +29,8 @@ void initMenu();
 void handleMenuInput();
 void drawAppMenu(M5Canvas &canvas, int centerX, int centerY, int radius, int arrowSize);
 
+extern const Page menuPage;
+
 
 // Actie functies die door menu-items worden gebruikt
 void action_startNavigation();
@@ -36,6 +38,8 @@ void action_showSettings();
 void action_showGpsInfo();
 void action_showSavedLocations();
 void action_showBluetoothInfo();
+void action_startBacktrack();
+void action_showDiagnostics();
 
 
 
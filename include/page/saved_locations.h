@@ -1,29 +1,43 @@
-// Structure for a saved location
 #ifndef saved_locations_h
 #define saved_locations_h
 
 #include "globals_and_includes.h" 
+#include "location_store.h" // SavedLocation + LocationStore
+#include "ui/page_stack.h"
 
-typedef struct {
-    const char* name;
-    double lat;
-    double lon;
-} SavedLocation;
-
-extern bool savedLocationsMenuActive; 
 extern int selectedLocationIndex;    
 
-extern std::vector<SavedLocation> savedLocations;
+extern LocationStore savedLocations;
 extern int numActualSavedLocations;   
 
 // Functions for persistence
 void loadSavedLocations(); // Call this in setup()
-void saveSavedLocations(); // Call this after any modification
+void saveSavedLocations(); // Rewrite the whole list (after bulk changes); single edits use the helpers below
+
+// Edit the list and append the change to the location database. False if the store is full / bad index.
+bool addSavedLocation(const char* name, double lat, double lon);
+bool updateSavedLocation(size_t index, const char* name, double lat, double lon);
+bool removeSavedLocation(size_t index);
+// Write the list to /saved_locations.json (import/export format), streamed entry by entry
+bool exportSavedLocationsJson();
+// Outcome of importSavedLocationsJson()
+enum class LocationImport : uint8_t {
+    Failed,     // file missing or not valid JSON; the list is unchanged
+    Complete,   // every valid entry was imported
+    Partial,    // the store filled up: the list holds the first entries only (a popup shows the counts)
+};
+// Replace the list with the contents of /saved_locations.json, streamed entry by entry
+LocationImport importSavedLocationsJson();
+
+// Sort the distance index now (boot), so opening the list does not pay for it
+void warmSavedLocationsIndex();
 
 void initSavedLocationsMenu();
 void handleSavedLocationsInput();
 void drawSavedLocationsMenu(M5Canvas &canvas, int centerX, int centerY);
 
+extern const Page savedLocationsPage;
+
 
 
 #endif // saved_locations_h
\ No newline at end of file
@@ -2,11 +2,21 @@
 #define SETTINGS_H
 
 #include "globals_and_includes.h"
+#include "ui/page_stack.h"
 
 void initSettingsMenu();
 void drawSettingsMenu(M5Canvas &canvas, int centerX, int centerY);
 void handleSettingsInput();
 // Optional external access
 void loadSettings();
+// Reads the old /settings.json once storage is mounted (deferred init) if NVS had no settings yet;
+// the values are applied and committed by the next serviceSettings() call
+void importLegacySettings();
+// Write pending setting changes to NVS now (page exit, sleep)
+void commitSettings();
+// Call from the main loop: commits pending changes once the knob has been idle for a moment
+void serviceSettings();
+
+extern const Page settingsPage;
 
 #endif // SETTINGS_H
@@ -0,0 +1,58 @@
+#ifndef POSITION_SOURCE_H
+#define POSITION_SOURCE_H
+
+#include <stdint.h>
+
+// Which source produced the position returned by positionSelect()
+enum class PositionSource : uint8_t {
+    None = 0,
+    Gps = 1,
+    Ble = 2,
+    Blended = 3
+};
+
+/**
+ * @brief Records a fix from the internal GPS receiver.
+ * @param lat Latitude in degrees.
+ * @param lon Longitude in degrees.
+ * @param accuracyM Estimated horizontal accuracy in meters (e.g. HDOP * UERE).
+ * @param fixTimeMs millis() timestamp at which the fix was valid.
+ */
+void positionUpdateGps(double lat, double lon, float accuracyM, uint32_t fixTimeMs);
+
+/**
+ * @brief Records a fix pushed by the phone over BLE.
+ * @param lat Latitude in degrees.
+ * @param lon Longitude in degrees.
+ * @param accuracyM Reported horizontal accuracy in meters (<= 0 when unknown).
+ * @param fixTimeMs millis() timestamp at which the fix was valid (already latency compensated).
+ */
+void positionUpdateBle(double lat, double lon, float accuracyM, uint32_t fixTimeMs);
+
+/**
+ * @brief Converts a phone-side timestamp into local millis() time.
+ *        Tracks the smallest observed (receive time - phone time) offset, which
+ *        is the offset of the packet with the least transport latency.
+ * @param phoneTimeMs Phone clock timestamp of the fix in milliseconds (wraps at 2^32).
+ * @param rxTimeMs Local millis() at which the frame was received.
+ * @return Estimated local millis() time of the fix (never later than rxTimeMs).
+ */
+uint32_t positionPhoneTimeToLocal(uint32_t phoneTimeMs, uint32_t rxTimeMs);
+
+/**
+ * @brief Picks (or blends) the position with the lowest expected error.
+ *        Expected error = reported accuracy + assumed drift since the fix was taken.
+ *        A hysteresis margin keeps the choice from flapping between sources.
+ * @param lat Receives latitude in degrees (unchanged if no source is usable).
+ * @param lon Receives longitude in degrees (unchanged if no source is usable).
+ * @param expectedErrorM Optional, receives the expected error of the result in meters.
+ * @return The source used, or PositionSource::None if no fix is usable.
+ */
+PositionSource positionSelect(double &lat, double &lon, float *expectedErrorM = nullptr);
+
+/**
+ * @brief Expected error of a single source right now, or a negative value if unusable.
+ */
+float positionExpectedError(PositionSource source);
+
+#endif // POSITION_SOURCE_H
@@ -0,0 +1,44 @@
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include <FS.h>
+
+// Persistent file storage (LittleFS on the "spiffs" data partition).
+// All modules go through storageFs() instead of naming a filesystem, so the backend can change
+// in one place.
+
+/**
+ * @brief Mounts the filesystem, migrating an existing SPIFFS image on first boot.
+ * LittleFS and SPIFFS share the data partition, so migration copies the old files to RAM,
+ * formats the partition as LittleFS and writes them back. Mount time is logged.
+ * @return false if no filesystem could be mounted (the device keeps running without persistence).
+ */
+bool storageBegin();
+
+/**
+ * @brief The mounted filesystem.
+ */
+fs::FS &storageFs();
+
+// The functions below live in storage_atomic.cpp and only use storageFs(), so the host tests
+// can run them against an in-memory filesystem with injected faults.
+
+/**
+ * @brief Renames from to to, replacing to if it exists (LittleFS does this in one step, so a
+ * power cut leaves either the old or the new file, never a mix). On failure both files are left
+ * as they were.
+ */
+bool storageRename(const char *from, const char *to);
+
+/**
+ * @brief storageRename() for a finished temp file: on failure tmpPath is removed, so it must not
+ * be a file the caller wants to keep.
+ */
+bool storageReplace(const char *tmpPath, const char *path);
+
+/**
+ * @brief Writes a whole file via a temp file ("<path>.tmp") + storageReplace().
+ */
+bool storageWriteAtomic(const char *path, const uint8_t *data, size_t len);
+
+#endif // STORAGE_H
@@ -0,0 +1,69 @@
+#ifndef TRACK_H
+#define TRACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// GPS track recorder and backtrack navigation.
+//
+// Fixes from the GPS ingest path are simplified as they arrive (opening-window variant of
+// Douglas-Peucker: a vertex is only kept once the straight line from the previous vertex can no
+// longer cover the points in between within TRACK_TOLERANCE_M). Kept vertices are appended to
+// /track.bin as delta-encoded varints:
+//
+//   varint (dtSeconds << 1 | segmentStart)
+//   segmentStart: zigzag varint latE6, zigzag varint lonE6 (absolute)
+//   otherwise:    zigzag varint dLatE6, zigzag varint dLonE6 (from the previous vertex)
+//
+// which is 3-5 bytes per vertex at walking/cycling speeds. Every boot starts a new segment.
+// Backtrack walks the recorded vertices in reverse by moving the regular navigation target.
+
+#define TRACK_FILE          "/track.bin"
+#define TRACK_OLD_FILE      "/track.old.bin"   // previous file after rotation
+#define TRACK_FILE_MAX      (64 * 1024)        // rotate above this size
+#define TRACK_ROTATE_RETRY_BYTES 4096          // after a failed rotation, append this much before retrying
+#define TRACK_TOLERANCE_M   4.0f               // max deviation of dropped points from the kept line
+#define TRACK_MIN_STEP_M    3.0f               // ignore jitter below this distance
+#define TRACK_MAX_ACCURACY_M 25.0f             // fixes worse than this are not recorded
+#define TRACK_BACKTRACK_MAX 2048               // newest vertices loaded for backtrack
+#define TRACK_ARRIVE_M      15.0f              // distance at which a backtrack vertex counts as reached
+#define TRACK_TARGET_MOVED_M 5.0f              // target this far from the backtrack vertex: set elsewhere, stop
+
+/**
+ * @brief Enables writing to flash; call once storage is mounted. Fixes recorded earlier are
+ * kept in RAM and written on the next flush.
+ */
+void trackBegin();
+
+/**
+ * @brief Feeds one GPS fix (call from the GPS ingest path for every new location).
+ */
+void trackAddFix(double lat, double lon, float accuracyM);
+
+/**
+ * @brief Closes the open window and writes buffered vertices (before sleep and backtrack).
+ */
+void trackFlush();
+
+/**
+ * @brief Vertices written this session and the track file size in bytes.
+ */
+uint32_t trackVertexCount();
+uint32_t trackFileBytes();
+
+/**
+ * @brief Loads the recorded track and targets its most recent vertex.
+ * @return false if there is no track (or too little of it) to follow.
+ */
+bool trackBacktrackStart();
+
+/**
+ * @brief Advances the backtrack target as vertices are reached; call every frame from the
+ * navigation page. Stops when the target is changed elsewhere or the track start is reached.
+ */
+void trackBacktrackUpdate(double lat, double lon, bool valid);
+
+bool trackBacktrackActive();
+void trackBacktrackStop();
+
+#endif // TRACK_H
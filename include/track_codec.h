@@ -0,0 +1,82 @@
+#ifndef TRACK_CODEC_H
+#define TRACK_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "track.h"
+
+// Pure parts of the track recorder (no Arduino or filesystem dependencies): the on-the-fly
+// simplifier, the varint record encoding described in track.h and its decoder.
+
+#define TRACK_WINDOW_MAX    64   // points since the last vertex before one is forced
+#define TRACK_RECORD_MAX    16   // longest encoded vertex
+
+struct TrackPoint {
+    int32_t latE6;
+    int32_t lonE6;
+    uint32_t t;      // seconds since boot
+};
+
+/**
+ * @brief Ground distance between two points in meters (local flat earth).
+ */
+float trackPointDistM(const TrackPoint &a, const TrackPoint &b);
+
+/**
+ * @brief Distance in meters from p to the segment a-b.
+ */
+float trackSegmentDistM(const TrackPoint &p, const TrackPoint &a, const TrackPoint &b);
+
+size_t trackPutVarint(uint8_t *out, uint32_t v);
+uint32_t trackZigzag(int32_t v);
+int32_t trackUnzigzag(uint32_t v);
+
+/**
+ * @brief Encodes one vertex.
+ * @param prev Previous vertex of the segment (delta base), or nullptr to start a segment.
+ * @return Bytes written to out (at most TRACK_RECORD_MAX).
+ */
+size_t trackEncodeVertex(uint8_t *out, const TrackPoint &p, const TrackPoint *prev);
+
+// Opening-window Douglas-Peucker: decides per fix whether the previous point has to be kept
+class TrackSimplifier {
+public:
+    /**
+     * @brief Feeds one fix.
+     * @param kept Receives the vertex to record, if any.
+     * @return true if a vertex was kept (at most one per fix; the first fix is always kept).
+     */
+    bool add(const TrackPoint &p, TrackPoint &kept);
+
+    /**
+     * @brief Closes the open window.
+     * @return true if its last point was kept (written to kept).
+     */
+    bool flush(TrackPoint &kept);
+
+private:
+    void keep(const TrackPoint &p, TrackPoint &kept);
+
+    bool haveAnchor_ = false;
+    TrackPoint anchor_;                         // last kept vertex
+    TrackPoint window_[TRACK_WINDOW_MAX];       // points since the anchor, not yet decided
+    size_t count_ = 0;
+};
+
+// Byte-at-a-time decoder of a track file (works on a stream without buffering it)
+class TrackDecoder {
+public:
+    /**
+     * @brief Feeds one byte.
+     * @return true when a vertex is complete; latE6/lonE6 then hold its absolute position.
+     */
+    bool push(uint8_t b, int32_t &latE6, int32_t &lonE6);
+
+private:
+    uint32_t fields_[3] = {};
+    uint8_t field_ = 0;
+    uint8_t shift_ = 0;
+    int32_t lat_ = 0, lon_ = 0;
+};
+
+#endif // TRACK_CODEC_H
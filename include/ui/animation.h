@@ -0,0 +1,81 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include "globals_and_includes.h"
+
+// Time-based animation helpers.
+// Everything is evaluated against the monotonic clock at draw time, so a slow frame shows a later
+// state (frames are skipped) instead of the animation stretching out.
+
+enum class Ease : uint8_t {
+    Linear,
+    OutCubic,     // fast start, soft stop
+    InOutCubic,
+    OutBack,      // slight overshoot, for pop-in
+};
+
+/**
+ * @brief Monotonic milliseconds used by all animations.
+ */
+uint32_t animNowMs();
+
+/**
+ * @brief Maps t in [0, 1] through an easing curve.
+ */
+float ease(Ease curve, float t);
+
+#define ANIM_STEP_MS 4             // Follower integration step
+#define ANIM_MAX_CATCHUP_MS 250    // longer stalls are integrated as this long (settled by then anyway)
+
+// Fixed-duration interpolation from one value to another
+struct Tween {
+    float from = 0.0f;
+    float to = 0.0f;
+    uint32_t startMs = 0;
+    uint32_t durationMs = 0;
+    Ease curve = Ease::OutCubic;
+
+    void start(float fromValue, float toValue, uint32_t duration, Ease easing);
+    /** @brief Starts again towards toValue from wherever the tween currently is (no jump). */
+    void retarget(float toValue, uint32_t duration);
+    float value() const;
+    bool done() const;
+};
+
+// Critically damped follower for values whose target keeps moving (menu ring position).
+// Integrated in fixed ANIM_STEP_MS steps with an accumulator, and the drawn value is interpolated
+// between the last two steps, so the motion does not depend on the frame rate.
+struct Follower {
+    float target = 0.0f;
+    float omega = 18.0f;          // stiffness (rad/s); ~1/omega is the settle time constant
+
+    void snap(float value);       // jump to value, at rest
+    float value();                // advance the simulation to now and return the interpolated value
+    bool settled() const;
+
+private:
+    float pos_ = 0.0f, vel_ = 0.0f;
+    float prevPos_ = 0.0f;
+    uint32_t lastMs_ = 0;
+    uint32_t accMs_ = 0;
+    bool started_ = false;
+};
+
+// Page transition: the new page opens as a growing circle (iris) from the center
+/**
+ * @brief Starts the iris transition; call when the visible page changes.
+ */
+void pageTransitionStart();
+
+/**
+ * @brief True while the transition is running (the page must be redrawn every frame).
+ */
+bool pageTransitionActive();
+
+/**
+ * @brief Masks the canvas outside the iris while a transition runs. Call after the page is drawn,
+ * before popups and pushSprite.
+ */
+void drawPageTransition(M5Canvas &canvas);
+
+#endif // ANIMATION_H
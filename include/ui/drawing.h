@@ -27,6 +27,15 @@ void drawCompassBackgroundToCanvas(M5Canvas& c, int centerX, int centerY, int R,
  */
 void drawCompassLabels(M5Canvas& canvas, double heading_rad, int centerX, int centerY, int R);
 
+/**
+ * @brief Draws the heading in whole degrees (0-359) with a degree sign, from the heading font.
+ * @param canvas Reference to the M5Canvas to draw on.
+ * @param heading_deg The current true heading in degrees.
+ * @param x The x-coordinate of the text center.
+ * @param y The y-coordinate of the text center.
+ */
+void drawHeadingValue(M5Canvas& canvas, double heading_deg, int x, int y);
+
 /**
  * @brief Draws the arrow pointing towards the target location.
  * @param canvas Reference to the M5Canvas to draw on.
@@ -38,13 +47,14 @@ void drawCompassLabels(M5Canvas& canvas, double heading_rad, int centerX, int ce
 void drawTargetArrow(M5Canvas& canvas, double arrowAngleDeg, int centerX, int centerY, int R);
 
 /**
- * @brief Displays GPS information (coordinates or status) on the canvas.
+ * @brief Displays the position status ("No GPS Fix" / "Using BLE Position") on the canvas.
  * @param canvas Reference to the M5Canvas to draw on.
- * @param gps Reference to the TinyGPSPlus object containing GPS data.
+ * @param gpsValid Whether the GPS has a valid location.
+ * @param usingBlePosition Whether the position comes from the phone over BLE.
  * @param centerX The x-coordinate of the canvas center.
  * @param centerY The y-coordinate of the canvas center.
  */
-void drawGpsInfo(M5Canvas& canvas, const TinyGPSPlus& gps, int centerX, int centerY);
+void drawGpsInfo(M5Canvas& canvas, bool gpsValid, bool usingBlePosition, int centerX, int centerY);
 
 /**
  * @brief Displays a status message on the canvas.
@@ -57,20 +67,4 @@ void drawGpsInfo(M5Canvas& canvas, const TinyGPSPlus& gps, int centerX, int cent
  */
 void drawStatusMessage(M5Canvas& canvas, const char* message, int centerX, int yPos, uint16_t color = TFT_RED, uint16_t bgColor = TFT_WHITE);
 
-/**
- * @brief Shows a temporary popup notification on the screen.
- * @param message The text message to display in the popup.
- * @param durationMs The duration in milliseconds to show the popup (default 2000ms).
- * @param color The color of the text (default TFT_WHITE).
- * @param bgColor The background color for the popup (default TFT_BLUE).
- */
-void showPopupNotification(const char* message, uint32_t durationMs = 2000, uint16_t color = TFT_WHITE, uint16_t bgColor = TFT_BLUE);
-
-/**
- * @brief If an active popup exists, draw it onto the provided canvas (no pushSprite inside).
- *        Automatically clears the popup state after its duration.
- * @param canvas Reference to the M5Canvas to draw on.
- */
-void drawPopupIfActive(M5Canvas& canvas);
-
 #endif // DRAWING_H
\ No newline at end of file
@@ -0,0 +1,369 @@
+#ifndef FONT_HEADING_H
+#define FONT_HEADING_H
+
+// Generated by tools/vlw_font.py from Lato-Regular.ttf at 28 px, do not edit by hand:
+//   tools/vlw_font.py Lato-Regular.ttf 28 --chars "0123456789°" --name font_heading -o include/ui/font_heading.h
+// Font: Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic with Reserved Font Name "Lato". Licensed under the SIL Open Font License, Version 1.1.
+// 11 glyphs, ascent 28, descent 6, 1651 B of 4-bit alpha maps (read from flash by ui/glyph_atlas.cpp)
+
+static const uint8_t font_heading_bits[1651] PROGMEM = {
+    // U+0030 '0' at 0
+    //        ░░
+    //     ░▓████▓░
+    //    ░████████▒
+    //   ░██▓░  ░▓██▒
+    //   ▓█▓░     ▓█▓
+    //  ░██▒      ░██▒
+    //  ▒██        ▓█▓
+    //  ▓█▓        ▒██
+    //  ██▒        ░██░
+    //  ██▒        ░██░
+    // ░██▒        ░██▒
+    // ░██▒        ░██▒
+    //  ██▒        ░██░
+    //  ██▒        ░██░
+    //  ▓█▓        ▒██
+    //  ▒██        ▓█▓
+    //  ░██▒      ░██░
+    //   ▓██░     ▓█▓
+    //   ░███░  ░▓██░
+    //    ░▓███████░
+    //      ▒▓███▓░
+    //         ░
+    // U+0031 '1' at 176
+    //        ░
+    //      ░▓█▓
+    //     ░▓██▓
+    //    ░████▓
+    //   ▒██▓▓█▓
+    //  ▒██▓ ▓█▓
+    //  ▓█▒  ▓█▓
+    //  ░░   ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //       ▓█▓
+    //   ▓█████████▓
+    //   ██████████▓
+    // U+0032 '2' at 323
+    //       ░░░
+    //    ░▒█████▒
+    //   ░████████▓
+    //  ░██▓░   ▒██▓
+    //  ▒██░     ▒██
+    //  ▓█▒      ░██░
+    //  ▒▒       ░██▒
+    //           ░██░
+    //           ▒██
+    //          ░██▒
+    //          ▓█▓
+    //         ▒██░
+    //        ▒██░
+    //       ▒██░
+    //      ▒██▒
+    //     ▒██▒
+    //    ▒██▒
+    //   ▒██▒
+    //  ▒██▒░░░░░░░░░
+    // ░████████████▓
+    // ▒████████████▓
+    // U+0033 '3' at 470
+    //       ░░░
+    //     ▒█████▓░
+    //    ▓███▓████░
+    //   ▓██▒   ▒██▓
+    //  ░██░     ▒██░
+    //  ▒█▓       ██▒
+    //  ▒▒░       ██▒
+    //           ░██░
+    //           ▓█▓
+    //       ░░▒██▓
+    //       ▓███▒
+    //       ▒▓▓███░
+    //          ░▓██░
+    //            ▓█▓
+    //            ▒█▓
+    //  ▒▒        ▒██
+    // ░██░       ▓█▓
+    //  ▓█▓      ░██▒
+    //  ░██▓░  ░▒██▓
+    //   ▒████████▓░
+    //    ░▓████▓▒
+    //       ░░
+    // U+0034 '4' at 624
+    // 
+    //          ░██▓
+    //          ▓██▓
+    //         ▒███▓
+    //        ░██▓█▓
+    //       ░██░▒█▓
+    //       ▓█▒ ▒█▓
+    //      ▒█▓  ▒█▓
+    //     ▒██░  ▒█▓
+    //    ░██▒   ▒█▓
+    //    ▓█▓    ▒█▓
+    //   ▓█▓     ▒█▓
+    //  ▒██░     ▒█▓
+    // ░██▓░░░░░░▓█▓░░░
+    // ░██████████████▓
+    //  ▓▓▓▓▓▓▓▓▓▓██▓▓▒
+    //           ▒█▓
+    //           ▒█▓
+    //           ▒█▓
+    //           ▒█▓
+    //           ▒█▓
+    // U+0035 '5' at 792
+    // 
+    //    █████████▓
+    //    █████████▒
+    //   ░█▓░░░░░░░
+    //   ▒█▓
+    //   ▒█▒
+    //   ▓█░
+    //   ██░
+    //  ░██▒▓▓▓▒░
+    //  ░████████▓░
+    //  ░▒▓▒░░▒▓███░
+    //          ░██▓
+    //           ▒██
+    //           ░██░
+    //           ░██░
+    //           ▒██
+    //           ▓█▓
+    //  ░░      ░██▒
+    // ░██▒░  ░▒██▓
+    // ░▓████████▓░
+    //   ▒▓████▓▒
+    //      ░░
+    // U+0036 '6' at 946
+    // 
+    //         ▓██░
+    //        ▓██░
+    //       ▒██▒
+    //      ░██▓
+    //      ▓█▓
+    //     ▓██░
+    //    ▒██▒
+    //   ░██▒ ░░
+    //   ▓██▓████▓░
+    //  ░████▓▓▓███▒
+    //  ▓██▒    ░▓██░
+    //  ██▓      ░██▒
+    // ░██░       ▓█▓
+    // ▒██        ▒██
+    // ░██        ▒█▓
+    // ░██░       ▓█▓
+    //  ▓█▓      ▒██░
+    //  ░██▓░   ▒██▓
+    //   ▒████████▓
+    //    ░▓████▓▒
+    //       ░░
+    // U+0037 '7' at 1122
+    // 
+    // ▒█████████████░
+    // ▒█████████████░
+    //  ░░░░░░░░░░▓█▓
+    //           ░██░
+    //           ▓█▓
+    //          ░██░
+    //          ▓█▓
+    //         ░██░
+    //         ▓█▓
+    //        ░██░
+    //        ▓█▓
+    //       ░██░
+    //       ▓█▓
+    //      ░██░
+    //      ▓█▓
+    //     ░██░
+    //     ▓█▓
+    //    ░██░
+    //    ▓█▓
+    //   ░█▓░
+    // U+0038 '8' at 1290
+    //       ░░
+    //    ░▓████▓░
+    //   ▒███▓▓▓██▓
+    //  ░██▒    ▒██▒
+    //  ▓█▓      ▓█▓
+    //  ▓█▒      ░██
+    //  ▓█▒      ░██
+    //  ▓█▓      ▒██
+    //  ░██▒    ░██▒
+    //   ▒██▓▒▒▓██▒
+    //    ░██████▒
+    //   ▓██▓▓▓▓██▓░
+    //  ▓██░    ░▓█▓
+    // ░██▒      ░██▒
+    // ▒██░       ▓█▓
+    // ▒██        ▓█▓
+    // ▒██░       ██▓
+    // ░██▒      ░██▒
+    //  ▓██▒    ▒██▓
+    //   ▓███▓▓████░
+    //    ░▓████▓▒
+    //       ░░
+    // U+0039 '9' at 1444
+    //       ░░
+    //    ▒▓████▓░
+    //  ░▓███▓████░
+    //  ▓██▒   ░▓██
+    // ░██░     ░██▒
+    // ▒█▓       ▒█▓
+    // ▓█▒       ▒██
+    // ▓█▓       ▒██
+    // ▓█▓       ▓██
+    // ▒██▒     ░██▓
+    //  ▓██▓░░░▓███▒
+    //  ░▓████████▓
+    //    ░▒▓▓▒░██░
+    //         ▓█▓
+    //        ▓█▓
+    //       ▒██░
+    //      ░██▒
+    //     ░██▓
+    //     ▓██░
+    //    ▒██▒
+    //   ░██▓
+    // U+00B0 '°' at 1591
+    //      ░░
+    //   ░▓███▓░
+    //  ░██▓▒▒██░
+    //  ▓█▒   ░█▓
+    //  ▓▓     ▓█
+    //  █▓     ▓█
+    //  ▓█░    █▓
+    //  ░█▓░ ░▓█▒
+    //   ▒█████▒
+    //    ░▒▓▒░
+    0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xEF, 0xFE, 0xC4, 0x00, 0x00,
+    0x00, 0x04, 0xEF, 0xFE, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x3F, 0xFD, 0x40, 0x02, 0xBF, 0xF6, 0x00,
+    0x00, 0xAF, 0xD2, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x03, 0xFF, 0x70, 0x00, 0x00, 0x04, 0xFF, 0x60,
+    0x09, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xCF, 0xC0, 0x0C, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF1,
+    0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF4, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF5,
+    0x2F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0x2F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF6,
+    0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF3,
+    0x0C, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF1, 0x09, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xDF, 0xC0,
+    0x02, 0xFF, 0x70, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0xAF, 0xE2, 0x00, 0x00, 0x1C, 0xFD, 0x00,
+    0x00, 0x3E, 0xFE, 0x41, 0x03, 0xCF, 0xF5, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xEF, 0xFE, 0x50, 0x00,
+    0x00, 0x00, 0x19, 0xDF, 0xFE, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0xBF,
+    0xC0, 0x00, 0x00, 0x08, 0xFF, 0xB1, 0xAF, 0xC0, 0x00, 0x00, 0x0C, 0xF9, 0x00, 0xAF, 0xC0, 0x00,
+    0x00, 0x02, 0x50, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0xDE, 0xEE, 0xFF, 0xFE, 0xEE, 0xA0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00, 0x00, 0x02, 0x9F, 0xFF, 0xFE, 0x81,
+    0x00, 0x00, 0x4E, 0xFF, 0xFE, 0xFF, 0xFD, 0x10, 0x02, 0xEF, 0xD4, 0x00, 0x18, 0xFF, 0xA0, 0x08,
+    0xFE, 0x20, 0x00, 0x00, 0x9F, 0xF1, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x07, 0x91, 0x00,
+    0x00, 0x00, 0x2F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFD, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF7, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0x95, 0x55, 0x55, 0x55, 0x52, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00, 0x00, 0x01, 0x7E,
+    0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x1D, 0xFF, 0xFD, 0xFF, 0xFF, 0x30, 0x00, 0xBF, 0xE6, 0x10, 0x06,
+    0xEF, 0xD1, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x6F, 0xF4, 0x09, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF7,
+    0x06, 0x93, 0x00, 0x00, 0x00, 0x0E, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x25, 0x8E, 0xFB, 0x10, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xDF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x16,
+    0x70, 0x00, 0x00, 0x00, 0x08, 0xFE, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x0D, 0xFD, 0x10,
+    0x00, 0x00, 0x5F, 0xF7, 0x05, 0xFF, 0xD4, 0x10, 0x28, 0xFF, 0xC1, 0x00, 0x7F, 0xFF, 0xFE, 0xFF,
+    0xFD, 0x20, 0x00, 0x03, 0xBE, 0xFF, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x00, 0x23, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFE, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF5, 0x8F, 0xA0, 0x00,
+    0x00, 0x00, 0x01, 0xCF, 0x90, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xFC, 0x10, 0x8F, 0xA0, 0x00,
+    0x00, 0x00, 0x6F, 0xE3, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x03, 0xEF, 0x60, 0x00, 0x8F, 0xA0, 0x00,
+    0x00, 0x1D, 0xFA, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0xAF, 0xD1, 0x00, 0x00, 0x8F, 0xA0, 0x00,
+    0x06, 0xFF, 0x30, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x3E, 0xFA, 0x44, 0x44, 0x44, 0xAF, 0xB4, 0x42,
+    0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x1A, 0xBB, 0xBB, 0xBB, 0xBB, 0xDF, 0xEB, 0xB6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
+    0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x4F, 0xD4,
+    0x44, 0x44, 0x42, 0x00, 0x00, 0x6F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0x9A, 0xCB, 0x85, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x02, 0x9A,
+    0x75, 0x46, 0xAF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x02,
+    0x20, 0x00, 0x00, 0x04, 0xFF, 0x70, 0x2E, 0xF9, 0x30, 0x02, 0x8F, 0xFC, 0x00, 0x2C, 0xFF, 0xFF,
+    0xEF, 0xFF, 0xB2, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x12, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xE3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFD, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2E, 0xF9, 0x13, 0x31, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xEB, 0xFF, 0xFF, 0xC3,
+    0x00, 0x00, 0x04, 0xFF, 0xFE, 0xBA, 0xCF, 0xFF, 0x60, 0x00, 0x0C, 0xFF, 0x91, 0x00, 0x03, 0xDF,
+    0xE2, 0x00, 0x1F, 0xFA, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0x00, 0x0B,
+    0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x5F, 0xF1, 0x00, 0x00, 0x00, 0x09,
+    0xFD, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0x00, 0x6F,
+    0xF5, 0x00, 0x03, 0xFF, 0xB2, 0x00, 0x18, 0xFF, 0xA0, 0x00, 0x00, 0x7F, 0xFF, 0xEE, 0xFF, 0xFB,
+    0x10, 0x00, 0x00, 0x03, 0xBE, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x30, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x04, 0x44, 0x44, 0x44, 0x44, 0x4B,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x10, 0x00,
+    0x00, 0x00, 0x03, 0xCF, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0x7F, 0xFE, 0xBB, 0xDF, 0xFA, 0x00, 0x03,
+    0xFF, 0x91, 0x00, 0x07, 0xFF, 0x60, 0x0A, 0xFD, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x0D, 0xF9, 0x00,
+    0x00, 0x00, 0x5F, 0xF1, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0xF1, 0x0B, 0xFC, 0x00, 0x00, 0x00,
+    0x8F, 0xE0, 0x04, 0xFF, 0x60, 0x00, 0x03, 0xFF, 0x70, 0x00, 0x7F, 0xFB, 0x87, 0xAF, 0xF9, 0x00,
+    0x00, 0x05, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0xAF, 0xFD, 0xAA, 0xCF, 0xFC, 0x20, 0x0B, 0xFF,
+    0x50, 0x00, 0x04, 0xDF, 0xD1, 0x4F, 0xF7, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0x8F, 0xF2, 0x00, 0x00,
+    0x00, 0x0D, 0xFB, 0x9F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xF2, 0x00, 0x00, 0x00, 0x0E,
+    0xFA, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x0A, 0xFF, 0x81, 0x00, 0x06, 0xEF, 0xD1, 0x01,
+    0xCF, 0xFF, 0xDC, 0xFF, 0xFE, 0x30, 0x00, 0x05, 0xCF, 0xFF, 0xFD, 0x71, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xFF, 0xEA,
+    0x20, 0x00, 0x02, 0xCF, 0xFF, 0xDE, 0xFF, 0xE4, 0x00, 0x0B, 0xFE, 0x60, 0x00, 0x4D, 0xFE, 0x10,
+    0x5F, 0xF5, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0xCF, 0x90,
+    0x00, 0x00, 0x00, 0x6F, 0xE0, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x6F, 0xF1, 0xAF, 0xD0, 0x00, 0x00,
+    0x00, 0xAF, 0xE0, 0x6F, 0xF7, 0x00, 0x00, 0x05, 0xFF, 0xB0, 0x0B, 0xFF, 0xA5, 0x35, 0xAF, 0xFF,
+    0x60, 0x02, 0xBF, 0xFF, 0xFF, 0xEE, 0xFD, 0x00, 0x00, 0x05, 0x8B, 0xA7, 0x5F, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFD, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x00, 0x2C, 0xFF,
+    0xFC, 0x30, 0x00, 0x02, 0xEF, 0xA7, 0x9F, 0xE2, 0x00, 0x0A, 0xF6, 0x00, 0x05, 0xFB, 0x00, 0x0D,
+    0xD0, 0x00, 0x00, 0xCE, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0xBF, 0x10, 0x0B, 0xF2, 0x00, 0x01, 0xED,
+    0x00, 0x04, 0xFC, 0x30, 0x3C, 0xF6, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0x7A,
+    0x83, 0x00, 0x00,
+};
+
+static const GlyphData font_heading_glyphs[11] PROGMEM = {
+    // code, w, h, dx, dy, advance, offset
+    { 0x30, 16, 22,   0,  21, 16,     0 },  // 0
+    { 0x31, 13, 21,   2,  21, 16,   176 },  // 1
+    { 0x32, 14, 21,   1,  21, 16,   323 },  // 2
+    { 0x33, 14, 22,   1,  21, 16,   470 },  // 3
+    { 0x34, 16, 21,   0,  21, 16,   624 },  // 4
+    { 0x35, 14, 22,   1,  21, 16,   792 },  // 5
+    { 0x36, 15, 22,   1,  21, 16,   946 },  // 6
+    { 0x37, 15, 21,   1,  21, 16,  1122 },  // 7
+    { 0x38, 14, 22,   1,  21, 16,  1290 },  // 8
+    { 0x39, 14, 21,   2,  21, 16,  1444 },  // 9
+    { 0xB0, 11, 10,   0,  21, 11,  1591 },  // °
+};
+
+static const GlyphFont font_heading = { font_heading_glyphs, 11, font_heading_bits, 28, 6 };
+
+#endif // FONT_HEADING_H
@@ -0,0 +1,1932 @@
+#ifndef FONT_LABEL_H
+#define FONT_LABEL_H
+
+// Generated by tools/vlw_font.py from Lato-Regular.ttf at 20 px, do not edit by hand:
+//   tools/vlw_font.py Lato-Regular.ttf 20 --name font_label -o include/ui/font_label.h
+// Font: Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic with Reserved Font Name "Lato". Licensed under the SIL Open Font License, Version 1.1.
+// 96 glyphs, ascent 20, descent 5, 6690 B of 4-bit alpha maps (read from flash by ui/glyph_atlas.cpp)
+
+static const uint8_t font_label_bits[6690] PROGMEM = {
+    // U+0021 '!' at 0
+    // ░░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ░█░
+    // ░█░
+    // ░█░
+    // 
+    // 
+    //  ░
+    // ▓█▒
+    // ▒█▒
+    // 
+    // U+0022 '"' at 32
+    // ░░  ░░
+    // ▒█ ░█▒
+    // ▒█ ░█▒
+    // ▒█ ░█▒
+    // ▒█  █░
+    // ░▒  ▒░
+    // U+0023 '#' at 50
+    //     ░░  ░░
+    //     ▓▓  ▓▒
+    //     █▒  █▒
+    //    ░█░ ░█░
+    //   ░▒█░░▒█░░
+    //  ▓█████████
+    //  ░░▓▓░░▓▓░░
+    //    █▒  █▒
+    //   ░█░ ░█░
+    // ░▒▓█▒▒▓█▒▒░
+    // ░▓▓█▓▓██▓▓░
+    //   ▓▓  ▓▓
+    //   ▓▒  █▒
+    //   █▒ ░█░
+    //  ░█░ ░█░
+    // U+0024 '$' at 140
+    //      ░
+    //      █░
+    //    ░░█░
+    //   ▓█████▒
+    //  ▓█▒░█░▓█
+    // ░█▒ ░█
+    // ░█▒ ░▓
+    // ░█▓ ░▓
+    //  ▓█▓▓▓
+    //   ▒███▓░
+    //     ▓▓██▓
+    //     ▒▒ ▓█░
+    //     ▓▒ ░█▒
+    //     ▓░ ░█▒
+    // ▒▒  ▓░ ▒█░
+    // ▒█▓▒█▒▓█▒
+    //  ░▓███▓▒
+    //     █░
+    //    ░█
+    //     ░
+    // U+0025 '%' at 240
+    //   ░▒░       ░░
+    //  ░█▓▓█░    ░█▒
+    //  █▒  ▓▓   ░█▓
+    // ░█░  ▒█   ▓▓
+    // ░█░  ▒█  ▒█░
+    //  █▒  ▒▓ ░█▒
+    //  ▒█▒▓█░ █▓
+    //   ░▒▒░ ▓▓
+    //       ▒█░ ▓█▓▒
+    //      ░█▒ ▓▓░▒█▒
+    //      ▓▓ ░█░  ▒▓
+    //     ▓▓  ░█   ▒█
+    //    ▒█░  ░█░  ▒▓
+    //   ░█▒    ▓▓ ░█▒
+    //   ▓▓     ░▓██▒
+    //            ░
+    // U+0026 '&' at 368
+    //      ░▒░
+    //    ░▓████░
+    //    ▓█░ ░▓▓
+    //   ░█▒   ░▓
+    //   ░█▒
+    //    █▓
+    //    ▒█▓
+    //   ░▓██▒    ░░
+    //  ░██░▓█▒  ░█░
+    //  ▓█░  ▓█▒ ▒█
+    //  █▓    ▓█▒▓▓
+    // ░█▓     ▓██░
+    //  ▓█░    ▒██▒
+    //  ░██▒░▒▓█▒▓█▒
+    //   ░▓██▓▓░  ▓█▒
+    // 
+    // U+0027 ''' at 480
+    // ░░
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ░▒
+    // U+0028 '(' at 492
+    //    ░
+    //   ▒█
+    //   █▓
+    //  ▒█░
+    //  ▓▓
+    // ░█▒
+    // ░█░
+    // ▒█░
+    // ▒█
+    // ▓█
+    // ▒█
+    // ▒█░
+    // ▒█░
+    // ░█▒
+    //  █▓
+    //  ▒█░
+    //  ░█▒
+    //   ▓█
+    //   ░▓
+    // U+0029 ')' at 549
+    //  ░
+    // ░█░
+    //  ▓▓
+    //  ▒█░
+    //   █▓
+    //   ▒█
+    //   ▒█░
+    //   ░█▒
+    //   ░█▒
+    //    █▒
+    //   ░█▒
+    //   ░█▒
+    //   ▒█░
+    //   ▒█
+    //   ▓▓
+    //  ░█▒
+    //  ▓█░
+    //  █▒
+    //  ▓
+    // U+002A '*' at 606
+    // 
+    //    ▒▒
+    //  ▒░▒▒░▒
+    //  ░▓▓▓▓░
+    //   ▒██▒
+    //  ▓▒▒▒▒▓
+    //    ▒▒
+    //    ░░
+    // U+002B '+' at 638
+    //     ▒░
+    //     █▒
+    //     █▒
+    //     █▒
+    // ▒▒▒▒█▓▒▒▒░
+    // █████████▒
+    //     █▒
+    //     █▒
+    //     █▒
+    //     █▒
+    //     ░░
+    // U+002C ',' at 693
+    //  ░░
+    //  ██░
+    //  ▓█░
+    //   ▓
+    //  ▒▒
+    //  ▒
+    // U+002D '-' at 705
+    // ▓▓▓▓▓
+    // ▓▓▓▓▓
+    // U+002E '.' at 711
+    //  ░░
+    //  ██░
+    //  ▓█░
+    // 
+    // U+002F '/' at 719
+    //        ▒░
+    //       ░█░
+    //       ▓▓
+    //      ░█░
+    //      ▒▓
+    //      █▒
+    //     ░█░
+    //     ▓▓
+    //    ░█░
+    //    ▒▓
+    //    █▒
+    //   ░█░
+    //   ▓▓
+    //  ░█░
+    //  ▒▓
+    //  ▓░
+    // U+0030 '0' at 799
+    //     ░▒░░
+    //   ░▓████▒
+    //   ██▒ ░▓█▒
+    //  ▒█▒    ▓█░
+    //  ██     ░█▒
+    // ░█▓      █▓
+    // ░█▒      █▓
+    // ░█▒      ▓█
+    // ░█▒      ██
+    // ░█▒      █▓
+    //  █▓     ░█▓
+    //  ▓█░    ▒█▒
+    //  ░█▒   ░█▓
+    //   ▓█▓▒▒██░
+    //    ▒▓██▓░
+    // 
+    // U+0031 '1' at 895
+    //     ░░
+    //    ▓█▓
+    //   ▓██▓
+    // ░▓█▒█▓
+    // ▓█░ █▓
+    // ░░  █▓
+    //     █▓
+    //     █▓
+    //     █▓
+    //     █▓
+    //     █▓
+    //     █▓
+    //     █▓
+    //  ░░▒█▓░░░
+    // ░███████▒
+    // U+0032 '2' at 970
+    //    ░▒▒░
+    //  ░▓████▓░
+    //  ▓█▒░░▒█▓
+    // ░█▒    ▓█░
+    // ░▓     ▒█░
+    //        ▓█░
+    //        █▓
+    //       ▓█░
+    //      ▒█▒
+    //     ▒█▒
+    //    ▒█▒
+    //   ▒█▒
+    //  ▒█▒
+    // ▒██▒▓▓▓▓▓░
+    // █████████▒
+    // U+0033 '3' at 1045
+    //    ░▒▒░
+    //   ▓████▓░
+    //  ▓█▒░░▒█▓
+    // ░█▓    ▒█░
+    // ░▓░    ▒█░
+    //        ▒█░
+    //      ░▒█▒
+    //     ▓██▒
+    //     ░▒▓█▓
+    //        ▒█▒
+    //        ░█▓
+    // ▓▓     ░█▒
+    // ▒█▒    ▓█░
+    //  ▓█▓▒▒▓█▓
+    //   ▒████▒
+    // 
+    // U+0034 '4' at 1125
+    //        ░░
+    //       ░██
+    //       ███
+    //      ▓▓▒█
+    //     ▒█░▒█
+    //    ░█▒ ▒█
+    //   ░█▓  ▒█
+    //   ▓█░  ▒█
+    //  ▒█░   ▒█
+    // ░█▓░░░░▒█░░
+    // ▒██████████░
+    //  ░░░░░░▓█░░
+    //        ▒█
+    //        ▒█
+    //        ▒█
+    // U+0035 '5' at 1215
+    //   ░░░░░░░
+    //  ░██████▓
+    //  ░█▒░░░░
+    //  ▒█
+    //  ▓▓
+    //  ▓▓ ░
+    //  █████▓░
+    //  ▒▒▒░▒██░
+    //       ░█▓
+    //        ▓█░
+    //        ▒█░
+    //        ▓█
+    //  ░    ▒█▒
+    // ▓█▓▒▒▓█▓
+    //  ▒████▒
+    //    ░
+    // U+0036 '6' at 1295
+    //       ░░
+    //      ▓█░
+    //     ▒█▒
+    //    ░█▓
+    //   ░█▓
+    //   ▓█░
+    //  ▒█▓▒▓▒░
+    // ░██▓▓▓██▒
+    // ▒█▓    ▓█░
+    // ▓█     ░█▒
+    // ▓▓      █▓
+    // ▓█     ░█▒
+    // ▒█▒    ▓█░
+    //  ▓█▒▒▒▓█▒
+    //   ▒███▓▒
+    // 
+    // U+0037 '7' at 1375
+    // ░░░░░░░░░░
+    // ▓████████▓
+    // ░░░░░░░▒█▒
+    //        ▓█
+    //       ░█▒
+    //       ▓█░
+    //      ░█▒
+    //      ▓█░
+    //     ░█▒
+    //     ▓█░
+    //    ░█▒
+    //    ▓█░
+    //   ░█▒
+    //   ▓█░
+    //  ░█▒
+    // U+0038 '8' at 1450
+    //     ░▒▒░
+    //   ░▓████▓
+    //   █▓░  ▒█▒
+    //  ▒█▒    ▓█
+    //  ▒█░    ▓█
+    //  ░█▒    ▓▓
+    //   ▒█▒░░▓█░
+    //    ▓████░
+    //  ░▓█▒░▒▓█▒
+    //  ▓█░    ▓█░
+    //  ██     ░█▒
+    //  █▓     ░█▒
+    //  ▓█░    ▓█░
+    //  ░██▒░▒▓█▓
+    //   ░▓███▓▒
+    //      ░
+    // U+0039 '9' at 1546
+    //    ░░▒░
+    //   ▒████▓░
+    //  ▓█▒░ ░██
+    // ░█▒    ░█▒
+    // ▒█░     █▓
+    // ▒█░     █▓
+    // ░█▓    ▒█▒
+    //  ▓█▓░░▒██░
+    //   ▒███▓█▓
+    //       ▓█░
+    //      ▒█▒
+    //     ░█▓
+    //    ░██░
+    //    ▓█▒
+    //   ▒█▒
+    // U+003A ':' at 1621
+    // ░▓░
+    // ▓█▓
+    // ░▒░
+    // 
+    // 
+    // 
+    // 
+    //  ░
+    // ▒█▓
+    // ▒█▒
+    //  ░
+    // U+003B ';' at 1643
+    // ░▓░
+    // ▓█▓
+    // ░▒░
+    // 
+    // 
+    // 
+    // 
+    //  ░
+    // ▒█▒
+    // ▒█▓
+    //  ▒▒
+    // ░▓
+    // ░░
+    // U+003C '<' at 1669
+    // 
+    //       ░▓░
+    //     ░▓█▓
+    //   ░▓█▓▒
+    // ░▒█▓▒
+    // ▒██░
+    //  ░▓█▓░
+    //    ░▓█▓░
+    //      ░▓█░
+    //        ░░
+    // U+003D '=' at 1719
+    // 
+    // ▒████████
+    // ░░░░░░░░░
+    // 
+    // ▒▓▓▓▓▓▓▓▓
+    // ░▒▒▒▒▒▒▒▒
+    // U+003E '>' at 1749
+    // 
+    // ▒▒
+    // ▒██▒
+    //  ░▒██▒
+    //    ░▒█▓▒
+    //      ▒██
+    //    ▒██▒
+    //  ▒██▒
+    // ▒█▒
+    // ░░
+    // U+003F '?' at 1799
+    //   ░▒▒░
+    // ░▓████▒
+    // ░▓░ ░▓█░
+    //      ░█▒
+    //      ░█▒
+    //      ▓█░
+    //     ▓█░
+    //    ▓█░
+    //   ░█▒
+    //    █░
+    // 
+    // 
+    //    ░
+    //   ▒█▓
+    //   ▒█▒
+    //    ░
+    // U+0040 '@' at 1863
+    //       ░▒▒▒░
+    //     ░▓█▓▓▓▓█▒
+    //    ▒█▒     ░▓▓
+    //   ▒█░        ▓▒
+    //  ░█▒    ░▒▒░ ░█░
+    //  ▒▓   ░▓█▓█▓  █▒
+    //  ▓▒  ░█▒  ▓▒  ▓▒
+    //  █░  ▓▓   █░  ▓▒
+    //  █░ ░█░  ░█   ▓▒
+    //  █▒ ░█░  ▓▓  ░█░
+    //  ▓▒ ░█▒░▒▓█ ░▓▒
+    //  ▒▓  ▒██▓ ▓██▒
+    //   █▒
+    //   ░█░
+    //    ▒█▓░    ░▒▓░
+    //     ░▓██▓▓██▓░
+    //        ░░░░
+    // U+0041 'A' at 1999
+    //       ░░
+    //      ▒██░
+    //      ▓██▒
+    //     ░█▒▓█
+    //     ▓█░▒█░
+    //    ░█▓ ░█▓
+    //    ▒█▒  ▓█░
+    //    ▓█   ░█▒
+    //   ░█▒    ██
+    //   ▓█▒░░░░▓█░
+    //  ░█████████▓
+    //  ▒█▒      ▓█░
+    //  ▓█       ▒█▒
+    // ░█▓        ██
+    // ▓█░        ▒█░
+    // U+0042 'B' at 2104
+    //  ░░░░░░
+    // ░███████▓
+    // ░█▓░░░░▓█▓
+    // ░█▓     ▓█░
+    // ░█▓     ▒█░
+    // ░█▓     ▓█░
+    // ░█▓    ▒█▒
+    // ░███████░
+    // ░█▓▒▒▒▒▓█▒
+    // ░█▓     ▒█▒
+    // ░█▓     ░█▓
+    // ░█▓     ░█▓
+    // ░█▓     ▓█▒
+    // ░█▓▒▒▒▓▓█▓
+    // ░██████▓▒
+    // U+0043 'C' at 2194
+    //       ░▒▒░
+    //     ▒██████▒
+    //   ░▓█▓▒░░░▓█▒
+    //   ▓█▓      ░
+    //  ░█▓
+    //  ▓█░
+    //  ▓█
+    //  ██
+    //  ██
+    //  ▓█░
+    //  ▓█▒
+    //  ░██
+    //   ▒█▓░    ░▓▒
+    //    ▓██▓▒▒▓██░
+    //     ░▓███▓▒░
+    //        ░
+    // U+0044 'D' at 2306
+    //  ░░░░░░
+    // ░████████▒
+    // ░█▓░░░░▒▓█▓░
+    // ░█▓      ▒█▓
+    // ░█▓       ▓█▒
+    // ░█▓       ░█▓
+    // ░█▓        ██
+    // ░█▓        ▓█
+    // ░█▓        ██
+    // ░█▓        █▓
+    // ░█▓       ▒█▓
+    // ░█▓       ▓█░
+    // ░█▓     ░▓█▒
+    // ░█▓▒▒▒▓▓██▒
+    // ░██████▓▒░
+    // U+0045 'E' at 2411
+    //  ░░░░░░░░░
+    // ░████████▒
+    // ░█▓░░░░░░░
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░███████░
+    // ░█▓▒▒▒▒▒░
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓▒▒▒▒▒▒░
+    // ░████████▒
+    // U+0046 'F' at 2486
+    //  ░░░░░░░░░
+    // ░████████▒
+    // ░█▓░░░░░░░
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░██▓▓▓▓▓▒
+    // ░██▓▓▓▓▓▒
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // U+0047 'G' at 2561
+    //       ░░▒▒░
+    //     ▒██████▓░
+    //   ░▓█▓▒░░░▒██░
+    //   ▓█▒      ░░
+    //  ░█▓
+    //  ▓█░
+    //  ▓█
+    //  ██
+    //  ██      ▓▓▓▓▒
+    //  ▓█░     ▒▒▓█▒
+    //  ▒█▒       ░█▒
+    //  ░██       ░█▒
+    //   ▒█▓░     ▒█▒
+    //    ▒██▓▒▒▒▓██░
+    //     ░▓▓███▓▒░
+    //         ░
+    // U+0048 'H' at 2673
+    //  ░░       ░░░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // ░███████████░
+    // ░█▓▒▒▒▒▒▒▒▓█░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // ░█▓       ▒█░
+    // U+0049 'I' at 2778
+    // ░░
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // ▓█
+    // U+004A 'J' at 2808
+    //      ░░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█
+    //      ██
+    //     ▒█▓
+    // ░▒▒▓██░
+    // ░███▓░
+    //   ░
+    // U+004B 'K' at 2872
+    //  ░░       ░░
+    //  █▓      ▓█░
+    //  █▓     ▓█▒
+    //  █▓    ▓█▒
+    //  █▓   ▒█▒
+    //  █▓  ▒█▓
+    //  █▓ ▒█▓
+    //  █████░
+    //  ██▒▓█▓
+    //  █▓  ▒█▓
+    //  █▓   ▓█▒
+    //  █▓    ▓█▒
+    //  █▓    ░▓█░
+    //  █▓     ░██░
+    //  █▓      ░█▓
+    // U+004C 'L' at 2977
+    //  ░░
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓
+    // ░█▓▒▒▒▒▒▒
+    // ░███████▓
+    // U+004D 'M' at 3052
+    //  ░░           ░░
+    // ░██░         ▓█▓
+    // ░██▓        ░██▓
+    // ░███░       ▓██▓
+    // ░█▒█▓      ▒█▒█▓
+    // ░█▒▒█░     ▓▓ █▓
+    // ░█▒ ▓▓    ▒█░ █▓
+    // ░█▒ ▒█▒   █▓  █▓
+    // ░█▒  ▓█  ▒█░  █▓
+    // ░█▒  ░█▒░█▓   █▓
+    // ░█▒   ▓█▓█░   █▓
+    // ░█▒   ░██▒    █▓
+    // ░█▒    ▒▓░    █▓
+    // ░█▒           █▓
+    // ░█▒           █▓
+    // U+004E 'N' at 3172
+    //  ░        ░░░
+    // ░█▓       ░█░
+    // ░██▒      ░█░
+    // ░███░     ░█░
+    // ░█▒██░    ░█░
+    // ░█▒░█▓    ░█░
+    // ░█▒ ▒█▓   ░█░
+    // ░█▒  ▓█▒  ░█░
+    // ░█▒  ░██░ ░█░
+    // ░█▒   ░█▓ ░█░
+    // ░█▒    ▒█▓░█░
+    // ░█▒     ▓█▓█░
+    // ░█▒      ▓██░
+    // ░█▒      ░██░
+    // ░█▒       ▒█░
+    // U+004F 'O' at 3277
+    //       ░▒▒░
+    //     ▒██████▒
+    //   ░▓█▓▒░░▒▓█▓░
+    //   ▓█▒      ▒█▓
+    //  ░█▓        ▓█░
+    //  ▓█░        ░█▓
+    //  ▓█░        ░█▓
+    //  ██          ██
+    //  ██          ██
+    //  ▓█░        ░█▓
+    //  ▒█▒        ▒█▒
+    //  ░██        ██░
+    //   ▒█▓░    ░▓█▒
+    //    ▒██▓▒▒▓██▒
+    //     ░▓▓██▓▓░
+    // 
+    // U+0050 'P' at 3405
+    //  ░░░░░░
+    //  ███████▒
+    //  █▓░░░▒▓█▓
+    //  █▓     ▓█░
+    //  █▓     ▒█▒
+    //  █▓     ▒█▒
+    //  █▓     ▓█░
+    //  █▓   ░▓█▓
+    //  ███████▓░
+    //  ██▓▓▒▒░
+    //  █▓
+    //  █▓
+    //  █▓
+    //  █▓
+    //  █▓
+    // U+0051 'Q' at 3495
+    //       ░▒▒░
+    //     ▒██████▒
+    //   ░▓█▓▒░░▒▓█▓░
+    //   ▓█▒      ▒█▓
+    //  ░█▓        ▓█░
+    //  ▓█░        ░█▓
+    //  ▓█░        ░█▓
+    //  ██          ██
+    //  ██          ██
+    //  ▓█░        ░█▓
+    //  ▒█▒        ▒█▒
+    //  ░██        ██░
+    //   ▒█▓░    ░▓█▒
+    //    ▒██▓▒▒▓██▒
+    //     ░▓▓███▓█▒
+    //         ░  ▓█▒
+    //             ▓█▒
+    //             ░▓█░
+    // U+0052 'R' at 3639
+    //  ░░░░░░
+    //  ███████▒
+    //  █▓░░░▒▓█▒
+    //  █▓     ██
+    //  █▓     ▓█░
+    //  █▓     ▓█
+    //  █▓    ░█▓
+    //  ██▒▒▒▓█▓░
+    //  ██████▒
+    //  █▓  ▓█▒
+    //  █▓   ▓█░
+    //  █▓   ░█▓
+    //  █▓    ▒█▓
+    //  █▓     ▓█▒
+    //  █▓     ░▓█░
+    // U+0053 'S' at 3729
+    //     ░▒░░
+    //   ░█████▓░
+    //  ░█▓░░░▒█░
+    //  ▒█░    ░
+    //  ▓█
+    //  ▒█▒
+    //  ░██▓▒
+    //   ░▓███▓░
+    //     ░▒███░
+    //        ▓█▓
+    //         █▓
+    //         █▓
+    //  ▓░    ▒█▒
+    // ░▓█▓▒▒▓█▓
+    //   ▒▓███▒
+    // 
+    // U+0054 'T' at 3809
+    // ░░░░░░░░░░░░
+    // ▓██████████▒
+    // ░░░░░██░░░░░
+    //      █▓
+    //      █▓
+    //      █▓
+    //      █▓
+    //      █▓
+    //      █▓
+    //      █▓
+    //      █▓
+    //      █▓
+    //      █▓
+    //      █▓
+    //      █▓
+    // U+0055 'U' at 3899
+    // ░░░       ░░
+    // ▒█▒       ██
+    // ▒█▒       ██
+    // ▒█▒       ██
+    // ▒█▒       ██
+    // ▒█▒       ██
+    // ▒█▒       ██
+    // ▒█▒       ██
+    // ▒█▒       ██
+    // ▒█▒       ██
+    // ░█▓       █▓
+    //  ██░     ▒█▒
+    //  ▒█▓    ░██░
+    //   ▓██▓▒▓██▒
+    //    ▒▓███▓░
+    //       ░
+    // U+0056 'V' at 4011
+    // ░░         ░░░
+    // ▒█▒        ▓█░
+    // ░█▓       ░█▓
+    //  ▓█░      ▓█░
+    //  ░█▓      ██
+    //   ██     ▒█▒
+    //   ▒█▒    ▓█░
+    //   ░█▓   ░█▓
+    //    ▓█░  ▓█░
+    //    ░█▓  █▓
+    //     ▓█ ▒█▒
+    //     ▒█▒▓█░
+    //     ░█▓█▓
+    //      ▓██░
+    //      ░█▓
+    // U+0057 'W' at 4116
+    // ░░       ░░       ░░
+    // ▒█▒      ▓█░      ██
+    // ░█▓     ░██▓     ░█▓
+    //  ██░    ▒█▓█     ▓█░
+    //  ▓█▒    ▓▓▒█░    ██
+    //  ░█▓   ░█▒░█▓   ░█▓
+    //   ██   ▒█░ ▓█   ▒█▒
+    //   ▓█░  ▓▓  ▒█░  ▓█░
+    //   ▒█▒ ░█▒  ░█▓ ░█▓
+    //   ░█▓ ▒█░   ▓█ ▒█▒
+    //    ▓█░▓▓    ▒█░▓█░
+    //    ▒█▓█▒    ░█▓█▓
+    //    ░███░     ▓██▒
+    //     ▓█▓      ▒██░
+    //     ▒█▒      ░██
+    // U+0058 'X' at 4281
+    // ░░░       ░░░
+    // ░██░     ░█▓
+    //  ▒█▓     ▓█░
+    //   ▓█▒   ▒█▒
+    //   ░██░ ░█▓
+    //    ▒█▓ ▓█░
+    //     ▓█▓█▒
+    //     ░███
+    //     ▒███▒
+    //    ░█▓░██░
+    //    ▓█░ ▒█▓
+    //   ▒█▒   ▓█▒
+    //  ░█▓    ░██░
+    //  ▓█░     ▒█▓
+    // ▒█▒       ▓█▒
+    // U+0059 'Y' at 4386
+    // ░░        ░░░
+    // ▒█▓      ░██
+    //  ▓█░     ▓█▒
+    //  ░█▓    ░█▓
+    //   ▒█▒   ▓█░
+    //    ██  ▒█▒
+    //    ▒█▒ ██
+    //     ▓█▓█░
+    //     ░██▓
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    //      ▓█░
+    // U+005A 'Z' at 4491
+    //  ░░░░░░░░░░░
+    //  ▓█████████▓
+    //  ░░░░░░░░██░
+    //         ▓█▒
+    //        ▒█▓
+    //       ░██░
+    //       ▓█░
+    //      ▒█▒
+    //     ░█▓
+    //     ██░
+    //    ▓█▒
+    //   ▒█▓
+    //  ░██░
+    //  ▓█▓▒▒▒▒▒▒▒░
+    // ░██████████▒
+    // U+005B '[' at 4581
+    // ░░░░
+    // ▒█▓▓
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█
+    // ▒█░░
+    // ▒▓▓▓
+    // U+005C 'backslash' at 4638
+    //  ▓░
+    //  ▓▓
+    //  ░█░
+    //   ▓▒
+    //   ▒█
+    //   ░█░
+    //    ▓▓
+    //    ░█░
+    //     ▓▒
+    //     ▒█
+    //     ░█░
+    //      ▓▓
+    //      ░█░
+    //       ▓▒
+    //       ▒█
+    //        ▓░
+    // U+005D ']' at 4718
+    //  ░░░░
+    //  ▓▓█▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //    █▒
+    //  ░░█▒
+    //  ▓▓▓▒
+    // U+005E '^' at 4775
+    //     ░░
+    //    ░█▓
+    //    ▓▓█░
+    //   ▒█░▓▓
+    //   █▓ ░█▒
+    //  ▒█░  ▒█
+    // ░█▒    █▒
+    //  ░      ░
+    // U+005F '_' at 4815
+    // ░░░░░░░░
+    // ▓▓▓▓▓▓▓▓
+    // U+0060 '`' at 4823
+    // ░▒░
+    //  ▓█░
+    //   ▓▓
+    //    ░
+    // U+0061 'a' at 4835
+    //     ░░
+    //   ▒████▒
+    //  ▒█▒░░▓█▒
+    //       ░█▓
+    //        ▓▓
+    //    ░▒▒▒██
+    //   ▓█▓▒▒██
+    //  ▓█░   ▓█
+    //  █▓    ██
+    //  ▓█░░░▓██
+    //  ░▓██▓░▒▓
+    //    ░
+    // U+0062 'b' at 4895
+    // ░▓░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░  ░░
+    // ▒█░▒███▓
+    // ▒██▒░░▓█▓
+    // ▒█▒    ▓█░
+    // ▒█░    ▒█░
+    // ▒█░    ▒█▒
+    // ▒█░    ▒█▒
+    // ▒█░    ▒█░
+    // ▒█▒    █▓
+    // ▒██▒░▒▓█░
+    // ▒█░▓██▓░
+    // 
+    // U+0063 'c' at 4975
+    //      ░░
+    //   ░▓███▓░
+    //  ░██░░░▓▒
+    //  ▓█░
+    //  █▓
+    // ░█▒
+    // ░█▓
+    //  █▓
+    //  ▓█░
+    //  ░██▒░▒▓▓
+    //   ░▓███▒
+    // 
+    // U+0064 'd' at 5035
+    //         ▓▒
+    //        ░█▓
+    //        ░█▓
+    //        ░█▓
+    //     ░░ ░█▓
+    //   ░████▒█▓
+    //  ░█▓░░░▓█▓
+    //  ▓█░   ░█▓
+    //  █▓    ░█▓
+    // ░█▒    ░█▓
+    // ░█▒    ░█▓
+    //  █▓    ░█▓
+    //  ▓█░   ▒█▓
+    //  ▒█▓▒▒▓▓█▓
+    //   ▒███▒ ▓▓
+    // 
+    // U+0065 'e' at 5115
+    //     ░░░
+    //   ░▓███▓░
+    //  ░█▓░ ░▓▓
+    //  ▓█    ░█░
+    //  █▓░░░░░█▒
+    // ░████████▒
+    // ░█▒
+    //  █▓
+    //  ▒█░    ░
+    //   ██▒░▒▓█░
+    //    ▓███▓▒
+    //      ░
+    // U+0066 'f' at 5175
+    //    ░▒▒░
+    //   ░██▓▒
+    //   ▓█░
+    //   █▓
+    //  ░█▒
+    // ▓█████▒
+    // ░▒█▓░░░
+    //  ░█▓
+    //  ░█▓
+    //  ░█▓
+    //  ░█▓
+    //  ░█▓
+    //  ░█▓
+    //  ░█▓
+    //  ░█▓
+    // U+0067 'g' at 5235
+    //     ░░
+    //   ▒████▓▓▓
+    //  ▒█▒░░▓█▓░
+    //  ▓▓   ░█▒
+    //  ▓▓    █▒
+    //  ▒█▒  ▒█░
+    //   ▓███▓░
+    //  ░█░░░
+    //  ▒█▒░░
+    //  ░██████▒
+    //  ▓▓░░░▒▓█▒
+    // ░█░     █▒
+    // ░█▒    ▒█░
+    //  ▓█▓▓▓▓█▒
+    //   ░▒▒▒▒░
+    // U+0068 'h' at 5310
+    // ▒▓░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░  ░░
+    // ▒█░▓███▒
+    // ▒██▒░░▓█▒
+    // ▒█▒   ░█▓
+    // ▒█░    █▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // U+0069 'i' at 5385
+    // ░▒░
+    // ▒█▓
+    // ░▓▒
+    // 
+    //  ░
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // U+006A 'j' at 5415
+    //   ░▒░
+    //   ▒█▓
+    //   ░▓▒
+    // 
+    //    ░
+    //   ░█▒
+    //   ░█▒
+    //   ░█▒
+    //   ░█▒
+    //   ░█▒
+    //   ░█▒
+    //   ░█▒
+    //   ░█▒
+    //   ░█▒
+    //   ░█▒
+    //   ░█▒
+    //   ▒█░
+    // ░▓█▓
+    // ░▒▒
+    // U+006B 'k' at 5472
+    // ░▓░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░    ░░
+    // ▒█░   ▓█░
+    // ▒█░  ▒█▒
+    // ▒█░ ▒█▒
+    // ▒█░▒█▒
+    // ▒███▓
+    // ▒█▒▒█▒
+    // ▒█░ ▓█▒
+    // ▒█░  ▓█░
+    // ▒█░  ░█▓
+    // ▒█░   ░█▓
+    // U+006C 'l' at 5547
+    // ░▓░
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // ░█▒
+    // U+006D 'm' at 5577
+    //     ░░    ░░
+    // ▒█░▓██▓ ▒███▓░
+    // ▒██▒░▒█▒█░░▒█▓
+    // ▒█░   ▓█▒   ▓█
+    // ▒█░   ▒█░   ▓█░
+    // ▒█░   ▒█░   ▒█░
+    // ▒█░   ▒█░   ▒█░
+    // ▒█░   ▒█░   ▒█░
+    // ▒█░   ▒█░   ▒█░
+    // ▒█░   ▒█░   ▒█░
+    // ▒█░   ▒█░   ▒█░
+    // U+006E 'n' at 5665
+    //      ░░
+    // ▒█░▓███▒
+    // ▒██▒░░▓█▒
+    // ▒█▒   ░█▓
+    // ▒█░    █▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // ▒█░    ▓▓
+    // U+006F 'o' at 5720
+    //      ░░
+    //   ░▓███▓░
+    //  ░█▓░░░▓█░
+    //  ▓█░    █▓
+    //  █▓     ▓█░
+    // ░█▒     ▒█░
+    // ░█▒     ▒█░
+    //  █▓     ▓█░
+    //  ▓█░   ░█▓
+    //  ░██▒░▒██░
+    //   ░▓███▓░
+    // 
+    // U+0070 'p' at 5792
+    //      ░░
+    // ▒█ ▓███▓
+    // ▒█▓▒░░▓█▒
+    // ▒█▒    ▓█
+    // ▒█░    ▒█░
+    // ▒█░    ▒█░
+    // ▒█░    ▒█░
+    // ▒█░    ▓█░
+    // ▒█░   ░█▓
+    // ▒██▒░▒██░
+    // ▒█▒▓██▓░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ░▒░
+    // U+0071 'q' at 5867
+    //     ░░
+    //   ░████▒▓▓
+    //  ░█▓░░░▓█▓
+    //  ▓█░   ░█▓
+    //  █▓    ░█▓
+    // ░█▒    ░█▓
+    // ░█▒    ░█▓
+    //  █▓    ░█▓
+    //  ▓█░   ▒█▓
+    //  ▒█▓▒▒▓▓█▓
+    //   ▒███▒░█▓
+    //        ░█▓
+    //        ░█▓
+    //        ░█▓
+    //         ▒░
+    // U+0072 'r' at 5942
+    //      ░
+    // ▒█ ▓██▒
+    // ▒█▒▓▒▒░
+    // ▒█▓
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // ▒█░
+    // U+0073 's' at 5986
+    //    ░░░
+    //  ░▓███▓░
+    //  ▓█░ ░▒░
+    //  █▓
+    //  ██▒
+    //  ░███▒░
+    //    ▒▓██░
+    //      ░█▓
+    //       █▓
+    // ░█▒░░▒█░
+    //  ▒▓███▒
+    // 
+    // U+0074 't' at 6034
+    //   ░░
+    //   ▒▓
+    //   ▓▓
+    //   ▓▓
+    // ▒▓████▓
+    // ░░█▓░░░
+    //   █▓
+    //   █▓
+    //   █▓
+    //   █▓
+    //   █▓
+    //   █▓
+    //   ▓█▒▒▒
+    //   ░███▒
+    //     ░
+    // U+0075 'u' at 6094
+    // ░░     ░
+    // ▓█    ░█▓
+    // ▓█    ░█▓
+    // ▓█    ░█▓
+    // ▓█    ░█▓
+    // ▓█    ░█▓
+    // ▓█    ░█▓
+    // ▓█    ░█▓
+    // ▒█░   ▒█▓
+    // ░█▓▒░▓▓█▓
+    //  ▒███▓ ▓▓
+    //    ░
+    // U+0076 'v' at 6154
+    // ░░       ░
+    // ▒█░     █▓
+    // ░█▓    ▒█▒
+    //  ▓█    ▓█
+    //  ░█▒  ░█▒
+    //   █▓  ▒█░
+    //   ▒█░ █▓
+    //   ░█▓░█░
+    //    ▓█▓█
+    //    ░██▒
+    //     ▓█░
+    // U+0077 'w' at 6220
+    // ░      ░      ░
+    // ▓█░   ░█▓    ▓█
+    // ░█▒   ▒██    █▓
+    //  █▓   █▓█░  ░█░
+    //  ▓█  ░█░▓▓  ▓█
+    //  ░█░ ▒▓ ▒█  █▓
+    //   █▓ ▓▒ ░█░░█▒
+    //   ▓█░█░  ▓▒▒█
+    //   ▒█▓▓   ▒▓▓▓
+    //    ██▒   ░██▒
+    //    ▓█░    ▓█
+    // U+0078 'x' at 6308
+    //  ░      ░
+    // ░█▓    ▓█░
+    //  ▒█▒  ░█▒
+    //   ▓█░░█▓
+    //   ░█▓▓█░
+    //    ▒██▒
+    //    ▓██▓
+    //   ░█▒▒█▒
+    //   █▓  ▓█░
+    //  ▓█░  ░█▓
+    // ▒█▒    ▒█▒
+    // U+0079 'y' at 6363
+    // ░░       ░
+    // ▒█░     █▓
+    // ░█▓    ▒█▒
+    //  ▓█░   ▓█
+    //  ░█▒  ░█▒
+    //   ▓█  ▒█░
+    //   ▒█▒ █▓
+    //    █▓▒█░
+    //    ▒██▓
+    //    ░██░
+    //     ▓█
+    //    ░█▒
+    //    ▓█
+    //   ░█▓
+    //   ░▒░
+    // U+007A 'z' at 6453
+    //  ░░░░░░░
+    //  ███████▒
+    //  ░░░░░▓█░
+    //      ▒█▒
+    //     ░█▓
+    //     ▓▓
+    //    ▓█░
+    //   ▒█▒
+    //  ░█▒
+    //  ▓█▒▒▒▒▒░
+    // ░███████░
+    // U+007B '{' at 6508
+    //    ░░
+    //   ▓█▓
+    //  ▒█▒
+    //  ▓█
+    //  ▓█
+    //  ▒█
+    //  ░█░
+    //  ░█░
+    //  ▒█░
+    // ▒█▒
+    // ░▓▓
+    //  ░█░
+    //  ░█░
+    //  ▒█░
+    //  ▒█
+    //  ▓▓
+    //  ▒█
+    //  ░█▓░
+    //   ░▓▓░
+    // U+007C '|' at 6565
+    // ░░
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ▓▓
+    // ░░
+    // U+007D '}' at 6585
+    //  ░░
+    //  ▓█▓
+    //   ▒█▒
+    //    █▓
+    //    █▓
+    //    █▒
+    //   ░█░
+    //   ░█░
+    //   ░█▒
+    //    ▒█▒
+    //    ▓▓░
+    //   ░█░
+    //   ░█░
+    //   ░█▒
+    //    █▒
+    //    ▓▓
+    //    █▒
+    //  ░▓█░
+    // ░▓▓░
+    // U+007E '~' at 6642
+    //   ░     ▓░
+    //  ▓██▓▒░▒█░
+    // ▒█▒▒▓███▒
+    // ▓▓   ░░░
+    // U+00B0 '°' at 6662
+    //   ░▒▒░
+    //  ░█▓▓█░
+    //  █▒  ▒█
+    // ░█   ░█░
+    // ░█░  ░█
+    //  ▓▓▒▒▓▒
+    //   ▒▓▓▒
+    0x25, 0x10, 0x6F, 0x40, 0x6F, 0x40, 0x6F, 0x40, 0x6F, 0x40, 0x6F, 0x40, 0x6F, 0x40, 0x5F, 0x40,
+    0x4F, 0x30, 0x3F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0xBF, 0x80, 0x9F, 0x70, 0x01, 0x00,
+    0x25, 0x01, 0x52, 0x7F, 0x12, 0xF6, 0x7F, 0x12, 0xF6, 0x7F, 0x12, 0xF6, 0x6F, 0x01, 0xF5, 0x29,
+    0x00, 0x92, 0x00, 0x00, 0x24, 0x00, 0x42, 0x00, 0x00, 0x00, 0xCA, 0x00, 0xD9, 0x00, 0x00, 0x00,
+    0xF7, 0x01, 0xF6, 0x00, 0x00, 0x03, 0xF4, 0x04, 0xF3, 0x00, 0x00, 0x27, 0xF3, 0x28, 0xF2, 0x20,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0x3C, 0xC3, 0x3D, 0xB3, 0x20, 0x00, 0x0E, 0x80, 0x0F,
+    0x70, 0x00, 0x00, 0x2F, 0x50, 0x3F, 0x40, 0x00, 0x38, 0xAF, 0x98, 0xAF, 0x98, 0x20, 0x4C, 0xDF,
+    0xCC, 0xEF, 0xCC, 0x40, 0x00, 0xAC, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xD9, 0x00, 0xE8, 0x00, 0x00,
+    0x01, 0xF6, 0x02, 0xF5, 0x00, 0x00, 0x04, 0xE2, 0x03, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10,
+    0x00, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x02, 0x5F, 0x51, 0x00, 0x01, 0xAF, 0xFF, 0xFE, 0x70,
+    0x0A, 0xF8, 0x5F, 0x4A, 0xE1, 0x2F, 0x90, 0x3E, 0x00, 0x00, 0x4F, 0x60, 0x4D, 0x00, 0x00, 0x2F,
+    0xC1, 0x5C, 0x00, 0x00, 0x0A, 0xFD, 0xBB, 0x00, 0x00, 0x01, 0x8E, 0xFF, 0xC5, 0x00, 0x00, 0x01,
+    0xAD, 0xEF, 0xA0, 0x00, 0x00, 0x97, 0x1B, 0xF5, 0x00, 0x00, 0xB6, 0x03, 0xF8, 0x00, 0x00, 0xC5,
+    0x03, 0xF7, 0x68, 0x10, 0xD4, 0x09, 0xF3, 0x8F, 0xD8, 0xE9, 0xCF, 0x80, 0x05, 0xBE, 0xFF, 0xC6,
+    0x00, 0x00, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
+    0x00, 0x26, 0x51, 0x00, 0x00, 0x00, 0x34, 0x00, 0x05, 0xFC, 0xDE, 0x30, 0x00, 0x04, 0xF6, 0x00,
+    0x0E, 0x80, 0x0B, 0xB0, 0x00, 0x2E, 0xA0, 0x00, 0x3F, 0x30, 0x06, 0xE0, 0x00, 0xBD, 0x10, 0x00,
+    0x3F, 0x30, 0x06, 0xF0, 0x08, 0xF3, 0x00, 0x00, 0x1F, 0x60, 0x09, 0xC0, 0x4F, 0x60, 0x00, 0x00,
+    0x07, 0xE9, 0xAF, 0x41, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x59, 0x93, 0x0B, 0xD1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x31, 0xAE, 0xD7, 0x00, 0x00, 0x00, 0x04, 0xF7, 0x0B, 0xC4, 0x6E, 0x60,
+    0x00, 0x00, 0x1D, 0xA0, 0x3F, 0x30, 0x09, 0xC0, 0x00, 0x00, 0xBD, 0x10, 0x5F, 0x10, 0x06, 0xE0,
+    0x00, 0x07, 0xF3, 0x00, 0x3F, 0x30, 0x08, 0xD0, 0x00, 0x4F, 0x70, 0x00, 0x0D, 0xA1, 0x3E, 0x70,
+    0x01, 0xDA, 0x00, 0x00, 0x03, 0xDF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00,
+    0x00, 0x00, 0x15, 0x75, 0x10, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xEF, 0xE3, 0x00, 0x00, 0x00, 0x0D,
+    0xE3, 0x02, 0xDD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x5B, 0x10, 0x00, 0x00, 0x2F, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2B, 0xFF, 0x90, 0x00, 0x05, 0x20, 0x02, 0xEE, 0x3A, 0xF9, 0x00, 0x3F, 0x40, 0x0B,
+    0xF2, 0x00, 0xAF, 0x90, 0x7F, 0x10, 0x1F, 0xC0, 0x00, 0x0A, 0xF8, 0xDB, 0x00, 0x2F, 0xB0, 0x00,
+    0x00, 0xAF, 0xF3, 0x00, 0x0D, 0xE2, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x05, 0xFE, 0x75, 0x8C, 0xF8,
+    0xAF, 0x80, 0x00, 0x4C, 0xFF, 0xDA, 0x30, 0x0A, 0xF8, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x00, 0x7F, 0x10, 0x7F, 0x10, 0x7F, 0x10, 0x6F, 0x00, 0x29, 0x00, 0x00, 0x14, 0x00, 0x00,
+    0x7F, 0x10, 0x01, 0xEB, 0x00, 0x07, 0xF4, 0x00, 0x0C, 0xD0, 0x00, 0x2F, 0x70, 0x00, 0x5F, 0x50,
+    0x00, 0x8F, 0x30, 0x00, 0x9F, 0x10, 0x00, 0xAE, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x8F, 0x20, 0x00,
+    0x6F, 0x40, 0x00, 0x3F, 0x60, 0x00, 0x0E, 0xB0, 0x00, 0x09, 0xF2, 0x00, 0x03, 0xF8, 0x00, 0x00,
+    0xBE, 0x00, 0x00, 0x2A, 0x00, 0x04, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x0C, 0xD0, 0x00, 0x06, 0xF5,
+    0x00, 0x01, 0xEB, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x5F, 0x60, 0x00, 0x3F, 0x70,
+    0x00, 0x1F, 0x80, 0x00, 0x2F, 0x70, 0x00, 0x4F, 0x60, 0x00, 0x6F, 0x40, 0x00, 0x8F, 0x10, 0x00,
+    0xCD, 0x00, 0x04, 0xF7, 0x00, 0x0A, 0xF2, 0x00, 0x1F, 0x90, 0x00, 0x1B, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x09, 0x37, 0x64, 0x90, 0x03, 0xCC, 0xCC, 0x30, 0x01, 0x7E,
+    0xE7, 0x00, 0x0B, 0x87, 0x78, 0xB0, 0x00, 0x07, 0x60, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00,
+    0x95, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8,
+    0x00, 0x00, 0x66, 0x66, 0xFB, 0x66, 0x63, 0xEE, 0xEE, 0xFF, 0xEE, 0xE8, 0x00, 0x00, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x42, 0x00, 0x00, 0x02, 0x40, 0x0E, 0xF3, 0x0B, 0xF4, 0x00, 0xD1, 0x08, 0x80, 0x07,
+    0x00, 0xBB, 0xBB, 0xB0, 0xBB, 0xBB, 0xB0, 0x02, 0x40, 0x1E, 0xF4, 0x0D, 0xF3, 0x01, 0x10, 0x00,
+    0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00,
+    0x02, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x5F,
+    0x20, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xD0, 0x00,
+    0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00,
+    0x02, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x36, 0x52, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xEF, 0x61, 0x3A, 0xF8,
+    0x00, 0x07, 0xF6, 0x00, 0x00, 0xCF, 0x20, 0x0E, 0xE0, 0x00, 0x00, 0x5F, 0x80, 0x2F, 0xA0, 0x00,
+    0x00, 0x1F, 0xB0, 0x4F, 0x90, 0x00, 0x00, 0x0F, 0xD0, 0x5F, 0x70, 0x00, 0x00, 0x0D, 0xE0, 0x5F,
+    0x80, 0x00, 0x00, 0x0E, 0xE0, 0x3F, 0x90, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xB0, 0x00, 0x00, 0x2F,
+    0xA0, 0x0C, 0xF2, 0x00, 0x00, 0x8F, 0x60, 0x05, 0xF9, 0x00, 0x02, 0xED, 0x00, 0x00, 0xAF, 0xB6,
+    0x8E, 0xE5, 0x00, 0x00, 0x07, 0xDF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0x00, 0x00, 0x00, 0x1A, 0xFB, 0x00, 0x00, 0x01, 0xCF, 0xFB, 0x00, 0x00, 0x2D, 0xF6,
+    0xFB, 0x00, 0x00, 0xBE, 0x41, 0xFB, 0x00, 0x00, 0x22, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB,
+    0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00,
+    0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00,
+    0x15, 0x56, 0xFC, 0x55, 0x30, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x66, 0x40, 0x00, 0x02,
+    0xCF, 0xFF, 0xFB, 0x20, 0x1C, 0xF6, 0x22, 0x8F, 0xB0, 0x5F, 0x70, 0x00, 0x0B, 0xF2, 0x5A, 0x10,
+    0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x00, 0x00,
+    0xBF, 0x40, 0x00, 0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x08, 0xF8, 0x00,
+    0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xE9, 0xAA, 0xAA, 0xA5,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x03, 0x67, 0x40, 0x00, 0x01, 0xAF, 0xFF, 0xFD, 0x30, 0x0A,
+    0xF8, 0x22, 0x6F, 0xD1, 0x2F, 0xA0, 0x00, 0x09, 0xF4, 0x4A, 0x20, 0x00, 0x06, 0xF5, 0x00, 0x00,
+    0x00, 0x09, 0xF2, 0x00, 0x00, 0x02, 0x8F, 0x70, 0x00, 0x00, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0x47,
+    0xBF, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xAD, 0x00, 0x00, 0x03,
+    0xF9, 0x7F, 0x80, 0x00, 0x0A, 0xF5, 0x1C, 0xFB, 0x77, 0xCF, 0xA0, 0x01, 0x9E, 0xFF, 0xE7, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0,
+    0x00, 0x00, 0x00, 0x01, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD9, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+    0x48, 0xF0, 0x00, 0x00, 0x04, 0xF8, 0x08, 0xF0, 0x00, 0x00, 0x2E, 0xB0, 0x08, 0xF0, 0x00, 0x00,
+    0xBE, 0x20, 0x08, 0xF0, 0x00, 0x08, 0xF5, 0x00, 0x08, 0xF0, 0x00, 0x4F, 0xA3, 0x33, 0x39, 0xF3,
+    0x31, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x13, 0x33, 0x33, 0x3A, 0xF4, 0x30, 0x00, 0x00, 0x00,
+    0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00,
+    0x55, 0x55, 0x55, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xB0, 0x05, 0xF7, 0x55, 0x55, 0x10, 0x07, 0xF1,
+    0x00, 0x00, 0x00, 0x0A, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xA0, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xC4, 0x00, 0x19, 0x96, 0x58, 0xEF, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B,
+    0xF2, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x13, 0x00, 0x00, 0x6F, 0x90,
+    0xAF, 0xB7, 0x7A, 0xFD, 0x10, 0x18, 0xEF, 0xFE, 0x81, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00, 0x05,
+    0xFB, 0x00, 0x00, 0x00, 0x2E, 0xD1, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x07, 0xFA, 0x9B,
+    0x94, 0x00, 0x2E, 0xFD, 0xAA, 0xEF, 0x80, 0x8F, 0xA1, 0x00, 0x1C, 0xF4, 0xBF, 0x10, 0x00, 0x04,
+    0xF8, 0xDD, 0x00, 0x00, 0x01, 0xFA, 0xBE, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x60, 0x00, 0x0B, 0xF4,
+    0x0C, 0xF9, 0x67, 0xCF, 0x90, 0x01, 0x9E, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x45,
+    0x55, 0x55, 0x55, 0x54, 0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0x35, 0x55, 0x55, 0x57, 0xF8, 0x00, 0x00,
+    0x00, 0x0B, 0xE1, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x04,
+    0xF9, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x00, 0x00, 0xCF, 0x20,
+    0x00, 0x00, 0x04, 0xF9, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x00,
+    0x00, 0xCF, 0x20, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x63, 0x00, 0x00,
+    0x00, 0x4D, 0xFE, 0xFF, 0xA1, 0x00, 0x01, 0xED, 0x30, 0x07, 0xF9, 0x00, 0x06, 0xF6, 0x00, 0x00,
+    0xCE, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xAF, 0x10, 0x03, 0xF7, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x9F,
+    0x73, 0x4B, 0xE4, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x50, 0x00, 0x02, 0xDE, 0x85, 0x6B, 0xF8, 0x00,
+    0x0A, 0xF4, 0x00, 0x00, 0xAF, 0x40, 0x0E, 0xE0, 0x00, 0x00, 0x5F, 0x80, 0x0E, 0xD0, 0x00, 0x00,
+    0x5F, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0xAF, 0x50, 0x03, 0xEE, 0x85, 0x6B, 0xFB, 0x00, 0x00, 0x3A,
+    0xEF, 0xFD, 0x71, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x56, 0x40, 0x00, 0x01,
+    0x9F, 0xFF, 0xFD, 0x30, 0x0A, 0xF8, 0x21, 0x5E, 0xE1, 0x3F, 0x90, 0x00, 0x05, 0xF7, 0x6F, 0x50,
+    0x00, 0x00, 0xFA, 0x6F, 0x50, 0x00, 0x01, 0xFB, 0x3F, 0xB0, 0x00, 0x07, 0xF9, 0x0A, 0xFA, 0x55,
+    0x9F, 0xF4, 0x01, 0x8E, 0xFE, 0xAF, 0xB0, 0x00, 0x00, 0x10, 0xBF, 0x20, 0x00, 0x00, 0x08, 0xF7,
+    0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x02, 0xEE, 0x20, 0x00, 0x00, 0x0C, 0xF6, 0x00, 0x00,
+    0x00, 0x8F, 0x90, 0x00, 0x00, 0x5C, 0x50, 0xAF, 0xB0, 0x39, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x10, 0x9F, 0xA0, 0x8F, 0x80, 0x02, 0x00, 0x5C, 0x50, 0xAF, 0xB0, 0x39,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x9F, 0x90, 0x6F, 0xA0, 0x08,
+    0x70, 0x3C, 0x10, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x30, 0x00,
+    0x00, 0x3B, 0xFD, 0x10, 0x00, 0x2A, 0xFD, 0x60, 0x00, 0x29, 0xFD, 0x60, 0x00, 0x00, 0x6F, 0xE5,
+    0x00, 0x00, 0x00, 0x03, 0xAF, 0xC5, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xC5, 0x00, 0x00, 0x00, 0x04,
+    0xBF, 0x30, 0x00, 0x00, 0x00, 0x04, 0x20, 0x11, 0x11, 0x11, 0x11, 0x10, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x24, 0x44, 0x44, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xBB, 0xBB, 0xBB, 0xB1,
+    0x59, 0x99, 0x99, 0x99, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x10, 0x00, 0x00, 0x00, 0x6E,
+    0xE7, 0x10, 0x00, 0x00, 0x02, 0x9F, 0xE7, 0x10, 0x00, 0x00, 0x02, 0x9F, 0xD6, 0x00, 0x00, 0x00,
+    0x19, 0xFE, 0x10, 0x00, 0x18, 0xEE, 0x71, 0x00, 0x18, 0xEE, 0x81, 0x00, 0x00, 0x9F, 0x81, 0x00,
+    0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x63, 0x00, 0x3D, 0xFF, 0xFF, 0x80, 0x4B,
+    0x30, 0x2B, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x0B, 0xF2, 0x00,
+    0x01, 0xBF, 0x50, 0x00, 0x0D, 0xE3, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x10, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00,
+    0x7F, 0x90, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x87, 0x51, 0x00, 0x00, 0x00,
+    0x00, 0x5D, 0xFC, 0xAB, 0xDE, 0x80, 0x00, 0x00, 0x09, 0xF8, 0x10, 0x00, 0x04, 0xDB, 0x00, 0x00,
+    0x7E, 0x30, 0x00, 0x00, 0x00, 0x1D, 0x90, 0x02, 0xF6, 0x00, 0x00, 0x36, 0x63, 0x04, 0xF2, 0x09,
+    0xC0, 0x00, 0x4D, 0xEB, 0xEC, 0x00, 0xE6, 0x0D, 0x80, 0x04, 0xF7, 0x00, 0xC8, 0x00, 0xB8, 0x1F,
+    0x50, 0x0D, 0xA0, 0x01, 0xF4, 0x00, 0xA9, 0x1F, 0x30, 0x2F, 0x40, 0x05, 0xF1, 0x00, 0xC6, 0x0E,
+    0x60, 0x4F, 0x30, 0x0B, 0xD0, 0x03, 0xF2, 0x0B, 0x80, 0x2F, 0x92, 0x7D, 0xE1, 0x3C, 0x90, 0x08,
+    0xD0, 0x07, 0xFF, 0xA1, 0xAF, 0xE8, 0x00, 0x01, 0xE8, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEB, 0x31, 0x00, 0x02, 0x7D, 0x50, 0x00,
+    0x00, 0x2A, 0xEF, 0xDD, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0xEF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8D, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x28, 0xF5,
+    0x00, 0x00, 0x00, 0x02, 0xFB, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x00, 0xBF, 0x20, 0x00,
+    0x00, 0x0D, 0xE1, 0x00, 0x5F, 0x80, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0xBF,
+    0x85, 0x55, 0x5B, 0xF5, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x08, 0xF7, 0x11, 0x11,
+    0x11, 0xCF, 0x20, 0x0D, 0xF1, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x5F, 0xA0, 0x00, 0x00, 0x00, 0x1E,
+    0xE0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x09, 0xF5, 0x15, 0x55, 0x55, 0x31, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xA1, 0x00, 0x4F, 0xB3, 0x33, 0x5B, 0xFC, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0xDF, 0x30,
+    0x4F, 0xA0, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0xCF, 0x20, 0x4F, 0xA0, 0x00, 0x18,
+    0xF7, 0x00, 0x4F, 0xFE, 0xEE, 0xFE, 0x50, 0x00, 0x4F, 0xC7, 0x77, 0x8C, 0xF9, 0x00, 0x4F, 0xA0,
+    0x00, 0x00, 0x9F, 0x70, 0x4F, 0xA0, 0x00, 0x00, 0x2F, 0xC0, 0x4F, 0xA0, 0x00, 0x00, 0x3F, 0xB0,
+    0x4F, 0xA0, 0x00, 0x00, 0xAF, 0x70, 0x4F, 0xD8, 0x88, 0xAD, 0xFC, 0x00, 0x4F, 0xFF, 0xFF, 0xEB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x36, 0x64, 0x10, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x10,
+    0x00, 0x2C, 0xFD, 0x75, 0x35, 0xBF, 0x90, 0x00, 0xBF, 0xA1, 0x00, 0x00, 0x04, 0x10, 0x05, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xC3, 0x00, 0x00, 0x2B, 0x60, 0x00, 0x1A, 0xFF,
+    0xC9, 0x8B, 0xFE, 0x40, 0x00, 0x00, 0x5B, 0xEF, 0xFC, 0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x15, 0x55, 0x55, 0x41, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00,
+    0x4F, 0xB4, 0x44, 0x57, 0xCF, 0xC2, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x4F, 0xA0,
+    0x00, 0x00, 0x00, 0xBF, 0x60, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x4F, 0xA0, 0x00, 0x00,
+    0x00, 0x1F, 0xE0, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x0D, 0xF1, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x0E,
+    0xF1, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x4F,
+    0xA0, 0x00, 0x00, 0x01, 0xDF, 0x30, 0x4F, 0xA0, 0x00, 0x00, 0x3C, 0xF8, 0x00, 0x4F, 0xD9, 0x99,
+    0xAC, 0xFF, 0x70, 0x00, 0x4F, 0xFF, 0xFF, 0xEB, 0x93, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x53,
+    0x4F, 0xFF, 0xFF, 0xFF, 0xF9, 0x4F, 0xC4, 0x44, 0x44, 0x42, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F,
+    0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0x40, 0x4F, 0xD8, 0x88, 0x88, 0x20, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00,
+    0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xD9, 0x99, 0x99,
+    0x95, 0x4F, 0xFF, 0xFF, 0xFF, 0xF9, 0x15, 0x55, 0x55, 0x55, 0x53, 0x4F, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x4F, 0xC4, 0x44, 0x44, 0x42, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F,
+    0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xEB, 0xBB, 0xBB, 0x60, 0x4F, 0xED,
+    0xDD, 0xDD, 0x70, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00,
+    0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x35, 0x76, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFC, 0x40, 0x00,
+    0x2D, 0xFD, 0x75, 0x35, 0x9E, 0xF2, 0x00, 0xBF, 0x91, 0x00, 0x00, 0x02, 0x40, 0x05, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0D, 0xDD, 0xD6,
+    0x0C, 0xF2, 0x00, 0x00, 0x08, 0x9B, 0xF7, 0x09, 0xF6, 0x00, 0x00, 0x00, 0x05, 0xF7, 0x02, 0xFE,
+    0x10, 0x00, 0x00, 0x05, 0xF7, 0x00, 0x8F, 0xC3, 0x00, 0x00, 0x06, 0xF7, 0x00, 0x08, 0xFF, 0xB8,
+    0x68, 0xBF, 0xF5, 0x00, 0x00, 0x3A, 0xDF, 0xFF, 0xD9, 0x30, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00,
+    0x00, 0x15, 0x30, 0x00, 0x00, 0x00, 0x35, 0x20, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F,
+    0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00,
+    0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00,
+    0x9F, 0x50, 0x4F, 0xFE, 0xEE, 0xEE, 0xEE, 0xFF, 0x50, 0x4F, 0xD7, 0x77, 0x77, 0x77, 0xCF, 0x50,
+    0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0,
+    0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00,
+    0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x45, 0x00, 0xDF, 0x10, 0xDF, 0x10,
+    0xDF, 0x10, 0xDF, 0x10, 0xDF, 0x10, 0xDF, 0x10, 0xDF, 0x10, 0xDF, 0x10, 0xDF, 0x10, 0xDF, 0x10,
+    0xDF, 0x10, 0xDF, 0x10, 0xDF, 0x10, 0xDF, 0x10, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x0C, 0xF2,
+    0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2,
+    0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2,
+    0x00, 0x00, 0x0D, 0xF1, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x7F, 0xA0, 0x29, 0x7A, 0xFE, 0x20,
+    0x5F, 0xFF, 0xB3, 0x00, 0x00, 0x20, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x01, 0x54, 0x00, 0x1F,
+    0xD0, 0x00, 0x00, 0x1D, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xCF, 0x60, 0x00, 0x1F, 0xD0, 0x00,
+    0x0A, 0xF7, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xFB, 0x00,
+    0x00, 0x00, 0x1F, 0xD1, 0x6F, 0xC1, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00,
+    0x1F, 0xE7, 0xAF, 0xD1, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x09, 0xFB, 0x00, 0x00, 0x00, 0x1F, 0xD0,
+    0x00, 0xBF, 0x90, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x1C, 0xF7, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02,
+    0xDF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3E, 0xE3, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x04, 0xED,
+    0x10, 0x15, 0x30, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00,
+    0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F,
+    0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0,
+    0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00,
+    0x00, 0x00, 0x4F, 0xD9, 0x99, 0x99, 0x80, 0x4F, 0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x53, 0x4F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0x4F, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFA, 0x4F, 0xEF, 0x40, 0x00, 0x00, 0x00, 0xCE, 0xFA, 0x4F, 0x8E, 0xC0, 0x00,
+    0x00, 0x06, 0xF8, 0xFA, 0x4F, 0x78, 0xF5, 0x00, 0x00, 0x1D, 0xD1, 0xFA, 0x4F, 0x71, 0xDD, 0x10,
+    0x00, 0x7F, 0x51, 0xFA, 0x4F, 0x70, 0x6F, 0x70, 0x01, 0xEC, 0x01, 0xFA, 0x4F, 0x70, 0x0C, 0xE1,
+    0x09, 0xF4, 0x01, 0xFA, 0x4F, 0x70, 0x04, 0xF9, 0x2F, 0xB0, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0xBF,
+    0xBF, 0x30, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0x3F, 0xF9, 0x00, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0x07,
+    0xC2, 0x00, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFA, 0x15, 0x10, 0x00, 0x00, 0x00, 0x25, 0x20, 0x4F, 0xC0, 0x00, 0x00, 0x00,
+    0x5F, 0x50, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x4F, 0xFF, 0x50, 0x00, 0x00, 0x5F, 0x50,
+    0x4F, 0x9E, 0xE2, 0x00, 0x00, 0x5F, 0x50, 0x4F, 0x75, 0xFC, 0x10, 0x00, 0x5F, 0x50, 0x4F, 0x70,
+    0x9F, 0xA0, 0x00, 0x5F, 0x50, 0x4F, 0x70, 0x0C, 0xF6, 0x00, 0x5F, 0x50, 0x4F, 0x70, 0x02, 0xEF,
+    0x30, 0x5F, 0x50, 0x4F, 0x70, 0x00, 0x4F, 0xD1, 0x5F, 0x50, 0x4F, 0x70, 0x00, 0x07, 0xFB, 0x5F,
+    0x50, 0x4F, 0x70, 0x00, 0x00, 0xBF, 0xCF, 0x50, 0x4F, 0x70, 0x00, 0x00, 0x1D, 0xFF, 0x50, 0x4F,
+    0x70, 0x00, 0x00, 0x03, 0xFF, 0x50, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00, 0x00, 0x01,
+    0x36, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2C, 0xFC,
+    0x74, 0x47, 0xDF, 0xC2, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x19, 0xFA, 0x00, 0x05, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0x40, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x0D, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0E, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xB0, 0x09, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x90, 0x02, 0xFE, 0x10, 0x00, 0x00, 0x01, 0xEE, 0x20, 0x00, 0x8F, 0xD3,
+    0x00, 0x00, 0x3D, 0xF7, 0x00, 0x00, 0x08, 0xFF, 0xC9, 0x9C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3A,
+    0xDF, 0xFD, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x05, 0x55, 0x54,
+    0x20, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x71, 0x00, 0x1F, 0xD3, 0x34, 0x6D, 0xFA, 0x00, 0x1F,
+    0xD0, 0x00, 0x01, 0xDF, 0x30, 0x1F, 0xD0, 0x00, 0x00, 0x8F, 0x60, 0x1F, 0xD0, 0x00, 0x00, 0x8F,
+    0x60, 0x1F, 0xD0, 0x00, 0x00, 0xCF, 0x40, 0x1F, 0xD0, 0x00, 0x2A, 0xFB, 0x00, 0x1F, 0xFE, 0xEE,
+    0xFF, 0xB2, 0x00, 0x1F, 0xEA, 0xA9, 0x74, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36, 0x63, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2C, 0xFC, 0x74, 0x47, 0xDF, 0xC2, 0x00, 0x00,
+    0xBF, 0x90, 0x00, 0x00, 0x19, 0xFA, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x0A,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x0D, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0F,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0C,
+    0xF2, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x09, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x02,
+    0xFE, 0x10, 0x00, 0x00, 0x01, 0xEF, 0x30, 0x00, 0x8F, 0xD3, 0x00, 0x00, 0x3D, 0xF8, 0x00, 0x00,
+    0x08, 0xFF, 0xC9, 0x9C, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3A, 0xDF, 0xFF, 0xDF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x20, 0x1C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xE4, 0x05, 0x55, 0x54, 0x20, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x70, 0x00, 0x1F, 0xD3, 0x34, 0x6D, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xEF, 0x10, 0x1F,
+    0xD0, 0x00, 0x00, 0xBF, 0x30, 0x1F, 0xD0, 0x00, 0x00, 0xCF, 0x10, 0x1F, 0xD0, 0x00, 0x05, 0xFB,
+    0x00, 0x1F, 0xE6, 0x67, 0xAF, 0xD2, 0x00, 0x1F, 0xFF, 0xFF, 0xE6, 0x10, 0x00, 0x1F, 0xD0, 0x1A,
+    0xF7, 0x00, 0x00, 0x1F, 0xD0, 0x01, 0xDF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xD1, 0x00, 0x1F,
+    0xD0, 0x00, 0x07, 0xFA, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x60, 0x1F, 0xD0, 0x00, 0x00, 0x2C,
+    0xF3, 0x00, 0x01, 0x47, 0x52, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xA2, 0x03, 0xFD, 0x52, 0x49, 0xF4,
+    0x09, 0xF3, 0x00, 0x00, 0x20, 0x0B, 0xF1, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xC6, 0x10, 0x00, 0x00, 0x4D, 0xFF, 0xFA, 0x20, 0x00, 0x00, 0x49, 0xEF, 0xE2, 0x00, 0x00,
+    0x00, 0x1A, 0xFA, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x1B, 0x50, 0x00,
+    0x08, 0xF7, 0x2D, 0xFC, 0x88, 0xBF, 0xC0, 0x01, 0x9D, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x11, 0x00,
+    0x00, 0x45, 0x55, 0x55, 0x55, 0x55, 0x52, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x34, 0x44, 0x5F,
+    0xE4, 0x44, 0x42, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x25, 0x30, 0x00, 0x00, 0x00,
+    0x55, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x00,
+    0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x6F, 0x80,
+    0x00, 0x00, 0x00, 0xEF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x6F, 0x80, 0x00, 0x00,
+    0x00, 0xEF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF,
+    0x00, 0x3F, 0xB0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xE2, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x07,
+    0xFB, 0x10, 0x00, 0x4E, 0xF2, 0x00, 0x00, 0xBF, 0xEA, 0x9C, 0xFF, 0x60, 0x00, 0x00, 0x07, 0xDF,
+    0xFE, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x52, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF3, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x4F, 0xB0,
+    0x0C, 0xF4, 0x00, 0x00, 0x00, 0xAF, 0x50, 0x05, 0xFA, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xEF,
+    0x10, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x8F, 0x70, 0x00, 0x0D, 0xF2, 0x00, 0x00, 0x2F, 0xD0, 0x00,
+    0x4F, 0xB0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xAF, 0x50, 0x00, 0x00, 0x05, 0xFA, 0x01, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0x17, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x6C, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFD, 0x00, 0x00, 0x00, 0x45, 0x10, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x35, 0x10, 0x9F,
+    0x80, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x4F, 0xC0, 0x00, 0x00, 0x2F, 0xFA,
+    0x00, 0x00, 0x05, 0xFA, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x7F, 0xDE, 0x10, 0x00, 0x0A, 0xF5, 0x00,
+    0x0A, 0xF6, 0x00, 0x00, 0xCD, 0x7F, 0x50, 0x00, 0x0E, 0xF1, 0x00, 0x05, 0xFB, 0x00, 0x03, 0xF8,
+    0x2F, 0xA0, 0x00, 0x3F, 0xB0, 0x00, 0x01, 0xFE, 0x10, 0x08, 0xF3, 0x0C, 0xE1, 0x00, 0x8F, 0x60,
+    0x00, 0x00, 0xBF, 0x50, 0x0D, 0xD0, 0x07, 0xF5, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x6F, 0x90, 0x3F,
+    0x80, 0x02, 0xFA, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x8F, 0x30, 0x00, 0xCE, 0x16, 0xF7,
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0xDD, 0x00, 0x00, 0x7F, 0x5B, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFA,
+    0xF8, 0x00, 0x00, 0x2F, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF3, 0x00, 0x00, 0x0C, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x35, 0x30, 0x00, 0x00, 0x00, 0x35, 0x20,
+    0x2E, 0xF2, 0x00, 0x00, 0x02, 0xED, 0x10, 0x06, 0xFC, 0x00, 0x00, 0x0C, 0xF4, 0x00, 0x00, 0xBF,
+    0x60, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x2E, 0xE2, 0x02, 0xFD, 0x10, 0x00, 0x00, 0x06, 0xFB, 0x0C,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xEF, 0x60, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x2E, 0xE2, 0x00, 0x00, 0x00,
+    0x0C, 0xF3, 0x06, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0xBF, 0x60, 0x00, 0x03, 0xFD, 0x10,
+    0x00, 0x2F, 0xE2, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x07, 0xFB, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00,
+    0xCF, 0x60, 0x45, 0x10, 0x00, 0x00, 0x00, 0x35, 0x20, 0x6F, 0xA0, 0x00, 0x00, 0x02, 0xEE, 0x10,
+    0x0C, 0xF4, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x4F, 0xC0, 0x00, 0x00, 0x9F,
+    0x70, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x1E, 0xE1, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x1E,
+    0xE1, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x55, 0x55, 0x55, 0x55,
+    0x54, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x03, 0x44, 0x44, 0x44, 0x5F, 0xF3, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x06, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE2, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xD1, 0x00,
+    0x00, 0x00, 0x01, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB0,
+    0x00, 0x00, 0x00, 0x02, 0xEE, 0x20, 0x00, 0x00, 0x00, 0x0C, 0xFC, 0x99, 0x99, 0x99, 0x95, 0x2F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x35, 0x55, 0x00, 0x9F, 0xDC, 0x10, 0x9E, 0x00, 0x00, 0x9E, 0x00,
+    0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00,
+    0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E,
+    0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x44, 0x00, 0x8D, 0xDD, 0x10, 0x1A, 0x30,
+    0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x00,
+    0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00,
+    0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x40, 0x05, 0x55,
+    0x30, 0x1C, 0xDF, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90,
+    0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00,
+    0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E,
+    0x90, 0x04, 0x4E, 0x90, 0x1D, 0xDD, 0x80, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x04, 0xFC, 0x00,
+    0x00, 0x00, 0x0D, 0xDF, 0x50, 0x00, 0x00, 0x6F, 0x4B, 0xD0, 0x00, 0x01, 0xEB, 0x03, 0xF6, 0x00,
+    0x08, 0xF3, 0x00, 0x9E, 0x10, 0x2E, 0x90, 0x00, 0x1E, 0x80, 0x12, 0x00, 0x00, 0x01, 0x20, 0x55,
+    0x55, 0x55, 0x55, 0xDD, 0xDD, 0xDD, 0xDB, 0x37, 0x50, 0x00, 0x0B, 0xF3, 0x00, 0x01, 0xCC, 0x00,
+    0x00, 0x15, 0x10, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x6E, 0xFF, 0xF9, 0x00, 0x06, 0xF9, 0x34,
+    0xBF, 0x60, 0x00, 0x10, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x02, 0x68, 0x9E,
+    0xE0, 0x01, 0xBF, 0xC9, 0x8E, 0xE0, 0x0B, 0xE3, 0x00, 0x0D, 0xE0, 0x0F, 0xA0, 0x00, 0x1E, 0xE0,
+    0x0D, 0xE4, 0x25, 0xCE, 0xE0, 0x03, 0xDF, 0xFC, 0x47, 0xD0, 0x00, 0x02, 0x10, 0x00, 0x00, 0x5B,
+    0x30, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0x50,
+    0x00, 0x00, 0x00, 0x7F, 0x50, 0x13, 0x20, 0x00, 0x7F, 0x59, 0xFF, 0xFB, 0x10, 0x7F, 0xE9, 0x43,
+    0xAF, 0xA0, 0x7F, 0x80, 0x00, 0x0D, 0xF2, 0x7F, 0x50, 0x00, 0x08, 0xF4, 0x7F, 0x50, 0x00, 0x06,
+    0xF6, 0x7F, 0x50, 0x00, 0x07, 0xF6, 0x7F, 0x50, 0x00, 0x09, 0xF3, 0x7F, 0x60, 0x00, 0x1E, 0xD0,
+    0x7F, 0xE8, 0x46, 0xDF, 0x50, 0x7E, 0x3B, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x20, 0x00, 0x00, 0x3D, 0xFF, 0xFC, 0x30, 0x03, 0xFE, 0x52, 0x4A, 0x70, 0x0B, 0xF3,
+    0x00, 0x00, 0x00, 0x1F, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xA0, 0x00,
+    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0x10, 0x02, 0xEE, 0x74, 0x6D,
+    0xA0, 0x00, 0x2B, 0xFF, 0xE9, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB7,
+    0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00,
+    0x00, 0x33, 0x12, 0xFA, 0x00, 0x4E, 0xFF, 0xE8, 0xFA, 0x04, 0xFD, 0x42, 0x4D, 0xFA, 0x0C, 0xF2,
+    0x00, 0x03, 0xFA, 0x1F, 0xB0, 0x00, 0x02, 0xFA, 0x3F, 0x90, 0x00, 0x02, 0xFA, 0x3F, 0x90, 0x00,
+    0x02, 0xFA, 0x1F, 0xB0, 0x00, 0x02, 0xFA, 0x0D, 0xF2, 0x00, 0x07, 0xFA, 0x06, 0xFD, 0x66, 0xAC,
+    0xFA, 0x00, 0x6E, 0xFE, 0x90, 0xCA, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00,
+    0x00, 0x3D, 0xFF, 0xFB, 0x20, 0x03, 0xFC, 0x31, 0x4D, 0xC0, 0x0C, 0xE1, 0x00, 0x03, 0xF5, 0x1F,
+    0xB3, 0x33, 0x33, 0xF8, 0x3F, 0xFE, 0xEE, 0xEE, 0xE8, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xC0,
+    0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x20, 0x01, 0xEF, 0x85, 0x6A, 0xF5, 0x00, 0x1A, 0xEF,
+    0xFC, 0x60, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x02, 0x67, 0x30, 0x00, 0x4E, 0xFD, 0x70, 0x00,
+    0xCE, 0x20, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0xAE, 0xFF, 0xEE, 0x70, 0x26,
+    0xFC, 0x55, 0x30, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02,
+    0xFA, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02,
+    0xFA, 0x00, 0x00, 0x00, 0x01, 0x43, 0x10, 0x00, 0x00, 0x9F, 0xFF, 0xEB, 0xBA, 0x08, 0xF7, 0x23,
+    0xAF, 0xA4, 0x0D, 0xD0, 0x00, 0x2F, 0x80, 0x0C, 0xB0, 0x00, 0x0F, 0x80, 0x07, 0xF6, 0x01, 0x9F,
+    0x30, 0x00, 0xAF, 0xFF, 0xD5, 0x00, 0x04, 0xE3, 0x32, 0x00, 0x00, 0x09, 0xF6, 0x32, 0x10, 0x00,
+    0x03, 0xEF, 0xFF, 0xFE, 0x80, 0x0A, 0xB3, 0x45, 0x6B, 0xF7, 0x5F, 0x30, 0x00, 0x01, 0xF9, 0x5F,
+    0x60, 0x00, 0x07, 0xF4, 0x0A, 0xFD, 0xAB, 0xDE, 0x70, 0x00, 0x37, 0x99, 0x62, 0x00, 0x6B, 0x30,
+    0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00,
+    0x00, 0x00, 0x8F, 0x40, 0x14, 0x20, 0x00, 0x8F, 0x5B, 0xFF, 0xF9, 0x00, 0x8F, 0xE9, 0x43, 0xBF,
+    0x60, 0x8F, 0x60, 0x00, 0x3F, 0xB0, 0x8F, 0x40, 0x00, 0x0E, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0,
+    0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F,
+    0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x28, 0x30, 0x9F, 0xC0, 0x5D, 0x70, 0x00,
+    0x00, 0x12, 0x10, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F,
+    0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x00, 0x28, 0x30, 0x00, 0x9F, 0xC0, 0x00, 0x5D, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00,
+    0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F,
+    0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x8F, 0x50, 0x5C, 0xFD, 0x10, 0x49, 0x71, 0x00,
+    0x5B, 0x30, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F,
+    0x50, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x02, 0x20, 0x7F, 0x50, 0x00, 0xAF, 0x50, 0x7F, 0x50,
+    0x09, 0xF6, 0x00, 0x7F, 0x50, 0x8F, 0x70, 0x00, 0x7F, 0x57, 0xF7, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
+    0x00, 0x00, 0x7F, 0x68, 0xF9, 0x00, 0x00, 0x7F, 0x50, 0xAF, 0x60, 0x00, 0x7F, 0x50, 0x1C, 0xF3,
+    0x00, 0x7F, 0x50, 0x02, 0xED, 0x10, 0x7F, 0x50, 0x00, 0x4E, 0xB0, 0x4B, 0x50, 0x5F, 0x70, 0x5F,
+    0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F,
+    0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x11, 0x00, 0x22, 0x00, 0x01, 0x42, 0x00,
+    0x00, 0x8E, 0x3D, 0xFF, 0xB0, 0x7E, 0xFF, 0xC2, 0x00, 0x8F, 0xE7, 0x38, 0xF9, 0xE5, 0x39, 0xFB,
+    0x00, 0x8F, 0x50, 0x00, 0xDF, 0x60, 0x00, 0xDF, 0x10, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0xAF,
+    0x30, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F, 0x30, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F,
+    0x30, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F, 0x30, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F,
+    0x30, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F, 0x30, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F,
+    0x30, 0x11, 0x00, 0x14, 0x20, 0x00, 0x8E, 0x2B, 0xFF, 0xF9, 0x00, 0x8F, 0xE9, 0x43, 0xBF, 0x60,
+    0x8F, 0x60, 0x00, 0x3F, 0xB0, 0x8F, 0x40, 0x00, 0x0E, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F,
+    0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40,
+    0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x00, 0x3C,
+    0xFF, 0xFD, 0x40, 0x00, 0x03, 0xFD, 0x52, 0x4C, 0xF4, 0x00, 0x0C, 0xF2, 0x00, 0x01, 0xED, 0x00,
+    0x1F, 0xB0, 0x00, 0x00, 0xAF, 0x20, 0x3F, 0x90, 0x00, 0x00, 0x8F, 0x50, 0x3F, 0x90, 0x00, 0x00,
+    0x8F, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0xAF, 0x20, 0x0A, 0xF3, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xEE,
+    0x74, 0x7E, 0xF3, 0x00, 0x00, 0x2A, 0xEF, 0xEB, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x14, 0x20, 0x00, 0x8E, 0x1A, 0xFF, 0xFA, 0x10, 0x8F, 0xD9, 0x43, 0xAF, 0x90, 0x8F,
+    0x70, 0x00, 0x0D, 0xE1, 0x8F, 0x40, 0x00, 0x09, 0xF3, 0x8F, 0x40, 0x00, 0x07, 0xF5, 0x8F, 0x40,
+    0x00, 0x08, 0xF4, 0x8F, 0x40, 0x00, 0x0A, 0xF2, 0x8F, 0x50, 0x00, 0x2F, 0xC0, 0x8F, 0xF8, 0x46,
+    0xEF, 0x40, 0x8F, 0x6C, 0xFF, 0xC4, 0x00, 0x8F, 0x40, 0x11, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00,
+    0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x36, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x10, 0x11,
+    0x00, 0x4E, 0xFF, 0xE6, 0xDA, 0x04, 0xFD, 0x42, 0x5D, 0xFA, 0x0C, 0xF2, 0x00, 0x03, 0xFA, 0x1F,
+    0xB0, 0x00, 0x02, 0xFA, 0x3F, 0x90, 0x00, 0x02, 0xFA, 0x3F, 0x90, 0x00, 0x02, 0xFA, 0x1F, 0xB0,
+    0x00, 0x02, 0xFA, 0x0D, 0xF2, 0x00, 0x07, 0xFA, 0x06, 0xFD, 0x66, 0xAD, 0xFA, 0x00, 0x6E, 0xFE,
+    0x92, 0xFA, 0x00, 0x00, 0x10, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x02,
+    0xFA, 0x00, 0x00, 0x00, 0x01, 0x64, 0x11, 0x00, 0x14, 0x10, 0x8F, 0x1A, 0xFF, 0x80, 0x8F, 0x9D,
+    0x88, 0x30, 0x8F, 0xD1, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40,
+    0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40,
+    0x00, 0x00, 0x00, 0x02, 0x42, 0x00, 0x02, 0xCF, 0xFF, 0xC3, 0x0C, 0xE4, 0x13, 0x94, 0x1F, 0xA0,
+    0x00, 0x00, 0x0E, 0xE6, 0x00, 0x00, 0x04, 0xEF, 0xE9, 0x30, 0x00, 0x16, 0xBF, 0xF5, 0x00, 0x00,
+    0x03, 0xFB, 0x00, 0x00, 0x00, 0xEB, 0x2E, 0x83, 0x39, 0xF5, 0x07, 0xDF, 0xFE, 0x60, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0xCC,
+    0x00, 0x00, 0x7D, 0xFF, 0xEE, 0xA0, 0x25, 0xFD, 0x55, 0x40, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC,
+    0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xED,
+    0x00, 0x00, 0x00, 0xCF, 0x77, 0x70, 0x00, 0x4E, 0xFE, 0x80, 0x00, 0x00, 0x20, 0x00, 0x22, 0x00,
+    0x00, 0x02, 0x10, 0xCF, 0x00, 0x00, 0x2F, 0xA0, 0xCF, 0x00, 0x00, 0x2F, 0xA0, 0xCF, 0x00, 0x00,
+    0x2F, 0xA0, 0xCF, 0x00, 0x00, 0x2F, 0xA0, 0xCF, 0x00, 0x00, 0x2F, 0xA0, 0xCF, 0x00, 0x00, 0x2F,
+    0xA0, 0xBF, 0x10, 0x00, 0x2F, 0xA0, 0x9F, 0x50, 0x00, 0x6F, 0xA0, 0x4F, 0xD6, 0x5A, 0xDF, 0xA0,
+    0x06, 0xEF, 0xEA, 0x1C, 0xA0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x8F, 0x40, 0x00, 0x01, 0xEC, 0x00, 0x2F, 0xA0, 0x00, 0x06, 0xF6, 0x00, 0x0B, 0xF1, 0x00, 0x0C,
+    0xE1, 0x00, 0x05, 0xF7, 0x00, 0x3F, 0x90, 0x00, 0x00, 0xED, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x8F,
+    0x41, 0xEB, 0x00, 0x00, 0x00, 0x2F, 0xA5, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xEB, 0xE0, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x21, 0x00, 0x00, 0x02,
+    0x10, 0x00, 0x01, 0x20, 0xAF, 0x20, 0x00, 0x4F, 0xA0, 0x00, 0x0B, 0xE1, 0x5F, 0x70, 0x00, 0x9F,
+    0xF1, 0x00, 0x1F, 0xA0, 0x1E, 0xB0, 0x00, 0xEA, 0xF5, 0x00, 0x5F, 0x50, 0x0A, 0xF1, 0x04, 0xF3,
+    0xDA, 0x00, 0xAE, 0x10, 0x05, 0xF5, 0x09, 0xD0, 0x8E, 0x00, 0xEA, 0x00, 0x01, 0xFA, 0x0D, 0x80,
+    0x3F, 0x44, 0xF6, 0x00, 0x00, 0xBE, 0x4F, 0x30, 0x0D, 0x99, 0xF1, 0x00, 0x00, 0x6F, 0xBD, 0x00,
+    0x08, 0xDC, 0xB0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x04, 0xFF, 0x60, 0x00, 0x00, 0x0B, 0xF3, 0x00,
+    0x00, 0xDF, 0x10, 0x00, 0x12, 0x10, 0x00, 0x00, 0x21, 0x3F, 0xD0, 0x00, 0x0A, 0xF3, 0x07, 0xF8,
+    0x00, 0x5F, 0x70, 0x00, 0xBF, 0x32, 0xEC, 0x00, 0x00, 0x2E, 0xCA, 0xE2, 0x00, 0x00, 0x06, 0xFF,
+    0x70, 0x00, 0x00, 0x0A, 0xFF, 0xB0, 0x00, 0x00, 0x5F, 0x87, 0xF6, 0x00, 0x01, 0xEC, 0x00, 0xCE,
+    0x20, 0x0A, 0xF3, 0x00, 0x3F, 0xB0, 0x6F, 0x70, 0x00, 0x08, 0xF7, 0x22, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x9F, 0x50, 0x00, 0x01, 0xEC, 0x00, 0x2F, 0xB0, 0x00, 0x06, 0xF6, 0x00, 0x0B, 0xF3, 0x00,
+    0x0C, 0xE0, 0x00, 0x04, 0xF9, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xCE, 0x10, 0x9F, 0x20, 0x00, 0x00,
+    0x6F, 0x71, 0xEA, 0x00, 0x00, 0x00, 0x1E, 0xD7, 0xF3, 0x00, 0x00, 0x00, 0x08, 0xFE, 0xC0, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x36, 0x20, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x10, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x04,
+    0x44, 0x44, 0xDE, 0x20, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x01,
+    0xDD, 0x10, 0x00, 0x00, 0x0B, 0xE3, 0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x03, 0xF9, 0x00,
+    0x00, 0x00, 0x1D, 0xF7, 0x66, 0x66, 0x20, 0x4F, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x02, 0x51, 0x00,
+    0xAF, 0xD1, 0x06, 0xF6, 0x00, 0x0A, 0xE0, 0x00, 0x0A, 0xE0, 0x00, 0x08, 0xF1, 0x00, 0x05, 0xF3,
+    0x00, 0x03, 0xF4, 0x00, 0x07, 0xF2, 0x00, 0x7F, 0x60, 0x00, 0x4C, 0xC0, 0x00, 0x04, 0xF4, 0x00,
+    0x04, 0xF4, 0x00, 0x06, 0xF2, 0x00, 0x09, 0xE0, 0x00, 0x0A, 0xD0, 0x00, 0x09, 0xF1, 0x00, 0x03,
+    0xFB, 0x50, 0x00, 0x4B, 0xD2, 0x33, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x54, 0x15, 0x20, 0x00, 0x1D, 0xFA, 0x00, 0x00,
+    0x6F, 0x60, 0x00, 0x0E, 0xA0, 0x00, 0x0E, 0xA0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x50, 0x00, 0x4F,
+    0x30, 0x00, 0x2F, 0x70, 0x00, 0x06, 0xF7, 0x00, 0x0C, 0xC4, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40,
+    0x00, 0x2F, 0x60, 0x00, 0x0E, 0x90, 0x00, 0x0D, 0xA0, 0x00, 0x1F, 0x90, 0x05, 0xBF, 0x30, 0x2D,
+    0xB4, 0x00, 0x00, 0x21, 0x00, 0x01, 0xA4, 0x1C, 0xFF, 0xC6, 0x39, 0xF3, 0x8F, 0x86, 0xBF, 0xFF,
+    0x90, 0xAA, 0x00, 0x02, 0x53, 0x00, 0x00, 0x26, 0x62, 0x00, 0x05, 0xFC, 0xCE, 0x40, 0x1E, 0x70,
+    0x08, 0xE0, 0x4F, 0x00, 0x02, 0xF2, 0x2F, 0x30, 0x04, 0xF1, 0x0A, 0xD6, 0x6D, 0x90, 0x01, 0x8D,
+    0xC7, 0x00,
+};
+
+static const GlyphData font_label_glyphs[96] PROGMEM = {
+    // code, w, h, dx, dy, advance, offset
+    { 0x20,  0,  0,   0,   0,  4,     0 },  // space
+    { 0x21,  3, 16,   2,  15,  7,     0 },  // !
+    { 0x22,  6,  6,   1,  15,  8,    32 },  // "
+    { 0x23, 12, 15,   0,  15, 12,    50 },  // #
+    { 0x24, 10, 20,   1,  17, 12,   140 },  // $
+    { 0x25, 15, 16,   0,  15, 16,   240 },  // %
+    { 0x26, 14, 16,   0,  15, 14,   368 },  // &
+    { 0x27,  3,  6,   1,  15,  5,   480 },  // '
+    { 0x28,  5, 19,   1,  16,  6,   492 },  // (
+    { 0x29,  5, 19,   0,  16,  6,   549 },  // )
+    { 0x2A,  7,  8,   0,  16,  8,   606 },  // *
+    { 0x2B, 10, 11,   1,  12, 12,   638 },  // +
+    { 0x2C,  4,  6,   0,   3,  4,   693 },  // ,
+    { 0x2D,  5,  2,   1,   7,  7,   705 },  // -
+    { 0x2E,  4,  4,   0,   3,  4,   711 },  // .
+    { 0x2F,  9, 16,  -1,  15,  7,   719 },  // /
+    { 0x30, 11, 16,   0,  15, 12,   799 },  // 0
+    { 0x31,  9, 15,   2,  15, 12,   895 },  // 1
+    { 0x32, 10, 15,   1,  15, 12,   970 },  // 2
+    { 0x33, 10, 16,   1,  15, 12,  1045 },  // 3
+    { 0x34, 12, 15,   0,  15, 12,  1125 },  // 4
+    { 0x35, 10, 16,   1,  15, 12,  1215 },  // 5
+    { 0x36, 10, 16,   1,  15, 12,  1295 },  // 6
+    { 0x37, 10, 15,   1,  15, 12,  1375 },  // 7
+    { 0x38, 11, 16,   0,  15, 12,  1450 },  // 8
+    { 0x39, 10, 15,   1,  15, 12,  1546 },  // 9
+    { 0x3A,  3, 11,   1,  10,  5,  1621 },  // :
+    { 0x3B,  3, 13,   1,  10,  5,  1643 },  // ;
+    { 0x3C,  9, 10,   1,  12, 12,  1669 },  // <
+    { 0x3D, 10,  6,   1,  10, 12,  1719 },  // =
+    { 0x3E,  9, 10,   2,  12, 12,  1749 },  // >
+    { 0x3F,  8, 16,   0,  15,  8,  1799 },  // ?
+    { 0x40, 16, 17,   0,  14, 16,  1863 },  // @
+    { 0x41, 14, 15,   0,  15, 14,  1999 },  // A
+    { 0x42, 11, 15,   1,  15, 13,  2104 },  // B
+    { 0x43, 13, 16,   0,  15, 14,  2194 },  // C
+    { 0x44, 14, 15,   1,  15, 15,  2306 },  // D
+    { 0x45, 10, 15,   1,  15, 12,  2411 },  // E
+    { 0x46, 10, 15,   1,  15, 11,  2486 },  // F
+    { 0x47, 14, 16,   0,  15, 15,  2561 },  // G
+    { 0x48, 13, 15,   1,  15, 15,  2673 },  // H
+    { 0x49,  3, 15,   2,  15,  6,  2778 },  // I
+    { 0x4A,  8, 16,   0,  15,  9,  2808 },  // J
+    { 0x4B, 13, 15,   1,  15, 14,  2872 },  // K
+    { 0x4C,  9, 15,   1,  15, 10,  2977 },  // L
+    { 0x4D, 16, 15,   1,  15, 18,  3052 },  // M
+    { 0x4E, 13, 15,   1,  15, 15,  3172 },  // N
+    { 0x4F, 16, 16,   0,  15, 16,  3277 },  // O
+    { 0x50, 11, 15,   1,  15, 12,  3405 },  // P
+    { 0x51, 16, 18,   0,  15, 16,  3495 },  // Q
+    { 0x52, 12, 15,   1,  15, 13,  3639 },  // R
+    { 0x53, 10, 16,   0,  15, 11,  3729 },  // S
+    { 0x54, 12, 15,   0,  15, 12,  3809 },  // T
+    { 0x55, 13, 16,   1,  15, 15,  3899 },  // U
+    { 0x56, 14, 15,   0,  15, 14,  4011 },  // V
+    { 0x57, 21, 15,   0,  15, 20,  4116 },  // W
+    { 0x58, 13, 15,   0,  15, 13,  4281 },  // X
+    { 0x59, 13, 15,   0,  15, 13,  4386 },  // Y
+    { 0x5A, 12, 15,   0,  15, 12,  4491 },  // Z
+    { 0x5B,  5, 19,   1,  16,  6,  4581 },  // [
+    { 0x5C,  9, 16,  -1,  15,  8,  4638 },  // backslash
+    { 0x5D,  5, 19,   0,  16,  6,  4718 },  // ]
+    { 0x5E,  9,  8,   1,  15, 12,  4775 },  // ^
+    { 0x5F,  8,  2,   0,  -1,  8,  4815 },  // _
+    { 0x60,  5,  4,   0,  15,  6,  4823 },  // `
+    { 0x61,  9, 12,   0,  11, 10,  4835 },  // a
+    { 0x62, 10, 16,   1,  15, 11,  4895 },  // b
+    { 0x63,  9, 12,   0,  11,  9,  4975 },  // c
+    { 0x64, 10, 16,   0,  15, 11,  5035 },  // d
+    { 0x65, 10, 12,   0,  11, 10,  5115 },  // e
+    { 0x66,  7, 15,   0,  15,  7,  5175 },  // f
+    { 0x67, 10, 15,   0,  11, 10,  5235 },  // g
+    { 0x68,  9, 15,   1,  15, 11,  5310 },  // h
+    { 0x69,  3, 15,   1,  15,  5,  5385 },  // i
+    { 0x6A,  5, 19,  -1,  15,  5,  5415 },  // j
+    { 0x6B, 10, 15,   1,  15, 10,  5472 },  // k
+    { 0x6C,  3, 15,   1,  15,  5,  5547 },  // l
+    { 0x6D, 15, 11,   1,  11, 16,  5577 },  // m
+    { 0x6E,  9, 11,   1,  11, 11,  5665 },  // n
+    { 0x6F, 11, 12,   0,  11, 11,  5720 },  // o
+    { 0x70, 10, 15,   1,  11, 11,  5792 },  // p
+    { 0x71, 10, 15,   0,  11, 11,  5867 },  // q
+    { 0x72,  7, 11,   1,  11,  8,  5942 },  // r
+    { 0x73,  8, 12,   0,  11,  9,  5986 },  // s
+    { 0x74,  7, 15,   0,  14,  7,  6034 },  // t
+    { 0x75,  9, 12,   1,  11, 11,  6094 },  // u
+    { 0x76, 11, 11,   0,  11, 10,  6154 },  // v
+    { 0x77, 16, 11,   0,  11, 15,  6220 },  // w
+    { 0x78, 10, 11,   0,  11, 10,  6308 },  // x
+    { 0x79, 11, 15,   0,  11, 10,  6363 },  // y
+    { 0x7A,  9, 11,   0,  11,  9,  6453 },  // z
+    { 0x7B,  6, 19,   0,  16,  6,  6508 },  // {
+    { 0x7C,  2, 20,   2,  16,  6,  6565 },  // |
+    { 0x7D,  6, 19,   0,  16,  6,  6585 },  // }
+    { 0x7E, 10,  4,   1,   8, 12,  6642 },  // ~
+    { 0xB0,  8,  7,   0,  15,  8,  6662 },  // °
+};
+
+static const GlyphFont font_label = { font_label_glyphs, 96, font_label_bits, 20, 5 };
+
+#endif // FONT_LABEL_H
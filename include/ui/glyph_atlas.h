@@ -0,0 +1,46 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include "globals_and_includes.h"
+
+// Anti-aliased text from fonts compiled into the firmware, without per-draw font decoding.
+// tools/vlw_font.py renders each font into a header (include/ui/font_*.h) holding its glyph table and
+// alpha maps quantized to 16 levels (4 bpp). Both stay in flash. Drawing blits each glyph with a
+// 16-entry palette that is pre-blended from the background to the text color, index 0 transparent,
+// so text looks smooth on the background it was blended for (black unless given) and costs one
+// pushImage per glyph.
+//
+// To change a font, regenerate its header with the command at its top and rebuild.
+
+enum class UiFont : uint8_t {
+    Label,      // 20 px, printable ASCII and °: dial letters, menu captions
+    Heading,    // 28 px, digits and °: heading value
+    Count
+};
+
+// ---- Font data, as generated by tools/vlw_font.py ----
+struct GlyphData {
+    uint16_t code;
+    uint8_t w, h;
+    int8_t dx;            // left extent
+    int8_t dy;            // top extent above the baseline
+    uint8_t advance;
+    uint16_t offset;      // into bits, rows padded to whole bytes (2 px)
+};
+
+struct GlyphFont {
+    const GlyphData *glyphs;  // sorted by code
+    uint16_t count;
+    const uint8_t *bits;      // 4-bit alpha, high nibble first
+    int16_t ascent, descent;
+};
+
+/**
+ * @brief Draws UTF-8 text with the font's atlas, like drawString with the given datum.
+ * Characters not in the atlas are skipped.
+ * @param bg Background the anti-aliasing is blended against.
+ */
+void drawTextSmooth(M5Canvas &canvas, UiFont font, const char *text, int x, int y, uint8_t datum,
+                    uint16_t fg, uint16_t bg = TFT_BLACK);
+
+#endif // GLYPH_ATLAS_H
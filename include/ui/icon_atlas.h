@@ -0,0 +1,23 @@
+#ifndef ICON_ATLAS_H
+#define ICON_ATLAS_H
+
+#include "globals_and_includes.h"
+
+// Decoded icon cache.
+// Palettized icons (ICON_ENC_PAL8_RLE) are expanded once, on first draw, to 8-bit palette
+// indices in RAM (w*h bytes each) and blitted with the palette, palette index 0 transparent.
+// The dimmed variant is a second, darkened palette over the same indices, so it costs
+// 2 bytes per palette entry instead of a second image.
+
+/**
+ * @brief Draws an icon centered on (centerX, centerY).
+ * @param dimmed Darkened colors (unselected menu items); 1-bit icons use a grey color instead.
+ */
+void drawIcon(M5Canvas &canvas, const tImage *icon, int centerX, int centerY, bool dimmed);
+
+/**
+ * @brief RAM held by decoded icons, in bytes.
+ */
+size_t iconAtlasBytes();
+
+#endif // ICON_ATLAS_H
@@ -3,12 +3,19 @@
 
 #include <stdint.h>
 
+// How tImage::data is stored
+enum : uint8_t {
+    ICON_ENC_RAW = 0,       // uncompressed: 1bpp XBM or 16bpp byte-swapped RGB565, per depth
+    ICON_ENC_PAL8_RLE = 1,  // palettized + run-length encoded (tools/icon_converter.py), 16bpp output
+};
+
 // Structure for 16-bit color images
 typedef struct {
     void *data;          // Changed from uint16_t* to void*
     uint16_t width;
     uint16_t height;
     uint8_t depth;
+    uint8_t encoding;    // ICON_ENC_*; draw encoded icons through ui/icon_atlas.h
 } tImage;
 
 
@@ -19,6 +26,8 @@ extern const tImage icon_compass;
 extern const tImage icon_target;
 extern const tImage icon_gps;
 extern const tImage icon_bluetooth;
+extern const tImage icon_backtrack;
+extern const tImage icon_diagnostics;
 
 
 #endif // ICONS_H
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef NOTIFICATIONS_H
+#define NOTIFICATIONS_H
+
+#include "globals_and_includes.h"
+
+// Popup notifications, queued and composited over the page.
+// Notifications are queued by priority (FIFO within one priority) and shown one at a time. A
+// higher priority cuts the current one short. Waiting ones of the same priority shorten it to
+// NOTIFY_MIN_SHOW_MS, so back-to-back events (BLE connect/disconnect) are each seen instead of
+// overwriting each other. Each one is rasterized once into a 2-bit overlay bitmap (transparent
+// corners, box, border, text) and blitted over the page after it renders. The overlay area is
+// only invalidated while it pops in or out and when it is replaced or hidden.
+// Safe to post from other tasks (BLE callbacks); rendering happens on the main loop.
+
+#define NOTIFY_QUEUE_LEN     6
+#define NOTIFY_MAX_LEN       39      // longer messages are cut
+#define NOTIFY_MAX_W         232     // box width limit, multiple of 4 (2-bit rows)
+#define NOTIFY_H             50
+#define NOTIFY_MIN_SHOW_MS   900     // shown at least this long when others are waiting
+
+enum class NotifyPriority : uint8_t {
+    Low,      // hints ("Loading...")
+    Normal,   // state changes (BLE connected, track events)
+    High,     // errors and power state; preempts the others
+};
+
+/**
+ * @brief Queues a popup notification.
+ * @param message Text shown in the popup (copied).
+ * @param durationMs How long it stays up once shown, pop-in and pop-out included.
+ * @param color Text color.
+ * @param bgColor Box color.
+ * @param priority Order in the queue; a higher priority replaces the popup on screen.
+ */
+void showPopupNotification(const char* message, uint32_t durationMs = 2000, uint16_t color = TFT_WHITE,
+                           uint16_t bgColor = TFT_BLUE, NotifyPriority priority = NotifyPriority::Normal);
+
+/**
+ * @brief Advances the popup on screen (timeouts, next in queue, pop animation) and invalidates its
+ * area when it changes. Called by pageStackService() before deciding whether to render.
+ */
+void notifyService();
+
+/**
+ * @brief Composites the current popup onto the canvas. Called after the page rendered.
+ */
+void drawNotification(M5Canvas& canvas);
+
+/**
+ * @brief True while a popup is on screen or waiting.
+ */
+bool notifyPending();
+
+#endif // NOTIFICATIONS_H
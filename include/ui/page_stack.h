@@ -0,0 +1,75 @@
+#ifndef PAGE_STACK_H
+#define PAGE_STACK_H
+
+#include "globals_and_includes.h"
+#include "frame_governor.h"
+
+// Retained-mode page navigation.
+// Each screen is a Page with hooks; the main loop calls pageStackService(), which updates the page on
+// top of the stack and redraws only when something was invalidated. Only the dirty region is
+// rendered (canvas clip) and pushed to the display, so an idle static page costs one update() call.
+
+#define PAGE_STACK_DEPTH 4
+
+// Region of the screen that needs to be redrawn (empty when w or h is 0)
+struct DirtyRect {
+    int16_t x = 0, y = 0, w = 0, h = 0;
+
+    bool empty() const { return w <= 0 || h <= 0; }
+    void add(int rx, int ry, int rw, int rh);   // grow to the bounding box of both
+    void clear() { x = y = w = h = 0; }
+};
+
+struct Page {
+    const char *name;
+    void (*onEnter)();                   // pushed (optional)
+    void (*onExit)();                    // popped (optional)
+    void (*update)(uint32_t dtMs);       // input and state; call pageInvalidate*() for visible changes
+    void (*render)(M5Canvas &canvas, const DirtyRect &dirty); // canvas is clipped to dirty
+    uint16_t refreshMs;                  // live data: redraw at least this often (0: only when invalidated)
+};
+
+/**
+ * @brief Sets the root page (bottom of the stack, never popped) and enters it.
+ */
+void pageStackInit(const Page *root);
+
+/**
+ * @brief Pushes a page on top; it is entered and drawn on the next service.
+ */
+void pagePush(const Page *page);
+
+/**
+ * @brief Leaves the top page and returns to the one below it (no-op on the root page).
+ */
+void pagePop();
+
+/**
+ * @brief Pops every page above the root.
+ */
+void pagePopToRoot();
+
+/**
+ * @brief Page currently on top of the stack.
+ */
+const Page *pageCurrent();
+
+/**
+ * @brief Marks the whole screen for redraw.
+ */
+void pageInvalidate();
+
+/**
+ * @brief Marks part of the screen for redraw.
+ */
+void pageInvalidateRect(int x, int y, int w, int h);
+
+/**
+ * @brief One loop iteration: update the top page, then render and push what was invalidated
+ * (page transition and popup overlays included).
+ * @return Whether a frame was pushed, and if so whether only the periodic refresh asked for it
+ * (the frame governor treats that as still).
+ */
+FrameResult pageStackService();
+
+#endif // PAGE_STACK_H
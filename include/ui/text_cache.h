@@ -0,0 +1,34 @@
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include "globals_and_includes.h"
+
+// Rendered-label cache.
+// A label is rasterized once into a 1-bit bitmap (keyed by text, font, size and colors) in a fixed
+// arena and afterwards blitted with a two-color palette, so labels that do not change (menu names,
+// setting lines, compass letters, target name) cost a pushImage instead of glyph rendering, and
+// nothing is allocated per frame. Texts longer than TEXT_CACHE_MAX_LEN are drawn directly.
+
+#define TEXT_CACHE_ENTRIES  24
+#define TEXT_CACHE_BYTES    6144   // bitmap arena; cleared as a whole when full
+#define TEXT_CACHE_MAX_LEN  31
+#define TEXT_TRANSPARENT    -1     // bg: only the glyphs are drawn
+
+/**
+ * @brief Draws text like canvas.drawString() with the given datum, size and colors, using the
+ * canvas' current font.
+ * @param bg Background color behind the text, or TEXT_TRANSPARENT.
+ */
+void drawTextCached(M5Canvas &canvas, const char *text, int x, int y, uint8_t datum, float size,
+                    uint16_t fg, int32_t bg = TEXT_TRANSPARENT);
+
+struct TextCacheStats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t resets;      // arena full, everything dropped
+    size_t bytesUsed;
+};
+
+TextCacheStats textCacheStats();
+
+#endif // TEXT_CACHE_H
@@ -0,0 +1,100 @@
+#include "async.h"
+#include <Arduino.h>
+#include <string.h>
+#include "log.h"
+
+struct AsyncTask {
+    const char *name;
+    AsyncStepFn step;
+    void (*oneShot)();
+    uint32_t dueMs;
+    uint8_t nextStep;
+    uint8_t generation;  // part of the id, so a stale id does not cancel a reused slot
+    bool active;
+};
+
+static AsyncTask g_tasks[ASYNC_MAX_TASKS];
+
+// Id = slot (3 bits) + generation (5 bits), never 0
+static AsyncId makeId(int slot) {
+    return (AsyncId)(((g_tasks[slot].generation & 0x1F) << 3) | slot) + 1;
+}
+
+static AsyncTask *taskFor(AsyncId id) {
+    if (!id) return nullptr;
+    int raw = id - 1;
+    int slot = raw & 7;
+    if (slot >= ASYNC_MAX_TASKS) return nullptr;
+    AsyncTask &t = g_tasks[slot];
+    if (!t.active || (t.generation & 0x1F) != (raw >> 3)) return nullptr;
+    return &t;
+}
+
+static AsyncId start(const char *name, AsyncStepFn fn, void (*oneShot)(), uint32_t delayMs) {
+    for (int i = 0; i < ASYNC_MAX_TASKS; i++) {
+        if (g_tasks[i].active && strcmp(g_tasks[i].name, name) == 0) return makeId(i);
+    }
+    for (int i = 0; i < ASYNC_MAX_TASKS; i++) {
+        AsyncTask &t = g_tasks[i];
+        if (t.active) continue;
+        t.name = name;
+        t.step = fn;
+        t.oneShot = oneShot;
+        t.dueMs = millis() + delayMs;
+        t.nextStep = 0;
+        t.generation++;
+        t.active = true;
+        return makeId(i);
+    }
+    LOGW("async", "no free slot for '%s'", name);
+    return 0;
+}
+
+AsyncId asyncRun(const char *name, AsyncStepFn fn, uint32_t delayMs) {
+    return start(name, fn, nullptr, delayMs);
+}
+
+AsyncId asyncAfter(const char *name, uint32_t delayMs, void (*fn)()) {
+    return start(name, nullptr, fn, delayMs);
+}
+
+void asyncCancel(AsyncId id) {
+    AsyncTask *t = taskFor(id);
+    if (t) t->active = false;
+}
+
+bool asyncRunning(AsyncId id) {
+    return taskFor(id) != nullptr;
+}
+
+void asyncService() {
+    uint32_t now = millis();
+    for (int i = 0; i < ASYNC_MAX_TASKS; i++) {
+        AsyncTask &t = g_tasks[i];
+        if (!t.active || (int32_t)(now - t.dueMs) < 0) continue;
+        if (t.oneShot) {
+            t.active = false; // before the call, so fn may schedule itself again
+            t.oneShot();
+            continue;
+        }
+        uint32_t wait = t.step(t.nextStep++);
+        if (wait == ASYNC_DONE) {
+            t.active = false;
+        } else {
+            t.dueMs = millis() + wait;
+        }
+    }
+}
+
+uint32_t asyncMsUntilNext() {
+    uint32_t now = millis();
+    uint32_t next = UINT32_MAX;
+    for (int i = 0; i < ASYNC_MAX_TASKS; i++) {
+        const AsyncTask &t = g_tasks[i];
+        if (!t.active) continue;
+        int32_t left = (int32_t)(t.dueMs - now);
+        uint32_t ms = left > 0 ? (uint32_t)left : 0;
+        if (ms < next) next = ms;
+    }
+    return next;
+}
@@ -0,0 +1,147 @@
+// Bluedroid backend: Arduino-ESP32 BLEDevice/BLEServer classes (default build)
+#if !defined(SUPERCOMPASS_USE_NIMBLE) && !defined(SUPERCOMPASS_BLE_LOOPBACK)
+
+#include "ble_backend.h"
+#include "log.h"
+#include <Arduino.h>
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <BLEUtils.h>
+#include <BLE2902.h>
+#include <esp_gap_ble_api.h>
+
+static BLEServer *g_pServer = nullptr;
+static BLECharacteristic *g_chars[(size_t)BleChar::Count] = {};
+static BLE2902 *g_cccds[(size_t)BleChar::Count] = {};
+
+// Peer captured from the GATT connect event (needed for connection parameter updates)
+static bool g_havePeer = false;
+static esp_bd_addr_t g_peerAddr;
+static uint16_t g_connId = 0;
+
+class ServerCallbacks: public BLEServerCallbacks {
+    // Overload with GATT params gives us the peer address needed for connection parameter updates
+    void onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t *param) override {
+        memcpy(g_peerAddr, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+        g_connId = param->connect.conn_id;
+        g_havePeer = true;
+        bleOnConnect();
+    }
+
+    void onDisconnect(BLEServer* pServer) override {
+        g_havePeer = false;
+        bleOnDisconnect();
+    }
+};
+
+class CharCallbacks : public BLECharacteristicCallbacks {
+public:
+    explicit CharCallbacks(BleChar ch) : ch_(ch) {}
+
+    void onWrite(BLECharacteristic *pCharacteristic) override {
+        std::string value = pCharacteristic->getValue();
+        bleOnWrite(ch_, reinterpret_cast<const uint8_t*>(value.data()), value.length());
+    }
+
+    void onRead(BLECharacteristic *pCharacteristic) override {
+        bleOnRead(ch_);
+    }
+
+private:
+    BleChar ch_;
+};
+
+// GAP events: log what the central actually granted
+static void gapHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param){
+    if(event == ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT){
+        LOGI("ble", "conn params granted: status=%d interval=%u x1.25ms latency=%u timeout=%u x10ms",
+            param->update_conn_params.status, param->update_conn_params.conn_int,
+            param->update_conn_params.latency, param->update_conn_params.timeout);
+    }
+}
+
+static void addChar(BLEService *service, BleChar ch, const char *uuid, uint32_t props){
+    BLECharacteristic *c = service->createCharacteristic(uuid, props);
+    if(props & (BLECharacteristic::PROPERTY_NOTIFY | BLECharacteristic::PROPERTY_INDICATE)){
+        BLE2902 *cccd = new BLE2902();
+        c->addDescriptor(cccd);
+        g_cccds[(size_t)ch] = cccd;
+    }
+    c->setCallbacks(new CharCallbacks(ch));
+    g_chars[(size_t)ch] = c;
+}
+
+void bleBackendInit(const char *deviceName){
+    BLEDevice::init(deviceName);
+    BLEDevice::setCustomGapHandler(gapHandler);
+    // Original Bluedroid stack auto-negotiates MTU with most phones.
+    // BLEDevice::setMTU(185);
+    g_pServer = BLEDevice::createServer();
+    g_pServer->setCallbacks(new ServerCallbacks());
+    BLEService *pService = g_pServer->createService(SERVICE_UUID);
+
+    const uint32_t R = BLECharacteristic::PROPERTY_READ;
+    const uint32_t W = BLECharacteristic::PROPERTY_WRITE;
+    const uint32_t N = BLECharacteristic::PROPERTY_NOTIFY;
+    addChar(pService, BleChar::Target, TARGET_CHAR_UUID, R | W | N);
+    addChar(pService, BleChar::Ready, READY_CHAR_UUID, R | N);
+    addChar(pService, BleChar::Telemetry, TELEMETRY_CHAR_UUID, R | W | N);
+    addChar(pService, BleChar::LocationsList, LOCATIONS_LIST_CHAR_UUID, R | N);
+    addChar(pService, BleChar::LocationsModify, LOCATIONS_MODIFY_CHAR_UUID, W);
+    addChar(pService, BleChar::CurrentPosition, CURRENT_POSITION_CHAR_UUID, W);
+
+    pService->start();
+}
+
+void bleBackendStartAdvertising(){
+    BLEAdvertising *pAdvertising = BLEDevice::getAdvertising();
+    pAdvertising->addServiceUUID(SERVICE_UUID);
+    pAdvertising->setScanResponse(false); // Advertise service UUID in the main packet
+    // Tune the peripheral preferred connection parameters (PPCP) to target ~30-50ms interval.
+    // Values are in units of 1.25ms. Common values used by ESP32 BLE stack:
+    // 0x06 (7.5ms), 0x12 (25ms), 0x18 (30ms), 0x28 (50ms), 0x30 (60ms).
+    // We expose a slightly wider range so the central (phone) can pick one within target band.
+    pAdvertising->setMinPreferred(0x18);  // 0x18 * 1.25ms = 30ms
+    pAdvertising->setMaxPreferred(0x28);  // 0x28 * 1.25ms = 50ms
+    BLEDevice::startAdvertising();
+}
+
+void bleBackendSetValue(BleChar ch, const uint8_t *data, size_t len){
+    BLECharacteristic *c = g_chars[(size_t)ch];
+    if(c) c->setValue(const_cast<uint8_t*>(data), len);
+}
+
+void bleBackendNotify(BleChar ch, const uint8_t *data, size_t len){
+    BLECharacteristic *c = g_chars[(size_t)ch];
+    if(!c) return;
+    c->setValue(const_cast<uint8_t*>(data), len);
+    c->notify();
+}
+
+bool bleBackendIsSubscribed(BleChar ch){
+    BLE2902 *cccd = g_cccds[(size_t)ch];
+    return g_havePeer && cccd && cccd->getNotifications();
+}
+
+void bleBackendDisconnect(){
+    if(!g_pServer) return;
+    if(g_havePeer){
+        g_pServer->disconnect(g_connId);
+    } else {
+        // Attempt generic disconnect. Some stacks ignore invalid IDs; try 0..3
+        for(int id=0; id<4; ++id){
+            g_pServer->disconnect(id);
+        }
+    }
+}
+
+void bleBackendRequestConnParams(uint16_t minInterval, uint16_t maxInterval, uint16_t latency, uint16_t timeout){
+    if(!g_pServer || !g_havePeer) return;
+    g_pServer->updateConnParams(g_peerAddr, minInterval, maxInterval, latency, timeout);
+}
+
+const char *bleBackendName(){
+    return "bluedroid";
+}
+
+#endif // !SUPERCOMPASS_USE_NIMBLE && !SUPERCOMPASS_BLE_LOOPBACK
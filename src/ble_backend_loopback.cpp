@@ -0,0 +1,130 @@
+// Loopback backend: no radio. A fake central lives in this file and drives the protocol layer
+// through the same callbacks the real stacks use (build with -DSUPERCOMPASS_BLE_LOOPBACK).
+// bleLoopbackRunScenarios() replays scripted traffic and prints throughput / queue / parse numbers.
+#ifdef SUPERCOMPASS_BLE_LOOPBACK
+
+#include "ble_backend.h"
+#include "bluetooth.h"
+#include "ble_scenarios.h"
+#include "page/saved_locations.h"
+
+// ---- Fake server state ----
+static bool g_connected = false;
+static bool g_subscribed = true;   // the fake central enables notifications on every NOTIFY char
+static uint32_t g_notifyCount[(size_t)BleChar::Count] = {};
+static uint32_t g_notifyBytes = 0;
+
+void bleBackendInit(const char *deviceName){
+    Serial.printf("BLE loopback backend '%s' (no radio)\n", deviceName);
+}
+
+void bleBackendStartAdvertising(){}
+
+void bleBackendSetValue(BleChar ch, const uint8_t *data, size_t len){}
+
+void bleBackendNotify(BleChar ch, const uint8_t *data, size_t len){
+    g_notifyCount[(size_t)ch]++;
+    g_notifyBytes += len;
+}
+
+bool bleBackendIsSubscribed(BleChar ch){
+    return g_connected && g_subscribed;
+}
+
+void bleBackendDisconnect(){
+    if(!g_connected) return;
+    g_connected = false;
+    bleOnDisconnect();
+}
+
+void bleBackendRequestConnParams(uint16_t minInterval, uint16_t maxInterval, uint16_t latency, uint16_t timeout){}
+
+const char *bleBackendName(){
+    return "loopback";
+}
+
+// ---- Fake central ----
+static void clientConnect(){
+    if(g_connected) return;
+    g_connected = true;
+    bleOnConnect();
+}
+
+static void clientWrite(BleChar ch, const uint8_t *data, size_t len){
+    bleOnWrite(ch, data, len);
+}
+
+// ---- Scenarios (ble_scenarios.cpp, shared with test/test_ble_protocol) ----
+static void runScenario(const BleScenario &sc){
+    clientConnect();
+    resetBleProtocolStats();
+    for(size_t c = 0; c < (size_t)BleChar::Count; ++c) g_notifyCount[c] = 0;
+    g_notifyBytes = 0;
+
+    uint32_t t0 = micros();
+    uint32_t loops = 0;
+    uint16_t sent = 0;
+    while(sent < sc.count){
+        for(uint8_t b = 0; b < sc.burst && sent < sc.count; ++b){
+            uint8_t buf[BLE_SCENARIO_MAX_WRITE];
+            BleChar ch;
+            size_t len = sc.build(sent++, millis(), ch, buf);
+            clientWrite(ch, buf, len);
+        }
+        checkBLEStatus();
+        loops++;
+    }
+    // Drain: stop once a pass produces no notification and processes nothing
+    uint32_t idlePasses = 0;
+    while(idlePasses < 20 && loops < 100000){
+        BleProtocolStats before = getBleProtocolStats();
+        checkBLEStatus();
+        loops++;
+        BleProtocolStats after = getBleProtocolStats();
+        bool progress = after.notifies != before.notifies || after.inboundProcessed != before.inboundProcessed;
+        idlePasses = progress ? 0 : idlePasses + 1;
+    }
+    uint32_t us = micros() - t0;
+
+    BleProtocolStats st = getBleProtocolStats();
+    float secs = us / 1e6f;
+    Serial.printf("[bench] %s\n", sc.name);
+    Serial.printf("[bench]   %u writes in %lu loop passes, %.1f ms\n", (unsigned)sent, (unsigned long)loops, us / 1000.0f);
+    Serial.printf("[bench]   processed %lu (%.0f msg/s), drops in %lu out %lu, parse errors %lu\n",
+        (unsigned long)st.inboundProcessed, secs > 0 ? st.inboundProcessed / secs : 0.0f,
+        (unsigned long)st.inboundDrops, (unsigned long)st.outboundDrops, (unsigned long)st.rxParseErrors);
+    Serial.printf("[bench]   queue high-water in %u/%u out %u/%u\n",
+        st.inboundHighWater, st.queueSize - 1, st.outboundHighWater, st.queueSize - 1);
+    Serial.printf("[bench]   json parse avg %lu us max %lu us (%lu parses)\n",
+        (unsigned long)(st.parseCount ? st.parseUsTotal / st.parseCount : 0), (unsigned long)st.parseUsMax,
+        (unsigned long)st.parseCount);
+    Serial.printf("[bench]   notifies %lu (%lu B): target %lu ready %lu list %lu telemetry %lu\n",
+        (unsigned long)st.notifies, (unsigned long)g_notifyBytes,
+        (unsigned long)g_notifyCount[(size_t)BleChar::Target], (unsigned long)g_notifyCount[(size_t)BleChar::Ready],
+        (unsigned long)g_notifyCount[(size_t)BleChar::LocationsList], (unsigned long)g_notifyCount[(size_t)BleChar::Telemetry]);
+}
+
+void bleLoopbackRunScenarios(){
+    // Scenarios change locations and target; put the user's data back afterwards
+    static LocationStore savedSnapshot; // static: too big for the loop task stack
+    savedSnapshot = savedLocations;
+    double targetLat = TARGET_LAT, targetLon = TARGET_LON;
+    String targetName = Setaddress;
+    bool hadTarget = targetIsSet;
+
+    Serial.println("[bench] BLE loopback scenarios starting");
+    for(size_t i = 0; i < BLE_SCENARIO_COUNT; ++i){
+        runScenario(BLE_SCENARIOS[i]);
+    }
+    bleBackendDisconnect();
+
+    savedLocations = savedSnapshot;
+    saveSavedLocations();
+    TARGET_LAT = targetLat; TARGET_LON = targetLon;
+    Setaddress = targetName;
+    targetIsSet = hadTarget;
+    publishTargetCharacteristic();
+    Serial.println("[bench] done, locations and target restored");
+}
+
+#endif // SUPERCOMPASS_BLE_LOOPBACK
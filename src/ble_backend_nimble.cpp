@@ -0,0 +1,122 @@
+// NimBLE backend: NimBLE-Arduino 1.4.x (build with -DSUPERCOMPASS_USE_NIMBLE)
+// Same GATT layout as the Bluedroid backend; see the heap/flash log in setupBLE() to compare.
+#if defined(SUPERCOMPASS_USE_NIMBLE) && !defined(SUPERCOMPASS_BLE_LOOPBACK)
+
+#include "ble_backend.h"
+#include "log.h"
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+
+static NimBLEServer *g_pServer = nullptr;
+static NimBLECharacteristic *g_chars[(size_t)BleChar::Count] = {};
+
+// Connection handle captured on connect (needed for parameter updates and disconnect)
+static bool g_havePeer = false;
+static uint16_t g_connHandle = 0;
+
+class ServerCallbacks : public NimBLEServerCallbacks {
+    void onConnect(NimBLEServer *pServer, ble_gap_conn_desc *desc) override {
+        g_connHandle = desc->conn_handle;
+        g_havePeer = true;
+        bleOnConnect();
+    }
+
+    void onDisconnect(NimBLEServer *pServer) override {
+        g_havePeer = false;
+        bleOnDisconnect();
+    }
+
+    // Log what the central actually granted
+    void onConnParamsUpdate(ble_gap_conn_desc *desc) override {
+        LOGI("ble", "conn params granted: interval=%u x1.25ms latency=%u timeout=%u x10ms",
+            desc->conn_itvl, desc->conn_latency, desc->supervision_timeout);
+    }
+};
+
+class CharCallbacks : public NimBLECharacteristicCallbacks {
+public:
+    explicit CharCallbacks(BleChar ch) : ch_(ch) {}
+
+    void onWrite(NimBLECharacteristic *pCharacteristic) override {
+        NimBLEAttValue value = pCharacteristic->getValue();
+        bleOnWrite(ch_, value.data(), value.length());
+    }
+
+    void onRead(NimBLECharacteristic *pCharacteristic) override {
+        bleOnRead(ch_);
+    }
+
+private:
+    BleChar ch_;
+};
+
+static void addChar(NimBLEService *service, BleChar ch, const char *uuid, uint32_t props){
+    // NimBLE creates the 0x2902 descriptor itself for NOTIFY/INDICATE characteristics
+    NimBLECharacteristic *c = service->createCharacteristic(uuid, props);
+    c->setCallbacks(new CharCallbacks(ch));
+    g_chars[(size_t)ch] = c;
+}
+
+void bleBackendInit(const char *deviceName){
+    NimBLEDevice::init(deviceName);
+    NimBLEDevice::setMTU(185);
+    g_pServer = NimBLEDevice::createServer();
+    g_pServer->setCallbacks(new ServerCallbacks());
+    NimBLEService *pService = g_pServer->createService(SERVICE_UUID);
+
+    const uint32_t R = NIMBLE_PROPERTY::READ;
+    const uint32_t W = NIMBLE_PROPERTY::WRITE;
+    const uint32_t N = NIMBLE_PROPERTY::NOTIFY;
+    addChar(pService, BleChar::Target, TARGET_CHAR_UUID, R | W | N);
+    addChar(pService, BleChar::Ready, READY_CHAR_UUID, R | N);
+    addChar(pService, BleChar::Telemetry, TELEMETRY_CHAR_UUID, R | W | N);
+    addChar(pService, BleChar::LocationsList, LOCATIONS_LIST_CHAR_UUID, R | N);
+    addChar(pService, BleChar::LocationsModify, LOCATIONS_MODIFY_CHAR_UUID, W);
+    addChar(pService, BleChar::CurrentPosition, CURRENT_POSITION_CHAR_UUID, W);
+
+    pService->start();
+}
+
+void bleBackendStartAdvertising(){
+    NimBLEAdvertising *pAdvertising = NimBLEDevice::getAdvertising();
+    pAdvertising->addServiceUUID(SERVICE_UUID);
+    pAdvertising->setScanResponse(false);
+    // Same preferred connection parameters as the Bluedroid backend (30-50 ms)
+    pAdvertising->setMinPreferred(0x18);
+    pAdvertising->setMaxPreferred(0x28);
+    NimBLEDevice::startAdvertising();
+}
+
+void bleBackendSetValue(BleChar ch, const uint8_t *data, size_t len){
+    NimBLECharacteristic *c = g_chars[(size_t)ch];
+    if(c) c->setValue(data, len);
+}
+
+void bleBackendNotify(BleChar ch, const uint8_t *data, size_t len){
+    NimBLECharacteristic *c = g_chars[(size_t)ch];
+    if(!c) return;
+    c->setValue(data, len);
+    c->notify();
+}
+
+bool bleBackendIsSubscribed(BleChar ch){
+    NimBLECharacteristic *c = g_chars[(size_t)ch];
+    return g_havePeer && c && c->getSubscribedCount() > 0;
+}
+
+void bleBackendDisconnect(){
+    if(g_pServer && g_havePeer){
+        g_pServer->disconnect(g_connHandle);
+    }
+}
+
+void bleBackendRequestConnParams(uint16_t minInterval, uint16_t maxInterval, uint16_t latency, uint16_t timeout){
+    if(!g_pServer || !g_havePeer) return;
+    g_pServer->updateConnParams(g_connHandle, minInterval, maxInterval, latency, timeout);
+}
+
+const char *bleBackendName(){
+    return "nimble";
+}
+
+#endif // SUPERCOMPASS_USE_NIMBLE && !SUPERCOMPASS_BLE_LOOPBACK
@@ -0,0 +1,332 @@
+#include "ble_protocol.h"
+#include "position_source.h"
+#include "log.h"
+#include <Arduino.h>
+
+BleStats g_bleStats;
+
+namespace BLEInbound {
+    static Msg queue[QSIZE];
+    static volatile uint8_t head = 0; // write position
+    static volatile uint8_t tail = 0; // read position
+    volatile uint32_t lastRxTime = 0;
+    uint8_t highWater = 0;
+
+    bool enqueue(Type t, const char* src, size_t len){
+        if(len == 0 || len > MAX_LEN){
+            g_bleStats.rxParseErrors++; // treat oversize as parse error category
+            return false;
+        }
+        uint8_t next = (head + 1) % QSIZE;
+        if(next == tail){
+            g_bleStats.queueOverflow++;
+            g_bleStats.inboundDrops++;
+            return false; // queue full
+        }
+        Msg &m = queue[head];
+        m.type = t;
+        m.len = (uint8_t)len;
+        m.rxTime = millis();
+        memcpy(m.data, src, len);
+        m.data[len] = '\0'; // zero terminate for safe string ops
+        head = next;
+        lastRxTime = m.rxTime;
+        uint8_t depth = (uint8_t)((head + QSIZE - tail) % QSIZE);
+        if(depth > highWater) highWater = depth;
+        return true;
+    }
+
+    bool dequeue(Msg &out){
+        if(tail == head) return false; // empty
+        out = queue[tail];
+        tail = (tail + 1) % QSIZE;
+        return true;
+    }
+
+    bool empty(){
+        return head == tail;
+    }
+}
+
+namespace BLEOutbound {
+    static Msg queue[QSIZE];
+    static volatile uint8_t head = 0; // write
+    static volatile uint8_t tail = 0; // read
+    uint8_t highWater = 0;
+
+    bool enqueue(BleChar ch, const uint8_t* buf, size_t len){
+        if(len == 0 || len > MAX_LEN) return false;
+        uint8_t next = (head + 1) % QSIZE;
+        if(next == tail){
+            g_bleStats.queueOverflow++; // reuse counter for outbound overflow
+            g_bleStats.outboundDrops++;
+            return false;
+        }
+        Msg &m = queue[head];
+        m.ch = ch; m.len = (uint8_t)len;
+        memcpy(m.data, buf, len);
+        head = next;
+        uint8_t depth = (uint8_t)((head + QSIZE - tail) % QSIZE);
+        if(depth > highWater) highWater = depth;
+        return true;
+    }
+
+    bool dequeue(Msg &out){
+        if(tail == head) return false;
+        out = queue[tail];
+        tail = (tail + 1) % QSIZE;
+        return true;
+    }
+
+    uint8_t freeSlots(){
+        return (uint8_t)((tail + QSIZE - head - 1) % QSIZE);
+    }
+
+    bool empty(){
+        return head == tail;
+    }
+
+    void clear(){
+        tail = head;
+    }
+}
+
+DeserializationError parseInbound(JsonDocument &doc, const BLEInbound::Msg &msg){
+    uint32_t t0 = micros();
+    DeserializationError err = deserializeJson(doc, msg.data, msg.len);
+    uint32_t us = micros() - t0;
+    g_bleStats.parseCount++;
+    g_bleStats.parseUsTotal += us;
+    if(us > g_bleStats.parseUsMax) g_bleStats.parseUsMax = us;
+    return err;
+}
+
+BleProtocolStats getBleProtocolStats(){
+    BleProtocolStats st;
+    st.rxParseErrors = g_bleStats.rxParseErrors;
+    st.inboundDrops = g_bleStats.inboundDrops;
+    st.outboundDrops = g_bleStats.outboundDrops;
+    st.inboundProcessed = g_bleStats.inboundProcessed;
+    st.notifies = g_bleStats.notifies;
+    st.inboundHighWater = BLEInbound::highWater;
+    st.outboundHighWater = BLEOutbound::highWater;
+    st.queueSize = BLEInbound::QSIZE;
+    st.parseCount = g_bleStats.parseCount;
+    st.parseUsTotal = g_bleStats.parseUsTotal;
+    st.parseUsMax = g_bleStats.parseUsMax;
+    return st;
+}
+
+void resetBleProtocolStats(){
+    uint32_t preservedHb = g_bleStats.hb;
+    g_bleStats = BleStats{};
+    g_bleStats.hb = preservedHb;
+    BLEInbound::highWater = 0;
+    BLEOutbound::highWater = 0;
+}
+
+// ---------------- Decoding ----------------
+static bool inRange(double lat, double lon){
+    return lat >= -90 && lat <= 90 && lon >= -180 && lon <= 180;
+}
+
+static void copyName(BleCommand &cmd, const char *name){
+    strncpy(cmd.name, name ? name : "", sizeof(cmd.name) - 1);
+    cmd.name[sizeof(cmd.name) - 1] = '\0';
+}
+
+// Accepts lat/lon or latitude/longitude
+template<typename T>
+static bool readLatLon(const T &obj, double &lat, double &lon){
+    if(obj.containsKey("lat") && obj.containsKey("lon")){
+        lat = obj["lat"].template as<double>(); lon = obj["lon"].template as<double>(); return true; }
+    if(obj.containsKey("latitude") && obj.containsKey("longitude")){
+        lat = obj["latitude"].template as<double>(); lon = obj["longitude"].template as<double>(); return true; }
+    return false;
+}
+
+static uint32_t get32(const uint8_t *b){
+    return (uint32_t)b[0] | ((uint32_t)b[1]<<8) | ((uint32_t)b[2]<<16) | ((uint32_t)b[3]<<24);
+}
+
+static bool decodeTarget(const BLEInbound::Msg &msg, BleCommand &cmd){
+    JsonDocument doc;
+    auto err = parseInbound(doc, msg);
+    if(err){
+        g_bleStats.rxParseErrors++;
+        LOGW("ble", "target JSON parse error: %s", err.c_str());
+        return false;
+    }
+    double lat = 0, lon = 0;
+    if(!readLatLon(doc, lat, lon) || !inRange(lat, lon)){
+        LOGW("ble", "target JSON invalid or out of range");
+        return false;
+    }
+    cmd.kind = BleCommand::Kind::Target;
+    cmd.lat = lat; cmd.lon = lon;
+    cmd.hasName = doc.containsKey("name");
+    if(cmd.hasName) copyName(cmd, doc["name"].as<const char*>());
+    return true;
+}
+
+static bool decodeLocationsModify(const BLEInbound::Msg &msg, BleCommand &cmd){
+    JsonDocument doc;
+    auto err = parseInbound(doc, msg);
+    if(err){ g_bleStats.rxParseErrors++; LOGW("ble", "locations JSON parse error: %s", err.c_str()); return false; }
+    const char* action = doc["action"].as<const char*>();
+    if(!action){ g_bleStats.rxParseErrors++; LOGW("ble", "locations: missing action"); return false; }
+    if(strcmp(action,"add")==0){
+        JsonObject data = doc.containsKey("data") ? doc["data"] : doc["location"];
+        if(!data){ LOGW("ble", "add: missing data/location"); return false; }
+        double lat = 0, lon = 0;
+        if(!readLatLon(data, lat, lon) || !inRange(lat, lon)){ LOGW("ble", "add: invalid fields"); return false; }
+        cmd.kind = BleCommand::Kind::AddLocation;
+        copyName(cmd, data["name"] | "Unnamed");
+        cmd.lat = lat; cmd.lon = lon;
+    } else if(strcmp(action,"edit")==0){
+        JsonObject data = doc["data"];
+        if(!data || !data.containsKey("name")){ LOGW("ble", "edit: invalid index or data"); return false; }
+        cmd.kind = BleCommand::Kind::EditLocation;
+        cmd.index = doc["index"] | -1;
+        copyName(cmd, data["name"] | "Unnamed");
+        cmd.hasLat = data.containsKey("lat"); cmd.lat = data["lat"] | 0.0;
+        cmd.hasLon = data.containsKey("lon"); cmd.lon = data["lon"] | 0.0;
+    } else if(strcmp(action,"delete")==0){
+        cmd.kind = BleCommand::Kind::DeleteLocation;
+        cmd.index = doc["index"] | -1;
+    } else if(strcmp(action,"exportJson")==0){
+        cmd.kind = BleCommand::Kind::ExportJson;
+    } else if(strcmp(action,"importJson")==0){
+        cmd.kind = BleCommand::Kind::ImportJson;
+    } else if(strcmp(action,"resetStats")==0){
+        cmd.kind = BleCommand::Kind::ResetStats;
+    } else {
+        LOGW("ble", "unknown locations action: %s", action);
+        return false;
+    }
+    return true;
+}
+
+// Compact binary frames OR JSON.
+// Binary v1 (12 bytes):
+// [0]=0xA1 magic, [1..4]=lat *1e7 (int32 LE), [5..8]=lon *1e7 (int32 LE), [9..10]=accuracy*100 (uint16 LE), [11]=flags
+// Binary v2 (16 bytes): v1 layout with [0]=0xA2, plus [12..15]=phone fix timestamp in ms (uint32 LE)
+static bool decodePosition(const BLEInbound::Msg &msg, BleCommand &cmd){
+    const uint8_t *b = reinterpret_cast<const uint8_t*>(msg.data);
+    bool isV1 = (msg.len == 12 && b[0] == 0xA1);
+    bool isV2 = (msg.len == 16 && b[0] == 0xA2);
+    double lat = 0, lon = 0;
+    if(isV1 || isV2){
+        lat = (int32_t)get32(b + 1) / 1e7;
+        lon = (int32_t)get32(b + 5) / 1e7;
+        uint16_t acc = (uint16_t)( b[9] | (b[10]<<8) );
+        // b[11] flags: reserved
+        if(!inRange(lat, lon)){
+            g_bleStats.rxParseErrors++; LOGW_EVERY(1000, "ble", "binary position out of range");
+            return false;
+        }
+        cmd.accuracyM = acc / 100.0f;
+        cmd.fixTime = isV2 ? positionPhoneTimeToLocal(get32(b + 12), msg.rxTime) : msg.rxTime;
+        g_bleStats.binaryPosPackets++;
+    } else {
+        JsonDocument doc;
+        auto err = parseInbound(doc, msg);
+        if(err){ g_bleStats.rxParseErrors++; LOGW_EVERY(1000, "ble", "position JSON parse error: %s", err.c_str()); return false; }
+        if(!readLatLon(doc, lat, lon) || !inRange(lat, lon)){
+            LOGW_EVERY(1000, "ble", "position invalid or out of range");
+            return false;
+        }
+        cmd.accuracyM = doc["acc"] | (doc["accuracy"] | 0.0f);
+        cmd.fixTime = msg.rxTime;
+        g_bleStats.jsonPosPackets++;
+    }
+    cmd.kind = BleCommand::Kind::Position;
+    cmd.lat = lat; cmd.lon = lon;
+    return true;
+}
+
+bool bleDecodeInbound(const BLEInbound::Msg &msg, BleCommand &cmd){
+    cmd = BleCommand{};
+    g_bleStats.inboundProcessed++;
+    switch(msg.type){
+        case BLEInbound::Type::Target:          return decodeTarget(msg, cmd);
+        case BLEInbound::Type::LocationsModify: return decodeLocationsModify(msg, cmd);
+        case BLEInbound::Type::Position:        return decodePosition(msg, cmd);
+    }
+    return false;
+}
+
+// ---------------- Locations Chunk Sending (Step 6) ----------------
+namespace BLELocationsSync {
+    static uint16_t nextIndex = 0;   // next store index to send
+    static uint16_t total = 0;       // locations snapshot at start of sending
+    static uint16_t seq = 0;         // chunks built in this sync
+    static bool active = false;
+
+    void start(uint16_t count){
+        total = count;
+        nextIndex = 0;
+        seq = 0;
+        active = true;
+    }
+
+    bool inProgress(){
+        return active;
+    }
+
+    // Adds location i; cuts the name short when it alone overflows a notification
+    static void addItem(JsonDocument &doc, JsonArray items, const LocationStore &store, uint16_t i){
+        JsonObject o = items.add<JsonObject>();
+        o["name"] = store.name(i);
+        o["lat"] = store.lat(i);
+        o["lon"] = store.lon(i);
+        size_t len = measureJson(doc);
+        if(len <= BLEOutbound::MAX_LEN || items.size() > 1) return;
+        char name[BLEInbound::MAX_LEN + 1];
+        strncpy(name, store.name(i), sizeof(name) - 1);
+        name[sizeof(name) - 1] = '\0';
+        size_t n = strlen(name);
+        while(len > BLEOutbound::MAX_LEN && n > 0){
+            size_t over = len - BLEOutbound::MAX_LEN;
+            n = over < n ? n - over : 0;
+            while(n > 0 && (name[n] & 0xC0) == 0x80) n--; // keep UTF-8 sequences whole
+            name[n] = '\0';
+            o["name"] = name;
+            len = measureJson(doc);
+        }
+    }
+
+    size_t next(const LocationStore &store, bool connected, char *out){
+        if(!active) return 0;
+        uint16_t limit = total < store.size() ? total : (uint16_t)store.size(); // store may have shrunk
+        if(nextIndex >= limit){
+            active = false; // done
+            return 0;
+        }
+        // The outbound queue is shared with telemetry: build a chunk only when it can be queued
+        if(connected && BLEOutbound::freeSlots() == 0) return 0;
+
+        JsonDocument doc;
+        JsonArray items = doc["items"].to<JsonArray>();
+        doc["chunk"] = seq;
+        doc["first"] = nextIndex;
+        doc["count"] = limit;
+        doc["final"] = false; // longest form while packing
+        uint16_t end = nextIndex;
+        while(end < limit && end - nextIndex < PER_CHUNK){
+            addItem(doc, items, store, end);
+            if(measureJson(doc) > BLEOutbound::MAX_LEN){
+                items.remove(items.size() - 1); // starts the next chunk
+                break;
+            }
+            end++;
+        }
+        doc["final"] = (end >= limit);
+        size_t n = serializeJson(doc, out, CHUNK_MAX);
+        // Advance only once the chunk is queued; otherwise the same chunk is retried next call
+        if(connected && !BLEOutbound::enqueue(BleChar::LocationsList, (uint8_t*)out, n)) return n;
+        nextIndex = end;
+        seq++;
+        return n;
+    }
+}
@@ -0,0 +1,44 @@
+#include "ble_scenarios.h"
+#include <stdio.h>
+#include <math.h>
+
+static void put32(uint8_t *b, uint32_t v){ b[0] = (uint8_t)v; b[1] = (uint8_t)(v >> 8); b[2] = (uint8_t)(v >> 16); b[3] = (uint8_t)(v >> 24); }
+
+static size_t buildBulkAdd(uint16_t i, uint32_t now, BleChar &ch, uint8_t *buf){
+    ch = BleChar::LocationsModify;
+    int n = snprintf((char*)buf, BLE_SCENARIO_MAX_WRITE, "{\"action\":\"add\",\"data\":{\"name\":\"Bench %u\",\"lat\":%.6f,\"lon\":%.6f}}",
+        (unsigned)i, 51.0 + i * 0.001, 5.0 + i * 0.001);
+    return (size_t)n;
+}
+
+static size_t buildTarget(uint16_t i, uint32_t now, BleChar &ch, uint8_t *buf){
+    ch = BleChar::Target;
+    int n = snprintf((char*)buf, BLE_SCENARIO_MAX_WRITE, "{\"name\":\"Bench target %u\",\"lat\":%.6f,\"lon\":%.6f}",
+        (unsigned)i, 51.4 + i * 0.0001, 5.4 + i * 0.0001);
+    return (size_t)n;
+}
+
+// Alternates binary v2 frames and JSON, like a phone app mid-migration
+static size_t buildPosition(uint16_t i, uint32_t now, BleChar &ch, uint8_t *buf){
+    ch = BleChar::CurrentPosition;
+    double lat = 51.44 + i * 0.00001;
+    double lon = 5.47 + i * 0.00001;
+    if(i & 1){
+        int n = snprintf((char*)buf, BLE_SCENARIO_MAX_WRITE, "{\"lat\":%.7f,\"lon\":%.7f,\"acc\":8.5}", lat, lon);
+        return (size_t)n;
+    }
+    buf[0] = 0xA2;
+    put32(buf + 1, (uint32_t)(int32_t)lround(lat * 1e7));
+    put32(buf + 5, (uint32_t)(int32_t)lround(lon * 1e7));
+    buf[9] = (uint8_t)(850 & 0xFF); buf[10] = (uint8_t)(850 >> 8); // 8.50 m
+    buf[11] = 0;
+    put32(buf + 12, now - 50);
+    return 16;
+}
+
+const BleScenario BLE_SCENARIOS[] = {
+    { "bulk add 500 locations", 500, 2, buildBulkAdd },
+    { "rapid target writes",    200, 4, buildTarget },
+    { "position flood",        1000, 4, buildPosition },
+};
+const size_t BLE_SCENARIO_COUNT = sizeof(BLE_SCENARIOS) / sizeof(BLE_SCENARIOS[0]);
@@ -1,33 +1,23 @@
 #include "bluetooth.h"
 #include "page/saved_locations.h"
-#include <BLEDevice.h>
-#include <BLEServer.h>
-#include <BLEUtils.h>
-#include <BLE2902.h>
+#include "position_source.h"
+#include "ble_backend.h"
+#include "log.h"
+#include "memory_stats.h"
+#include "async.h"
+#include "input.h"
+#include "ui/notifications.h"
 #include <ArduinoJson.h>
 
 #define BluetoothName "SuperCompass"
 
-#define SERVICE_UUID           "e393c3ca-4e9f-4d5c-bba0-37e53272f8b3"
-#define TARGET_CHAR_UUID       "78afdeb8-a315-4030-8337-629d4e021306"
-#define LOCATIONS_LIST_CHAR_UUID "cdefa4dc-b73e-4865-b35f-fafa76914afb"
-#define LOCATIONS_MODIFY_CHAR_UUID "c660ca7d-b7ea-4c13-84fe-74dd8a11814d"
-#define CURRENT_POSITION_CHAR_UUID "b5439cfa-7d1b-4e82-8a81-f5d84a276dc2"
-// New READY/status characteristic UUID (randomly generated)
-#define READY_CHAR_UUID "8a3de9c1-5b06-4d8f-9c0b-f2d7b5b0f9aa"
-
-
-
-BLECharacteristic *pLocationsListCharacteristic;
-static BLECharacteristic *pTargetCharacteristic = nullptr;
-static BLECharacteristic *pReadyCharacteristic = nullptr;
-static BLEServer *g_pServer = nullptr; // store server reference for disconnect
+static bool bleInitialized = false; // backend created (setupBLE may run again from resetBluetooth)
 
 // Global variables to track BLE connection state
 bool btConnected = false;
 uint32_t lastBtConnectedTime = 0;
 
-// Flag to save locations after BLE action
+// Flag to sync the locations list to the client after BLE action (edits are already persisted)
 bool needsLocationsSave = false;
 
 // BLE position variables
@@ -39,247 +29,319 @@ double BLE_LON = 0.0;               // Longitude from BLE
 // Defer target publish out of BLE callback to avoid potential stack re-entrancy issues
 static volatile bool targetNeedsPublish = false;
 
-// ---------------- BLE Reliability / Stats (Step 2) ----------------
-struct BleStats {
-    uint32_t hb = 0;              // heartbeat counter
-    uint32_t rxParseErrors = 0;   // JSON / decode failures
-    uint32_t queueOverflow = 0;   // (placeholder for future queue implementation)
-    uint32_t notifyErrors = 0;    // notification send failures (future use)
-    uint32_t jsonPosPackets = 0;  // JSON position packets processed
-    uint32_t binaryPosPackets = 0;// binary position packets processed (future)
-} g_bleStats;
-
 static uint32_t lastHeartbeatTime = 0;      // ms timestamp of last heartbeat publish
 static const uint32_t HEARTBEAT_INTERVAL = 15000; // 15s heartbeat interval
 
-// ---------------- Inbound Message Queue (Step 3) ----------------
-// We avoid heavy JSON parsing inside BLE callbacks to reduce timing pressure and risk of re-entrancy issues.
-namespace BLEInbound {
-    enum class Type : uint8_t { Target=0, LocationsModify=1, Position=2 };
-    struct Msg { Type type; uint8_t len; char data[128]; };
-    static constexpr uint8_t QSIZE = 8; // ring buffer size
-    static Msg queue[QSIZE];
-    static volatile uint8_t head = 0; // write position
-    static volatile uint8_t tail = 0; // read position
-
-    bool enqueue(Type t, const char* src, size_t len){
-        if(len == 0 || len > 120){
-            g_bleStats.rxParseErrors++; // treat oversize as parse error category
-            return false;
-        }
-        uint8_t next = (head + 1) % QSIZE;
-        if(next == tail){
-            g_bleStats.queueOverflow++;
-            return false; // queue full
-        }
-        Msg &m = queue[head];
-        m.type = t;
-        m.len = (uint8_t)len;
-        memcpy(m.data, src, len);
-        m.data[len] = '\0'; // zero terminate for safe string ops
-        head = next;
-        return true;
+// ---------------- Connection Parameter Management ----------------
+// The PPCP set on the advertisement only suggests 30-50 ms. Once connected we know the peer address
+// and can request our own parameters: a short interval while data is flowing (locations sync,
+// telemetry, queued notifies, recent writes) and a long interval with slave latency when idle.
+namespace BLEConnParams {
+    enum class Mode : uint8_t { Unknown=0, Fast=1, Idle=2 };
+
+    struct Params { uint16_t minInt; uint16_t maxInt; uint16_t latency; uint16_t timeout; };
+    // Intervals in 1.25 ms units, timeout in 10 ms units
+    static constexpr Params FAST = { 0x06, 0x0C, 0, 400 };   // 7.5-15 ms, no latency, 4 s supervision
+    static constexpr Params IDLE = { 0x50, 0xA0, 4, 600 };   // 100-200 ms, skip up to 4 events, 6 s supervision
+
+    static constexpr uint32_t IDLE_AFTER_MS = 5000;        // no activity for this long -> idle params
+    static constexpr uint32_t MIN_REQUEST_GAP_MS = 2000;   // don't hammer the central with updates
+
+    static bool connected = false;
+    static Mode mode = Mode::Unknown;
+    static uint32_t lastActivity = 0;
+    static uint32_t lastRequest = 0;
+
+    // Per-mode accounting so the two settings can be compared from the serial log
+    static uint32_t modeSince = 0;
+    static uint32_t modeNotifies = 0;
+    static uint32_t modeBytes = 0;
+
+    static const char* modeName(Mode m){ return m == Mode::Fast ? "fast" : (m == Mode::Idle ? "idle" : "default"); }
+
+    void onConnect(){
+        connected = true;
+        mode = Mode::Unknown;     // central picked the initial parameters
+        lastActivity = millis();  // connection setup usually continues with discovery/sync
+        lastRequest = 0;
+        modeSince = millis(); modeNotifies = 0; modeBytes = 0;
     }
 
-    bool dequeue(Msg &out){
-        if(tail == head) return false; // empty
-        out = queue[tail];
-        tail = (tail + 1) % QSIZE;
-        return true;
+    void onDisconnect(){
+        connected = false;
+        mode = Mode::Unknown;
     }
-}
 
-// ---------------- Outbound Notification Queue (Step 5) ----------------
-namespace BLEOutbound {
-    struct Msg { BLECharacteristic* ch; uint8_t len; uint8_t data[180]; }; // len <= 180 (< MTU-3 if MTU 185)
-    static constexpr uint8_t QSIZE = 8;
-    static Msg queue[QSIZE];
-    static volatile uint8_t head = 0; // write
-    static volatile uint8_t tail = 0; // read
-
-    bool enqueue(BLECharacteristic* ch, const uint8_t* buf, size_t len){
-        if(!ch || len == 0 || len > 180) return false;
-        uint8_t next = (head + 1) % QSIZE;
-        if(next == tail){
-            g_bleStats.queueOverflow++; // reuse counter for outbound overflow
-            return false;
-        }
-        Msg &m = queue[head];
-        m.ch = ch; m.len = (uint8_t)len;
-        memcpy(m.data, buf, len);
-        head = next;
-        return true;
+    void noteNotify(size_t len){
+        modeNotifies++;
+        modeBytes += len;
     }
 
-    bool dequeue(Msg &out){
-        if(tail == head) return false;
-        out = queue[tail];
-        tail = (tail + 1) % QSIZE;
-        return true;
+    static void request(Mode m){
+        const Params &p = (m == Mode::Fast) ? FAST : IDLE;
+        uint32_t now = millis();
+        uint32_t dur = now - modeSince;
+        LOGI("ble", "conn params: %s -> %s after %lu ms (%lu notifies, %lu B, %lu B/s)",
+            modeName(mode), modeName(m), (unsigned long)dur, (unsigned long)modeNotifies, (unsigned long)modeBytes,
+            (unsigned long)(dur ? (uint64_t)modeBytes * 1000 / dur : 0));
+        bleBackendRequestConnParams(p.minInt, p.maxInt, p.latency, p.timeout);
+        mode = m;
+        lastRequest = now;
+        modeSince = now; modeNotifies = 0; modeBytes = 0;
+    }
+
+    // Called from checkBLEStatus(); 'busy' is true while a sync/stream has data pending
+    void service(bool busy){
+        if(!connected) return;
+        uint32_t now = millis();
+        if(busy) lastActivity = now;
+        uint32_t lastRx = BLEInbound::lastRxTime;
+        if((int32_t)(lastRx - lastActivity) > 0) lastActivity = lastRx;
+        Mode want = (now - lastActivity < IDLE_AFTER_MS) ? Mode::Fast : Mode::Idle;
+        if(want == mode) return;
+        if(now - lastRequest < MIN_REQUEST_GAP_MS) return;
+        request(want);
     }
 }
 
-// ---------------- Locations Chunk Sending (Step 6) ----------------
-static uint16_t locationsChunkNextIndex = 0; // next savedLocations index to send when chunking
-static uint16_t locationsChunkTotal = 0;     // total locations snapshot at start of sending
-static bool locationsChunkInProgress = false;
-static const uint8_t LOCATIONS_PER_CHUNK = 3; // keep JSON small
+// ---------------- Telemetry Stream ----------------
+// Packed little-endian frame, 32 bytes:
+// [0]=0xB1 magic, [1]=version, [2..3]=seq (uint16), [4..7]=millis (uint32),
+// [8..9]=heading*100 (uint16), [10..15]=raw mag x/y/z (int16),
+// [16..19]=lat *1e7 (int32), [20..23]=lon *1e7 (int32), [24..25]=hdop*100 (uint16, 0xFFFF unknown),
+// [26]=satellites, [27]=flags, [28..29]=speed cm/s (uint16), [30..31]=bearing to target*100 (uint16, 0xFFFF none)
+namespace BLETelemetry {
+    static constexpr uint8_t MAGIC = 0xB1;
+    static constexpr uint8_t VERSION = 1;
+    static constexpr uint8_t FRAME_LEN = 32;
+    static constexpr uint8_t MAX_RATE_HZ = 20;
+    // Telemetry is only queued when this many outbound slots remain free,
+    // so target/ready/locations notifications always find room.
+    static constexpr uint8_t RESERVED_SLOTS = 3;
+
+    enum Flags : uint8_t {
+        FLAG_FIX_VALID   = 0x01,
+        FLAG_FIX_BLE     = 0x02,
+        FLAG_TARGET_SET  = 0x04,
+        FLAG_BEARING     = 0x08,
+        FLAG_HDOP_VALID  = 0x10,
+    };
+
+    static volatile uint8_t rateHz = 5;   // client writes 0 to stop, 1..20 to set rate
+    static NavTelemetry latest;           // newest sample, overwritten every loop (coalescing)
+    static bool hasSample = false;
+    static uint16_t seq = 0;
+    static uint32_t lastSendTime = 0;
+
+    static void put16(uint8_t *b, uint16_t v){ b[0] = (uint8_t)v; b[1] = (uint8_t)(v >> 8); }
+    static void put32(uint8_t *b, uint32_t v){ b[0] = (uint8_t)v; b[1] = (uint8_t)(v >> 8); b[2] = (uint8_t)(v >> 16); b[3] = (uint8_t)(v >> 24); }
+    static int16_t clamp16(int v){ return (int16_t)(v > 32767 ? 32767 : (v < -32768 ? -32768 : v)); }
+
+    static size_t buildFrame(uint8_t *b){
+        const NavTelemetry &t = latest;
+        uint8_t flags = 0;
+        if(t.fixValid) flags |= FLAG_FIX_VALID;
+        if(t.fixFromBle) flags |= FLAG_FIX_BLE;
+        if(targetIsSet) flags |= FLAG_TARGET_SET;
+        if(t.targetBearingValid) flags |= FLAG_BEARING;
+
+        uint16_t hdop = 0xFFFF;
+        if(gps.hdop.isValid()){
+            flags |= FLAG_HDOP_VALID;
+            int32_t h = gps.hdop.value(); // TinyGPS++ reports HDOP already scaled by 100
+            hdop = (uint16_t)(h > 0xFFFE ? 0xFFFE : h);
+        }
+        uint32_t speedCms = gps.speed.isValid() ? (uint32_t)(gps.speed.mps() * 100.0) : 0;
+        uint32_t sats = gps.satellites.isValid() ? gps.satellites.value() : 0;
+
+        b[0] = MAGIC;
+        b[1] = VERSION;
+        put16(b + 2, seq++);
+        put32(b + 4, millis());
+        put16(b + 8, (uint16_t)(fmod(t.headingDeg + 360.0, 360.0) * 100.0));
+        put16(b + 10, (uint16_t)clamp16(lastMagX));
+        put16(b + 12, (uint16_t)clamp16(lastMagY));
+        put16(b + 14, (uint16_t)clamp16(lastMagZ));
+        put32(b + 16, (uint32_t)(t.fixValid ? (int32_t)lround(t.lat * 1e7) : 0));
+        put32(b + 20, (uint32_t)(t.fixValid ? (int32_t)lround(t.lon * 1e7) : 0));
+        put16(b + 24, hdop);
+        b[26] = (uint8_t)(sats > 255 ? 255 : sats);
+        b[27] = flags;
+        put16(b + 28, (uint16_t)(speedCms > 0xFFFF ? 0xFFFF : speedCms));
+        put16(b + 30, t.targetBearingValid ? (uint16_t)(fmod(t.targetBearingDeg + 360.0, 360.0) * 100.0) : 0xFFFF);
+        return FRAME_LEN;
+    }
 
-static void scheduleNextLocationsChunk(){
-    if(!pLocationsListCharacteristic) return;
-    if(!locationsChunkInProgress) return;
-    if(locationsChunkNextIndex >= locationsChunkTotal){
-        locationsChunkInProgress = false; // done
-        return;
+    static bool subscribed(){
+        return bleBackendIsSubscribed(BleChar::Telemetry);
     }
-    StaticJsonDocument<256> doc; // chunk doc
-    JsonArray items = doc.createNestedArray("items");
-    uint8_t count = 0;
-    for(; locationsChunkNextIndex < locationsChunkTotal && count < LOCATIONS_PER_CHUNK; ++locationsChunkNextIndex, ++count){
-        if(locationsChunkNextIndex < savedLocations.size()){
-            JsonObject o = items.createNestedObject();
-            o["name"] = savedLocations[locationsChunkNextIndex].name ? savedLocations[locationsChunkNextIndex].name : "Unnamed";
-            o["lat"] = savedLocations[locationsChunkNextIndex].lat;
-            o["lon"] = savedLocations[locationsChunkNextIndex].lon;
+
+    // Called from checkBLEStatus(); sends at most one frame per period and only the newest sample
+    static void service(){
+        if(!bleInitialized || !hasSample) return;
+        uint8_t rate = rateHz;
+        if(rate == 0) return;
+        uint32_t period = 1000 / rate;
+        uint32_t now = millis();
+        if(now - lastSendTime < period) return;
+        lastSendTime = now;
+
+        uint8_t frame[FRAME_LEN];
+        size_t n = buildFrame(frame);
+        bleBackendSetValue(BleChar::Telemetry, frame, n); // keep READ value current even without subscribers
+        if(!btConnected || !subscribed()) return;
+        if(BLEOutbound::freeSlots() <= RESERVED_SLOTS){
+            g_bleStats.telemetrySkipped++; // the next period carries a fresher sample anyway
+            return;
+        }
+        if(BLEOutbound::enqueue(BleChar::Telemetry, frame, n)){
+            g_bleStats.telemetryFrames++;
         }
-    }
-    doc["chunk"] = (locationsChunkNextIndex / LOCATIONS_PER_CHUNK) - 1; // sequence (after loop increment)
-    uint16_t totalChunks = (locationsChunkTotal + LOCATIONS_PER_CHUNK - 1) / LOCATIONS_PER_CHUNK;
-    doc["total"] = totalChunks;
-    doc["final"] = (locationsChunkNextIndex >= locationsChunkTotal);
-    char out[256]; size_t n = serializeJson(doc, out, sizeof(out));
-    pLocationsListCharacteristic->setValue((uint8_t*)out, n);
-    if(btConnected){
-        // enqueue notify; if fails, we'll retry next status loop (queue overflow increments)
-        BLEOutbound::enqueue(pLocationsListCharacteristic, (uint8_t*)out, n);
     }
 }
 
-class ServerCallbacks: public BLEServerCallbacks {
-    void onConnect(BLEServer* pServer) {
-      Serial.println("BLE Client Connected");
-      btConnected = true;
-      lastBtConnectedTime = millis();
-      // Show popup notification for connection
-      showPopupNotification("Connected", 2000, TFT_WHITE, TFT_GREEN);
-    }
+void updateTelemetrySample(const NavTelemetry &sample){
+    BLETelemetry::latest = sample;
+    BLETelemetry::hasSample = true;
+}
 
-    void onDisconnect(BLEServer* pServer) {
-      Serial.println("BLE Client Disconnected");
-      btConnected = false;
-      BLEDevice::startAdvertising(); // Restart advertising on disconnect
-      // Show popup notification for disconnection
-      showPopupNotification("Disconnected", 2000, TFT_WHITE, TFT_RED);
+// ---------------- Locations Chunk Sending (Step 6) ----------------
+// One chunk per call, built by BLELocationsSync; the chunk also becomes the list's READ value
+static void scheduleNextLocationsChunk(){
+    if(!bleInitialized) return;
+    char out[BLELocationsSync::CHUNK_MAX];
+    size_t n = BLELocationsSync::next(savedLocations, btConnected, out);
+    if(n > 0) bleBackendSetValue(BleChar::LocationsList, (uint8_t*)out, n);
+}
+
+// Connection setup timing (connect -> first GATT read/write, i.e. discovery finished)
+static uint32_t connectStartTime = 0;
+static bool connectSetupLogged = false;
+
+static void noteGattActivity(){
+    if(btConnected && !connectSetupLogged){
+        connectSetupLogged = true;
+        LOGI("ble", "connection setup took %lu ms (%s)",
+            (unsigned long)(millis() - connectStartTime), bleBackendName());
     }
-};
+}
+
+// ---------------- Backend callbacks (run on the BLE stack task) ----------------
+void bleOnConnect(){
+    LOGI("ble", "client connected");
+    btConnected = true;
+    lastBtConnectedTime = millis();
+    connectStartTime = lastBtConnectedTime;
+    connectSetupLogged = false;
+    BLEConnParams::onConnect();
+    // Show popup notification for connection
+    showPopupNotification("Connected", 2000, TFT_WHITE, TFT_GREEN);
+}
+
+void bleOnDisconnect(){
+    LOGI("ble", "client disconnected");
+    btConnected = false;
+    BLEConnParams::onDisconnect();
+    BLEOutbound::clear();
+    bleBackendStartAdvertising(); // Restart advertising on disconnect
+    // Show popup notification for disconnection
+    showPopupNotification("Disconnected", 2000, TFT_WHITE, TFT_RED);
+}
 
 void notifySavedLocationsChange() {
     try {
-        Serial.println("BLE: Preparing to notify saved locations change");
-    Serial.print("BLE: Total saved locations: "); Serial.println(savedLocations.size());
+        LOGD("ble", "notifying saved locations change (%u locations)", (unsigned)savedLocations.size());
     // Start chunk sending sequence
-    locationsChunkTotal = savedLocations.size();
-    locationsChunkNextIndex = 0;
-    locationsChunkInProgress = true;
+    BLELocationsSync::start(savedLocations.size());
     scheduleNextLocationsChunk(); // enqueue first chunk
     } catch (const std::exception& e) {
-        Serial.print("Exception in notifySavedLocationsChange: ");
-        Serial.println(e.what());
+        LOGE("ble", "exception in notifySavedLocationsChange: %s", e.what());
     } catch (...) {
-        Serial.println("Unknown exception in notifySavedLocationsChange");
+        LOGE("ble", "unknown exception in notifySavedLocationsChange");
     }
 }
 
-class TargetCharacteristicCallbacks : public BLECharacteristicCallbacks {
-    void onWrite(BLECharacteristic *pCharacteristic) override {
-        std::string value = pCharacteristic->getValue();
-        Serial.print("BLE Target received raw len: "); Serial.println(value.length());
-        if(!BLEInbound::enqueue(BLEInbound::Type::Target, value.c_str(), value.length())){
-            Serial.println("BLE Target enqueue failed (size or queue)");
-        }
-    }
-};
-
-class LocationsModifyCallbacks : public BLECharacteristicCallbacks {
-    void onWrite(BLECharacteristic *pCharacteristic) override {
-        std::string value = pCharacteristic->getValue();
-        Serial.print("BLE LocationsModify raw len: "); Serial.println(value.length());
-        if(!BLEInbound::enqueue(BLEInbound::Type::LocationsModify, value.c_str(), value.length())){
-            Serial.println("BLE LocationsModify enqueue failed (size or queue)");
-        }
-    }
-};
-
-class CurrentPositionCallbacks : public BLECharacteristicCallbacks {
-    void onWrite(BLECharacteristic *pCharacteristic) override {
-        std::string value = pCharacteristic->getValue();
-        if(!value.empty()){
-            if(!BLEInbound::enqueue(BLEInbound::Type::Position, value.c_str(), value.length())){
-                Serial.println("BLE Position enqueue failed (size or queue)");
+void bleOnWrite(BleChar ch, const uint8_t *data, size_t len){
+    noteGattActivity();
+    inputWake(); // BLE host task: ends the loop's idle wait so the write is handled now (not counted as activity)
+    const char *value = reinterpret_cast<const char*>(data);
+    switch(ch){
+        case BleChar::Target:
+            LOGD("ble", "target write, %u B", (unsigned)len);
+            if(!BLEInbound::enqueue(BLEInbound::Type::Target, value, len)){
+                LOGW("ble", "target enqueue failed (size or queue)");
             }
-        }
+            break;
+        case BleChar::LocationsModify:
+            LOGD("ble", "locations modify write, %u B", (unsigned)len);
+            if(!BLEInbound::enqueue(BLEInbound::Type::LocationsModify, value, len)){
+                LOGW("ble", "locations modify enqueue failed (size or queue)");
+            }
+            break;
+        case BleChar::CurrentPosition:
+            if(len > 0){
+                if(!BLEInbound::enqueue(BLEInbound::Type::Position, value, len)){
+                    LOGW_EVERY(1000, "ble", "position enqueue failed (size or queue)");
+                }
+            }
+            break;
+        case BleChar::Telemetry: {
+            // Single byte: requested rate in Hz (0 = stop). Applied directly, no parsing needed.
+            if(len != 1){ g_bleStats.rxParseErrors++; break; }
+            uint8_t hz = data[0];
+            if(hz > BLETelemetry::MAX_RATE_HZ) hz = BLETelemetry::MAX_RATE_HZ;
+            BLETelemetry::rateHz = hz;
+        } break;
+        default:
+            break;
     }
-};
-
-class LocationsListCallbacks : public BLECharacteristicCallbacks {
-    void onRead(BLECharacteristic *pCharacteristic) override {
-        Serial.println("BLE: Client requested saved locations list");
-        try {
-            // Use a small static buffer
-            static char buffer[200];
-            strcpy(buffer, "[]"); // Default empty array
+}
+
+void bleOnRead(BleChar ch){
+    noteGattActivity();
+    if(ch != BleChar::LocationsList) return;
+    LOGD("ble", "client read saved locations list");
+    try {
+        // Use a small static buffer
+        static char buffer[200];
+        strcpy(buffer, "[]"); // Default empty array
+        
+        if (savedLocations.size() > 0) {
+            // Create a small document
+            JsonDocument doc;
+            JsonArray array = doc.to<JsonArray>();
             
-            if (savedLocations.size() > 0) {
-                // Create a small document
-                JsonDocument doc;
-                JsonArray array = doc.to<JsonArray>();
-                
-                // Only send a few locations to avoid memory issues
-                const size_t maxLocations = 3; // Send very few at a time
-                
-                for (size_t i = 0; i < savedLocations.size() && i < maxLocations; i++) {
-                    JsonObject obj = array.add<JsonObject>();
-                    
-                    // Safely handle the name
-                    if (savedLocations[i].name != nullptr) {
-                        obj["name"] = savedLocations[i].name;
-                    } else {
-                        obj["name"] = "Unnamed";
-                    }
-                    
-                    obj["lat"] = savedLocations[i].lat;
-                    obj["lon"] = savedLocations[i].lon;
-                }
+            // Only send a few locations to avoid memory issues
+            const size_t maxLocations = 3; // Send very few at a time
+            
+            for (size_t i = 0; i < savedLocations.size() && i < maxLocations; i++) {
+                JsonObject obj = array.add<JsonObject>();
                 
-                // Serialize to our buffer with size limit
-                serializeJson(doc, buffer, sizeof(buffer));
+                obj["name"] = savedLocations.name(i);
+                obj["lat"] = savedLocations.lat(i);
+                obj["lon"] = savedLocations.lon(i);
             }
             
-            // Log what's being sent
-            Serial.print("BLE: Returning locations: ");
-            Serial.println(buffer);
-            
-            // Use standard string API which is known to be safe
-            pCharacteristic->setValue(buffer);
-            Serial.print("BLE: Sent ");
-            Serial.print(strlen(buffer));
-            Serial.println(" bytes of location data");
-        } catch (const std::exception& e) {
-            Serial.print("Exception in LocationsListCallbacks: ");
-            Serial.println(e.what());
-            // Fall back to empty array
-            pCharacteristic->setValue("[]");
-        } catch (...) {
-            Serial.println("Unknown exception in LocationsListCallbacks");
-            // Fall back to empty array
-            pCharacteristic->setValue("[]");
+            // Serialize to our buffer with size limit
+            serializeJson(doc, buffer, sizeof(buffer));
         }
+        
+        bleBackendSetValue(BleChar::LocationsList, (const uint8_t*)buffer, strlen(buffer));
+        LOGD("ble", "returned %u B of location data: %s", (unsigned)strlen(buffer), buffer);
+    } catch (const std::exception& e) {
+        LOGE("ble", "exception in bleOnRead: %s", e.what());
+        // Fall back to empty array
+        bleBackendSetValue(BleChar::LocationsList, (const uint8_t*)"[]", 2);
+    } catch (...) {
+        LOGE("ble", "unknown exception in bleOnRead");
+        // Fall back to empty array
+        bleBackendSetValue(BleChar::LocationsList, (const uint8_t*)"[]", 2);
     }
-};
+}
 
 // Helper to publish target in JSON form (public API declared in header)
 void publishTargetCharacteristic(){
-    if(!pTargetCharacteristic) return;
+    if(!bleInitialized) return;
     // We keep JSON small to reduce heap pressure and avoid malloc failures in callbacks.
     // Also avoid using explicit JSON nulls for numeric fields (some central apps or
     // BLE debug utilities have been observed to mishandle them). Instead include a
@@ -301,28 +363,25 @@ void publishTargetCharacteristic(){
     if(n == 0 || n >= sizeof(out)){
         // Fallback to a minimal JSON (should never happen unless truncated)
         const char *fallback = "{\"hasTarget\":false}";
-        Serial.println("publishTargetCharacteristic: JSON serialization truncated, using fallback");
-        pTargetCharacteristic->setValue((uint8_t*)fallback, strlen(fallback));
+        LOGW("ble", "target JSON truncated, using fallback");
+        n = strlen(fallback);
+        memcpy(out, fallback, n + 1);
     } else {
-        // Log (trimmed) outgoing JSON for diagnostics
-        Serial.print("publishTargetCharacteristic JSON (len=");
-        Serial.print(n);
-        Serial.print("): ");
-        Serial.println(out);
-        pTargetCharacteristic->setValue((uint8_t*)out, n);
+        LOGD("ble", "target JSON (%u B): %s", (unsigned)n, out);
     }
+    bleBackendSetValue(BleChar::Target, (uint8_t*)out, n);
 
-    // Notify only if connected; descriptor (BLE2902) handles whether client enabled notifications
+    // Notify only if connected; the stack handles whether client enabled notifications
     if(btConnected){
-        BLEOutbound::enqueue(pTargetCharacteristic, (uint8_t*)pTargetCharacteristic->getValue().c_str(), strlen(pTargetCharacteristic->getValue().c_str()));
+        BLEOutbound::enqueue(BleChar::Target, (uint8_t*)out, n);
     }
 }
 
 // Helper to publish ready state
 void publishReady(bool ready){
-    if(!pReadyCharacteristic) return;
+    if(!bleInitialized) return;
     // Expanded READY/heartbeat JSON (keep under ~120 bytes to fit in single notification easily)
-    StaticJsonDocument<128> doc;
+    StaticJsonDocument<160> doc;
     doc["ready"] = ready;
     doc["hasTarget"] = targetIsSet;
     doc["fw"] = "1.0.0"; // firmware version placeholder
@@ -331,140 +390,72 @@ void publishReady(bool ready){
     err["rx"] = g_bleStats.rxParseErrors;
     err["qov"] = g_bleStats.queueOverflow;
     err["nt"] = g_bleStats.notifyErrors;
-
-    char out[128];
+    // Memory headroom, short keys to stay in one notification: heap free / min free / largest
+    // block in KB, smallest task stack high-water mark in bytes
+    const MemStats &m = memStatsCurrent();
+    JsonObject mem = doc.createNestedObject("mem");
+    mem["f"] = m.heapFree / 1024;
+    mem["m"] = m.heapMinFree / 1024;
+    mem["b"] = m.heapLargest / 1024;
+    mem["s"] = m.stackMinFree;
+
+    char out[160];
     size_t n = serializeJson(doc, out, sizeof(out));
-    pReadyCharacteristic->setValue((uint8_t*)out, n);
+    bleBackendSetValue(BleChar::Ready, (uint8_t*)out, n);
     if(btConnected){
-        BLEOutbound::enqueue(pReadyCharacteristic, (uint8_t*)pReadyCharacteristic->getValue().c_str(), strlen(pReadyCharacteristic->getValue().c_str()));
+        BLEOutbound::enqueue(BleChar::Ready, (uint8_t*)out, n);
     }
 }
 
 void setupBLE() {
     // Log initial target values
-    Serial.println("BLE Setup - Initial target values:");
-    Serial.print("TARGET_LAT: ");
-    Serial.print(TARGET_LAT, 6);
-    Serial.print(", TARGET_LON: ");
-    Serial.println(TARGET_LON, 6);
-    Serial.print("targetIsSet: ");
-    Serial.println(targetIsSet ? "true" : "false");
-    
-    BLEDevice::init(BluetoothName);
-    // (Optional) Request higher MTU if using NimBLE (macro may differ). Original Bluedroid stack often auto-negotiates.
-    // Uncomment if supported in your build:
-    // BLEDevice::setMTU(185);
-    g_pServer = BLEDevice::createServer();
-    g_pServer->setCallbacks(new ServerCallbacks());
-    BLEService *pService = g_pServer->createService(SERVICE_UUID);
-
-    // Target Characteristic (now READ + WRITE + NOTIFY)
-    pTargetCharacteristic = pService->createCharacteristic(
-        TARGET_CHAR_UUID,
-        BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_WRITE | BLECharacteristic::PROPERTY_NOTIFY
-    );
-    pTargetCharacteristic->addDescriptor(new BLE2902());
-    pTargetCharacteristic->setCallbacks(new TargetCharacteristicCallbacks());
-
-    // READY Characteristic (READ + NOTIFY)
-    pReadyCharacteristic = pService->createCharacteristic(
-        READY_CHAR_UUID,
-        BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY
-    );
-    pReadyCharacteristic->addDescriptor(new BLE2902());
-
-    // Locations List Characteristic
-    pLocationsListCharacteristic = pService->createCharacteristic(
-        LOCATIONS_LIST_CHAR_UUID,
-        BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY
-    );
-    pLocationsListCharacteristic->addDescriptor(new BLE2902());
-    pLocationsListCharacteristic->setCallbacks(new LocationsListCallbacks());
-
-    // Locations Modify Characteristic
-    BLECharacteristic *pLocationsModifyCharacteristic = pService->createCharacteristic(
-        LOCATIONS_MODIFY_CHAR_UUID,
-        BLECharacteristic::PROPERTY_WRITE
-    );
-    pLocationsModifyCharacteristic->setCallbacks(new LocationsModifyCallbacks());
-    
-    // Current Position Characteristic
-    BLECharacteristic *pCurrentPositionCharacteristic = pService->createCharacteristic(
-        CURRENT_POSITION_CHAR_UUID,
-        BLECharacteristic::PROPERTY_WRITE
-    );
-    pCurrentPositionCharacteristic->setCallbacks(new CurrentPositionCallbacks());
-
-    pService->start();
+    LOGI("ble", "setup, target %.6f, %.6f (set: %s)", TARGET_LAT, TARGET_LON, targetIsSet ? "yes" : "no");
+
+    if(!bleInitialized){
+        // Footprint of the selected stack, collected from both builds by tools/ble_footprint.py
+        uint32_t heapBefore = ESP.getFreeHeap();
+        uint32_t t0 = millis();
+        bleBackendInit(BluetoothName);
+        bleInitialized = true;
+        LOGI("ble", "stack '%s' init: %lu ms, heap used %ld B (free %lu B, min free %lu B)",
+            bleBackendName(), (unsigned long)(millis() - t0), (long)heapBefore - (long)ESP.getFreeHeap(),
+            (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+    }
 
     // Publish initial values BEFORE advertising so central can read immediately after connect
     publishTargetCharacteristic();
     publishReady(true); // Currently no long init, so mark ready immediately
 
-    BLEAdvertising *pAdvertising = BLEDevice::getAdvertising();
-    pAdvertising->addServiceUUID(SERVICE_UUID);
-    pAdvertising->setScanResponse(false); // Advertise service UUID in the main packet
-    // Tune the peripheral preferred connection parameters (PPCP) to target ~30-50ms interval.
-    // Values are in units of 1.25ms. Common values used by ESP32 BLE stack:
-    // 0x06 (7.5ms), 0x12 (25ms), 0x18 (30ms), 0x28 (50ms), 0x30 (60ms).
-    // We expose a slightly wider range so the central (phone) can pick one within target band.
-    pAdvertising->setMinPreferred(0x18);  // 0x18 * 1.25ms = 30ms
-    pAdvertising->setMaxPreferred(0x28);  // 0x28 * 1.25ms = 50ms
-    // Note: For finer control (e.g. supervision timeout / latency) we'd need lower level GAP param update
-    // via esp_ble_gap_update_conn_params which requires the peer address from GATT connect event. That can
-    // be added later if we migrate to NimBLE or install a custom GAP callback.
-    BLEDevice::startAdvertising();
-    Serial.println("BLE advertising started (with target + ready published).");
+    // After connect, BLEConnParams switches between fast and idle parameters (interval, latency, timeout).
+    bleBackendStartAdvertising();
+    LOGI("ble", "advertising started (target + ready published)");
+}
+
+// The link drops in the stack's own task; check on it later instead of blocking the loop
+static void checkDisconnected(){
+    if(btConnected) LOGW("ble", "client still connected 1 s after forced disconnect");
 }
 
 void disconnectBluetooth(){
-    if(btConnected && g_pServer){
-        Serial.println("Forcing BLE disconnect");
-        // Attempt generic disconnect. Some stacks ignore invalid IDs; try 0..3
-        for(int id=0; id<4; ++id){
-            g_pServer->disconnect(id);
-        }
-        delay(100);
+    if(btConnected){
+        LOGI("ble", "forcing disconnect");
+        bleBackendDisconnect();
+        asyncAfter("bleDisconnectCheck", 1000, checkDisconnected);
     }
 }
 
 
 // Returns true if the BLE position is valid (i.e., has been set).
-// It also logs the age of the position.
+// It also logs the age of the position (debug builds, at most every 5 s).
 bool isBlePositionValid() {
-    static uint32_t lastLogTime = 0;
-    uint32_t currentTime = millis();
-    
-    // Only log detailed status every 5 seconds to avoid spamming Serial
-    bool shouldLog = (currentTime - lastLogTime > 5000);
-    
     if (!blePositionSet) {
-        if (shouldLog) {
-            Serial.println("BLE Position Status: Not set yet");
-            lastLogTime = currentTime;
-        }
+        LOGD_EVERY(5000, "ble", "position not set yet");
         return false;
     }
 
-    uint32_t positionAge = currentTime - blePositionTime;
-    if (shouldLog) {
-        if (positionAge > 30000) {
-            Serial.print("BLE Position Status: Stale (");
-            Serial.print(positionAge / 1000.0, 1);
-            Serial.println(" seconds old)");
-        } else {
-            Serial.print("BLE Position Status: Valid (");
-            Serial.print(positionAge / 1000.0, 1);
-            Serial.println(" seconds old)");
-        }
-        Serial.print("BLE Position: [");
-        Serial.print(BLE_LAT, 6);
-        Serial.print(", ");
-        Serial.print(BLE_LON, 6);
-        Serial.println("]");
-        lastLogTime = currentTime;
-    }
-    
+    uint32_t positionAge = millis() - blePositionTime;
+    LOGD_EVERY(5000, "ble", "position %s (%.1f s old): %.6f, %.6f",
+        positionAge > 30000 ? "stale" : "valid", positionAge / 1000.0, BLE_LAT, BLE_LON);
     return true;
 }
 
@@ -473,25 +464,77 @@ void getBlePosition(double &lat, double &lon) {
     if (isBlePositionValid()) {
         lat = BLE_LAT;
         lon = BLE_LON;
-        
-        // Log when this position is used
-        Serial.println(">>> Using BLE position for location <<<");
-        Serial.print("Coordinates: [");
-        Serial.print(lat, 6);
-        Serial.print(", ");
-        Serial.print(lon, 6);
-        Serial.println("]");
-        Serial.print("Position age: ");
-        Serial.print((millis() - blePositionTime) / 1000.0, 1);
-        Serial.println(" seconds");
+        LOGD_EVERY(1000, "ble", "using BLE position %.6f, %.6f (%.1f s old)",
+            lat, lon, (millis() - blePositionTime) / 1000.0);
     } else {
         // Return zeros if not valid
         lat = 0.0;
         lon = 0.0;
-        Serial.println(">>> BLE position requested but not valid, returning zeros <<<");
+        LOGD_EVERY(1000, "ble", "position requested but not valid, returning zeros");
+    }
+}
+
+// Applies a decoded client write to the target, the saved locations and the position source
+static void applyBleCommand(const BleCommand &cmd){
+    switch(cmd.kind){
+        case BleCommand::Kind::Target: {
+            TARGET_LAT = cmd.lat; TARGET_LON = cmd.lon; targetIsSet = true;
+            Setaddress = cmd.hasName ? cmd.name : "BLE Target";
+            const size_t MAX_ADDR_LEN = 40; if(Setaddress.length() > MAX_ADDR_LEN) Setaddress.remove(MAX_ADDR_LEN);
+            targetNeedsPublish = true; // publish updated target soon
+        } break;
+        case BleCommand::Kind::AddLocation:
+            if(addSavedLocation(cmd.name, cmd.lat, cmd.lon)) needsLocationsSave = true;
+            else LOGW("ble", "add failed: location store full");
+            break;
+        case BleCommand::Kind::EditLocation:
+            if(cmd.index >= 0 && cmd.index < (int)savedLocations.size()){
+                double lat = cmd.hasLat ? cmd.lat : savedLocations.lat(cmd.index);
+                double lon = cmd.hasLon ? cmd.lon : savedLocations.lon(cmd.index);
+                if(updateSavedLocation(cmd.index, cmd.name, lat, lon)) needsLocationsSave = true;
+                else LOGW("ble", "edit failed: name pool full");
+            } else { LOGW("ble", "edit: invalid index or data"); }
+            break;
+        case BleCommand::Kind::DeleteLocation:
+            if(cmd.index >= 0 && cmd.index < (int)savedLocations.size()){
+                removeSavedLocation(cmd.index); needsLocationsSave = true;
+            } else { LOGW("ble", "delete: invalid index"); }
+            break;
+        case BleCommand::Kind::ExportJson:
+            exportSavedLocationsJson(); // /saved_locations.json, for pulling the list off the filesystem
+            break;
+        case BleCommand::Kind::ImportJson:
+            // Replace the list with an uploaded /saved_locations.json
+            // Partial imports are kept (the popup reports the counts) and synced like complete ones
+            if(importSavedLocationsJson() != LocationImport::Failed) needsLocationsSave = true;
+            break;
+        case BleCommand::Kind::ResetStats:
+            LOGI("ble", "resetting stats on request");
+            resetBleProtocolStats(); // keeps heartbeat continuity
+            publishReady(true); // immediate status update
+            break;
+        case BleCommand::Kind::Position:
+            BLE_LAT = cmd.lat; BLE_LON = cmd.lon; blePositionSet = true; blePositionTime = cmd.fixTime;
+            positionUpdateBle(cmd.lat, cmd.lon, cmd.accuracyM, cmd.fixTime);
+            break;
+        case BleCommand::Kind::None:
+            break;
     }
 }
 
+uint32_t bleMaxLoopPeriodMs(){
+    if(!bleInitialized) return UINT32_MAX;
+    // Queued work is drained one step per loop; outbound work only moves while a client is connected
+    if(!BLEInbound::empty()) return 0;
+    if(btConnected && (!BLEOutbound::empty() || BLELocationsSync::inProgress())) return 0;
+    uint8_t rate = BLETelemetry::rateHz;
+    if(btConnected && rate > 0 && BLETelemetry::subscribed()){
+        // Twice the frame rate, so loop jitter never pushes a frame into the next period
+        return 1000 / rate / 2;
+    }
+    return UINT32_MAX;
+}
+
 // Call this from your main loop
 void checkBLEStatus() {
     static uint32_t lastStatusTime = 0;
@@ -502,114 +545,15 @@ void checkBLEStatus() {
     if (targetNeedsPublish) {
         // Clear first to avoid re-trigger if publish triggers another set
         targetNeedsPublish = false;
-        Serial.println("checkBLEStatus: publishing deferred target characteristic");
+        LOGD("ble", "publishing deferred target");
         publishTargetCharacteristic();
     }
 
     // Process inbound BLE messages (JSON parsing outside ISR/stack callback context)
     BLEInbound::Msg msg; // local copy
+    BleCommand cmd;
     while(BLEInbound::dequeue(msg)){
-        switch(msg.type){
-            case BLEInbound::Type::Target: {
-                Serial.println("Processing queued Target message");
-                JsonDocument doc;
-                auto err = deserializeJson(doc, msg.data, msg.len);
-                if(err){
-                    g_bleStats.rxParseErrors++;
-                    Serial.print("Target JSON parse error: "); Serial.println(err.c_str());
-                    break;
-                }
-                double lat=0, lon=0; bool valid=false;
-                if(doc.containsKey("lat") && doc.containsKey("lon")){
-                    lat = doc["lat"].as<double>(); lon = doc["lon"].as<double>(); valid=true; }
-                else if(doc.containsKey("latitude") && doc.containsKey("longitude")){
-                    lat = doc["latitude"].as<double>(); lon = doc["longitude"].as<double>(); valid=true; }
-                if(valid && lat >= -90 && lat <= 90 && lon >= -180 && lon <= 180){
-                    TARGET_LAT = lat; TARGET_LON = lon; targetIsSet = true;
-                    if(doc.containsKey("name")) Setaddress = doc["name"].as<const char*>(); else Setaddress = "BLE Target";
-                    const size_t MAX_ADDR_LEN = 40; if(Setaddress.length() > MAX_ADDR_LEN) Setaddress.remove(MAX_ADDR_LEN);
-                    targetNeedsPublish = true; // publish updated target soon
-                } else {
-                    Serial.println("Target JSON invalid or out of range");
-                }
-            } break;
-            case BLEInbound::Type::LocationsModify: {
-                Serial.println("Processing queued LocationsModify message");
-                JsonDocument doc;
-                auto err = deserializeJson(doc, msg.data, msg.len);
-                if(err){ g_bleStats.rxParseErrors++; Serial.print("Locations JSON parse error: "); Serial.println(err.c_str()); break; }
-                const char* action = doc["action"].as<const char*>();
-                if(!action){ g_bleStats.rxParseErrors++; Serial.println("Locations: missing action"); break; }
-                if(strcmp(action,"add")==0){
-                    JsonObject data = doc.containsKey("data") ? doc["data"] : doc["location"];
-                    if(!data){ Serial.println("Add missing data/location"); break; }
-                    const char* name = data["name"] | "Unnamed";
-                    double lat=0, lon=0; bool have=false;
-                    if(data.containsKey("lat") && data.containsKey("lon")){ lat=data["lat"]; lon=data["lon"]; have=true; }
-                    else if(data.containsKey("latitude") && data.containsKey("longitude")){ lat=data["latitude"]; lon=data["longitude"]; have=true; }
-                    if(have && name && lat>=-90 && lat<=90 && lon>=-180 && lon<=180){
-                        char* name_copy = new char[strlen(name)+1]; strcpy(name_copy, name);
-                        savedLocations.push_back({name_copy, lat, lon}); needsLocationsSave = true; }
-                    else { Serial.println("Add invalid fields"); }
-                } else if(strcmp(action,"edit")==0){
-                    int index = doc["index"] | -1;
-                    JsonObject data = doc["data"];
-                    if(index>=0 && index < (int)savedLocations.size() && data && data.containsKey("name")){
-                        if(savedLocations[index].name) delete[] savedLocations[index].name;
-                        const char* name = data["name"].as<const char*>();
-                        char* name_copy = new char[strlen(name)+1]; strcpy(name_copy, name);
-                        savedLocations[index].name = name_copy;
-                        if(data.containsKey("lat")) savedLocations[index].lat = data["lat"];
-                        if(data.containsKey("lon")) savedLocations[index].lon = data["lon"];
-                        needsLocationsSave = true;
-                    } else { Serial.println("Edit invalid index or data"); }
-                } else if(strcmp(action,"delete")==0){
-                    int index = doc["index"] | -1;
-                    if(index>=0 && index < (int)savedLocations.size()){
-                        if(savedLocations[index].name) delete[] savedLocations[index].name;
-                        savedLocations.erase(savedLocations.begin()+index); needsLocationsSave = true;
-                    } else { Serial.println("Delete invalid index"); }
-                } else if(strcmp(action,"resetStats")==0){
-                    Serial.println("Resetting BLE stats on request");
-                    uint32_t preservedHb = g_bleStats.hb; // keep heartbeat continuity
-                    g_bleStats = BleStats{}; // reset
-                    g_bleStats.hb = preservedHb; // restore counter
-                    publishReady(true); // immediate status update
-                } else {
-                    Serial.print("Unknown locations action: "); Serial.println(action);
-                }
-            } break;
-            case BLEInbound::Type::Position: {
-                // Support compact binary frame OR JSON.
-                // Binary format (12 bytes):
-                // [0]=0xA1 magic, [1..4]=lat *1e7 (int32 LE), [5..8]=lon *1e7 (int32 LE), [9..10]=accuracy*100 (uint16 LE), [11]=flags
-                if(msg.len == 12 && (uint8_t)msg.data[0] == 0xA1){
-                    const uint8_t *b = reinterpret_cast<const uint8_t*>(msg.data);
-                    int32_t latE7 = (int32_t)( (uint32_t)b[1] | ((uint32_t)b[2]<<8) | ((uint32_t)b[3]<<16) | ((uint32_t)b[4]<<24) );
-                    int32_t lonE7 = (int32_t)( (uint32_t)b[5] | ((uint32_t)b[6]<<8) | ((uint32_t)b[7]<<16) | ((uint32_t)b[8]<<24) );
-                    uint16_t acc = (uint16_t)( b[9] | (b[10]<<8) );
-                    uint8_t flags = b[11];
-                    double lat = latE7 / 1e7;
-                    double lon = lonE7 / 1e7;
-                    if(lat>=-90 && lat<=90 && lon>=-180 && lon<=180){
-                        BLE_LAT = lat; BLE_LON = lon; blePositionSet = true; blePositionTime = millis(); g_bleStats.binaryPosPackets++;
-                    } else {
-                        g_bleStats.rxParseErrors++; Serial.println("Binary position out of range");
-                    }
-                    (void)acc; (void)flags; // placeholders for future use
-                } else {
-                    JsonDocument doc;
-                    auto err = deserializeJson(doc, msg.data, msg.len);
-                    if(err){ g_bleStats.rxParseErrors++; Serial.print("Position JSON parse error: "); Serial.println(err.c_str()); break; }
-                    double lat=0, lon=0; bool valid=false;
-                    if(doc.containsKey("lat") && doc.containsKey("lon")){ lat=doc["lat"].as<double>(); lon=doc["lon"].as<double>(); valid=true; }
-                    else if(doc.containsKey("latitude") && doc.containsKey("longitude")){ lat=doc["latitude"].as<double>(); lon=doc["longitude"].as<double>(); valid=true; }
-                    if(valid && lat>=-90 && lat<=90 && lon>=-180 && lon<=180){
-                        BLE_LAT = lat; BLE_LON = lon; blePositionSet = true; blePositionTime = millis(); g_bleStats.jsonPosPackets++; }
-                    else { Serial.println("Position invalid or out of range"); }
-                }
-            } break;
-        }
+        if(bleDecodeInbound(msg, cmd)) applyBleCommand(cmd);
     }
     
     // Verify target variables consistency every 30 seconds
@@ -618,29 +562,24 @@ void checkBLEStatus() {
         
         // Check for potential issues with the target coordinates
         if (targetIsSet && TARGET_LAT == 0.0 && TARGET_LON == 0.0) {
-            Serial.println("WARNING: targetIsSet is true but coordinates are 0.0");
+            LOGW("ble", "targetIsSet is true but coordinates are 0.0");
         }
         
         if (!targetIsSet && (TARGET_LAT != 0.0 || TARGET_LON != 0.0)) {
-            Serial.println("WARNING: targetIsSet is false but coordinates are non-zero");
-            Serial.print("TARGET_LAT: ");
-            Serial.print(TARGET_LAT, 6);
-            Serial.print(", TARGET_LON: ");
-            Serial.println(TARGET_LON, 6);
+            LOGW("ble", "targetIsSet is false but coordinates are non-zero (%.6f, %.6f)", TARGET_LAT, TARGET_LON);
         }
         
         // Log BLE position status
         if (isBlePositionValid()) {
-            Serial.println("BLE position is valid and recent");
+            LOGD("ble", "position is valid and recent");
         } else if (blePositionSet) {
-            Serial.println("BLE position is set but too old");
+            LOGD("ble", "position is set but too old");
         }
     }
     
     if (needsLocationsSave) {
         needsLocationsSave = false;
-        Serial.println("Saving locations from main loop due to BLE update");
-        saveSavedLocations();
+        LOGI("ble", "locations changed, syncing list to client");
         notifySavedLocationsChange();
     }
 
@@ -649,8 +588,8 @@ void checkBLEStatus() {
     // rapid connect/disconnect cycles. Restart advertising every 5s if not connected.
     if (!btConnected && millis() - lastAdvWatchdog > 5000) {
         lastAdvWatchdog = millis();
-        Serial.println("BLE watchdog: ensuring advertising is active");
-        BLEDevice::startAdvertising();
+        LOGD("ble", "watchdog: ensuring advertising is active");
+        bleBackendStartAdvertising();
     }
 
     // Heartbeat: publish READY/status JSON every HEARTBEAT_INTERVAL while connected.
@@ -660,21 +599,28 @@ void checkBLEStatus() {
         publishReady(true);
     }
 
+    // Telemetry: coalesced, rate-limited, and only queued when the outbound queue has headroom.
+    BLETelemetry::service();
+
     // Outbound notification dispatcher: send one queued notify per loop iteration to avoid bursts.
     BLEOutbound::Msg outMsg;
-    if(btConnected && BLEOutbound::dequeue(outMsg)){
-        // Set characteristic value (already set by origin, but ensure correct copy for reliability if needed)
-        outMsg.ch->setValue(outMsg.data, outMsg.len);
-        outMsg.ch->notify();
+    if(!btConnected){
+        BLEOutbound::clear(); // also catches frames queued by this loop after the disconnect callback
+    } else if(BLEOutbound::dequeue(outMsg)){
+        bleBackendNotify(outMsg.ch, outMsg.data, outMsg.len);
+        g_bleStats.notifies++;
+        BLEConnParams::noteNotify(outMsg.len);
     }
 
     // If locations chunking is active and there is room in outbound queue, schedule next chunk.
-    if(locationsChunkInProgress){
-        // Simple heuristic: only attempt scheduling if queue not near full
-        // (We approximate fullness by ensuring at least one free slot)
-        BLEOutbound::Msg dummy;
-        // Use head/tail distance directly (not exposed) - instead optimistically attempt schedule every cycle
+    if(BLELocationsSync::inProgress()){
+        // One chunk per cycle; it waits while the outbound queue has no free slot
         scheduleNextLocationsChunk();
     }
+
+    // Fast connection interval while anything is flowing, slow + slave latency when idle
+    bool linkBusy = BLELocationsSync::inProgress() || !BLEOutbound::empty()
+        || (BLETelemetry::rateHz > 0 && BLETelemetry::subscribed());
+    BLEConnParams::service(linkBusy);
 }
 
@@ -0,0 +1,120 @@
+#include "boot.h"
+#include "globals_and_includes.h"
+#include "bluetooth.h"
+#include "storage.h"
+#include "saved_locations.h"
+#include "page/settings.h"
+#include "track.h"
+#include "ui/notifications.h"
+#include <esp_sleep.h>
+#ifdef SUPERCOMPASS_BLE_LOOPBACK
+#include "ble_backend.h"
+#endif
+
+static const size_t BOOT_MARKS_MAX = 24;
+static const uint32_t DEFERRED_TASK_STACK = 8192; // JSON import + LittleFS + BLE init
+static const UBaseType_t DEFERRED_TASK_PRIORITY = 1; // same as loop(), which runs on the other core
+
+struct BootMark {
+    const char *stage;
+    uint32_t us; // since reset
+};
+
+static BootMark g_marks[BOOT_MARKS_MAX];
+static size_t g_markCount = 0;
+static portMUX_TYPE g_marksMux = portMUX_INITIALIZER_UNLOCKED;
+
+static volatile bool g_dataReady = false;
+static volatile bool g_storageOk = true;
+static bool g_firstFrame = false;
+static bool g_reported = false;
+
+void bootMark(const char *stage) {
+    uint32_t now = micros();
+    portENTER_CRITICAL(&g_marksMux);
+    if (g_markCount < BOOT_MARKS_MAX) {
+        g_marks[g_markCount].stage = stage;
+        g_marks[g_markCount].us = now;
+        g_markCount++;
+    }
+    portEXIT_CRITICAL(&g_marksMux);
+}
+
+bool bootIsFast() {
+#ifdef SUPERCOMPASS_FAST_BOOT
+    return true;
+#else
+    return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0;
+#endif
+}
+
+static void runDeferredInit() {
+    g_storageOk = storageBegin();
+    bootMark("storage mounted");
+    if (g_storageOk) importLegacySettings();
+    if (g_storageOk) trackBegin();
+    loadSavedLocations();
+    bootMark("locations loaded");
+    warmSavedLocationsIndex();
+    bootMark("location index");
+    // Data is in place, so the READY flag published here is already true
+    setupBLE();
+    bootMark("ble advertising");
+#ifdef SUPERCOMPASS_BLE_LOOPBACK
+    bleLoopbackRunScenarios(); // protocol benchmark, see ble_backend_loopback.cpp
+#endif
+    g_dataReady = true;
+}
+
+static void deferredInitTask(void *) {
+    runDeferredInit();
+    vTaskDelete(nullptr);
+}
+
+void bootStartDeferredInit(bool async) {
+    if (async) {
+        // Core 0, next to the BLE host; loop() keeps drawing on core 1
+        if (xTaskCreatePinnedToCore(deferredInitTask, "bootInit", DEFERRED_TASK_STACK, nullptr,
+                                    DEFERRED_TASK_PRIORITY, nullptr, 0) == pdPASS) {
+            return;
+        }
+        Serial.println(F("boot: deferred init task failed to start, running inline"));
+    }
+    runDeferredInit();
+}
+
+bool bootDataReady() {
+    return g_dataReady;
+}
+
+static void printBootSummary() {
+    BootMark marks[BOOT_MARKS_MAX];
+    portENTER_CRITICAL(&g_marksMux);
+    size_t n = g_markCount;
+    memcpy(marks, g_marks, n * sizeof(BootMark));
+    portEXIT_CRITICAL(&g_marksMux);
+
+    Serial.printf("--- Boot profile (%s boot) ---\n", bootIsFast() ? "fast" : "cold");
+    uint32_t prev = 0;
+    for (size_t i = 0; i < n; i++) {
+        Serial.printf("%8lu us  +%7lu us  %s\n", (unsigned long)marks[i].us,
+                      (unsigned long)(marks[i].us - prev), marks[i].stage);
+        prev = marks[i].us;
+    }
+    Serial.printf("free heap %lu B, min free %lu B\n", (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+}
+
+void bootService() {
+    if (g_reported) return;
+    if (!g_firstFrame) {
+        g_firstFrame = true;
+        bootMark("first frame");
+    }
+    if (!g_dataReady) return;
+    g_reported = true;
+    if (!g_storageOk) {
+        // Keep navigating; locations fall back to the defaults and nothing is persisted
+        showPopupNotification("Storage error", 3000, TFT_WHITE, TFT_RED, NotifyPriority::High);
+    }
+    printBootSummary();
+}
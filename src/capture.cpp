@@ -0,0 +1,133 @@
+#include "capture.h"
+#include "globals_and_includes.h"
+
+#ifdef SUPERCOMPASS_CAPTURE
+#include "log.h"
+#include "boot.h"
+#include "input.h"
+#include "ui/page_stack.h"
+#include "page/compass.h"
+#include "page/menu.h"
+#include "page/settings.h"
+#include "page/gpsinfo.h"
+#include "page/saved_locations.h"
+#include "page/bluetoothinfo.h"
+#include "page/diagnostics.h"
+
+static const size_t CMD_MAX = 24;
+static const size_t TRIPLES_PER_LINE = 19;   // 57 bytes -> 76 base64 characters
+static const double COMPASS_HEADINGS[] = { 0.0, 45.0, 137.0, 270.0 };
+
+static char g_cmd[CMD_MAX];
+static size_t g_cmdLen = 0;
+
+static const char BASE64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static void sendLine(const uint8_t *data, size_t len) {
+    char line[4 + TRIPLES_PER_LINE * 4 + 1];
+    size_t n = 0;
+    line[n++] = 'C'; line[n++] = 'A'; line[n++] = 'P'; line[n++] = ' ';
+    for (size_t i = 0; i < len; i += 3) {
+        uint32_t v = (uint32_t)data[i] << 16 | (uint32_t)data[i + 1] << 8 | data[i + 2]; // len is a multiple of 3
+        line[n++] = BASE64[(v >> 18) & 63];
+        line[n++] = BASE64[(v >> 12) & 63];
+        line[n++] = BASE64[(v >> 6) & 63];
+        line[n++] = BASE64[v & 63];
+    }
+    line[n++] = '\n';
+    Serial.write((const uint8_t*)line, n);
+}
+
+// Run-length encoded, since most of every page is background
+static void sendCanvas(const char *name, uint32_t renderUs) {
+    const uint16_t *px = (const uint16_t*)canvas.getBuffer(); // byte order as sent to the panel
+    if (!px) return;
+    int w = canvas.width(), h = canvas.height();
+    size_t total = (size_t)w * h;
+    logFlush(); // pending log lines first, so they do not land between the frame lines
+    Serial.printf("CAP BEGIN %s %d %d %lu\n", name, w, h, (unsigned long)renderUs);
+
+    uint8_t chunk[TRIPLES_PER_LINE * 3];
+    size_t used = 0;
+    size_t i = 0;
+    while (i < total) {
+        uint16_t v = px[i];
+        size_t run = 1;
+        while (i + run < total && run < 256 && px[i + run] == v) run++;
+        const uint8_t *bytes = (const uint8_t*)&px[i];
+        chunk[used++] = (uint8_t)(run - 1);
+        chunk[used++] = bytes[0];
+        chunk[used++] = bytes[1];
+        i += run;
+        if (used == sizeof(chunk)) {
+            sendLine(chunk, used);
+            used = 0;
+        }
+    }
+    if (used) sendLine(chunk, used);
+    Serial.printf("CAP END %u\n", (unsigned)total);
+}
+
+static void capturePage(const char *name, const Page *page) {
+    if (page->onEnter) page->onEnter(); // selection back to the first entry, like opening the page
+    DirtyRect full;
+    full.add(0, 0, canvas.width(), canvas.height());
+    canvas.clearClipRect();
+    uint32_t t0 = micros();
+    page->render(canvas, full);
+    uint32_t us = micros() - t0;
+    sendCanvas(name, us);
+}
+
+static void captureAll() {
+    // Entering the pages resets their state; only do that while none of them is open
+    if (pageCurrent() != &compassPage) {
+        Serial.println(F("CAP ERROR cap all only runs from the compass page"));
+        return;
+    }
+    char name[24];
+    for (double heading : COMPASS_HEADINGS) {
+        compassPreview(heading);
+        snprintf(name, sizeof(name), "compass_%03d", (int)heading);
+        capturePage(name, &compassPage);
+    }
+    capturePage("menu", &menuPage);
+    capturePage("settings", &settingsPage);
+    capturePage("gpsinfo", &gpsInfoPage);
+    capturePage("bluetooth", &bluetoothInfoPage);
+    capturePage("diagnostics", &diagnosticsPage);
+    if (bootDataReady()) capturePage("savedlocations", &savedLocationsPage);
+    Serial.println(F("CAP DONE"));
+
+    // Back to the live compass: next update recomputes the heading, the next frame repaints it all
+    inputFlush();
+    pageInvalidate();
+}
+
+static void runCommand(const char *cmd) {
+    if (strcmp(cmd, "cap") == 0) {
+        sendCanvas(pageCurrent() ? pageCurrent()->name : "screen", 0);
+    } else if (strcmp(cmd, "cap all") == 0) {
+        captureAll();
+    }
+}
+
+void captureService() {
+    while (Serial.available() > 0) {
+        char c = (char)Serial.read();
+        if (c == '\r') continue;
+        if (c == '\n') {
+            g_cmd[g_cmdLen] = '\0';
+            if (g_cmdLen) runCommand(g_cmd);
+            g_cmdLen = 0;
+        } else if (g_cmdLen < CMD_MAX - 1) {
+            g_cmd[g_cmdLen++] = c;
+        }
+    }
+}
+
+#else
+
+void captureService() {}
+
+#endif // SUPERCOMPASS_CAPTURE
@@ -0,0 +1,143 @@
+#include "frame_governor.h"
+#include "globals_and_includes.h"
+#include "input.h"
+#include "log.h"
+#include "async.h"
+#include "bluetooth.h"
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+
+extern bool btConnected;
+
+// Current model for the estimate (mA): CPU/radio awake, light-sleeping, and backlight at full scale
+static const float MA_AWAKE = 48.0f;
+static const float MA_BLOCKED = 30.0f;      // task blocked, CPU idles (no PM), radio as configured
+static const float MA_LIGHT_SLEEP = 3.0f;
+static const float MA_BACKLIGHT_FULL = 30.0f;
+static const uint32_t REPORT_PERIOD_MS = 60000;
+
+struct ModeAccum {
+    uint32_t timeMs;
+    uint32_t blockedMs;
+    uint32_t sleepMs;
+    uint32_t frames;
+};
+
+static GovMode g_mode = GovMode::Active;
+static uint32_t g_lastActivity = 0;
+static uint32_t g_lastInputSeen = 0;
+static ModeAccum g_accum[(int)GovMode::Count];
+static uint32_t g_lastReport = 0;
+
+static uint32_t periodFor(GovMode mode) {
+    switch (mode) {
+    case GovMode::Idle: return GOV_IDLE_PERIOD_MS;
+    case GovMode::Doze: return GOV_DOZE_PERIOD_MS;
+    default: return GOV_ACTIVE_PERIOD_MS;
+    }
+}
+
+const char *governorModeName(GovMode mode) {
+    switch (mode) {
+    case GovMode::Active: return "active";
+    case GovMode::Idle: return "idle";
+    case GovMode::Doze: return "doze";
+    default: return "?";
+    }
+}
+
+GovMode governorMode() {
+    return g_mode;
+}
+
+void governorWake() {
+    g_lastActivity = millis();
+    g_mode = GovMode::Active;
+}
+
+#ifdef SUPERCOMPASS_LIGHT_SLEEP
+// Wake on the timer, or on any level change of the encoder pins / a button press
+static void lightSleepFor(uint32_t ms) {
+    gpio_wakeup_enable((gpio_num_t)INPUT_ENCODER_PIN_A, digitalRead(INPUT_ENCODER_PIN_A) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+    gpio_wakeup_enable((gpio_num_t)INPUT_ENCODER_PIN_B, digitalRead(INPUT_ENCODER_PIN_B) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+    gpio_wakeup_enable((gpio_num_t)INPUT_BUTTON_PIN, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000ULL);
+    esp_light_sleep_start();
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+    gpio_wakeup_disable((gpio_num_t)INPUT_ENCODER_PIN_A);
+    gpio_wakeup_disable((gpio_num_t)INPUT_ENCODER_PIN_B);
+    gpio_wakeup_disable((gpio_num_t)INPUT_BUTTON_PIN);
+}
+#endif
+
+static void report(uint32_t now) {
+    if (now - g_lastReport < REPORT_PERIOD_MS) return;
+    g_lastReport = now;
+    for (int m = 0; m < (int)GovMode::Count; m++) {
+        GovModeStats s = governorStats((GovMode)m);
+        if (!s.timeMs) continue;
+        LOGI("gov", "%s: %lu s, %.1f fps, %u%% waiting, ~%.0f mA", governorModeName((GovMode)m),
+            (unsigned long)(s.timeMs / 1000), s.fps, (unsigned)((uint64_t)s.sleepMs * 100 / s.timeMs), s.estCurrentMa);
+    }
+}
+
+void governorEndLoop(FrameResult frame, uint32_t loopStartMs) {
+    uint32_t now = millis();
+    uint32_t inputAt = inputLastEventMs();
+    if (frame == FrameResult::Changed || inputAt != g_lastInputSeen) {
+        g_lastInputSeen = inputAt;
+        g_lastActivity = now;
+    }
+
+    // Mode from how long the picture has been still
+    uint32_t still = now - g_lastActivity;
+    GovMode mode = GovMode::Active;
+    if (still >= GOV_DOZE_AFTER_MS && !btConnected) mode = GovMode::Doze; // a connected client keeps the loop at Idle or faster
+    else if (still >= GOV_IDLE_AFTER_MS) mode = GovMode::Idle;
+    if (mode != g_mode) {
+        LOGD("gov", "%s -> %s", governorModeName(g_mode), governorModeName(mode));
+        g_mode = mode;
+    }
+
+    ModeAccum &acc = g_accum[(int)g_mode];
+    if (frame != FrameResult::None) acc.frames++;
+
+    // Wait out the rest of this mode's frame slot; input interrupts end the wait early
+    uint32_t period = periodFor(g_mode);
+    uint32_t blePeriod = bleMaxLoopPeriodMs(); // telemetry rate and queued BLE work override Idle/Doze
+    if (blePeriod < period) period = blePeriod > GOV_ACTIVE_PERIOD_MS ? blePeriod : GOV_ACTIVE_PERIOD_MS;
+    uint32_t elapsed = now - loopStartMs;
+    if (elapsed < period) {
+        uint32_t waitMs = period - elapsed;
+        uint32_t asyncDue = asyncMsUntilNext(); // do not sleep through a scheduled flow step
+        if (asyncDue < waitMs) waitMs = asyncDue;
+        uint32_t t0 = millis();
+#ifdef SUPERCOMPASS_LIGHT_SLEEP
+        if (g_mode != GovMode::Active && !btConnected) {
+            lightSleepFor(waitMs);
+            acc.sleepMs += millis() - t0;
+        } else
+#endif
+        {
+            inputWaitForEvent(waitMs);
+            acc.blockedMs += millis() - t0;
+        }
+    }
+    acc.timeMs += millis() - loopStartMs;
+    report(millis());
+}
+
+GovModeStats governorStats(GovMode mode) {
+    const ModeAccum &acc = g_accum[(int)mode];
+    GovModeStats s = {};
+    s.timeMs = acc.timeMs;
+    s.sleepMs = acc.blockedMs + acc.sleepMs;
+    s.frames = acc.frames;
+    if (!acc.timeMs) return s;
+    s.fps = acc.frames * 1000.0f / acc.timeMs;
+    uint32_t awakeMs = acc.timeMs > s.sleepMs ? acc.timeMs - s.sleepMs : 0;
+    s.estCurrentMa = (awakeMs * MA_AWAKE + acc.blockedMs * MA_BLOCKED + acc.sleepMs * MA_LIGHT_SLEEP) / acc.timeMs
+        + MA_BACKLIGHT_FULL * screenBrightness / 255.0f;
+    return s;
+}
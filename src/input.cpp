@@ -0,0 +1,193 @@
+#include "input.h"
+#include "globals_and_includes.h"
+#include <atomic>
+
+// ---- ISR side: quadrature decoding into whole detents ----
+// Single producer (the GPIO ISR), single consumer (inputPoll on the loop task)
+struct DetentSample {
+    int8_t dir;
+    uint32_t us;
+};
+
+static const uint8_t ISR_RING_SIZE = 32; // power of two
+static DetentSample g_ring[ISR_RING_SIZE];
+static std::atomic<uint8_t> g_ringHead(0);   // written by the ISR
+static std::atomic<uint8_t> g_ringTail(0);   // written by the loop
+static std::atomic<int> g_overflowDetents(0); // ring full: detents are kept here instead of dropped
+static volatile uint8_t g_quadState = 0;
+static volatile int8_t g_quadCount = 0;
+static TaskHandle_t g_waiter = nullptr;
+
+// Position change per (old AB, new AB) transition, as in the PJRC Encoder library the M5Dial uses
+static const int8_t QUAD_DELTA[16] = { 0, 1, -1, 2, -1, 0, -2, 1, 1, -2, 0, -1, 2, -1, 1, 0 };
+
+static void IRAM_ATTR wakeWaiter() {
+    if (!g_waiter) return;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(g_waiter, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+static void IRAM_ATTR encoderIsr() {
+    uint8_t s = g_quadState & 3;
+    if (digitalRead(INPUT_ENCODER_PIN_A)) s |= 4;
+    if (digitalRead(INPUT_ENCODER_PIN_B)) s |= 8;
+    g_quadState = s >> 2;
+    int8_t count = g_quadCount + QUAD_DELTA[s];
+
+    int8_t dir = 0;
+    if (count >= INPUT_COUNTS_PER_DETENT) { dir = 1; count -= INPUT_COUNTS_PER_DETENT; }
+    else if (count <= -INPUT_COUNTS_PER_DETENT) { dir = -1; count += INPUT_COUNTS_PER_DETENT; }
+    g_quadCount = count;
+    if (!dir) return;
+
+    uint8_t head = g_ringHead.load(std::memory_order_relaxed);
+    uint8_t next = (head + 1) & (ISR_RING_SIZE - 1);
+    if (next == g_ringTail.load(std::memory_order_acquire)) {
+        g_overflowDetents.fetch_add(dir, std::memory_order_relaxed);
+    } else {
+        g_ring[head] = { dir, (uint32_t)micros() };
+        g_ringHead.store(next, std::memory_order_release);
+    }
+    wakeWaiter();
+}
+
+static void IRAM_ATTR buttonIsr() {
+    wakeWaiter();
+}
+
+// ---- Loop side: event queue ----
+static InputEvent g_queue[INPUT_QUEUE_SIZE];
+static uint8_t g_queueHead = 0, g_queueCount = 0;
+static uint32_t g_lastDetentUs = 0;
+static int8_t g_lastDetentDir = 0;
+static bool g_longPressSent = false;
+static uint32_t g_lastEventMs = 0;
+
+// Detents further apart than this start a new spin (velocity 0, no acceleration)
+static const uint32_t SPIN_GAP_US = 250000;
+
+static int8_t accelerate(uint16_t velocity) {
+    if (velocity < 10) return 1;
+    if (velocity < 20) return 2;
+    if (velocity < 35) return 4;
+    return 8;
+}
+
+static void push(const InputEvent &ev) {
+    g_lastEventMs = millis();
+    if (g_queueCount == INPUT_QUEUE_SIZE) { // full: the oldest event is the least relevant
+        g_queueHead = (g_queueHead + 1) % INPUT_QUEUE_SIZE;
+        g_queueCount--;
+    }
+    g_queue[(g_queueHead + g_queueCount) % INPUT_QUEUE_SIZE] = ev;
+    g_queueCount++;
+}
+
+// Consecutive detents of one direction collected in the same poll become one Rotate event
+static void pushRotate(int8_t dir, uint32_t us) {
+    uint16_t velocity = 0;
+    if (dir == g_lastDetentDir && us - g_lastDetentUs < SPIN_GAP_US && us != g_lastDetentUs) {
+        velocity = (uint16_t)(1000000UL / (us - g_lastDetentUs));
+    }
+    g_lastDetentDir = dir;
+    g_lastDetentUs = us;
+    int8_t steps = dir * accelerate(velocity);
+
+    if (g_queueCount) {
+        InputEvent &last = g_queue[(g_queueHead + g_queueCount - 1) % INPUT_QUEUE_SIZE];
+        if (last.type == InputType::Rotate && (last.detents > 0) == (dir > 0) &&
+            last.detents > -100 && last.detents < 100 && last.steps > -100 && last.steps < 100) {
+            last.detents += dir;
+            last.steps += steps;
+            if (velocity > last.velocity) last.velocity = velocity;
+            return;
+        }
+    }
+    InputEvent ev = {};
+    ev.type = InputType::Rotate;
+    ev.detents = dir;
+    ev.steps = steps;
+    ev.velocity = velocity;
+    ev.timeMs = us / 1000;
+    push(ev);
+}
+
+void inputBegin() {
+    g_waiter = xTaskGetCurrentTaskHandle();
+    pinMode(INPUT_ENCODER_PIN_A, INPUT_PULLUP);
+    pinMode(INPUT_ENCODER_PIN_B, INPUT_PULLUP);
+    g_quadState = (digitalRead(INPUT_ENCODER_PIN_A) ? 1 : 0) | (digitalRead(INPUT_ENCODER_PIN_B) ? 2 : 0);
+    attachInterrupt(INPUT_ENCODER_PIN_A, encoderIsr, CHANGE);
+    attachInterrupt(INPUT_ENCODER_PIN_B, encoderIsr, CHANGE);
+    attachInterrupt(INPUT_BUTTON_PIN, buttonIsr, FALLING);
+}
+
+void inputPoll() {
+    uint8_t tail = g_ringTail.load(std::memory_order_relaxed);
+    uint8_t head = g_ringHead.load(std::memory_order_acquire);
+    while (tail != head) {
+        pushRotate(g_ring[tail].dir, g_ring[tail].us);
+        tail = (tail + 1) & (ISR_RING_SIZE - 1);
+    }
+    g_ringTail.store(tail, std::memory_order_release);
+
+    int overflow = g_overflowDetents.exchange(0, std::memory_order_relaxed);
+    for (; overflow > 0; overflow--) pushRotate(1, micros());
+    for (; overflow < 0; overflow++) pushRotate(-1, micros());
+
+    uint32_t now = millis();
+    InputEvent ev = {};
+    ev.timeMs = now;
+    if (M5.BtnA.wasPressed()) {
+        ev.type = InputType::Press;
+        push(ev);
+        g_longPressSent = false;
+    }
+    if (M5.BtnA.wasHold()) {
+        ev.type = InputType::Hold;
+        push(ev);
+    }
+    if (M5.BtnA.pressedFor(INPUT_LONG_PRESS_MS) && !g_longPressSent) {
+        ev.type = InputType::LongPress;
+        push(ev);
+        g_longPressSent = true;
+    }
+    if (touchEnabled) {
+        auto t = M5Dial.Touch.getDetail();
+        if (t.wasClicked()) {
+            ev.type = InputType::Tap;
+            ev.x = t.x;
+            ev.y = t.y;
+            push(ev);
+        }
+    }
+}
+
+bool inputNext(InputEvent &ev) {
+    if (!g_queueCount) return false;
+    ev = g_queue[g_queueHead];
+    g_queueHead = (g_queueHead + 1) % INPUT_QUEUE_SIZE;
+    g_queueCount--;
+    return true;
+}
+
+uint32_t inputLastEventMs() {
+    return g_lastEventMs;
+}
+
+void inputFlush() {
+    g_queueHead = 0;
+    g_queueCount = 0;
+}
+
+void inputWake() {
+    if (g_waiter) xTaskNotifyGive(g_waiter);
+}
+
+bool inputWaitForEvent(uint32_t timeoutMs) {
+    if (g_queueCount || g_ringHead.load(std::memory_order_acquire) != g_ringTail.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    return ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs)) > 0;
+}
@@ -0,0 +1,131 @@
+#include "location_db.h"
+#include "location_record.h"
+#include <Arduino.h>
+#include "storage.h"
+
+#define FileSystem storageFs()
+#define LOCATION_DB_TMP_FILE "/locations.db.tmp"
+
+// Records in the log file (live + dead), drives compaction
+static uint32_t g_records = 0;
+
+static bool appendRecord(const DbRecord &r) {
+    File file = FileSystem.open(LOCATION_DB_FILE, FILE_APPEND);
+    if (!file) {
+        Serial.println(F("locationDb: failed to open log for append"));
+        return false;
+    }
+    size_t n = file.write(reinterpret_cast<const uint8_t*>(&r), sizeof(r));
+    file.close();
+    if (n != sizeof(r)) {
+        Serial.println(F("locationDb: short write (filesystem full?)"));
+        return false;
+    }
+    g_records++;
+    return true;
+}
+
+bool locationDbLoad(LocationStore &store) {
+    // A leftover temp file means a compaction was interrupted before its atomic rename; the old
+    // log is still intact then. Only a missing log (image written by an older build) uses it.
+    if (FileSystem.exists(LOCATION_DB_TMP_FILE)) {
+        if (FileSystem.exists(LOCATION_DB_FILE)) {
+            FileSystem.remove(LOCATION_DB_TMP_FILE);
+        } else {
+            FileSystem.rename(LOCATION_DB_TMP_FILE, LOCATION_DB_FILE);
+        }
+    }
+    if (!FileSystem.exists(LOCATION_DB_FILE)) return false;
+
+    File file = FileSystem.open(LOCATION_DB_FILE, FILE_READ);
+    if (!file) return false;
+
+    store.clear();
+    g_records = 0;
+    bool damaged = false;
+    uint32_t rejected = 0;
+    DbRecord r;
+    while (true) {
+        size_t n = file.read(reinterpret_cast<uint8_t*>(&r), sizeof(r));
+        if (n == 0) break;
+        // Only a short or corrupt record ends the replay; an intact record the store refuses
+        // (full, stale index) is skipped so the valid records after it survive
+        if (n != sizeof(r)) {
+            damaged = true;
+            break;
+        }
+        DbReplay result = locationRecordApply(store, r);
+        if (result == DbReplay::Corrupt) {
+            damaged = true;
+            break;
+        }
+        if (result == DbReplay::Rejected) {
+            rejected++;
+            Serial.printf("locationDb: record %lu (op %u, index %u) rejected, skipped\n",
+                (unsigned long)g_records, (unsigned)r.op, (unsigned)r.index);
+        }
+        g_records++;
+    }
+    file.close();
+
+    Serial.printf("locationDb: replayed %lu records, %u locations\n", (unsigned long)g_records, (unsigned)store.size());
+    if (rejected) {
+        Serial.printf("locationDb: %lu records could not be applied\n", (unsigned long)rejected);
+    }
+    if (damaged) {
+        Serial.println(F("locationDb: corrupt tail dropped"));
+        locationDbCompact(store);
+    }
+    return true;
+}
+
+bool locationDbAppendAdd(const char *name, double lat, double lon) {
+    DbRecord r;
+    locationRecordFill(r, DB_OP_ADD, 0, name, lat, lon);
+    return appendRecord(r);
+}
+
+bool locationDbAppendUpdate(uint16_t index, const char *name, double lat, double lon) {
+    DbRecord r;
+    locationRecordFill(r, DB_OP_UPDATE, index, name, lat, lon);
+    return appendRecord(r);
+}
+
+bool locationDbAppendRemove(uint16_t index) {
+    DbRecord r;
+    locationRecordFill(r, DB_OP_REMOVE, index, nullptr, 0.0, 0.0);
+    return appendRecord(r);
+}
+
+bool locationDbCompact(const LocationStore &store) {
+    File file = FileSystem.open(LOCATION_DB_TMP_FILE, FILE_WRITE);
+    if (!file) {
+        Serial.println(F("locationDb: failed to open temp file for compaction"));
+        return false;
+    }
+    bool ok = true;
+    DbRecord r;
+    for (size_t i = 0; i < store.size() && ok; i++) {
+        locationRecordFill(r, DB_OP_ADD, 0, store.name(i), store.lat(i), store.lon(i));
+        ok = file.write(reinterpret_cast<const uint8_t*>(&r), sizeof(r)) == sizeof(r);
+    }
+    file.close();
+    if (!ok) {
+        Serial.println(F("locationDb: compaction write failed, keeping old log"));
+        FileSystem.remove(LOCATION_DB_TMP_FILE);
+        return false;
+    }
+    // Atomic: a power cut leaves either the old or the compacted log
+    if (!storageReplace(LOCATION_DB_TMP_FILE, LOCATION_DB_FILE)) {
+        return false;
+    }
+    Serial.printf("locationDb: compacted %lu records to %u\n", (unsigned long)g_records, (unsigned)store.size());
+    g_records = store.size();
+    return true;
+}
+
+void locationDbMaybeCompact(const LocationStore &store) {
+    if (g_records > store.size() * 2 + 32) {
+        locationDbCompact(store);
+    }
+}
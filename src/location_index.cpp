@@ -0,0 +1,115 @@
+#include "location_index.h"
+#include <algorithm>
+#include <math.h>
+
+// Meters per 1e-7 degree of latitude (mean earth radius)
+static const float M_PER_E7 = 0.0111195f;
+
+// Query reference point; distances are compared squared, in E7 latitude units
+struct QueryRef {
+    int32_t latE7;
+    int32_t lonE7;
+    float cosLat; // shrinks longitude differences to latitude units
+};
+
+static QueryRef makeRef(double lat, double lon) {
+    QueryRef r;
+    r.latE7 = (int32_t)lround(lat * 1e7);
+    r.lonE7 = (int32_t)lround(lon * 1e7);
+    r.cosLat = (float)cos(lat * M_PI / 180.0);
+    return r;
+}
+
+static float distSqE7(const LocationStore &store, size_t i, const QueryRef &r) {
+    float dy = (float)(store.latE7(i) - r.latE7);
+    int64_t dl = (int64_t)store.lonE7(i) - r.lonE7;
+    if (dl > 1800000000LL) dl -= 3600000000LL;        // shorter way round the antimeridian
+    else if (dl < -1800000000LL) dl += 3600000000LL;
+    float dx = (float)dl * r.cosLat;
+    return dx * dx + dy * dy;
+}
+
+float LocationIndex::distanceM(const LocationStore &store, size_t i, double lat, double lon) {
+    return sqrtf(distSqE7(store, i, makeRef(lat, lon))) * M_PER_E7;
+}
+
+void LocationIndex::sync(const LocationStore &store) {
+    if (built_ && revision_ == store.revision()) return;
+    count_ = (uint16_t)store.size();
+    for (uint16_t i = 0; i < count_; i++) order_[i] = i;
+    std::sort(order_, order_ + count_, [&store](uint16_t a, uint16_t b) {
+        return store.latE7(a) < store.latE7(b);
+    });
+    revision_ = store.revision();
+    built_ = true;
+}
+
+size_t LocationIndex::lowerBound(const LocationStore &store, int32_t latE7) const {
+    size_t lo = 0, hi = count_;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (store.latE7(order_[mid]) < latE7) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+size_t LocationIndex::nearest(const LocationStore &store, double lat, double lon, size_t n, uint16_t *out) {
+    sync(store);
+    if (n > count_) n = count_;
+    if (n == 0) return 0;
+    QueryRef ref = makeRef(lat, lon);
+
+    // out[0..k) is a max-heap on distance: the root is the worst of the best k so far
+    auto key = [&](uint16_t idx) { return distSqE7(store, idx, ref); };
+    auto less = [&](uint16_t a, uint16_t b) { return key(a) < key(b); };
+    size_t k = 0;
+
+    size_t hi = lowerBound(store, ref.latE7); // first entry at or north of the reference
+    size_t lo = hi;                           // entries below lo are south of the reference
+    while (lo > 0 || hi < count_) {
+        // Take whichever side is closer in latitude; once even that gap cannot beat the
+        // current worst, nothing further out can either.
+        int64_t gapSouth = lo > 0 ? (int64_t)ref.latE7 - store.latE7(order_[lo - 1]) : INT64_MAX;
+        int64_t gapNorth = hi < count_ ? (int64_t)store.latE7(order_[hi]) - ref.latE7 : INT64_MAX;
+        bool south = gapSouth < gapNorth;
+        float gap = (float)(south ? gapSouth : gapNorth);
+        if (k == n && gap * gap >= key(out[0])) break;
+
+        uint16_t cand = south ? order_[--lo] : order_[hi++];
+        if (k < n) {
+            out[k++] = cand;
+            std::push_heap(out, out + k, less);
+        } else if (key(cand) < key(out[0])) {
+            std::pop_heap(out, out + k, less);
+            out[k - 1] = cand;
+            std::push_heap(out, out + k, less);
+        }
+    }
+    std::sort_heap(out, out + k, less); // ascending distance
+    return k;
+}
+
+size_t LocationIndex::within(const LocationStore &store, double lat, double lon, float radiusM, uint16_t *out, size_t maxOut) {
+    sync(store);
+    QueryRef ref = makeRef(lat, lon);
+    float radiusE7 = radiusM / M_PER_E7;
+    float radiusSq = radiusE7 * radiusE7;
+    int64_t south = (int64_t)ref.latE7 - (int64_t)radiusE7;
+    int64_t north = (int64_t)ref.latE7 + (int64_t)radiusE7;
+
+    if (south < INT32_MIN) south = INT32_MIN;
+
+    size_t found = 0;
+    for (size_t p = lowerBound(store, (int32_t)south); p < count_; p++) {
+        uint16_t idx = order_[p];
+        if (store.latE7(idx) > north) break;
+        if (distSqE7(store, idx, ref) > radiusSq) continue;
+        if (out) {
+            if (found >= maxOut) break;
+            out[found] = idx;
+        }
+        found++;
+    }
+    return found;
+}
@@ -0,0 +1,52 @@
+#include "location_record.h"
+#include <string.h>
+#include <math.h>
+#ifdef ESP_PLATFORM
+#include <esp_rom_crc.h>
+#endif
+
+uint32_t locationRecordCrc(const DbRecord &r) {
+    const uint8_t *p = reinterpret_cast<const uint8_t*>(&r);
+    size_t len = offsetof(DbRecord, crc);
+#ifdef ESP_PLATFORM
+    return esp_rom_crc32_le(0, p, len);
+#else
+    // Same CRC as the ROM routine, for host builds
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= p[i];
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+#endif
+}
+
+void locationRecordFill(DbRecord &r, DbOp op, uint16_t index, const char *name, double lat, double lon) {
+    memset(&r, 0, sizeof(r));
+    r.op = op;
+    r.index = index;
+    r.latE7 = (int32_t)lround(lat * 1e7);
+    r.lonE7 = (int32_t)lround(lon * 1e7);
+    if (name) {
+        size_t len = strnlen(name, LOCATION_NAME_MAX_LEN);
+        memcpy(r.name, name, len);
+        r.nameLen = (uint8_t)len;
+    }
+    r.crc = locationRecordCrc(r);
+}
+
+DbReplay locationRecordApply(LocationStore &store, const DbRecord &r) {
+    if (r.crc != locationRecordCrc(r)) return DbReplay::Corrupt;
+    char name[LOCATION_NAME_MAX_LEN + 1];
+    size_t len = r.nameLen < LOCATION_NAME_MAX_LEN ? r.nameLen : LOCATION_NAME_MAX_LEN;
+    memcpy(name, r.name, len);
+    name[len] = '\0';
+    bool ok;
+    switch (r.op) {
+        case DB_OP_ADD:    ok = store.add(name, r.latE7 / 1e7, r.lonE7 / 1e7); break;
+        case DB_OP_UPDATE: ok = store.update(r.index, name, r.latE7 / 1e7, r.lonE7 / 1e7); break;
+        case DB_OP_REMOVE: ok = store.remove(r.index); break;
+        default:           ok = false; break;
+    }
+    return ok ? DbReplay::Applied : DbReplay::Rejected;
+}
@@ -0,0 +1,98 @@
+#include "location_store.h"
+#include <string.h>
+#include <math.h>
+
+static int32_t toE7(double deg) {
+    return (int32_t)lround(deg * 1e7);
+}
+
+static size_t clampedNameLen(const char* name) {
+    size_t len = 0;
+    while (len < LOCATION_NAME_MAX_LEN && name[len]) len++;
+    return len;
+}
+
+void LocationStore::touch() {
+    static uint32_t nextRevision = 0;
+    revision_ = ++nextRevision;
+}
+
+SavedLocation LocationStore::operator[](size_t i) const {
+    SavedLocation loc;
+    loc.name = pool_ + nameOff_[i];
+    loc.lat = latE7_[i] / 1e7;
+    loc.lon = lonE7_[i] / 1e7;
+    return loc;
+}
+
+// Cut entry i's name out of the pool and shift the offsets of every name stored after it
+void LocationStore::removeName(size_t i) {
+    uint16_t off = nameOff_[i];
+    uint16_t len = (uint16_t)(strlen(pool_ + off) + 1);
+    memmove(pool_ + off, pool_ + off + len, poolUsed_ - off - len);
+    poolUsed_ -= len;
+    for (size_t k = 0; k < count_; ++k) {
+        if (nameOff_[k] > off) nameOff_[k] -= len;
+    }
+}
+
+bool LocationStore::appendName(size_t i, const char* name) {
+    if (!name) name = "";
+    size_t len = clampedNameLen(name);
+    if (poolUsed_ + len + 1 > LOCATION_STORE_NAME_POOL) return false;
+    memcpy(pool_ + poolUsed_, name, len);
+    pool_[poolUsed_ + len] = '\0';
+    nameOff_[i] = poolUsed_;
+    poolUsed_ += (uint16_t)(len + 1);
+    return true;
+}
+
+bool LocationStore::add(const char* name, double lat, double lon) {
+    if (count_ >= LOCATION_STORE_MAX) return false;
+    if (!appendName(count_, name)) return false;
+    latE7_[count_] = toE7(lat);
+    lonE7_[count_] = toE7(lon);
+    count_++;
+    touch();
+    return true;
+}
+
+bool LocationStore::update(size_t i, const char* name, double lat, double lon) {
+    if (i >= count_) return false;
+    if (!name) name = "";
+    size_t oldLen = strlen(pool_ + nameOff_[i]);
+    size_t newLen = clampedNameLen(name);
+    // Check before touching the pool so a failed rename leaves the entry intact
+    if (poolUsed_ - oldLen + newLen > LOCATION_STORE_NAME_POOL) return false;
+    // The name may live in our own pool, which moves underneath it during the rename
+    char copy[LOCATION_NAME_MAX_LEN + 1];
+    if (name >= pool_ && name < pool_ + poolUsed_) {
+        memcpy(copy, name, newLen);
+        copy[newLen] = '\0';
+        name = copy;
+    }
+    removeName(i);
+    appendName(i, name);
+    latE7_[i] = toE7(lat);
+    lonE7_[i] = toE7(lon);
+    touch();
+    return true;
+}
+
+bool LocationStore::remove(size_t i) {
+    if (i >= count_) return false;
+    removeName(i);
+    size_t tail = count_ - i - 1;
+    memmove(&latE7_[i], &latE7_[i + 1], tail * sizeof(latE7_[0]));
+    memmove(&lonE7_[i], &lonE7_[i + 1], tail * sizeof(lonE7_[0]));
+    memmove(&nameOff_[i], &nameOff_[i + 1], tail * sizeof(nameOff_[0]));
+    count_--;
+    touch();
+    return true;
+}
+
+void LocationStore::clear() {
+    count_ = 0;
+    poolUsed_ = 0;
+    touch();
+}
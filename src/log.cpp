@@ -0,0 +1,93 @@
+#include "log.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+static const size_t LOG_RING_SIZE = 4096;  // bytes of pending text
+static const size_t LOG_LINE_MAX = 160;    // longer lines are truncated
+static const uint32_t LOG_DRAIN_PERIOD_MS = 20;
+static const uint32_t LOG_TASK_STACK = 3072;
+
+// Byte ring; head/tail only move under g_logMux, which is held for a memcpy and never across I/O
+static char g_ring[LOG_RING_SIZE];
+static size_t g_head = 0; // next write
+static size_t g_tail = 0; // next read
+static uint32_t g_dropped = 0;
+static portMUX_TYPE g_logMux = portMUX_INITIALIZER_UNLOCKED;
+static bool g_started = false;
+
+static size_t ringUsed() {
+    return (g_head + LOG_RING_SIZE - g_tail) % LOG_RING_SIZE;
+}
+
+static void ringPush(const char *line, size_t len) {
+    portENTER_CRITICAL(&g_logMux);
+    if (len > LOG_RING_SIZE - 1 - ringUsed()) {
+        g_dropped++;
+    } else {
+        size_t first = LOG_RING_SIZE - g_head;
+        if (first > len) first = len;
+        memcpy(g_ring + g_head, line, first);
+        memcpy(g_ring, line + first, len - first);
+        g_head = (g_head + len) % LOG_RING_SIZE;
+    }
+    portEXIT_CRITICAL(&g_logMux);
+}
+
+// Copies the next contiguous run of pending text into out; returns its length
+static size_t ringPop(char *out, size_t max, uint32_t &dropped) {
+    portENTER_CRITICAL(&g_logMux);
+    size_t n = (g_head >= g_tail) ? g_head - g_tail : LOG_RING_SIZE - g_tail;
+    if (n > max) n = max;
+    memcpy(out, g_ring + g_tail, n);
+    g_tail = (g_tail + n) % LOG_RING_SIZE;
+    dropped = g_dropped;
+    g_dropped = 0;
+    portEXIT_CRITICAL(&g_logMux);
+    return n;
+}
+
+static bool drainOnce() {
+    char chunk[256];
+    uint32_t dropped = 0;
+    size_t n = ringPop(chunk, sizeof(chunk), dropped);
+    if (dropped) Serial.printf("[log] %lu lines dropped\n", (unsigned long)dropped);
+    if (n) Serial.write(reinterpret_cast<const uint8_t*>(chunk), n);
+    return n > 0;
+}
+
+static void logTask(void *) {
+    for (;;) {
+        while (drainOnce()) {}
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_PERIOD_MS));
+    }
+}
+
+void logBegin() {
+    if (g_started) return;
+    // Idle priority on core 0: only runs when the BLE host and boot work have nothing to do,
+    // and never competes with loop() on core 1
+    g_started = xTaskCreatePinnedToCore(logTask, "log", LOG_TASK_STACK, nullptr, tskIDLE_PRIORITY, nullptr, 0) == pdPASS;
+    if (!g_started) Serial.println(F("log: drain task failed to start, use logFlush()"));
+}
+
+void logFlush() {
+    while (drainOnce()) {}
+    Serial.flush();
+}
+
+void logWrite(char level, const char *tag, const char *fmt, ...) {
+    char line[LOG_LINE_MAX];
+    int n = snprintf(line, sizeof(line), "[%7lu][%c][%s] ", (unsigned long)millis(), level, tag);
+    if (n < 0) return;
+    size_t len = (size_t)n < sizeof(line) ? (size_t)n : sizeof(line) - 1;
+
+    va_list args;
+    va_start(args, fmt);
+    int m = vsnprintf(line + len, sizeof(line) - len, fmt, args);
+    va_end(args);
+    if (m > 0) len += ((size_t)m < sizeof(line) - len) ? (size_t)m : sizeof(line) - len - 1;
+
+    if (len > sizeof(line) - 2) len = sizeof(line) - 2; // room for the newline
+    line[len++] = '\n';
+    ringPush(line, len);
+}
@@ -0,0 +1,90 @@
+#include "memory_stats.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include "log.h"
+
+// Below these the log warns (rate-limited), well before allocations start failing
+static const uint32_t HEAP_LOW_BYTES = 24 * 1024;
+static const uint32_t BLOCK_LOW_BYTES = 8 * 1024;
+static const uint32_t STACK_LOW_BYTES = 512;
+
+// Tasks worth watching; the ones that do not exist in this build (other BLE stack) are skipped
+static const char *const WATCHED_TASKS[] = {
+    "loopTask",     // Arduino loop(): drawing, JSON parsing of BLE writes
+    "log",          // log drain (log.cpp)
+    "bootInit",     // deferred boot init, gone once it finishes
+    "btController", // Bluedroid controller
+    "BTC_TASK",     // Bluedroid callbacks (GATT write/read handlers run here)
+    "BTU_TASK",
+    "nimble_host",  // NimBLE host (callbacks run here)
+};
+static_assert(sizeof(WATCHED_TASKS) / sizeof(WATCHED_TASKS[0]) <= MEMSTATS_MAX_TASKS, "raise MEMSTATS_MAX_TASKS");
+
+static MemStats g_stats = {};
+static TaskStackInfo g_tasks[MEMSTATS_MAX_TASKS];
+static size_t g_taskCount = 0;
+static uint16_t g_history[MEMSTATS_HISTORY];
+static size_t g_historyCount = 0;
+static size_t g_historyNext = 0;
+static uint32_t g_lastSample = 0;
+static bool g_sampled = false;
+
+static void sample() {
+    g_stats.heapFree = heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+    g_stats.heapMinFree = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+    g_stats.heapLargest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+    g_stats.fragPct = g_stats.heapFree ? (uint8_t)(100 - (uint64_t)g_stats.heapLargest * 100 / g_stats.heapFree) : 0;
+    g_stats.psramSize = ESP.getPsramSize();
+    g_stats.psramFree = ESP.getFreePsram();
+
+    // ESP-IDF reports stack high-water marks in bytes
+    g_taskCount = 0;
+    g_stats.stackMinFree = UINT32_MAX;
+    for (const char *name : WATCHED_TASKS) {
+        TaskHandle_t h = xTaskGetHandle(name);
+        if (!h) continue;
+        uint32_t freeMin = (uint32_t)uxTaskGetStackHighWaterMark(h);
+        g_tasks[g_taskCount++] = { name, freeMin };
+        if (freeMin < g_stats.stackMinFree) g_stats.stackMinFree = freeMin;
+    }
+    if (g_taskCount == 0) g_stats.stackMinFree = 0;
+
+    g_history[g_historyNext] = (uint16_t)(g_stats.heapFree / 1024);
+    g_historyNext = (g_historyNext + 1) % MEMSTATS_HISTORY;
+    if (g_historyCount < MEMSTATS_HISTORY) g_historyCount++;
+    g_sampled = true;
+
+    if (g_stats.heapFree < HEAP_LOW_BYTES || g_stats.heapLargest < BLOCK_LOW_BYTES) {
+        LOGW_EVERY(30000, "mem", "heap low: %lu B free, largest block %lu B",
+            (unsigned long)g_stats.heapFree, (unsigned long)g_stats.heapLargest);
+    }
+    if (g_taskCount && g_stats.stackMinFree < STACK_LOW_BYTES) {
+        LOGW_EVERY(30000, "mem", "task stack low: %lu B left", (unsigned long)g_stats.stackMinFree);
+    }
+}
+
+void memStatsService() {
+    uint32_t now = millis();
+    if (g_sampled && now - g_lastSample < MEMSTATS_PERIOD_MS) return;
+    g_lastSample = now;
+    sample();
+}
+
+const MemStats &memStatsCurrent() {
+    if (!g_sampled) sample();
+    return g_stats;
+}
+
+size_t memStatsTasks(TaskStackInfo *out, size_t max) {
+    if (!g_sampled) sample();
+    size_t n = g_taskCount < max ? g_taskCount : max;
+    memcpy(out, g_tasks, n * sizeof(TaskStackInfo));
+    return n;
+}
+
+size_t memStatsHistory(uint16_t *outKb, size_t max) {
+    size_t n = g_historyCount < max ? g_historyCount : max;
+    size_t start = (g_historyNext + MEMSTATS_HISTORY - n) % MEMSTATS_HISTORY;
+    for (size_t i = 0; i < n; i++) outKb[i] = g_history[(start + i) % MEMSTATS_HISTORY];
+    return n;
+}
@@ -1,9 +1,10 @@
 #include "page/bluetoothinfo.h"
 #include "bluetooth.h"
-#include <BLEDevice.h>
+#include "input.h"
+#include "async.h"
+#include "ui/notifications.h"
+#include "log.h"
 
-extern bool bluetoothInfoActive;
-extern bool menuActive;
 extern bool btConnected;
 extern uint32_t lastBtConnectedTime;
 
@@ -28,7 +29,7 @@ void showBluetoothInfoPage() {
     int lineHeight = 25;  // Reduced line height from 30 to 25
     
     // Connection Status - using the global variable instead of checking advertising
-    // This avoids calling BLEDevice::getAdvertising() which might be causing issues
+    // This avoids querying the BLE stack for advertising state, which might be causing issues
     
     if (btConnected) {
         canvas.setTextColor(TFT_GREEN);
@@ -41,7 +42,7 @@ void showBluetoothInfoPage() {
     
     // Device information
     canvas.setTextColor(TFT_WHITE);
-    canvas.drawString(String("Name: ") + String(BluetoothName), canvas.width()/2, yPos);
+    canvas.drawString("Name: " BluetoothName, canvas.width()/2, yPos);
     yPos += lineHeight;
     
     // Service UUID info
@@ -51,17 +52,17 @@ void showBluetoothInfoPage() {
     // Connection duration if connected
     if (btConnected && lastBtConnectedTime > 0) {
         uint32_t connectedDuration = (millis() - lastBtConnectedTime) / 1000; // in seconds
-        String durationStr = "Connected: ";
+        char durationStr[32];
         
         if (connectedDuration < 60) {
             // Less than a minute
-            durationStr += String(connectedDuration) + " sec";
+            snprintf(durationStr, sizeof(durationStr), "Connected: %lu sec", (unsigned long)connectedDuration);
         } else if (connectedDuration < 3600) {
             // Less than an hour
-            durationStr += String(connectedDuration / 60) + "m " + String(connectedDuration % 60) + "s";
+            snprintf(durationStr, sizeof(durationStr), "Connected: %lum %lus", (unsigned long)(connectedDuration / 60), (unsigned long)(connectedDuration % 60));
         } else {
             // Hours and minutes
-            durationStr += String(connectedDuration / 3600) + "h " + String((connectedDuration % 3600) / 60) + "m";
+            snprintf(durationStr, sizeof(durationStr), "Connected: %luh %lum", (unsigned long)(connectedDuration / 3600), (unsigned long)((connectedDuration % 3600) / 60));
         }
         canvas.drawString(durationStr, canvas.width()/2, yPos);
         yPos += lineHeight;
@@ -80,64 +81,68 @@ void showBluetoothInfoPage() {
         static int lastBtnX=0,lastBtnY=0,lastBtnW=0,lastBtnH=0; lastBtnX=btnX; lastBtnY=btnY; lastBtnW=btnW; lastBtnH=btnH;
     }
     
-        // Don't push here; main loop will call drawPopupIfActive + pushSprite
+        // Don't push here; the page stack composites the popup and pushes
 }
 
 void handleBluetoothInfoInput() {
-    // Don't call M5.update() here as it's already called at the beginning of the main loop
-    
-    // Short press - return to menu
-    if (M5.BtnA.wasPressed()) {
-        bluetoothInfoActive = false;
-        menuActive = true; // Go back to the menu
-        Serial.println("Returning to menu from Bluetooth info");
-    }
-    
-    // Touch button detection (disconnect only if connected)
-    if(touchEnabled){
-        static int btnX,btnY,btnW,btnH; // will be set by drawing code via static storage; safe fallback
-        auto t = M5Dial.Touch.getDetail();
-        if(t.wasClicked()){
+    InputEvent ev;
+    while (inputNext(ev)) {
+        // Short press - return to menu
+        if (ev.type == InputType::Press) {
+            pagePop(); // Go back to the menu
+            LOGD("ui", "returning to menu from Bluetooth info");
+            return;
+        }
+
+        // Touch button detection (disconnect only if connected)
+        if (ev.type == InputType::Tap) {
             if(btConnected){
                 // Recompute button bounds (match drawing)
                 int w = M5Dial.Display.width();
                 int indicatorY = 70 + 25*4 + 70; // yPos logic mirrored
                 int calcBtnW=140; int calcBtnH=40; int calcBtnX=(w-calcBtnW)/2; int calcBtnY=indicatorY - calcBtnH/2; 
-                if(t.x>=calcBtnX && t.x<calcBtnX+calcBtnW && t.y>=calcBtnY && t.y<calcBtnY+calcBtnH){
+                if(ev.x>=calcBtnX && ev.x<calcBtnX+calcBtnW && ev.y>=calcBtnY && ev.y<calcBtnY+calcBtnH){
                     disconnectBluetooth();
                     showPopupNotification("Disconnecting",1500,TFT_WHITE,TFT_RED);
                 }
             }
             if(soundEnabled) M5Dial.Speaker.tone(650,25);
         }
+        // Encoder turns are not used on this page
     }
-    // Removed long-press actions per new UI spec
-    
-    // Check for encoder activity - can be used for additional interaction
-    int encoderValue = M5Dial.Encoder.read();
-    if (encoderValue != 0) {
-        M5Dial.Encoder.write(0); // Reset encoder value after reading
-        // Could add additional functionality here in the future
+}
+
+// Reset flow: message first (drawn by the next frames), then restart the stack and re-advertise
+static uint32_t resetBluetoothStep(uint8_t step) {
+    switch (step) {
+    case 0:
+        LOGI("ble", "reset requested");
+        showPopupNotification("Resetting Bluetooth...", 1500, TFT_WHITE, TFT_NAVY);
+        return 50; // let the popup reach the screen before the stack init takes the CPU
+    case 1:
+        // Call setupBLE() directly without trying to deinit
+        // The setupBLE() function should handle initialization properly (it restarts advertising)
+        setupBLE();
+        return 300; // settle before reporting
+    default:
+        showPopupNotification("Bluetooth ready", 1200, TFT_WHITE, TFT_BLUE);
+        return ASYNC_DONE;
     }
 }
 
 void resetBluetooth() {
-    // Simple visual feedback - avoid complex operations during reset
-    canvas.fillSprite(TFT_BLACK);
-    canvas.setTextDatum(MC_DATUM);
-    canvas.setTextSize(1.5);
-    canvas.setTextColor(TFT_WHITE);
-    canvas.drawString("Resetting Bluetooth...", canvas.width()/2, canvas.height()/2);
-    canvas.pushSprite(0, 0);
-    
-    Serial.println("Bluetooth reset requested");
-    
-    // Call setupBLE() directly without trying to deinit
-    // The setupBLE() function should handle initialization properly
-    setupBLE();
-    
-    delay(300); // Small delay for stability
-    
-    // Go back to info page
-        // Caller (reset flow) will handle popup compose+push
+    asyncRun("bleReset", resetBluetoothStep);
 }
+
+static void bluetoothInfoUpdate(uint32_t dtMs) {
+    (void)dtMs;
+    handleBluetoothInfoInput();
+}
+
+static void bluetoothInfoRender(M5Canvas &canvas, const DirtyRect &dirty) {
+    (void)dirty;
+    showBluetoothInfoPage();
+}
+
+// Connection state and duration change on their own; refreshed once a second
+const Page bluetoothInfoPage = { "bluetooth", nullptr, nullptr, bluetoothInfoUpdate, bluetoothInfoRender, 1000 };
@@ -0,0 +1,127 @@
+#include "page/compass.h"
+#include "sensor_processing.h"
+#include "drawing.h"
+#include "calculations.h"
+#include "gpsinfo.h"
+#include "bluetooth.h"
+#include "position_source.h"
+#include "boot.h"
+#include "track.h"
+#include "menu.h"
+#include "input.h"
+#include "ui/notifications.h"
+
+// Nav solution of the last update, drawn by compassRender()
+static double currentHeadingRadians = 0.0;
+static double arrowAngleOnCompassDegrees = 0.0;
+static bool locationIsValid = false;
+// Set by compassPreview(): the next render shows only the heading, no fix and no target
+static bool previewing = false;
+
+// What is on screen; a redraw is only needed when one of these moves
+static const double REDRAW_STEP_DEG = 0.5;
+static double drawnHeadingDeg = -1000.0;
+static double drawnArrowDeg = -1000.0;
+static bool drawnLocationValid = false;
+static bool drawnTargetSet = false;
+static char drawnAddress[LOCATION_NAME_MAX_LEN + 1];
+
+static bool angleMoved(double a, double b) {
+    double diff = fabs(fmod(a - b + 540.0, 360.0) - 180.0);
+    return diff >= REDRAW_STEP_DEG;
+}
+
+static void compassUpdate(uint32_t dtMs) {
+    (void)dtMs;
+    previewing = false;
+    InputEvent ev;
+    while (inputNext(ev)) {
+        if (ev.type != InputType::Press && ev.type != InputType::Hold) continue;
+        if (!bootDataReady()) {
+            showPopupNotification("Loading...", 1000, TFT_WHITE, TFT_BLUE, NotifyPriority::Low); // pages need the saved locations
+            continue;
+        }
+        Serial.println(ev.type == InputType::Press ? "Button A pressed" : "Returning to menu...");
+        pagePush(&menuPage);
+        return;
+    }
+
+    double currentHeadingDegrees = getSmoothedHeadingDegrees();
+    currentHeadingRadians = currentHeadingDegrees * M_PI / 180.0;
+
+    double targetBearingDegrees = 0.0;
+    arrowAngleOnCompassDegrees = 0.0;
+
+    // Best available location from GPS and/or BLE, chosen by expected error
+    double currentLat = 0.0;
+    double currentLon = 0.0;
+    PositionSource positionSource = positionSelect(currentLat, currentLon);
+    locationIsValid = (positionSource != PositionSource::None);
+
+    trackBacktrackUpdate(currentLat, currentLon, locationIsValid); // moves the target along the track
+    targetIsSet = (TARGET_LAT != 0.0 || TARGET_LON != 0.0);
+
+    if (locationIsValid && targetIsSet) {
+        targetBearingDegrees = calculateTargetBearing(
+            currentLat, currentLon,
+            TARGET_LAT, TARGET_LON
+        );
+        arrowAngleOnCompassDegrees = targetBearingDegrees - currentHeadingDegrees;
+        arrowAngleOnCompassDegrees = fmod(arrowAngleOnCompassDegrees + 360.0, 360.0);
+    }
+
+    // Hand the nav solution to the BLE telemetry stream (sent at the client-selected rate)
+    NavTelemetry telemetry;
+    telemetry.headingDeg = currentHeadingDegrees;
+    telemetry.fixValid = locationIsValid;
+    telemetry.fixFromBle = (positionSource == PositionSource::Ble);
+    telemetry.lat = currentLat;
+    telemetry.lon = currentLon;
+    telemetry.targetBearingValid = locationIsValid && targetIsSet;
+    telemetry.targetBearingDeg = targetBearingDegrees;
+    updateTelemetrySample(telemetry);
+
+    if (angleMoved(currentHeadingDegrees, drawnHeadingDeg) || angleMoved(arrowAngleOnCompassDegrees, drawnArrowDeg) ||
+        locationIsValid != drawnLocationValid || targetIsSet != drawnTargetSet || strncmp(Setaddress.c_str(), drawnAddress, sizeof(drawnAddress) - 1) != 0) {
+        drawnHeadingDeg = currentHeadingDegrees;
+        drawnArrowDeg = arrowAngleOnCompassDegrees;
+        drawnLocationValid = locationIsValid;
+        drawnTargetSet = targetIsSet;
+        snprintf(drawnAddress, sizeof(drawnAddress), "%s", Setaddress.c_str());
+        pageInvalidate();
+    }
+}
+
+static void compassRender(M5Canvas &canvas, const DirtyRect &dirty) {
+    (void)dirty;
+    canvas.fillSprite(TFT_BLACK); // Begin met een schone canvas
+    drawCompassBackgroundToCanvas(canvas, centerX, centerY, R, currentHeadingRadians);
+    drawCompassLabels(canvas, currentHeadingRadians, centerX, centerY, R);
+    bool gpsValid = !previewing && gps.location.isValid();
+    bool usingBlePosition = !previewing && getFixQuality() == 9;
+    drawGpsInfo(canvas, gpsValid, usingBlePosition, centerX, centerY);
+    // Below the centre, above the target line; the arrow is drawn over it when it points down
+    drawHeadingValue(canvas, currentHeadingRadians * 180.0 / M_PI, centerX, centerY + 24);
+
+    if (previewing || !targetIsSet) {
+        drawStatusMessage(canvas, "No Target", centerX, centerY + 50, TFT_RED, TFT_WHITE);
+    } else {
+        if (locationIsValid) {
+            drawTargetArrow(canvas, arrowAngleOnCompassDegrees, centerX, centerY, R);
+        }
+        //draw target name
+        char label[LOCATION_NAME_MAX_LEN + 9];
+        snprintf(label, sizeof(label), "Target: %s", Setaddress.c_str());
+        drawStatusMessage(canvas, label, centerX, centerY + 50, TFT_BLUE, TFT_WHITE);
+    }
+}
+
+void compassPreview(double headingDeg) {
+    currentHeadingRadians = headingDeg * M_PI / 180.0;
+    arrowAngleOnCompassDegrees = 0.0;
+    previewing = true;
+    drawnHeadingDeg = -1000.0; // redraw with the live heading afterwards
+}
+
+// GPS/BLE status text changes without the heading moving, so it refreshes once a second as well
+const Page compassPage = { "compass", nullptr, nullptr, compassUpdate, compassRender, 1000 };
@@ -0,0 +1,103 @@
+#include "page/diagnostics.h"
+#include "memory_stats.h"
+#include "input.h"
+#include "frame_governor.h"
+
+// Trend graph of heap free over the last MEMSTATS_HISTORY samples
+static void drawHeapTrend(M5Canvas &canvas, int x, int y, int w, int h) {
+    uint16_t hist[MEMSTATS_HISTORY];
+    size_t n = memStatsHistory(hist, MEMSTATS_HISTORY);
+    canvas.drawRect(x, y, w, h, TFT_DARKGREY);
+    if (n < 2) return;
+
+    uint16_t lo = hist[0], hi = hist[0];
+    for (size_t i = 1; i < n; i++) {
+        if (hist[i] < lo) lo = hist[i];
+        if (hist[i] > hi) hi = hist[i];
+    }
+    if (hi - lo < 4) { lo = lo > 2 ? lo - 2 : 0; hi = lo + 4; } // keep a flat line off the frame
+    int prevX = 0, prevY = 0;
+    for (size_t i = 0; i < n; i++) {
+        int px = x + 1 + (int)(i * (w - 3) / (MEMSTATS_HISTORY - 1));
+        int py = y + h - 2 - (int)((hist[i] - lo) * (h - 3) / (hi - lo));
+        if (i) canvas.drawLine(prevX, prevY, px, py, TFT_GREEN);
+        prevX = px; prevY = py;
+    }
+}
+
+void drawDiagnosticsPage(M5Canvas &canvas, int centerX, int centerY) {
+    const MemStats &m = memStatsCurrent();
+    canvas.fillSprite(TFT_BLACK);
+    canvas.setTextDatum(MC_DATUM);
+    canvas.setTextSize(1);
+    char buffer[48];
+
+    int yPos = 28;
+    int lineHeight = 16;
+    canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+    canvas.drawString("Diagnostics", centerX, yPos);
+    yPos += lineHeight + 4;
+
+    sprintf(buffer, "Heap: %lu KB free (min %lu)", (unsigned long)(m.heapFree / 1024), (unsigned long)(m.heapMinFree / 1024));
+    canvas.drawString(buffer, centerX, yPos);
+    yPos += lineHeight;
+
+    canvas.setTextColor(m.fragPct > 50 ? TFT_ORANGE : TFT_WHITE, TFT_BLACK);
+    sprintf(buffer, "Largest: %lu KB (frag %u%%)", (unsigned long)(m.heapLargest / 1024), (unsigned)m.fragPct);
+    canvas.drawString(buffer, centerX, yPos);
+    yPos += lineHeight;
+
+    canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+    if (m.psramSize) {
+        sprintf(buffer, "PSRAM: %lu / %lu KB free", (unsigned long)(m.psramFree / 1024), (unsigned long)(m.psramSize / 1024));
+    } else {
+        sprintf(buffer, "PSRAM: none");
+    }
+    canvas.drawString(buffer, centerX, yPos);
+    yPos += lineHeight;
+
+    // Frame pacing of the current mode (current is an estimate, see frame_governor.cpp)
+    GovMode mode = governorMode();
+    GovModeStats g = governorStats(mode);
+    sprintf(buffer, "Loop: %s %.1f fps ~%.0f mA", governorModeName(mode), g.fps, g.estCurrentMa);
+    canvas.drawString(buffer, centerX, yPos);
+    yPos += lineHeight + 4;
+
+    // Stack headroom per task
+    TaskStackInfo tasks[MEMSTATS_MAX_TASKS];
+    size_t n = memStatsTasks(tasks, MEMSTATS_MAX_TASKS);
+    for (size_t i = 0; i < n; i++) {
+        canvas.setTextColor(tasks[i].freeMin < 512 ? TFT_RED : TFT_LIGHTGREY, TFT_BLACK);
+        sprintf(buffer, "%s: %lu B", tasks[i].name, (unsigned long)tasks[i].freeMin);
+        canvas.drawString(buffer, centerX, yPos);
+        yPos += lineHeight - 2;
+    }
+
+    drawHeapTrend(canvas, centerX - 60, yPos + 2, 120, 28);
+
+    canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+    canvas.drawString("Press to go back", centerX, canvas.height() - 20);
+}
+
+void handleDiagnosticsInput() {
+    InputEvent ev;
+    while (inputNext(ev)) {
+        if (ev.type == InputType::Press) {
+            pagePop();
+            return;
+        }
+    }
+}
+
+static void diagnosticsUpdate(uint32_t dtMs) {
+    (void)dtMs;
+    handleDiagnosticsInput();
+}
+
+static void diagnosticsRender(M5Canvas &canvas, const DirtyRect &dirty) {
+    (void)dirty;
+    drawDiagnosticsPage(canvas, centerX, centerY);
+}
+
+// Redrawn once per memory sample
+const Page diagnosticsPage = { "diagnostics", nullptr, nullptr, diagnosticsUpdate, diagnosticsRender, MEMSTATS_PERIOD_MS };
@@ -1,4 +1,5 @@
 #include "gpsinfo.h" // Assuming gps_info.h is in the same directory or include path
+#include "input.h"
 
 // Define the global variables
 double latitude_ = 0.0;
@@ -133,8 +134,24 @@ void drawGpsInfoPage(M5Canvas &canvas, int centerX, int centerY) {
 }
 
 void handleGpsInfoInput(){
-    if (M5.BtnA.wasPressed()) {
-        gpsinfoActive = false; 
-        menuActive = true;    
+    InputEvent ev;
+    while (inputNext(ev)) {
+        if (ev.type == InputType::Press) {
+            pagePop();
+            return;
+        }
     }
-}
\ No newline at end of file
+}
+
+static void gpsInfoUpdate(uint32_t dtMs) {
+    (void)dtMs;
+    handleGpsInfoInput();
+}
+
+static void gpsInfoRender(M5Canvas &canvas, const DirtyRect &dirty) {
+    (void)dirty;
+    drawGpsInfoPage(canvas, centerX, centerY);
+}
+
+// Values come from the GPS/BLE position updates; refreshed twice a second
+const Page gpsInfoPage = { "gpsinfo", nullptr, nullptr, gpsInfoUpdate, gpsInfoRender, 500 };
@@ -1,73 +1,152 @@
 #include "saved_locations.h"
 #include "menu.h"
 #include "bluetooth.h" // For publishTargetCharacteristic / publishReady
+#include "location_db.h"
+#include "storage.h"
+#include "location_index.h"
+#include "position_source.h"
+#include "input.h"
+#include "ui/text_cache.h"
+#include "ui/notifications.h"
+#include <new>
 
-#define FileSystem SPIFFS
-#define SAVED_LOCATIONS_FILE "/saved_locations.json"
+#define FileSystem storageFs()
+#define SAVED_LOCATIONS_FILE "/saved_locations.json" // import/export format, the list itself lives in LOCATION_DB_FILE
 
-std::vector<SavedLocation> savedLocations;
+LocationStore savedLocations;
+static LocationIndex locationIndex;
+
+// List page order: nearest first while a fix is available, stored order otherwise.
+// Re-sorted only when the store changes or the fix moves more than LIST_RESORT_DISTANCE_M.
+static const float LIST_RESORT_DISTANCE_M = 25.0f;
+static const float NEARBY_RADIUS_M = 5000.0f;
+static uint16_t listOrder[LOCATION_STORE_MAX];
+static int selectedRank = 0;           // position of selectedLocationIndex in listOrder
+static bool listHasFix = false;
+static double listRefLat = 0.0, listRefLon = 0.0;
+static uint32_t listRevision = 0;
+static size_t nearbyCount = 0;         // entries within NEARBY_RADIUS_M of the fix
 
 
 // Example initial locations if file doesn't exist (optional)
 void addDefaultLocations() {
     if (savedLocations.empty()) { // Only add if the list is empty after trying to load
-        const char* name1 = "Eindhoven";
-        char* name1_copy = new char[strlen(name1) + 1];
-        strcpy(name1_copy, name1);
-        savedLocations.push_back({name1_copy, 51.4392648, 5.478633});
-
-        const char* name2 = "Helmond";
-        char* name2_copy = new char[strlen(name2) + 1];
-        strcpy(name2_copy, name2);
-        savedLocations.push_back({name2_copy, 51.4790956, 5.6557686});
-
-        const char* name3 = "Parijs";
-        char* name3_copy = new char[strlen(name3) + 1];
-        strcpy(name3_copy, name3);
-        savedLocations.push_back({name3_copy, 48.8534951, 2.3483915});
+        savedLocations.add("Eindhoven", 51.4392648, 5.478633);
+        savedLocations.add("Helmond", 51.4790956, 5.6557686);
+        savedLocations.add("Parijs", 48.8534951, 2.3483915);
         
         saveSavedLocations(); // Save them if added
     }
 }
 
-void loadSavedLocations() {
-    // Example using SPIFFS and ArduinoJson
-    // Ensure FileSystem.begin() has been called in setup()
-    if (FileSystem.exists(SAVED_LOCATIONS_FILE)) {
-        File file = FileSystem.open(SAVED_LOCATIONS_FILE, "r");
-        if (file) {
-            DynamicJsonDocument doc(2048); // Adjust size as needed
-            DeserializationError error = deserializeJson(doc, file);
+// Read-side Stream over a File with a small buffer. ArduinoJson and Stream::find() pull one byte
+// at a time, which is slow straight from the filesystem.
+class BufferedFileStream : public Stream {
+public:
+    explicit BufferedFileStream(File &file) : file_(file) { setTimeout(0); } // no waiting at EOF
+    int available() override { return (int)(len_ - pos_) + file_.available(); }
+    int read() override { return fill() ? buf_[pos_++] : -1; }
+    int peek() override { return fill() ? buf_[pos_] : -1; }
+    size_t write(uint8_t) override { return 0; }
+
+private:
+    bool fill() {
+        if (pos_ < len_) return true;
+        len_ = file_.read(buf_, sizeof(buf_));
+        pos_ = 0;
+        return len_ > 0;
+    }
+
+    File &file_;
+    uint8_t buf_[256];
+    size_t len_ = 0;
+    size_t pos_ = 0;
+};
+
+LocationImport importSavedLocationsJson() {
+    File file = FileSystem.open(SAVED_LOCATIONS_FILE, "r");
+    if (!file) {
+        Serial.println(F("Failed to open saved_locations.json for reading"));
+        return LocationImport::Failed;
+    }
+    // Parse into a scratch store so a bad file leaves the current list untouched.
+    // It is ~22 KB, too big for the loop task's stack.
+    LocationStore *imported = new (std::nothrow) LocationStore();
+    if (!imported) {
+        Serial.println(F("Import failed: out of memory"));
+        file.close();
+        return LocationImport::Failed;
+    }
+    BufferedFileStream in(file);
+
+    // Only these keys are kept from each element; anything else is skipped while parsing
+    JsonDocument filter;
+    filter["name"] = true;
+    filter["lat"] = true;
+    filter["lon"] = true;
+    filter["latitude"] = true;
+    filter["longitude"] = true;
+
+    uint32_t t0 = millis();
+    size_t skipped = 0;
+    size_t dropped = 0; // valid entries that did not fit
+    bool ok = in.find("[");
+    if (!ok) Serial.println(F("Import failed: no JSON array in saved_locations.json"));
+    // Walk the top-level array one element at a time: only one small object is in RAM at once
+    if (ok) {
+        do {
+            JsonDocument doc;
+            DeserializationError error = deserializeJson(doc, in,
+                DeserializationOption::Filter(filter), DeserializationOption::NestingLimit(4));
             if (error) {
-                Serial.print(F("deserializeJson() failed: "));
+                Serial.print(F("Import failed, deserializeJson() failed: "));
                 Serial.println(error.c_str());
-            } else {
-                JsonArray array = doc.as<JsonArray>();
-
-                // Before clearing, delete any dynamically allocated names from the current vector
-                for (const auto& loc : savedLocations) {
-                    delete[] loc.name; // Free memory if it was dynamically allocated
-                }
-                savedLocations.clear(); // Now clear the vector of SavedLocation objects
-
-                for (JsonObject obj : array) {
-                    const char* name_from_json = obj["name"]; 
-                    double lat_from_json = obj["lat"]; //.as<double>(); // Be explicit if needed
-                    double lon_from_json = obj["lon"]; //.as<double>();
-
-                    if (name_from_json) { // Check if name exists in JSON
-                        char* name_copy = new char[strlen(name_from_json) + 1];
-                        strcpy(name_copy, name_from_json);
-                        savedLocations.push_back({name_copy, lat_from_json, lon_from_json});
-                    } else {
-                        Serial.println(F("Warning: Location in JSON missing name. Skipping."));
-                    }
-                }
+                ok = false;
+                break;
             }
-            file.close();
-        } else {
-            Serial.println(F("Failed to open saved_locations.json for reading"));
-        }
+            if (doc.isNull()) break; // empty array: the parser only saw the closing bracket
+            const char* name = doc["name"] | "Unnamed";
+            bool hasLatLon = doc["lat"].is<double>() && doc["lon"].is<double>();
+            double lat = hasLatLon ? doc["lat"].as<double>() : doc["latitude"].as<double>();
+            double lon = hasLatLon ? doc["lon"].as<double>() : doc["longitude"].as<double>();
+            bool valid = (hasLatLon || (doc["latitude"].is<double>() && doc["longitude"].is<double>()))
+                && lat >= -90 && lat <= 90 && lon >= -180 && lon <= 180;
+            if (!valid) {
+                skipped++;
+            } else if (dropped || !imported->add(name, lat, lon)) {
+                dropped++; // keep parsing, so the popup can tell how many were left out
+            }
+        } while (in.findUntil(",", "]"));
+    }
+    file.close();
+    if (ok) {
+        savedLocations = *imported;
+        Serial.printf("Imported %u locations (%u skipped) in %lu ms\n",
+            (unsigned)savedLocations.size(), (unsigned)skipped, (unsigned long)(millis() - t0));
+        saveSavedLocations(); // one database snapshot for the whole import
+    }
+    delete imported;
+    if (!ok) return LocationImport::Failed;
+    if (dropped) {
+        size_t kept = savedLocations.size();
+        Serial.printf("Warning: location store full, %u of %u locations imported\n",
+            (unsigned)kept, (unsigned)(kept + dropped));
+        char msg[40];
+        snprintf(msg, sizeof(msg), "Store full: %u of %u", (unsigned)kept, (unsigned)(kept + dropped));
+        showPopupNotification(msg, 4000, TFT_WHITE, TFT_ORANGE, NotifyPriority::High);
+        return LocationImport::Partial;
+    }
+    return LocationImport::Complete;
+}
+
+void loadSavedLocations() {
+    // Ensure storageBegin() has been called in setup()
+    if (locationDbLoad(savedLocations)) {
+        // Normal boot: the binary log is authoritative
+    } else if (FileSystem.exists(SAVED_LOCATIONS_FILE)) {
+        // First boot after upgrading: import the old JSON list once, then keep it as an export
+        Serial.println(F("No location database yet, importing saved_locations.json"));
+        importSavedLocationsJson();
     } else {
         Serial.println(F("saved_locations.json not found. Loading defaults."));
         addDefaultLocations(); // Load defaults if file doesn't exist
@@ -76,34 +155,110 @@ void loadSavedLocations() {
 }
 
 void saveSavedLocations() {
-    // Example using SPIFFS and ArduinoJson
-    File file = FileSystem.open(SAVED_LOCATIONS_FILE, "w");
-    if (file) {
-        StaticJsonDocument<2048> doc; // Adjust size as needed
-        JsonArray array = doc.to<JsonArray>();
-        for (const auto& loc : savedLocations) {
-            JsonObject obj = array.createNestedObject();
-            obj["name"] = loc.name; // If name is String, this is fine. If const char*, also fine.
-            obj["lat"] = loc.lat;
-            obj["lon"] = loc.lon;
-        }
-        if (serializeJson(doc, file) == 0) {
-            Serial.println(F("Failed to write to file"));
-        }
-        file.close();
-        Serial.println(F("Saved locations to file."));
-    } else {
+    // Snapshot of the whole list; single edits are appended by the helpers below
+    if (locationDbCompact(savedLocations)) {
+        Serial.println(F("Saved locations to database."));
+    }
+}
+
+bool addSavedLocation(const char* name, double lat, double lon) {
+    if (!savedLocations.add(name, lat, lon)) return false;
+    locationDbAppendAdd(name, lat, lon);
+    locationDbMaybeCompact(savedLocations);
+    return true;
+}
+
+bool updateSavedLocation(size_t index, const char* name, double lat, double lon) {
+    if (!savedLocations.update(index, name, lat, lon)) return false;
+    locationDbAppendUpdate((uint16_t)index, name, lat, lon);
+    locationDbMaybeCompact(savedLocations);
+    return true;
+}
+
+bool removeSavedLocation(size_t index) {
+    if (!savedLocations.remove(index)) return false;
+    locationDbAppendRemove((uint16_t)index);
+    locationDbMaybeCompact(savedLocations);
+    return true;
+}
+
+bool exportSavedLocationsJson() {
+    const char* tmpPath = SAVED_LOCATIONS_FILE ".tmp";
+    File file = FileSystem.open(tmpPath, "w");
+    if (!file) {
         Serial.println(F("Failed to open saved_locations.json for writing"));
+        return false;
+    }
+    // One small document per entry streamed straight to the file, so the export size is not
+    // limited by RAM (mirror of importSavedLocationsJson())
+    file.print('[');
+    for (size_t i = 0; i < savedLocations.size(); i++) {
+        if (i > 0) file.print(',');
+        JsonDocument obj;
+        obj["name"] = savedLocations.name(i);
+        obj["lat"] = savedLocations.lat(i);
+        obj["lon"] = savedLocations.lon(i);
+        serializeJson(obj, file);
     }
+    file.print(']');
+    file.close();
+    if (!storageReplace(tmpPath, SAVED_LOCATIONS_FILE)) return false;
+    Serial.print("Exported "); Serial.print(savedLocations.size()); Serial.println(" locations to JSON.");
+    return true;
+}
+
+// Short-range ground distance in meters (equirectangular)
+static float approxDistanceM(double lat1, double lon1, double lat2, double lon2) {
+    double x = (lon2 - lon1) * cos((lat1 + lat2) * 0.5 * M_PI / 180.0);
+    double y = lat2 - lat1;
+    return (float)(sqrt(x * x + y * y) * 111195.0);
+}
+
+// Returns true if the order was rebuilt
+static bool refreshListOrder(bool force) {
+    double lat = 0.0, lon = 0.0;
+    bool hasFix = positionSelect(lat, lon) != PositionSource::None;
+    bool storeChanged = savedLocations.revision() != listRevision;
+    bool moved = hasFix && (!listHasFix || approxDistanceM(listRefLat, listRefLon, lat, lon) > LIST_RESORT_DISTANCE_M);
+    if (!force && !storeChanged && !moved && hasFix == listHasFix) return false;
+
+    size_t count = savedLocations.size();
+    if (hasFix) {
+        locationIndex.nearest(savedLocations, lat, lon, count, listOrder);
+        nearbyCount = locationIndex.within(savedLocations, lat, lon, NEARBY_RADIUS_M, nullptr, 0);
+        listRefLat = lat;
+        listRefLon = lon;
+    } else {
+        for (size_t i = 0; i < count; i++) listOrder[i] = (uint16_t)i;
+        nearbyCount = 0;
+    }
+    listHasFix = hasFix;
+    listRevision = savedLocations.revision();
+
+    // Keep the highlighted entry under the cursor while the order changes around it
+    selectedRank = 0;
+    for (size_t r = 0; r < count; r++) {
+        if (listOrder[r] == selectedLocationIndex) { selectedRank = (int)r; break; }
+    }
+    selectedLocationIndex = count ? listOrder[selectedRank] : 0;
+    return true;
+}
+
+void warmSavedLocationsIndex() {
+    uint32_t t0 = micros();
+    locationIndex.sync(savedLocations);
+    Serial.printf("Location index built in %lu us\n", (unsigned long)(micros() - t0));
 }
 
 void initSavedLocationsMenu() {
-    selectedLocationIndex = 0;
-    encoder_click_accumulator = 0; // Reset accumulator for this menu
+    refreshListOrder(true);
+    selectedRank = 0; // nearest (or first) entry
+    selectedLocationIndex = savedLocations.empty() ? 0 : listOrder[0];
     Serial.println("Saved Locations Menu Initialized");
 }
 
 void drawSavedLocationsMenu(M5Canvas &canvas, int centerX, int centerY) {
+    refreshListOrder(false);
     canvas.fillSprite(TFT_BLACK);
     canvas.setTextDatum(MC_DATUM); // Center datum for all text
     canvas.setTextColor(TFT_WHITE);
@@ -119,76 +274,67 @@ void drawSavedLocationsMenu(M5Canvas &canvas, int centerX, int centerY) {
 
     // Display Previous Item (with wrap around)
     if (savedLocations.size() > 1) { // Only show if there's more than one item
-        int prevIndex = (selectedLocationIndex - 1 + savedLocations.size()) % savedLocations.size();
-        canvas.setTextSize(1); // Smaller font size
-        canvas.setTextColor(TFT_WHITE);
-        canvas.drawString(String(savedLocations[prevIndex].name), centerX, prevY);
+        int prevIndex = listOrder[(selectedRank - 1 + savedLocations.size()) % savedLocations.size()];
+        drawTextCached(canvas, savedLocations[prevIndex].name, centerX, prevY, MC_DATUM, 1, TFT_WHITE); // Smaller font size
     }
 
     // Display Selected Item
     if (savedLocations.size() > 0) { // Ensure there's at least one item to display
-        canvas.setTextSize(3); // Larger font size
-        canvas.setTextColor(TFT_YELLOW); // Highlight selected item
-        canvas.drawString(String(savedLocations[selectedLocationIndex].name), centerX, selectedY);
+        // Larger font size, highlighted
+        drawTextCached(canvas, savedLocations[selectedLocationIndex].name, centerX, selectedY, MC_DATUM, 3, TFT_YELLOW);
+
+        if (listHasFix) {
+            float d = LocationIndex::distanceM(savedLocations, selectedLocationIndex, listRefLat, listRefLon);
+            char distText[16];
+            if (d < 1000.0f) snprintf(distText, sizeof(distText), "%d m", (int)d);
+            else snprintf(distText, sizeof(distText), "%.1f km", d / 1000.0f);
+            canvas.setTextSize(1);
+            canvas.setTextColor(TFT_LIGHTGREY);
+            canvas.drawString(distText, centerX, selectedY + 24);
+        }
     }
 
 
     // Display Next Item (with wrap around)
     if (savedLocations.size() > 1) { // Only show if there's more than one item
-        int nextIndex = (selectedLocationIndex + 1) % savedLocations.size();
-        canvas.setTextSize(1); // Smaller font size
-        canvas.setTextColor(TFT_WHITE);
-        canvas.drawString(String(savedLocations[nextIndex].name), centerX, nextY);
+        int nextIndex = listOrder[(selectedRank + 1) % savedLocations.size()];
+        drawTextCached(canvas, savedLocations[nextIndex].name, centerX, nextY, MC_DATUM, 1, TFT_WHITE); // Smaller font size
     }
 
     // Footer instructions
     canvas.setTextSize(1); // Reset text size for footer
+    if (listHasFix) {
+        char nearbyText[24];
+        snprintf(nearbyText, sizeof(nearbyText), "%d within 5 km", (int)nearbyCount);
+        canvas.setTextColor(TFT_LIGHTGREY);
+        canvas.drawString(nearbyText, centerX, canvas.height() - 40);
+    }
     canvas.setTextColor(TFT_CYAN);
     canvas.drawString("Press to Select", centerX, canvas.height() - 25);
 }
 
 
 void handleSavedLocationsInput() {
-    if (savedLocations.empty()) return; // No input if no locations
-
-    // Assuming ENCODER_COUNTS_PER_DETENT and encoder_click_accumulator are available
-    // Ensure encoder_click_accumulator is declared/managed appropriately (e.g., global or passed)
-    extern int encoder_click_accumulator; // If it's a global from menu.cpp or main.cpp
-    extern const int ENCODER_COUNTS_PER_DETENT; // If it's a global const
-
-    int raw_encoder_change = M5Dial.Encoder.read();
-    if (raw_encoder_change != 0) {
-        M5Dial.Encoder.write(0);
-    }
-    encoder_click_accumulator += raw_encoder_change;
-
-    if (ENCODER_COUNTS_PER_DETENT > 0 && !savedLocations.empty()) {
-        if (encoder_click_accumulator >= ENCODER_COUNTS_PER_DETENT) {
-            int num_detents = encoder_click_accumulator / ENCODER_COUNTS_PER_DETENT;
-            for (int i = 0; i < num_detents; ++i) {
-                selectedLocationIndex++;
-                if (selectedLocationIndex >= savedLocations.size()) {
-                    selectedLocationIndex = 0;
-                }
-            }
-            encoder_click_accumulator %= ENCODER_COUNTS_PER_DETENT;
-        } else if (encoder_click_accumulator <= -ENCODER_COUNTS_PER_DETENT) {
-            int num_detents = -encoder_click_accumulator / ENCODER_COUNTS_PER_DETENT;
-            for (int i = 0; i < num_detents; ++i) {
-                selectedLocationIndex--;
-                if (selectedLocationIndex < 0) {
-                    selectedLocationIndex = savedLocations.size() - 1;
-                }
-            }
-            encoder_click_accumulator = -(-encoder_click_accumulator % ENCODER_COUNTS_PER_DETENT);
-        }
-    }
+    InputEvent ev;
+    while (inputNext(ev)) {
+        if (savedLocations.empty()) continue; // No input if no locations
 
-    if (M5.BtnA.wasPressed()) {
-        if (!savedLocations.empty()) {
+        if (ev.type == InputType::Rotate) {
+            // Accelerated: a fast spin skips through long lists
+            int count = (int)savedLocations.size();
+            if (savedLocations.revision() != listRevision) refreshListOrder(true);
+            selectedRank = ((selectedRank + ev.steps) % count + count) % count;
+            selectedLocationIndex = listOrder[selectedRank];
+            pageInvalidate();
+        } else if (ev.type == InputType::Press) {
+            if (selectedLocationIndex < 0 || (size_t)selectedLocationIndex >= savedLocations.size()) {
+                refreshListOrder(true); // store shrank under us; re-select and let the user confirm
+                pageInvalidate();
+                continue;
+            }
             TARGET_LAT = savedLocations[selectedLocationIndex].lat;
             TARGET_LON = savedLocations[selectedLocationIndex].lon;
-            Setaddress = savedLocations[selectedLocationIndex].name; // If name is const char*, this is fine. If String, Setaddress should be String.
+            Setaddress = savedLocations[selectedLocationIndex].name;
             targetIsSet = true; 
             
             Serial.print("Target set from saved: "); Serial.println(Setaddress);
@@ -198,8 +344,23 @@ void handleSavedLocationsInput() {
             // Update ready characteristic (hasTarget field)
             publishReady(true);
             
-            savedLocationsMenuActive = false; 
-            menuActive = false;             
+            pagePopToRoot(); // back to the compass, now pointing at the new target
         }
     }
 }
+
+static void savedLocationsUpdate(uint32_t dtMs) {
+    (void)dtMs;
+    // BLE add/delete/import run in the same loop; the order input maps through must match the store
+    if (refreshListOrder(false)) pageInvalidate();
+    handleSavedLocationsInput();
+}
+
+static void savedLocationsRender(M5Canvas &canvas, const DirtyRect &dirty) {
+    (void)dirty;
+    drawSavedLocationsMenu(canvas, centerX, centerY);
+}
+
+// Distances and the nearest-first order follow the position; refreshed once a second
+const Page savedLocationsPage = { "savedlocations", initSavedLocationsMenu, nullptr, savedLocationsUpdate, savedLocationsRender, 1000 };
+
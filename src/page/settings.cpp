@@ -1,71 +1,146 @@
 #include "page/settings.h"
 #include "menu.h"
+#include "storage.h"
+#include "log.h"
+#include "track.h"
+#include "input.h"
+#include "async.h"
+#include "ui/notifications.h"
+#include "ui/text_cache.h"
+#include <Preferences.h>
 
 // Local state
 static int settingsSelectedIndex = 0;
 static const int SETTINGS_ITEMS = 6; // Sound, Sound Level, Touch, Brightness, Power Off, Back
-static int encoderAccum = 0; // for slower scroll
 static bool adjustingValue = false; // Track if we're adjusting a value
 
-// Persistence file
-static const char* SETTINGS_FILE = "/settings.json";
+// Persistence: NVS via Preferences, written behind the UI.
+// Knob changes only mark the settings dirty; they are committed once the knob has been idle for
+// SETTINGS_COMMIT_IDLE_MS, or right away when the page is left / the device goes to sleep.
+static const char* SETTINGS_NAMESPACE = "settings";
+static const char* LEGACY_SETTINGS_FILE = "/settings.json"; // imported once, then removed
+static const uint32_t SETTINGS_COMMIT_IDLE_MS = 2000;
+static bool settingsDirty = false;
+static uint32_t settingsChangedAt = 0;
 
-static void saveSettings(){
-    File f = SPIFFS.open(SETTINGS_FILE, "w");
-    if(!f){ Serial.println("Failed to open settings file for write"); return; }
-    StaticJsonDocument<256> doc;
-    doc["sound"] = soundEnabled;
-    doc["touch"] = touchEnabled;
-    doc["brightness"] = screenBrightness;
-    doc["soundlevel"] = soundLevel;
-    serializeJson(doc, f);
-    f.close();
-    Serial.println("Settings saved");
+static void markSettingsDirty(){
+    settingsDirty = true;
+    settingsChangedAt = millis();
 }
 
-void loadSettings(){
-    if(!SPIFFS.exists(SETTINGS_FILE)){ Serial.println("Settings file not found, using defaults"); return; }
-    File f = SPIFFS.open(SETTINGS_FILE, "r");
-    if(!f){ Serial.println("Failed to open settings file for read"); return; }
-    StaticJsonDocument<256> doc;
-    DeserializationError e = deserializeJson(doc, f);
-    if(e){ Serial.println("Failed to parse settings file"); f.close(); return; }
-    if(doc.containsKey("sound")) soundEnabled = doc["sound"].as<bool>();
-    if(doc.containsKey("touch")) touchEnabled = doc["touch"].as<bool>();
-    if(doc.containsKey("brightness")) {
-        screenBrightness = doc["brightness"].as<int>();
-        M5Dial.Display.setBrightness(screenBrightness); // Apply brightness setting
+void commitSettings(){
+    if(!settingsDirty) return;
+    uint32_t t0 = millis();
+    Preferences prefs;
+    if(!prefs.begin(SETTINGS_NAMESPACE, false)){ LOGE("settings", "failed to open the NVS namespace for write"); return; }
+    prefs.putBool("sound", soundEnabled);
+    prefs.putBool("touch", touchEnabled);
+    prefs.putUChar("brightness", (uint8_t)screenBrightness);
+    prefs.putUChar("soundlevel", (uint8_t)soundLevel);
+    prefs.end();
+    settingsDirty = false;
+    LOGI("settings", "saved (%lu ms)", (unsigned long)(millis() - t0));
+}
+
+// Legacy settings.json import. The file can only be read once storage is mounted, which happens
+// on the deferred init task after loadSettings(); the parsed values are handed to the loop task,
+// which applies and commits them.
+struct LegacySettings {
+    bool sound;
+    bool touch;
+    int brightness;
+    int soundLevel;
+};
+static bool settingsInNvs = false;
+static LegacySettings legacySettings;
+static volatile bool legacySettingsPending = false;
+
+static void applyLegacySettings(){
+    soundEnabled = legacySettings.sound;
+    touchEnabled = legacySettings.touch;
+    screenBrightness = legacySettings.brightness;
+    soundLevel = legacySettings.soundLevel;
+    M5Dial.Display.setBrightness(screenBrightness);
+    M5Dial.Speaker.setVolume(soundLevel);
+    markSettingsDirty();
+    commitSettings();
+    storageFs().remove(LEGACY_SETTINGS_FILE);
+    LOGI("settings", "imported from settings.json");
+}
+
+void serviceSettings(){
+    if(legacySettingsPending){
+        legacySettingsPending = false;
+        applyLegacySettings();
     }
-    if(doc.containsKey("soundlevel")) {
-        soundLevel = doc["soundlevel"].as<int>();
-        M5Dial.Speaker.setVolume(soundLevel); // Apply sound level setting
+    if(settingsDirty && millis() - settingsChangedAt >= SETTINGS_COMMIT_IDLE_MS){
+        commitSettings();
     }
+}
+
+void importLegacySettings(){
+    if(settingsInNvs || !storageFs().exists(LEGACY_SETTINGS_FILE)) return;
+    File f = storageFs().open(LEGACY_SETTINGS_FILE, "r");
+    if(!f){ LOGW("settings", "failed to open settings.json for read"); return; }
+    JsonDocument doc;
+    DeserializationError e = deserializeJson(doc, f);
     f.close();
-    Serial.println("Settings loaded");
+    if(e){ LOGW("settings", "failed to parse settings.json"); return; }
+    legacySettings.sound = doc["sound"] | soundEnabled;
+    legacySettings.touch = doc["touch"] | touchEnabled;
+    legacySettings.brightness = doc["brightness"] | screenBrightness;
+    legacySettings.soundLevel = doc["soundlevel"] | soundLevel;
+    legacySettingsPending = true;
+}
+
+void loadSettings(){
+    Preferences prefs;
+    bool opened = prefs.begin(SETTINGS_NAMESPACE, true);
+    settingsInNvs = opened && prefs.isKey("brightness");
+    if(settingsInNvs){
+        soundEnabled = prefs.getBool("sound", soundEnabled);
+        touchEnabled = prefs.getBool("touch", touchEnabled);
+        screenBrightness = prefs.getUChar("brightness", (uint8_t)screenBrightness);
+        soundLevel = prefs.getUChar("soundlevel", (uint8_t)soundLevel);
+        LOGI("settings", "loaded from NVS");
+    } else {
+        LOGI("settings", "none saved, using defaults");
+    }
+    if(opened) prefs.end();
+    M5Dial.Display.setBrightness(screenBrightness); // Apply brightness setting
+    M5Dial.Speaker.setVolume(soundLevel); // Apply sound level setting
+}
+
+// Leave the page: persist pending changes now rather than waiting for the idle timer
+static void exitSettingsMenu(){
+    pagePop();
+    initMenu();
+}
+
+static void onSettingsExit(){
+    adjustingValue = false;
+    commitSettings();
 }
 
 void initSettingsMenu(){
     settingsSelectedIndex = 0;
     adjustingValue = false;
-    loadSettings();
 }
 
 static void drawSettingLine(M5Canvas &canvas,int y,const char* label,const char* value,bool sel, bool adjusting = false){
-    canvas.setTextDatum(MC_DATUM);
+    uint16_t fg = TFT_WHITE, bg = TFT_BLACK;
     if(sel){
         if(adjusting) {
             // Different style when in adjustment mode
-            canvas.setTextColor(TFT_BLACK,TFT_YELLOW);
-            canvas.fillRect(0,y-18,canvas.width(),36,TFT_YELLOW);
+            fg = TFT_BLACK; bg = TFT_YELLOW;
         } else {
-            canvas.setTextColor(TFT_YELLOW,TFT_DARKGREY);
-            canvas.fillRect(0,y-18,canvas.width(),36,TFT_DARKGREY);
+            fg = TFT_YELLOW; bg = TFT_DARKGREY;
         }
-    } else {
-        canvas.setTextColor(TFT_WHITE,TFT_BLACK);
+        canvas.fillRect(0,y-18,canvas.width(),36,bg);
     }
-    String line = String(label) + ": " + value;
-    canvas.drawString(line,canvas.width()/2,y);
+    char line[TEXT_CACHE_MAX_LEN + 1];
+    snprintf(line, sizeof(line), "%s: %s", label, value);
+    drawTextCached(canvas, line, canvas.width()/2, y, MC_DATUM, 1, fg, bg);
 }
 
 void drawSettingsMenu(M5Canvas &canvas,int centerX,int centerY){
@@ -100,159 +175,144 @@ void drawSettingsMenu(M5Canvas &canvas,int centerX,int centerY){
     }
 }
 
-void handleSettingsInput(){
-    int delta = M5Dial.Encoder.read();
-    if(delta!=0){
-        M5Dial.Encoder.write(0);
-        encoderAccum += delta;
-        const int STEP = 4; // require four raw ticks per move (slower)
-        const int ADJUST_STEP = 4; // step size for value adjustments
-        
-        if(adjustingValue) {
-            // We're in adjustment mode - adjust the selected setting
-            switch(settingsSelectedIndex) {
-                case 0: // Sound On/Off - toggle with encoder motion
-                    if(encoderAccum >= STEP || encoderAccum <= -STEP) {
-                        encoderAccum = 0;
-                        soundEnabled = !soundEnabled;
-                        if(soundEnabled) { 
-                            M5Dial.Speaker.tone(1000, 40);
-                        } else { 
-                            M5Dial.Speaker.tone(400, 40);
-                        }
-                        saveSettings();
-                    }
-                    break;
+// Encoder turn: in adjustment mode it changes the selected value (accelerated steps),
+// otherwise it moves the selection one line per detent
+static void handleSettingsRotate(const InputEvent &ev){
+    if(adjustingValue) {
+        // We're in adjustment mode - adjust the selected setting
+        switch(settingsSelectedIndex) {
+            case 0: // Sound On/Off - toggle with encoder motion
+                soundEnabled = !soundEnabled;
+                if(soundEnabled) { 
+                    M5Dial.Speaker.tone(1000, 40);
+                } else { 
+                    M5Dial.Speaker.tone(400, 40);
+                }
+                markSettingsDirty();
+                break;
+            
+            case 1: // Sound Level, ~4% per step, keep minimum audible level
+                soundLevel = constrain(soundLevel + 10 * ev.steps, 10, 255);
+                M5Dial.Speaker.setVolume(soundLevel);
+                if(soundEnabled) {
+                    // Play a sound to demonstrate the current volume level
+                    M5Dial.Speaker.tone(800, 50);
+                }
+                markSettingsDirty();
+                break;
                 
-                case 1: // Sound Level
-                    if(encoderAccum >= ADJUST_STEP) {
-                        encoderAccum -= ADJUST_STEP;
-                        soundLevel = min(255, soundLevel + 10); // Increment by ~4%
-                        M5Dial.Speaker.setVolume(soundLevel);
-                        if(soundEnabled) {
-                            // Play a sound to demonstrate the current volume level
-                            M5Dial.Speaker.tone(800, 50);
-                        }
-                        saveSettings();
-                    } else if(encoderAccum <= -ADJUST_STEP) {
-                        encoderAccum += ADJUST_STEP;
-                        soundLevel = max(10, soundLevel - 10); // Decrement by ~4%, keep minimum audible level
-                        M5Dial.Speaker.setVolume(soundLevel);
-                        if(soundEnabled) {
-                            // Play a sound to demonstrate the current volume level
-                            M5Dial.Speaker.tone(800, 50);
-                        }
-                        saveSettings();
-                    }
-                    break;
-                    
-                case 2: // Touch On/Off - toggle with encoder motion
-                    if(encoderAccum >= STEP || encoderAccum <= -STEP) {
-                        encoderAccum = 0;
-                        touchEnabled = !touchEnabled;
-                        if(soundEnabled) M5Dial.Speaker.tone(800, 30);
-                        saveSettings();
-                    }
-                    break;
-                    
-                case 3: // Brightness
-                    if(encoderAccum >= ADJUST_STEP) {
-                        encoderAccum -= ADJUST_STEP;
-                        screenBrightness = min(255, screenBrightness + 10); // Increment by ~4%
-                        M5Dial.Display.setBrightness(screenBrightness);
-                        if(soundEnabled) M5Dial.Speaker.tone(600, 15);
-                        saveSettings();
-                    } else if(encoderAccum <= -ADJUST_STEP) {
-                        encoderAccum += ADJUST_STEP;
-                        screenBrightness = max(10, screenBrightness - 10); // Decrement by ~4%, keep minimum visible
-                        M5Dial.Display.setBrightness(screenBrightness);
-                        if(soundEnabled) M5Dial.Speaker.tone(600, 15);
-                        saveSettings();
-                    }
-                    break;
-                    
-                // No adjustment for Power Off or Back options
-            }
-        } else {
-            // Normal navigation mode
-            while(encoderAccum >= STEP){ 
-                encoderAccum -= STEP; 
-                settingsSelectedIndex++; 
-                if(soundEnabled) M5Dial.Speaker.tone(600, 15); 
-            }
-            while(encoderAccum <= -STEP){ 
-                encoderAccum += STEP; 
-                settingsSelectedIndex--; 
-                if(soundEnabled) M5Dial.Speaker.tone(600, 15); 
-            }
-            if(settingsSelectedIndex < 0) settingsSelectedIndex = SETTINGS_ITEMS - 1;
-            if(settingsSelectedIndex >= SETTINGS_ITEMS) settingsSelectedIndex = 0;
+            case 2: // Touch On/Off - toggle with encoder motion
+                touchEnabled = !touchEnabled;
+                if(soundEnabled) M5Dial.Speaker.tone(800, 30);
+                markSettingsDirty();
+                break;
+                
+            case 3: // Brightness, ~4% per step, keep minimum visible
+                screenBrightness = constrain(screenBrightness + 10 * ev.steps, 10, 255);
+                M5Dial.Display.setBrightness(screenBrightness);
+                if(soundEnabled) M5Dial.Speaker.tone(600, 15);
+                markSettingsDirty();
+                break;
+                
+            // No adjustment for Power Off or Back options
         }
+    } else {
+        // Normal navigation mode
+        settingsSelectedIndex = ((settingsSelectedIndex + ev.detents) % SETTINGS_ITEMS + SETTINGS_ITEMS) % SETTINGS_ITEMS;
+        if(soundEnabled) M5Dial.Speaker.tone(600, 15); 
     }
+}
 
-    if(M5.BtnA.wasPressed()){ // Button press action
-        if(adjustingValue) {
-            // Exit adjustment mode
-            adjustingValue = false;
-            if(soundEnabled) M5Dial.Speaker.tone(900, 30);
-        } else {
-            // Handle selecting an option
-            switch(settingsSelectedIndex){
-                case 0: // Sound - enter adjustment mode
-                    adjustingValue = true;
-                    if(soundEnabled) M5Dial.Speaker.tone(800, 30);
-                    break;
-                    
-                case 1: // Sound Level - enter adjustment mode
-                    adjustingValue = true;
-                    if(soundEnabled) {
-                        // Play a sound to demonstrate the current volume level
-                        M5Dial.Speaker.tone(800, 100);
-                    }
-                    break;
-                    
-                case 2: // Touch - enter adjustment mode
-                    adjustingValue = true;
-                    if(soundEnabled) M5Dial.Speaker.tone(800, 30);
-                    break;
-                    
-                case 3: // Brightness - enter adjustment mode
-                    adjustingValue = true;
-                    if(soundEnabled) M5Dial.Speaker.tone(800, 30);
-                    break;
-                    
-                case 4: // Power Off - immediate action (using deep sleep for wake capability)
-                    if(soundEnabled) M5Dial.Speaker.tone(200, 200);
-                    
-                    // Show a popup message
-                    popupActive = true;
-                    popupMessage = "Going to sleep, press button to wake";
-                    popupTextColor = TFT_WHITE;
-                    popupBgColor = TFT_NAVY;
-                    popupEndTime = millis() + 2000; // Display for 2 seconds
-                    
-                    // Process the popup message before sleeping
-                    delay(2000); 
-                    
-                    // Use deepSleep instead of powerOff
-                    // This allows the button to wake the device
-                    M5Dial.Power.deepSleep(0, true); // No time limit, enable button wakeup
-                    break;
-                    
-                case 5: // Back - immediate action
-                    settingsMenuActive = false;
-                    menuActive = true;
-                    initMenu();
-                    break;
-            }
+// Power Off: show the message for 2 s (the loop keeps drawing it), then persist and deep sleep
+static uint32_t powerOffStep(uint8_t step){
+    switch(step){
+        case 0:
+            if(soundEnabled) M5Dial.Speaker.tone(200, 200);
+            showPopupNotification("Going to sleep, press button to wake", 2000, TFT_WHITE, TFT_NAVY, NotifyPriority::High);
+            return 2000;
+        default:
+            commitSettings();
+            trackFlush();
+            logFlush();
+
+            // Use deepSleep instead of powerOff
+            // This allows the button to wake the device
+            M5Dial.Power.deepSleep(0, true); // No time limit, enable button wakeup
+            return ASYNC_DONE;
+    }
+}
+
+static void handleSettingsPress(){
+    if(adjustingValue) {
+        // Exit adjustment mode
+        adjustingValue = false;
+        if(soundEnabled) M5Dial.Speaker.tone(900, 30);
+    } else {
+        // Handle selecting an option
+        switch(settingsSelectedIndex){
+            case 0: // Sound - enter adjustment mode
+                adjustingValue = true;
+                if(soundEnabled) M5Dial.Speaker.tone(800, 30);
+                break;
+            
+            case 1: // Sound Level - enter adjustment mode
+                adjustingValue = true;
+                if(soundEnabled) {
+                    // Play a sound to demonstrate the current volume level
+                    M5Dial.Speaker.tone(800, 100);
+                }
+                break;
+            
+            case 2: // Touch - enter adjustment mode
+                adjustingValue = true;
+                if(soundEnabled) M5Dial.Speaker.tone(800, 30);
+                break;
+            
+            case 3: // Brightness - enter adjustment mode
+                adjustingValue = true;
+                if(soundEnabled) M5Dial.Speaker.tone(800, 30);
+                break;
+            
+            case 4: // Power Off - immediate action (using deep sleep for wake capability)
+                asyncRun("powerOff", powerOffStep);
+                break;
+            
+            case 5: // Back - immediate action
+                exitSettingsMenu();
+                break;
         }
     }
+}
 
-    // Optional long press to exit to menu from anywhere in settings
-    if(M5.BtnA.pressedFor(2000)){
-        adjustingValue = false; // Reset adjustment state
-        settingsMenuActive = false;
-        menuActive = true;
-        initMenu();
+void handleSettingsInput(){
+    InputEvent ev;
+    while(inputNext(ev)){
+        switch(ev.type){
+            case InputType::Rotate:
+                handleSettingsRotate(ev);
+                pageInvalidate();
+                break;
+            case InputType::Press: // Button press action
+                handleSettingsPress();
+                pageInvalidate();
+                break;
+            case InputType::LongPress: // exit to menu from anywhere in settings
+                exitSettingsMenu();
+                return;
+            default:
+                break;
+        }
     }
 }
+
+static void settingsUpdate(uint32_t dtMs){
+    (void)dtMs;
+    handleSettingsInput();
+}
+
+static void settingsRender(M5Canvas &canvas, const DirtyRect &dirty){
+    (void)dirty;
+    drawSettingsMenu(canvas, centerX, centerY);
+}
+
+const Page settingsPage = { "settings", initSettingsMenu, onSettingsExit, settingsUpdate, settingsRender, 0 };
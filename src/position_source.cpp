@@ -0,0 +1,146 @@
+#include "position_source.h"
+#include <Arduino.h>
+#include <math.h>
+
+// ---- Tuning ----
+// Assumed worst-case movement since a fix was taken (brisk walk / cycling in town).
+static const float DRIFT_M_PER_S = 1.5f;
+// Sources older than this are ignored entirely.
+static const uint32_t GPS_MAX_AGE_MS = 10000;
+static const uint32_t BLE_MAX_AGE_MS = 30000;
+// Only switch to the other source if it is clearly better than the current one.
+static const float SWITCH_RATIO = 0.8f;
+// Blend when the two expected errors are within this ratio and the fixes agree.
+static const float BLEND_RATIO = 2.0f;
+// Offset estimate for phone timestamps is the minimum over the last two windows.
+static const uint32_t CLOCK_WINDOW_MS = 30000;
+
+struct SourceState {
+    bool valid = false;
+    double lat = 0.0;
+    double lon = 0.0;
+    float accuracyM = 0.0f;
+    uint32_t fixTimeMs = 0; // local millis() time the fix refers to
+};
+
+static SourceState g_gps;
+static SourceState g_ble;
+// Single source the hysteresis compares against. Kept through blended stretches, so leaving a
+// blend for one source needs the same margin as switching directly.
+static PositionSource g_preferred = PositionSource::None;
+
+// Phone clock offset tracking (local - phone), kept as wrapping uint32
+static bool g_offsetValid = false;
+static uint32_t g_offsetCur = 0;      // min of current window
+static uint32_t g_offsetPrev = 0;     // min of previous window
+static uint32_t g_windowStart = 0;
+
+void positionUpdateGps(double lat, double lon, float accuracyM, uint32_t fixTimeMs) {
+    g_gps.valid = true;
+    g_gps.lat = lat;
+    g_gps.lon = lon;
+    g_gps.accuracyM = accuracyM;
+    g_gps.fixTimeMs = fixTimeMs;
+}
+
+void positionUpdateBle(double lat, double lon, float accuracyM, uint32_t fixTimeMs) {
+    g_ble.valid = true;
+    g_ble.lat = lat;
+    g_ble.lon = lon;
+    // Phones without an accuracy estimate get a conservative default
+    g_ble.accuracyM = accuracyM > 0.0f ? accuracyM : 20.0f;
+    g_ble.fixTimeMs = fixTimeMs;
+}
+
+uint32_t positionPhoneTimeToLocal(uint32_t phoneTimeMs, uint32_t rxTimeMs) {
+    uint32_t offset = rxTimeMs - phoneTimeMs;
+    if (!g_offsetValid) {
+        g_offsetValid = true;
+        g_offsetCur = g_offsetPrev = offset;
+        g_windowStart = rxTimeMs;
+    } else {
+        if (rxTimeMs - g_windowStart > CLOCK_WINDOW_MS) {
+            // Roll the window so clock drift can move the estimate upward again
+            g_offsetPrev = g_offsetCur;
+            g_offsetCur = offset;
+            g_windowStart = rxTimeMs;
+        } else if ((int32_t)(offset - g_offsetCur) < 0) {
+            g_offsetCur = offset;
+        }
+    }
+    uint32_t best = ((int32_t)(g_offsetCur - g_offsetPrev) < 0) ? g_offsetCur : g_offsetPrev;
+    uint32_t local = phoneTimeMs + best;
+    // A fix cannot be newer than the frame that carried it
+    if ((int32_t)(local - rxTimeMs) > 0) local = rxTimeMs;
+    return local;
+}
+
+static float expectedError(const SourceState &s, uint32_t maxAgeMs, uint32_t now) {
+    if (!s.valid) return -1.0f;
+    uint32_t age = now - s.fixTimeMs;
+    if ((int32_t)age < 0) age = 0; // fix stamped slightly in the future
+    if (age > maxAgeMs) return -1.0f;
+    return s.accuracyM + DRIFT_M_PER_S * (age / 1000.0f);
+}
+
+float positionExpectedError(PositionSource source) {
+    uint32_t now = millis();
+    switch (source) {
+        case PositionSource::Gps: return expectedError(g_gps, GPS_MAX_AGE_MS, now);
+        case PositionSource::Ble: return expectedError(g_ble, BLE_MAX_AGE_MS, now);
+        default: return -1.0f;
+    }
+}
+
+// Approximate ground distance in meters (equirectangular, fine for the short spans compared here)
+static float approxDistanceM(double lat1, double lon1, double lat2, double lon2) {
+    const double R_EARTH = 6371000.0;
+    double x = (lon2 - lon1) * M_PI / 180.0 * cos((lat1 + lat2) * 0.5 * M_PI / 180.0);
+    double y = (lat2 - lat1) * M_PI / 180.0;
+    return (float)(sqrt(x * x + y * y) * R_EARTH);
+}
+
+PositionSource positionSelect(double &lat, double &lon, float *expectedErrorM) {
+    uint32_t now = millis();
+    float eGps = expectedError(g_gps, GPS_MAX_AGE_MS, now);
+    float eBle = expectedError(g_ble, BLE_MAX_AGE_MS, now);
+
+    PositionSource choice = PositionSource::None;
+    float err = -1.0f;
+
+    if (eGps >= 0.0f && eBle >= 0.0f) {
+        float ratio = eGps > eBle ? eGps / eBle : eBle / eGps;
+        float separation = approxDistanceM(g_gps.lat, g_gps.lon, g_ble.lat, g_ble.lon);
+        if (ratio <= BLEND_RATIO && separation <= eGps + eBle) {
+            // Comparable and consistent: inverse-variance weighted average
+            float wGps = 1.0f / (eGps * eGps);
+            float wBle = 1.0f / (eBle * eBle);
+            float sum = wGps + wBle;
+            lat = (g_gps.lat * wGps + g_ble.lat * wBle) / sum;
+            lon = (g_gps.lon * wGps + g_ble.lon * wBle) / sum;
+            err = sqrtf(1.0f / sum);
+            choice = PositionSource::Blended;
+            if (g_preferred == PositionSource::None) g_preferred = eGps <= eBle ? PositionSource::Gps : PositionSource::Ble;
+        } else {
+            // Disagreeing or very different quality: keep the current source unless the other is clearly better
+            bool preferGps = eGps < eBle;
+            if (g_preferred == PositionSource::Gps && !preferGps && eBle > eGps * SWITCH_RATIO) preferGps = true;
+            if (g_preferred == PositionSource::Ble && preferGps && eGps > eBle * SWITCH_RATIO) preferGps = false;
+            choice = preferGps ? PositionSource::Gps : PositionSource::Ble;
+        }
+    } else if (eGps >= 0.0f) {
+        choice = PositionSource::Gps;
+    } else if (eBle >= 0.0f) {
+        choice = PositionSource::Ble;
+    }
+
+    if (choice == PositionSource::Gps) {
+        lat = g_gps.lat; lon = g_gps.lon; err = eGps;
+    } else if (choice == PositionSource::Ble) {
+        lat = g_ble.lat; lon = g_ble.lon; err = eBle;
+    }
+
+    if (choice == PositionSource::Gps || choice == PositionSource::Ble) g_preferred = choice;
+    if (expectedErrorM) *expectedErrorM = err;
+    return choice;
+}
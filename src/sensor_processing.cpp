@@ -1,18 +1,30 @@
 #include "sensor_processing.h"
 #include "gpsinfo.h"
 #include "bluetooth.h"
+#include "position_source.h"
+#include "track.h"
+#include "input.h"
+
+// Typical user equivalent range error for a consumer GPS module; accuracy ~= HDOP * UERE
+static const float GPS_UERE_M = 5.0f;
 // Assumes globals_and_includes.h is included via sensor_processing.h
 // Access to global objects 'M5Dial', 'canvas', 'GPS_Serial', 'qmc'
 // Access to global variables 'centerX', 'centerY', 'R', 'firstHeadingReading', 'smoothedHeadingX/Y'
 // Access to constants from 'config.h' like 'offset_x', 'MAGNETIC_DECLINATION', 'HEADING_SMOOTHING_FACTOR'
 
+// Last raw magnetometer sample (exposed for BLE telemetry)
+int lastMagX = 0;
+int lastMagY = 0;
+int lastMagZ = 0;
+
 void initializeHardwareAndSensors() {
     auto cfg = M5.config(); // Get M5Dial default configuration
     // Consider enabling power for PortA if GPS is connected there and needs it.
     // cfg.external_power = true; // If PortA needs to supply power via M5Dial control
-    M5Dial.begin(cfg, true, true); // Initialize M5Dial, with I2C and Display by default
-    M5Dial.Encoder.begin(); // Initialize the encoder
+    M5Dial.begin(cfg, false, true); // Display, I2C and RFID; the encoder is decoded by input.cpp instead
+    inputBegin(); // encoder/button interrupts feeding the input event queue
     
+    GPS_Serial.setRxBufferSize(2048); // ~2 s of NMEA at 9600 baud: the loop runs at 1 FPS when dozing
     GPS_Serial.begin(9600, SERIAL_8N1, 1, 2); // RX=GPIO1, TX=GPIO2 (as per your original code)
     Serial.println(F("GPS Serial (UART1) configured on RX=1, TX=2 at 9600 baud."));
 
@@ -57,24 +69,24 @@ void processGpsData() {
             setSpeed(gps.speed.kmph());
             setSatellitesInView(gps.satellites.value());
             setFixQuality(gps.location.FixQuality());
+
+            // Feed the position arbiter; without HDOP assume a mediocre fix
+            float accuracyM = gps.hdop.isValid() ? (float)gps.hdop.hdop() * GPS_UERE_M : 15.0f;
+            positionUpdateGps(gps.location.lat(), gps.location.lng(), accuracyM, millis() - gps.location.age());
+            trackAddFix(gps.location.lat(), gps.location.lng(), accuracyM);
         }
     }
 
-    // If we didn't get a GPS update and GPS location is not valid or is too old
-    if (!gpsUpdated && (!gps.location.isValid() || gps.location.age() > 10000)) {
-        // Check if we have a valid BLE position
-        if (isBlePositionValid()) {
-            double lat, lon;
-            getBlePosition(lat, lon);
-            
+    // Without a fresh GPS update, show whichever source the arbiter currently prefers
+    if (!gpsUpdated) {
+        double lat, lon;
+        if (positionSelect(lat, lon) == PositionSource::Ble) {
             // Use the BLE position
             setLatitude(lat);
             setLongitude(lon);
             
             // Set fix quality to indicate BLE source (using value 9 to distinguish from GPS quality)
             setFixQuality(9);
-            
-            Serial.println("Using BLE position instead of GPS");
         }
     }
 }
@@ -84,6 +96,9 @@ double calculateRawTrueHeading() {
     float heading_deg;
 
     qmc.read(&raw_x, &raw_y, &raw_z); // Read raw compass values
+    lastMagX = raw_x;
+    lastMagY = raw_y;
+    lastMagZ = raw_z;
 
     // Apply calibration offsets and scales from config.h
     // It's crucial these are correctly determined for your specific sensor.
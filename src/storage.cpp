@@ -0,0 +1,89 @@
+#include "storage.h"
+#include "log.h"
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <SPIFFS.h>
+#include <vector>
+
+// Upper bound for the files carried over from SPIFFS (they are held in RAM during the reformat)
+static const size_t MIGRATION_RAM_MAX = 96 * 1024;
+
+static bool g_mounted = false;
+
+fs::FS &storageFs() {
+    return LittleFS;
+}
+
+struct MigratedFile {
+    String path;
+    uint8_t *data;
+    size_t len;
+};
+
+// Copy every file of a SPIFFS image into RAM. Returns false if the partition is not SPIFFS.
+static bool readSpiffsImage(std::vector<MigratedFile> &files) {
+    if (!SPIFFS.begin(false)) return false;
+    size_t total = 0;
+    File root = SPIFFS.open("/");
+    File f = root.openNextFile();
+    while (f) {
+        size_t len = f.size();
+        if (total + len > MIGRATION_RAM_MAX) {
+            LOGW("storage", "skipping %s (%u B), migration RAM budget exceeded", f.path(), (unsigned)len);
+        } else {
+            uint8_t *data = (uint8_t*)malloc(len ? len : 1);
+            if (data && f.read(data, len) == len) {
+                files.push_back({String(f.path()), data, len});
+                total += len;
+            } else {
+                LOGW("storage", "failed to read %s", f.path());
+                free(data);
+            }
+        }
+        f.close();
+        f = root.openNextFile();
+    }
+    root.close();
+    SPIFFS.end();
+    LOGI("storage", "read %u files (%u B) from SPIFFS", (unsigned)files.size(), (unsigned)total);
+    return true;
+}
+
+static void writeMigratedFiles(std::vector<MigratedFile> &files) {
+    for (MigratedFile &m : files) {
+        if (!storageWriteAtomic(m.path.c_str(), m.data, m.len)) {
+            LOGE("storage", "failed to migrate %s", m.path.c_str());
+        }
+        free(m.data);
+    }
+    files.clear();
+}
+
+bool storageBegin() {
+    uint32_t t0 = micros();
+    g_mounted = LittleFS.begin(false);
+    uint32_t mountUs = micros() - t0;
+
+    if (!g_mounted) {
+        // Not LittleFS (yet): either an old SPIFFS image to carry over, or a blank/corrupt partition
+        std::vector<MigratedFile> files;
+        bool hadSpiffs = readSpiffsImage(files);
+        LOGI("storage", "%s", hadSpiffs ? "migrating SPIFFS -> LittleFS" : "no filesystem, formatting LittleFS");
+        t0 = micros();
+        g_mounted = LittleFS.begin(true); // formats the partition
+        mountUs = micros() - t0;
+        if (g_mounted) {
+            writeMigratedFiles(files);
+        } else {
+            for (MigratedFile &m : files) free(m.data);
+        }
+    }
+
+    if (!g_mounted) {
+        LOGE("storage", "mount failed, running without persistence");
+        return false;
+    }
+    LOGI("storage", "LittleFS mounted in %lu us, %u/%u B used",
+        (unsigned long)mountUs, (unsigned)LittleFS.usedBytes(), (unsigned)LittleFS.totalBytes());
+    return true;
+}
@@ -0,0 +1,32 @@
+#include "storage.h"
+#include "log.h"
+#include <stdio.h>
+
+bool storageRename(const char *from, const char *to) {
+    if (!storageFs().rename(from, to)) {
+        LOGW("storage", "rename %s -> %s failed", from, to);
+        return false;
+    }
+    return true;
+}
+
+bool storageReplace(const char *tmpPath, const char *path) {
+    if (storageRename(tmpPath, path)) return true;
+    storageFs().remove(tmpPath);
+    return false;
+}
+
+bool storageWriteAtomic(const char *path, const uint8_t *data, size_t len) {
+    char tmp[64];
+    if (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int)sizeof(tmp)) return false;
+    File f = storageFs().open(tmp, FILE_WRITE);
+    if (!f) return false;
+    size_t n = f.write(data, len);
+    f.close();
+    if (n != len) {
+        LOGW("storage", "short write to %s (%u of %u B)", tmp, (unsigned)n, (unsigned)len);
+        storageFs().remove(tmp);
+        return false;
+    }
+    return storageReplace(tmp, path);
+}
@@ -0,0 +1,201 @@
+#include "track.h"
+#include "track_codec.h"
+#include "globals_and_includes.h"
+#include "bluetooth.h"
+#include "storage.h"
+#include "log.h"
+#include "ui/notifications.h"
+#include <algorithm>
+
+#define FileSystem storageFs()
+
+static const size_t WRITE_BUFFER = 128;      // encoded bytes kept in RAM between flash writes
+static const size_t WRITE_THRESHOLD = 96;
+
+// ---- Recorder state ----
+static volatile bool g_storageReady = false;
+static TrackSimplifier g_simplifier;
+
+static bool g_segmentStart = true;          // next vertex starts a segment (boot, rotation)
+static TrackPoint g_lastWritten;            // delta base
+static uint8_t g_buf[WRITE_BUFFER];
+static size_t g_bufLen = 0;
+static uint32_t g_vertices = 0;
+static uint32_t g_fileBytes = 0;
+static uint32_t g_bufferDrops = 0;
+static uint32_t g_rotateAt = TRACK_FILE_MAX; // file size that triggers rotation, raised after a failure
+
+// ---- Backtrack state ----
+static int32_t *g_btLat = nullptr;          // E6, oldest first
+static int32_t *g_btLon = nullptr;
+static int g_btCount = 0;
+static int g_btIndex = -1;                  // vertex currently targeted, -1 when inactive
+
+static void writeBuffer() {
+    if (!g_storageReady || g_bufLen == 0) return;
+    File f = FileSystem.open(TRACK_FILE, FILE_APPEND);
+    if (!f) { LOGW("track", "failed to open %s", TRACK_FILE); return; }
+    size_t n = f.write(g_buf, g_bufLen);
+    f.close();
+    if (n != g_bufLen) LOGW("track", "short write (%u of %u B)", (unsigned)n, (unsigned)g_bufLen);
+    g_fileBytes += n;
+    g_bufLen = 0;
+}
+
+// Keep one previous file; the new one starts a segment with absolute coordinates
+static void rotateIfFull() {
+    if (!g_storageReady || g_fileBytes + g_bufLen + TRACK_RECORD_MAX <= g_rotateAt) return;
+    writeBuffer();
+    if (!storageRename(TRACK_FILE, TRACK_OLD_FILE)) {
+        // Keep appending to the current file and try again a little later
+        g_rotateAt = g_fileBytes + TRACK_ROTATE_RETRY_BYTES;
+        LOGW("track", "rotation failed at %lu B, retrying after %u B more",
+            (unsigned long)g_fileBytes, (unsigned)TRACK_ROTATE_RETRY_BYTES);
+        return;
+    }
+    LOGI("track", "rotated %s (%lu B)", TRACK_FILE, (unsigned long)g_fileBytes);
+    g_fileBytes = 0;
+    g_rotateAt = TRACK_FILE_MAX;
+    g_segmentStart = true;
+}
+
+static void emitVertex(const TrackPoint &p) {
+    uint8_t rec[TRACK_RECORD_MAX];
+    rotateIfFull();
+    size_t n = trackEncodeVertex(rec, p, g_segmentStart ? nullptr : &g_lastWritten);
+    if (g_bufLen + n > WRITE_BUFFER) writeBuffer();
+    if (g_bufLen + n > WRITE_BUFFER) { g_bufferDrops++; return; } // storage not mounted yet
+    memcpy(g_buf + g_bufLen, rec, n);
+    g_bufLen += n;
+    g_segmentStart = false;
+    g_lastWritten = p;
+    g_vertices++;
+    if (g_bufLen >= WRITE_THRESHOLD) writeBuffer();
+}
+
+void trackBegin() {
+    File f = FileSystem.open(TRACK_FILE, FILE_READ);
+    g_fileBytes = f ? (uint32_t)f.size() : 0;
+    if (f) f.close();
+    g_storageReady = true;
+    LOGI("track", "recording to %s (%lu B)", TRACK_FILE, (unsigned long)g_fileBytes);
+}
+
+void trackAddFix(double lat, double lon, float accuracyM) {
+    if (accuracyM > TRACK_MAX_ACCURACY_M) return;
+    TrackPoint p = { (int32_t)lround(lat * 1e6), (int32_t)lround(lon * 1e6), millis() / 1000 };
+    TrackPoint kept;
+    if (g_simplifier.add(p, kept)) emitVertex(kept);
+}
+
+void trackFlush() {
+    TrackPoint kept;
+    if (g_simplifier.flush(kept)) emitVertex(kept);
+    writeBuffer();
+    if (g_bufferDrops) {
+        LOGW("track", "%lu vertices dropped before storage was ready", (unsigned long)g_bufferDrops);
+        g_bufferDrops = 0;
+    }
+}
+
+uint32_t trackVertexCount() { return g_vertices; }
+uint32_t trackFileBytes() { return g_fileBytes + g_bufLen; }
+
+// ---- Backtrack ----
+// Decodes the track file, keeping the newest TRACK_BACKTRACK_MAX vertices in a ring
+static bool loadTrack() {
+    File f = FileSystem.open(TRACK_FILE, FILE_READ);
+    if (!f) return false;
+    if (!g_btLat) {
+        g_btLat = (int32_t*)malloc(TRACK_BACKTRACK_MAX * sizeof(int32_t));
+        g_btLon = (int32_t*)malloc(TRACK_BACKTRACK_MAX * sizeof(int32_t));
+        if (!g_btLat || !g_btLon) {
+            free(g_btLat); free(g_btLon);
+            g_btLat = g_btLon = nullptr;
+            f.close();
+            return false;
+        }
+    }
+    uint32_t total = 0;
+    int32_t lat, lon;
+    TrackDecoder decoder;
+    int c;
+    while ((c = f.read()) >= 0) {
+        if (!decoder.push((uint8_t)c, lat, lon)) continue;
+        g_btLat[total % TRACK_BACKTRACK_MAX] = lat;
+        g_btLon[total % TRACK_BACKTRACK_MAX] = lon;
+        total++;
+    }
+    f.close();
+
+    // Unroll the ring so index 0 is the oldest kept vertex
+    g_btCount = total < TRACK_BACKTRACK_MAX ? (int)total : TRACK_BACKTRACK_MAX;
+    if (total > TRACK_BACKTRACK_MAX) {
+        size_t start = total % TRACK_BACKTRACK_MAX;
+        std::rotate(g_btLat, g_btLat + start, g_btLat + TRACK_BACKTRACK_MAX);
+        std::rotate(g_btLon, g_btLon + start, g_btLon + TRACK_BACKTRACK_MAX);
+    }
+    LOGI("track", "loaded %lu vertices for backtrack (%d kept)", (unsigned long)total, g_btCount);
+    return g_btCount >= 2;
+}
+
+static float distToVertexM(double lat, double lon, int i) {
+    TrackPoint here = { (int32_t)lround(lat * 1e6), (int32_t)lround(lon * 1e6), 0 };
+    TrackPoint v = { g_btLat[i], g_btLon[i], 0 };
+    return trackPointDistM(here, v);
+}
+
+static void targetVertex(int i) {
+    g_btIndex = i;
+    TARGET_LAT = g_btLat[i] / 1e6;
+    TARGET_LON = g_btLon[i] / 1e6;
+    targetIsSet = true;
+    char label[24];
+    snprintf(label, sizeof(label), "Backtrack %u/%u", (unsigned)(i + 1), (unsigned)g_btCount);
+    Setaddress = label;
+    publishTargetCharacteristic();
+}
+
+bool trackBacktrackStart() {
+    trackFlush();
+    if (!g_storageReady || !loadTrack()) return false;
+    targetVertex(g_btCount - 1);
+    return true;
+}
+
+void trackBacktrackUpdate(double lat, double lon, bool valid) {
+    if (g_btIndex < 0) return;
+    if (distToVertexM(TARGET_LAT, TARGET_LON, g_btIndex) > TRACK_TARGET_MOVED_M) {
+        // Target picked from the list or set over BLE. Small differences are just our own vertex
+        // coming back rounded (e.g. echoed by the app as float), not a new target.
+        trackBacktrackStop();
+        return;
+    }
+    if (!valid) return;
+
+    // Skip ahead if a shortcut brought us next to a vertex further back along the track
+    int next = g_btIndex;
+    int lookahead = g_btIndex > 8 ? g_btIndex - 8 : 0;
+    for (int i = g_btIndex; i >= lookahead; i--) {
+        if (distToVertexM(lat, lon, i) < TRACK_ARRIVE_M) next = i - 1;
+    }
+    if (next == g_btIndex) return;
+    if (next < 0) {
+        LOGI("track", "backtrack finished");
+        showPopupNotification("Track start reached", 3000, TFT_WHITE, TFT_DARKGREEN);
+        trackBacktrackStop(); // keep the final vertex as the target
+        return;
+    }
+    targetVertex(next);
+}
+
+bool trackBacktrackActive() {
+    return g_btIndex >= 0;
+}
+
+void trackBacktrackStop() {
+    g_btIndex = -1;
+    free(g_btLat); free(g_btLon);
+    g_btLat = g_btLon = nullptr;
+    g_btCount = 0;
+}
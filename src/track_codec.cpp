@@ -0,0 +1,116 @@
+#include "track_codec.h"
+#include <math.h>
+
+static const float M_PER_E6 = 0.111195f;    // meters per 1e-6 degree of latitude
+
+// ---- Geometry (local flat earth, fine over the few hundred meters of a window) ----
+static float dxM(int32_t lonA, int32_t lonB, float cosLat) { return (float)(lonB - lonA) * M_PER_E6 * cosLat; }
+static float dyM(int32_t latA, int32_t latB) { return (float)(latB - latA) * M_PER_E6; }
+static float cosLatE6(int32_t latE6) { return cosf((float)latE6 * 1e-6f * (float)M_PI / 180.0f); }
+
+float trackPointDistM(const TrackPoint &a, const TrackPoint &b) {
+    float c = cosLatE6(a.latE6);
+    float x = dxM(a.lonE6, b.lonE6, c), y = dyM(a.latE6, b.latE6);
+    return sqrtf(x * x + y * y);
+}
+
+float trackSegmentDistM(const TrackPoint &p, const TrackPoint &a, const TrackPoint &b) {
+    float cosLat = cosLatE6(a.latE6);
+    float bx = dxM(a.lonE6, b.lonE6, cosLat), by = dyM(a.latE6, b.latE6);
+    float px = dxM(a.lonE6, p.lonE6, cosLat), py = dyM(a.latE6, p.latE6);
+    float len2 = bx * bx + by * by;
+    float t = len2 > 0.0f ? (px * bx + py * by) / len2 : 0.0f;
+    if (t < 0.0f) t = 0.0f; else if (t > 1.0f) t = 1.0f;
+    float ex = px - t * bx, ey = py - t * by;
+    return sqrtf(ex * ex + ey * ey);
+}
+
+// ---- Encoding ----
+size_t trackPutVarint(uint8_t *out, uint32_t v) {
+    size_t n = 0;
+    while (v >= 0x80) { out[n++] = (uint8_t)(v | 0x80); v >>= 7; }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+uint32_t trackZigzag(int32_t v) { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+int32_t trackUnzigzag(uint32_t v) { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+size_t trackEncodeVertex(uint8_t *out, const TrackPoint &p, const TrackPoint *prev) {
+    size_t n;
+    if (!prev) {
+        n = trackPutVarint(out, 1); // dt 0, segment start
+        n += trackPutVarint(out + n, trackZigzag(p.latE6));
+        n += trackPutVarint(out + n, trackZigzag(p.lonE6));
+    } else {
+        uint32_t dt = p.t - prev->t;
+        if (dt > 0x3FFFFFFF) dt = 0x3FFFFFFF;
+        n = trackPutVarint(out, dt << 1);
+        n += trackPutVarint(out + n, trackZigzag(p.latE6 - prev->latE6));
+        n += trackPutVarint(out + n, trackZigzag(p.lonE6 - prev->lonE6));
+    }
+    return n;
+}
+
+// ---- Simplifier ----
+void TrackSimplifier::keep(const TrackPoint &p, TrackPoint &kept) {
+    kept = p;
+    anchor_ = p;
+    count_ = 0;
+}
+
+bool TrackSimplifier::add(const TrackPoint &p, TrackPoint &kept) {
+    if (!haveAnchor_) {
+        haveAnchor_ = true;
+        keep(p, kept);
+        return true;
+    }
+    const TrackPoint &last = count_ ? window_[count_ - 1] : anchor_;
+    if (trackPointDistM(last, p) < TRACK_MIN_STEP_M) return false;
+
+    bool emitted = false;
+    if (count_ == TRACK_WINDOW_MAX) {
+        keep(window_[TRACK_WINDOW_MAX - 1], kept);
+        emitted = true;
+    } else {
+        // Can the line anchor -> p still stand in for every point in between?
+        for (size_t i = 0; i < count_; i++) {
+            if (trackSegmentDistM(window_[i], anchor_, p) > TRACK_TOLERANCE_M) {
+                keep(window_[count_ - 1], kept);
+                emitted = true;
+                break;
+            }
+        }
+    }
+    window_[count_++] = p;
+    return emitted;
+}
+
+bool TrackSimplifier::flush(TrackPoint &kept) {
+    if (!count_) return false;
+    keep(window_[count_ - 1], kept);
+    return true;
+}
+
+// ---- Decoding ----
+bool TrackDecoder::push(uint8_t b, int32_t &latE6, int32_t &lonE6) {
+    if (shift_ == 0) fields_[field_] = 0;
+    if (shift_ < 35) fields_[field_] |= (uint32_t)(b & 0x7F) << shift_;
+    if (b & 0x80) {
+        shift_ += 7;
+        return false;
+    }
+    shift_ = 0;
+    if (++field_ < 3) return false;
+    field_ = 0;
+    if (fields_[0] & 1) {
+        lat_ = trackUnzigzag(fields_[1]);
+        lon_ = trackUnzigzag(fields_[2]);
+    } else {
+        lat_ += trackUnzigzag(fields_[1]);
+        lon_ += trackUnzigzag(fields_[2]);
+    }
+    latE6 = lat_;
+    lonE6 = lon_;
+    return true;
+}
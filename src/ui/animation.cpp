@@ -0,0 +1,113 @@
+#include "ui/animation.h"
+
+static const uint32_t TRANSITION_MS = 260;
+
+uint32_t animNowMs() {
+    return millis(); // unsigned differences below stay correct across the 49-day wrap
+}
+
+float ease(Ease curve, float t) {
+    if (t <= 0.0f) return 0.0f;
+    if (t >= 1.0f) return 1.0f;
+    switch (curve) {
+        case Ease::Linear:
+            return t;
+        case Ease::OutCubic: {
+            float u = 1.0f - t;
+            return 1.0f - u * u * u;
+        }
+        case Ease::InOutCubic: {
+            if (t < 0.5f) return 4.0f * t * t * t;
+            float u = -2.0f * t + 2.0f;
+            return 1.0f - u * u * u / 2.0f;
+        }
+        case Ease::OutBack: {
+            const float c1 = 1.70158f, c3 = c1 + 1.0f;
+            float u = t - 1.0f;
+            return 1.0f + c3 * u * u * u + c1 * u * u;
+        }
+    }
+    return t;
+}
+
+// ---- Tween ----
+void Tween::start(float fromValue, float toValue, uint32_t duration, Ease easing) {
+    from = fromValue;
+    to = toValue;
+    startMs = animNowMs();
+    durationMs = duration;
+    curve = easing;
+}
+
+void Tween::retarget(float toValue, uint32_t duration) {
+    start(value(), toValue, duration, curve);
+}
+
+float Tween::value() const {
+    if (durationMs == 0) return to;
+    float t = (float)(animNowMs() - startMs) / (float)durationMs;
+    return from + (to - from) * ease(curve, t);
+}
+
+bool Tween::done() const {
+    return animNowMs() - startMs >= durationMs;
+}
+
+// ---- Follower ----
+void Follower::snap(float v) {
+    target = pos_ = prevPos_ = v;
+    vel_ = 0.0f;
+    accMs_ = 0;
+    lastMs_ = animNowMs();
+    started_ = true;
+}
+
+float Follower::value() {
+    uint32_t now = animNowMs();
+    if (!started_) snap(target);
+    uint32_t elapsed = now - lastMs_;
+    lastMs_ = now;
+    if (elapsed > ANIM_MAX_CATCHUP_MS) elapsed = ANIM_MAX_CATCHUP_MS;
+    accMs_ += elapsed;
+
+    // Semi-implicit Euler on x'' = omega^2 (target - x) - 2 omega x' (critical damping)
+    const float dt = ANIM_STEP_MS / 1000.0f;
+    while (accMs_ >= ANIM_STEP_MS) {
+        prevPos_ = pos_;
+        vel_ += (omega * omega * (target - pos_) - 2.0f * omega * vel_) * dt;
+        pos_ += vel_ * dt;
+        accMs_ -= ANIM_STEP_MS;
+    }
+    float alpha = (float)accMs_ / ANIM_STEP_MS;
+    return prevPos_ + (pos_ - prevPos_) * alpha;
+}
+
+bool Follower::settled() const {
+    return fabsf(target - pos_) < 0.001f && fabsf(vel_) < 0.01f;
+}
+
+// ---- Page transition ----
+static uint32_t g_transitionStart = 0;
+static bool g_transitionActive = false;
+
+void pageTransitionStart() {
+    g_transitionStart = animNowMs();
+    g_transitionActive = true;
+}
+
+bool pageTransitionActive() {
+    return g_transitionActive;
+}
+
+void drawPageTransition(M5Canvas &canvas) {
+    if (!g_transitionActive) return;
+    uint32_t elapsed = animNowMs() - g_transitionStart;
+    if (elapsed >= TRANSITION_MS) {
+        g_transitionActive = false;
+        return;
+    }
+    int cx = canvas.width() / 2, cy = canvas.height() / 2;
+    int full = (int)sqrtf((float)(cx * cx + cy * cy)) + 1; // reaches the corners of the sprite
+    int radius = (int)(full * ease(Ease::OutCubic, (float)elapsed / TRANSITION_MS));
+    canvas.fillArc(cx, cy, full, radius, 0, 360, TFT_BLACK);
+}
@@ -1,7 +1,8 @@
 // drawing.cpp
 #include "drawing.h"
 #include "bluetooth.h"
-#include "page/gpsinfo.h"
+#include "ui/text_cache.h"
+#include "ui/glyph_atlas.h"
 
 
 #ifndef M_PI
@@ -9,8 +10,9 @@
 #endif
 
 // --- Helper Function ---
+// Dial letters only move, so they are blitted from the glyph atlas (label cache until it is loaded)
 void drawLetterInternal(M5Canvas& canvas, int x, int y, const char* letter) {
-    canvas.drawString(letter, x, y);
+    drawTextSmooth(canvas, UiFont::Label, letter, x, y, MC_DATUM, TFT_WHITE);
 }
 
 // Draw the compass background with ticks, rings, and markers rotated so that
@@ -96,20 +98,13 @@ void drawCompassLabels(M5Canvas& canvas, double heading_rad, int centerX, int ce
     }
 }
 
-// Draw the dynamic heading and degree text at center
-void drawHeadingValue(M5Canvas& c, double heading_deg, int centerX, int centerY) {
+// Heading readout; the digits come from the glyph atlas, so they move smoothly with the dial
+void drawHeadingValue(M5Canvas& canvas, double heading_deg, int x, int y) {
+    int deg = (int)lround(heading_deg) % 360;
+    if (deg < 0) deg += 360;
     char buf[8];
-    snprintf(buf, sizeof(buf), "%.0f°", heading_deg);
-    c.setTextSize(6);
-    c.setTextDatum(MC_DATUM);
-    c.setTextColor(TFT_GREEN, TFT_BLACK);
-    c.drawString(buf, centerX, centerY - 10);
-
-    // Small directional suffix
-    const char* dirs[] = {"N","NE","E","SE","S","SW","W","NW"};
-    int idx = (int)round(heading_deg / 45.0) % 8;
-    c.setTextSize(2);
-    c.drawString(dirs[idx], centerX, centerY + 20);
+    snprintf(buf, sizeof(buf), "%d\xC2\xB0", deg); // UTF-8 degree sign
+    drawTextSmooth(canvas, UiFont::Heading, buf, x, y, MC_DATUM, TFT_GREEN);
 }
 
 // Arrow and GPS info remain unchanged...
@@ -185,28 +180,11 @@ void drawTargetArrow(M5Canvas& canvas, double arrowAngleDeg, int centerX, int ce
 }
 
 
-void drawGpsInfo(M5Canvas& canvas, const TinyGPSPlus& gps, int centerX, int centerY) {
+void drawGpsInfo(M5Canvas& canvas, bool gpsValid, bool usingBlePosition, int centerX, int centerY) {
     canvas.setTextSize(1);
     canvas.setTextDatum(MC_DATUM); // Middle Center
 
-    // Get the current fix quality to determine if we're using BLE position
-    int fixQuality = getFixQuality();
-    bool usingBlePosition = (fixQuality == 9);
-    
-    // If GPS is valid or we're using BLE position
-    if (gps.location.isValid() || usingBlePosition) {
-        // Get position from our global variables which might come from BLE
-        double lat = getLatitude();
-        double lon = getLongitude();
-        
-        //draws the GPS coordinates
-        // String lat_str = "Lat: " + String(lat, 4);
-        // String lng_str = "Lng: " + String(lon, 4);
-
-        // canvas.setTextColor(TFT_BLACK, TFT_WHITE);
-        // canvas.drawString(lat_str, centerX, centerY - 10);
-        // canvas.drawString(lng_str, centerX, centerY + 10);
-        
+    if (gpsValid || usingBlePosition) {
         // If using BLE position, show an indicator
         if (usingBlePosition) {
             canvas.setTextColor(TFT_BLUE, TFT_WHITE);
@@ -220,63 +198,5 @@ void drawGpsInfo(M5Canvas& canvas, const TinyGPSPlus& gps, int centerX, int cent
 }
 
 void drawStatusMessage(M5Canvas& canvas, const char* message, int centerX, int yPos, uint16_t color, uint16_t bgColor) {
-    canvas.setTextColor(color, bgColor);
-    canvas.setTextSize(1);
-    canvas.setTextDatum(BC_DATUM); // Bottom Center
-    canvas.drawString(message, centerX, yPos);
-}
-
-// Global variables for popup notifications
-bool popupActive = false;
-uint32_t popupEndTime = 0;
-String popupMessage = "";
-uint16_t popupTextColor = TFT_WHITE;
-uint16_t popupBgColor = TFT_BLUE;
-
-void showPopupNotification(const char* message, uint32_t durationMs, uint16_t color, uint16_t bgColor) {
-    Serial.print("Showing popup: ");
-    Serial.println(message);
-    
-    // Store popup information in global variables
-    popupMessage = String(message);
-    popupEndTime = millis() + durationMs;
-    popupActive = true;
-    popupTextColor = color;
-    popupBgColor = bgColor;
-    // Do not push to display here; main loop will composite to avoid flicker
-}
-
-void drawPopupIfActive(M5Canvas& canvas) {
-    if (!popupActive) return;
-
-    // Expired? clear state and return
-    if (millis() > popupEndTime) {
-        popupActive = false;
-        return;
-    }
-
-    // Save state
-    int oldTextSize = canvas.getTextSizeX();
-    uint8_t oldDatum = canvas.getTextDatum();
-
-    canvas.setTextSize(2);
-    canvas.setTextDatum(MC_DATUM);
-
-    int popupWidth = canvas.textWidth(popupMessage.c_str()) + 40;
-    int popupHeight = 50;
-    if (popupWidth > canvas.width() - 10) popupWidth = canvas.width() - 10; // clamp
-    int popupX = (canvas.width() - popupWidth) / 2;
-    int popupY = (canvas.height() - popupHeight) / 2;
-
-    // Draw body
-    canvas.fillRoundRect(popupX, popupY, popupWidth, popupHeight, 15, popupBgColor);
-    canvas.drawRoundRect(popupX, popupY, popupWidth, popupHeight, 15, TFT_WHITE);
-    canvas.drawRoundRect(popupX+1, popupY+1, popupWidth-2, popupHeight-2, 14, TFT_WHITE);
-
-    canvas.setTextColor(popupTextColor);
-    canvas.drawString(popupMessage, canvas.width() / 2, canvas.height() / 2);
-
-    // Restore
-    canvas.setTextSize(oldTextSize);
-    canvas.setTextDatum(oldDatum);
+    drawTextCached(canvas, message, centerX, yPos, BC_DATUM, 1, color, bgColor); // Bottom Center
 }
@@ -0,0 +1,94 @@
+#include "ui/glyph_atlas.h"
+#include "ui/font_label.h"
+#include "ui/font_heading.h"
+
+static const GlyphFont *const FONTS[(int)UiFont::Count] = { &font_label, &font_heading };
+
+static const GlyphData *findGlyph(const GlyphFont &a, uint32_t code) {
+    int lo = 0, hi = (int)a.count - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (a.glyphs[mid].code == code) return &a.glyphs[mid];
+        if (a.glyphs[mid].code < code) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return nullptr;
+}
+
+// Next code point of a UTF-8 string (1..3 byte sequences; anything else is returned as a byte)
+static uint32_t nextCodePoint(const char *&s) {
+    uint8_t c = (uint8_t)*s++;
+    if (c < 0x80) return c;
+    if ((c & 0xE0) == 0xC0 && (s[0] & 0xC0) == 0x80) {
+        return ((uint32_t)(c & 0x1F) << 6) | (uint8_t)(*s++ & 0x3F);
+    }
+    if ((c & 0xF0) == 0xE0 && (s[0] & 0xC0) == 0x80 && (s[1] & 0xC0) == 0x80) {
+        uint32_t cp = ((uint32_t)(c & 0x0F) << 12) | ((uint32_t)(s[0] & 0x3F) << 6) | (uint32_t)(s[1] & 0x3F);
+        s += 2;
+        return cp;
+    }
+    return c;
+}
+
+static int textWidth(const GlyphFont &a, const char *text) {
+    int w = 0;
+    while (*text) {
+        const GlyphData *g = findGlyph(a, nextCodePoint(text));
+        if (g) w += g->advance;
+    }
+    return w;
+}
+
+// 16 alpha levels blended from bg to fg, byte-swapped RGB565 like the other palettes
+static void blendPalette(uint16_t fg, uint16_t bg, uint16_t *palette) {
+    static uint16_t lastFg = 0, lastBg = 0;
+    static uint16_t cached[16];
+    static bool valid = false;
+    if (!valid || fg != lastFg || bg != lastBg) {
+        int fr = fg >> 11, fgc = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+        int br = bg >> 11, bgc = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+        for (int i = 0; i < 16; i++) {
+            int r = br + (fr - br) * i / 15;
+            int g = bgc + (fgc - bgc) * i / 15;
+            int b = bb + (fb - bb) * i / 15;
+            uint16_t c = (uint16_t)((r << 11) | (g << 5) | b);
+            cached[i] = (uint16_t)((c >> 8) | (c << 8));
+        }
+        lastFg = fg; lastBg = bg; valid = true;
+    }
+    memcpy(palette, cached, sizeof(cached));
+}
+
+void drawTextSmooth(M5Canvas &canvas, UiFont font, const char *text, int x, int y, uint8_t datum,
+                    uint16_t fg, uint16_t bg) {
+    if (!text || !*text) return;
+    const GlyphFont &a = *FONTS[(int)font];
+
+    // Same box as drawString: width of the advances, height ascent + descent
+    int w = textWidth(a, text);
+    int h = a.ascent + a.descent;
+    switch (datum) {
+    case TC_DATUM: x -= w / 2; break;
+    case TR_DATUM: x -= w; break;
+    case ML_DATUM: y -= h / 2; break;
+    case MC_DATUM: x -= w / 2; y -= h / 2; break;
+    case MR_DATUM: x -= w; y -= h / 2; break;
+    case BL_DATUM: y -= h; break;
+    case BC_DATUM: x -= w / 2; y -= h; break;
+    case BR_DATUM: x -= w; y -= h; break;
+    default: break;
+    }
+    int baseline = y + a.ascent;
+
+    uint16_t palette[16];
+    blendPalette(fg, bg, palette);
+    while (*text) {
+        const GlyphData *g = findGlyph(a, nextCodePoint(text));
+        if (!g) continue;
+        if (g->w && g->h) {
+            canvas.pushImage(x + g->dx, baseline - g->dy, g->w, g->h, a.bits + g->offset, 0u,
+                lgfx::palette_4bit, (const lgfx::swap565_t*)palette);
+        }
+        x += g->advance;
+    }
+}
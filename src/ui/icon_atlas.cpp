@@ -0,0 +1,110 @@
+#include "ui/icon_atlas.h"
+#include "log.h"
+
+static const size_t ATLAS_MAX_ICONS = 16;
+static const uint8_t DIM_PERCENT = 45; // brightness of the dimmed palette
+
+struct AtlasEntry {
+    const tImage *icon;
+    uint8_t *pixels;          // palette indices, row-major
+    uint16_t *palette;        // byte-swapped RGB565, as stored
+    uint16_t *dimPalette;
+    uint16_t paletteSize;
+    bool transparent;         // index 0 is not drawn
+};
+
+static AtlasEntry g_entries[ATLAS_MAX_ICONS];
+static size_t g_entryCount = 0;
+static size_t g_bytes = 0;
+
+static uint16_t dimSwapped565(uint16_t swapped) {
+    uint16_t c = (uint16_t)((swapped >> 8) | (swapped << 8));
+    uint16_t r = ((c >> 11) & 0x1F) * DIM_PERCENT / 100;
+    uint16_t g = ((c >> 5) & 0x3F) * DIM_PERCENT / 100;
+    uint16_t b = (c & 0x1F) * DIM_PERCENT / 100;
+    c = (uint16_t)((r << 11) | (g << 5) | b);
+    return (uint16_t)((c >> 8) | (c << 8));
+}
+
+// Blob layout: see tools/icon_converter.py
+static bool decode(const tImage *icon, AtlasEntry &e) {
+    const uint8_t *p = (const uint8_t*)icon->data;
+    e.transparent = p[0] & 1;
+    e.paletteSize = (uint16_t)p[1] + 1;
+    p += 2;
+
+    size_t count = (size_t)icon->width * icon->height;
+    e.pixels = (uint8_t*)malloc(count);
+    e.palette = (uint16_t*)malloc(e.paletteSize * sizeof(uint16_t) * 2);
+    if (!e.pixels || !e.palette) {
+        free(e.pixels); free(e.palette);
+        return false;
+    }
+    e.dimPalette = e.palette + e.paletteSize;
+    for (uint16_t i = 0; i < e.paletteSize; i++, p += 2) {
+        e.palette[i] = (uint16_t)(p[0] | (p[1] << 8));
+        e.dimPalette[i] = dimSwapped565(e.palette[i]);
+    }
+
+    size_t out = 0;
+    while (out < count) {
+        uint8_t token = *p++;
+        size_t len = (token & 0x7F) + 1;
+        if (len > count - out) len = count - out; // never write past the image, even for a bad blob
+        if (token & 0x80) {
+            memset(e.pixels + out, *p++, len);
+        } else {
+            memcpy(e.pixels + out, p, len);
+            p += (token & 0x7F) + 1;
+        }
+        out += len;
+    }
+    e.icon = icon;
+    g_bytes += count + e.paletteSize * sizeof(uint16_t) * 2;
+    return true;
+}
+
+static const AtlasEntry *lookup(const tImage *icon) {
+    for (size_t i = 0; i < g_entryCount; i++) {
+        if (g_entries[i].icon == icon) return &g_entries[i];
+    }
+    if (g_entryCount == ATLAS_MAX_ICONS) return nullptr;
+    uint32_t t0 = micros();
+    AtlasEntry &e = g_entries[g_entryCount];
+    if (!decode(icon, e)) {
+        LOGW("icons", "out of memory decoding %ux%u icon", icon->width, icon->height);
+        return nullptr;
+    }
+    g_entryCount++;
+    LOGD("icons", "decoded %ux%u icon (%u colors) in %lu us, atlas %u B", icon->width, icon->height,
+        e.paletteSize, (unsigned long)(micros() - t0), (unsigned)g_bytes);
+    return &e;
+}
+
+void drawIcon(M5Canvas &canvas, const tImage *icon, int centerX, int centerY, bool dimmed) {
+    int x = centerX - icon->width / 2;
+    int y = centerY - icon->height / 2;
+
+    if (icon->depth == 1) {
+        canvas.drawXBitmap(x, y, (const uint8_t*)icon->data, icon->width, icon->height,
+                           dimmed ? TFT_DARKGREY : TFT_WHITE);
+        return;
+    }
+    if (icon->encoding == ICON_ENC_PAL8_RLE) {
+        const AtlasEntry *e = lookup(icon);
+        if (!e) return;
+        auto palette = (const lgfx::swap565_t*)(dimmed ? e->dimPalette : e->palette);
+        if (e->transparent) {
+            canvas.pushImage(x, y, icon->width, icon->height, e->pixels, 0u, lgfx::palette_8bit, palette);
+        } else {
+            canvas.pushImage(x, y, icon->width, icon->height, e->pixels, lgfx::palette_8bit, palette);
+        }
+        return;
+    }
+    // Raw 16-bit: no dimmed variant
+    canvas.pushImage(x, y, icon->width, icon->height, (const uint16_t*)icon->data);
+}
+
+size_t iconAtlasBytes() {
+    return g_bytes;
+}
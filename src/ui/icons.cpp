@@ -1,625 +1,950 @@
-#include "icons.h" // Include the header!
-#include <M5GFX.h>
+// Generated by tools/icon_converter.py from icons.cpp, do not edit by hand.
+// Palettized + RLE (ICON_ENC_PAL8_RLE); decoded once by ui/icon_atlas.cpp.
+#include "icons.h"
 
+// 42x42, 1882 B (raw 3528 B)
+static const uint8_t image_data_compass[1882] = {
+    // █████████████████  ░░░░  █████████████████
+    // ██████████████ ░▒▒▒▒▒▒▒▒▒▒░░██████████████
+    // ████████████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ ███████████
+    // ██████████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░██████████
+    // █████████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█████████
+    // ███████ ▒▒▒▒▒▒▒▒▒▒▒▒ ░░▒▒▒▒▒▒▒▒▒▒▒ ███████
+    // ██████ ▒▒▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒▒▒ ██████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░▒▒▒▒▒▒▒▒▒▒▒▒▒ █████
+    // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+    // ████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░████
+    // ███ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ███
+    // ███░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ██ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ██
+    // ██░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░██
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ █
+    // █ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ █
+    // █░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█
+    // █░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█
+    // █░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ░░ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █░▒▒▒░░░░▒▒▒▒▒▒▒▒▒ ░░░░ ▒▒▒▒▒▒▒▒▒▒░ ░▒▒▒▒█
+    // █░▒▒▒░   ▒▒▒▒▒▒▒▒▒ ░  ░ ▒▒▒▒▒▒▒▒▒▒░ ▒▒▒▒▒█
+    // █▒▒▒▒▒░░░▒▒▒▒▒▒▒▒░ ▒  ░ ▒▒▒▒▒▒▒▒▒▒░░░▒▒▒▒█
+    // █░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒   ░░ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█
+    // █░▒▒▒▒▒▒▒▒▒▒▒▒▒▒░     ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█
+    // █░▒▒▒▒▒▒▒▒▒▒▒▒▒▒    ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█
+    // █ ▒▒▒▒▒▒▒▒▒▒▒▒▒░   ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ █
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ██░▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░██
+    // ██ ▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ██
+    // ███░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ███ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ███
+    // ████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░████
+    // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒ █████
+    // ██████ ▒▒▒▒▒▒▒▒▒▒▒▒▒ ░▒▒▒▒▒▒▒▒▒▒▒▒▒ ██████
+    // ███████ ▒▒▒▒▒▒▒▒▒▒▒▒░ ░▒▒▒▒▒▒▒▒▒▒▒ ███████
+    // █████████░▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒ ████████
+    // ██████████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░██████████
+    // ████████████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ ███████████
+    // ██████████████ ░▒▒▒▒▒▒▒▒▒▒░░██████████████
+    // █████████████████  ░░░░   ████████████████
+    // ██████████████████████████████████████████
+    0x01, 0xef, 0x00, 0x00, 0x35, 0x12, 0x3d, 0x12, 0x25, 0x13, 0x2d, 0x13, 0x35, 0x13, 0x3d, 0x13,
+    0x45, 0x13, 0x5d, 0x13, 0x25, 0x14, 0x2d, 0x14, 0x35, 0x14, 0x3d, 0x14, 0x45, 0x14, 0x4d, 0x14,
+    0x5e, 0x17, 0x76, 0x17, 0x5e, 0x18, 0x8e, 0x18, 0x86, 0x19, 0x8f, 0x1b, 0xa7, 0x1b, 0x8f, 0x1c,
+    0x9f, 0x1c, 0xb7, 0x1c, 0xb7, 0x1d, 0x35, 0x33, 0x3d, 0x33, 0x55, 0x33, 0x1d, 0x34, 0x25, 0x34,
+    0x2d, 0x34, 0x35, 0x34, 0x3d, 0x34, 0x45, 0x34, 0x4d, 0x34, 0x55, 0x34, 0x5d, 0x34, 0x25, 0x35,
+    0x2d, 0x35, 0x35, 0x35, 0x3d, 0x35, 0x45, 0x35, 0x2d, 0x36, 0x35, 0x36, 0x96, 0x38, 0x5e, 0x39,
+    0x76, 0x39, 0x8e, 0x39, 0x9f, 0x3c, 0xa7, 0x3c, 0xaf, 0x3c, 0xb7, 0x3c, 0xbf, 0x3c, 0xc7, 0x3c,
+    0xbf, 0x3d, 0x2d, 0x53, 0x35, 0x53, 0x25, 0x54, 0x2d, 0x54, 0x35, 0x54, 0x3d, 0x54, 0x45, 0x54,
+    0x4d, 0x54, 0x55, 0x54, 0x5d, 0x54, 0x25, 0x55, 0x2d, 0x55, 0x35, 0x55, 0x3d, 0x55, 0x45, 0x55,
+    0x5d, 0x55, 0x7d, 0x55, 0x2d, 0x56, 0x35, 0x56, 0x65, 0x56, 0x86, 0x58, 0x8e, 0x58, 0x66, 0x59,
+    0x6e, 0x59, 0x8e, 0x59, 0x96, 0x59, 0x5e, 0x5a, 0x8f, 0x5d, 0xb7, 0x5d, 0x97, 0x5e, 0x2d, 0x73,
+    0x25, 0x74, 0x2d, 0x74, 0x35, 0x74, 0x25, 0x75, 0x2d, 0x75, 0x35, 0x75, 0x3d, 0x75, 0x45, 0x75,
+    0x65, 0x75, 0x6d, 0x75, 0x2d, 0x76, 0x35, 0x76, 0x5d, 0x76, 0x6d, 0x76, 0x86, 0x78, 0x6e, 0x79,
+    0x96, 0x79, 0x9e, 0x79, 0x66, 0x7a, 0x6e, 0x7a, 0x7e, 0x7a, 0x96, 0x7a, 0x9e, 0x7a, 0x9f, 0x7d,
+    0xb7, 0x7d, 0xbf, 0x7d, 0xc7, 0x7d, 0xa7, 0x7e, 0xaf, 0x7e, 0xcf, 0x7e, 0x44, 0x91, 0x2c, 0x92,
+    0x34, 0x92, 0x3c, 0x92, 0x2d, 0x94, 0x2d, 0x95, 0x35, 0x95, 0x3d, 0x95, 0x25, 0x96, 0x35, 0x96,
+    0x3d, 0x96, 0x45, 0x96, 0x4d, 0x96, 0x65, 0x96, 0x6d, 0x96, 0x86, 0x99, 0x9e, 0x99, 0x76, 0x9a,
+    0x96, 0x9a, 0x9e, 0x9a, 0x76, 0x9b, 0x86, 0x9b, 0xae, 0x9b, 0xa7, 0x9d, 0x9f, 0x9e, 0xa7, 0x9e,
+    0xc7, 0x9e, 0xdf, 0x9e, 0xc7, 0x9f, 0xcf, 0x9f, 0xd7, 0x9f, 0x3c, 0xb1, 0x34, 0xb2, 0x3c, 0xb2,
+    0x44, 0xb2, 0x34, 0xb3, 0x4c, 0xb3, 0x35, 0xb5, 0x35, 0xb6, 0x3d, 0xb6, 0x45, 0xb6, 0x4d, 0xb6,
+    0x65, 0xb6, 0x75, 0xb6, 0x7d, 0xb6, 0x95, 0xb6, 0x85, 0xb7, 0x9e, 0xba, 0xae, 0xba, 0xa6, 0xbb,
+    0xa7, 0xbd, 0xbf, 0xbe, 0xc7, 0xbe, 0xcf, 0xbe, 0x9f, 0xbf, 0xa7, 0xbf, 0xb7, 0xbf, 0xd7, 0xbf,
+    0x2c, 0xd2, 0x34, 0xd2, 0x3c, 0xd2, 0x44, 0xd2, 0x4c, 0xd2, 0x2c, 0xd3, 0x34, 0xd3, 0x3c, 0xd3,
+    0x4c, 0xd3, 0x5d, 0xd6, 0x6d, 0xd6, 0x7d, 0xd6, 0x5d, 0xd7, 0x65, 0xd7, 0x6d, 0xd7, 0x75, 0xd7,
+    0x7d, 0xd7, 0x75, 0xd8, 0x86, 0xda, 0x96, 0xdb, 0xa6, 0xdb, 0xae, 0xdb, 0xbe, 0xdb, 0xbf, 0xde,
+    0xcf, 0xde, 0xaf, 0xdf, 0xb7, 0xdf, 0xc7, 0xdf, 0xcf, 0xdf, 0xdf, 0xdf, 0x2c, 0xf2, 0x34, 0xf2,
+    0x3c, 0xf2, 0x4c, 0xf2, 0x24, 0xf3, 0x2c, 0xf3, 0x34, 0xf3, 0x3c, 0xf3, 0x44, 0xf3, 0x4c, 0xf3,
+    0x54, 0xf3, 0x24, 0xf4, 0x2c, 0xf4, 0x34, 0xf4, 0x3c, 0xf4, 0x4c, 0xf4, 0x7d, 0xf6, 0x5d, 0xf7,
+    0x6d, 0xf7, 0x75, 0xf7, 0x85, 0xf7, 0x8d, 0xf7, 0x65, 0xf8, 0x75, 0xf8, 0x85, 0xf8, 0x86, 0xfb,
+    0x96, 0xfb, 0x86, 0xfc, 0x8e, 0xfc, 0xb6, 0xfc, 0xaf, 0xff, 0xb7, 0xff, 0xbf, 0xff, 0xc7, 0xff,
+    0xff, 0xff, 0x90, 0x00, 0x07, 0xed, 0x6e, 0x14, 0xc1, 0xe6, 0xe6, 0x6e, 0xc8, 0x9e, 0x00, 0x0d,
+    0x37, 0xe5, 0x4b, 0x0e, 0xd4, 0x06, 0xb6, 0xd4, 0xd4, 0xb6, 0xdc, 0x47, 0xbf, 0xa6, 0x99, 0x00,
+    0x12, 0x87, 0x40, 0xb1, 0xd4, 0xda, 0x44, 0x3b, 0x5c, 0x5c, 0x20, 0x45, 0x28, 0x28, 0x29, 0x0c,
+    0xb5, 0x23, 0x84, 0xca, 0x94, 0x00, 0x15, 0xc4, 0x25, 0xce, 0x3c, 0x3b, 0x3b, 0x5c, 0x1e, 0x7a,
+    0x3a, 0x0a, 0x28, 0x27, 0x44, 0x4a, 0x43, 0x43, 0x7b, 0x3c, 0x76, 0x23, 0xc2, 0x92, 0x00, 0x05,
+    0x10, 0xb1, 0x20, 0x58, 0x57, 0x7a, 0x82, 0x5b, 0x08, 0x1f, 0x9d, 0x45, 0x46, 0x5d, 0x1f, 0x43,
+    0x26, 0x43, 0x82, 0x5c, 0x02, 0x21, 0x95, 0x9f, 0x8f, 0x00, 0x1b, 0x91, 0x24, 0x21, 0x0a, 0x43,
+    0x7a, 0x5a, 0x1e, 0x3b, 0x3a, 0x58, 0x3c, 0x81, 0xab, 0x86, 0x4e, 0x0a, 0x1f, 0x9b, 0x62, 0x43,
+    0x5c, 0x5c, 0x1f, 0x45, 0xaf, 0x0e, 0x8f, 0x8c, 0x00, 0x1d, 0xca, 0x24, 0x05, 0x44, 0x5b, 0x61,
+    0x43, 0x27, 0x27, 0x43, 0x7b, 0x58, 0xce, 0xbb, 0x8e, 0xec, 0xde, 0x1a, 0x7b, 0x3a, 0x3a, 0x43,
+    0x5b, 0x43, 0x44, 0x44, 0x9c, 0xd3, 0x97, 0xa8, 0x8b, 0x00, 0x13, 0x1c, 0x05, 0x44, 0x43, 0x49,
+    0x49, 0x27, 0x44, 0x44, 0x1f, 0x3b, 0x59, 0xd3, 0xb8, 0x9f, 0xbc, 0x0f, 0x04, 0x58, 0x7a, 0x82,
+    0x5b, 0x07, 0x3b, 0x1f, 0x43, 0x42, 0x5c, 0x3e, 0x75, 0xa9, 0x89, 0x00, 0x1f, 0x5f, 0x1a, 0x59,
+    0x44, 0x28, 0x2c, 0x28, 0x28, 0x43, 0x3b, 0x5b, 0x43, 0x43, 0x44, 0x20, 0x0b, 0x05, 0x20, 0x3b,
+    0x58, 0x58, 0x43, 0x5b, 0x5b, 0x3a, 0x43, 0x5b, 0x42, 0x5b, 0x3c, 0xd3, 0x41, 0x88, 0x00, 0x04,
+    0x67, 0x07, 0x3b, 0x57, 0x44, 0x82, 0x28, 0x03, 0x43, 0x43, 0x58, 0x5b, 0x83, 0x43, 0x04, 0x3c,
+    0x1f, 0x3b, 0x3b, 0x5b, 0x82, 0x43, 0x09, 0x5b, 0x5b, 0x43, 0x43, 0x61, 0x42, 0x43, 0x3d, 0xcf,
+    0xdd, 0x86, 0x00, 0x06, 0x74, 0xd6, 0x05, 0x7b, 0x3b, 0x44, 0x44, 0x82, 0x43, 0x0c, 0x3b, 0x3b,
+    0x43, 0x49, 0x49, 0x43, 0x43, 0x44, 0x44, 0x43, 0x43, 0x5b, 0x5b, 0x83, 0x43, 0x08, 0x44, 0x28,
+    0x49, 0x61, 0x27, 0x5d, 0x1a, 0x94, 0x35, 0x85, 0x00, 0x03, 0xe1, 0xd4, 0x5c, 0x5c, 0x82, 0x43,
+    0x01, 0x5b, 0x58, 0x82, 0x3b, 0x01, 0x43, 0x49, 0x82, 0x43, 0x01, 0x44, 0x44, 0x82, 0x43, 0x0d,
+    0x5b, 0x5c, 0x28, 0x27, 0x27, 0x44, 0x44, 0x43, 0x4a, 0x28, 0x20, 0x7b, 0x1b, 0x60, 0x84, 0x00,
+    0x07, 0xc6, 0xb2, 0x3c, 0x5b, 0x43, 0x5b, 0x5a, 0x5a, 0x83, 0x3b, 0x02, 0x44, 0x28, 0x28, 0x82,
+    0x43, 0x01, 0x3b, 0x3b, 0x82, 0x5b, 0x0e, 0x43, 0x28, 0x0b, 0x1f, 0x3b, 0x44, 0x3b, 0x5c, 0x1f,
+    0x45, 0x44, 0x1f, 0x7c, 0xb1, 0x54, 0x83, 0x00, 0x07, 0x84, 0xb0, 0x43, 0x61, 0x43, 0x43, 0x42,
+    0x58, 0x82, 0x3b, 0x05, 0x43, 0x43, 0x28, 0x28, 0x44, 0x43, 0x82, 0x3b, 0x11, 0x58, 0x5b, 0x5b,
+    0x27, 0x0a, 0x0a, 0x43, 0x5c, 0x5b, 0x3b, 0x5b, 0x5c, 0x28, 0x44, 0x43, 0x5b, 0xd3, 0xe0, 0x83,
+    0x00, 0x06, 0x41, 0x21, 0x28, 0x62, 0x4a, 0x27, 0x27, 0x82, 0x3b, 0x07, 0x43, 0x43, 0x49, 0x49,
+    0x44, 0x44, 0x58, 0x5b, 0x82, 0x43, 0x16, 0x44, 0x27, 0x0a, 0x09, 0x1e, 0x5a, 0x5b, 0x43, 0x3b,
+    0x3b, 0x7b, 0x27, 0x43, 0x62, 0x5b, 0x3b, 0x0d, 0xae, 0x00, 0x00, 0x71, 0xd0, 0x3d, 0x82, 0x27,
+    0x36, 0x49, 0x44, 0x3c, 0x3b, 0x58, 0x5b, 0x5b, 0x49, 0x43, 0x44, 0x3c, 0x3b, 0x5b, 0x5c, 0x44,
+    0x44, 0x1f, 0xd8, 0xd8, 0x09, 0x43, 0x5a, 0x42, 0x43, 0x44, 0x5c, 0x1f, 0x5b, 0x43, 0x26, 0x61,
+    0x7a, 0xd3, 0x19, 0x00, 0x00, 0xa5, 0xb1, 0x3c, 0x1f, 0x7e, 0x26, 0x5c, 0x1f, 0x5b, 0x5c, 0x1f,
+    0x7a, 0x1e, 0x3b, 0x44, 0x43, 0x3b, 0x44, 0x3c, 0x83, 0xd2, 0x1f, 0xd1, 0x09, 0x27, 0x44, 0x5b,
+    0x42, 0x43, 0x5b, 0x43, 0x43, 0x3b, 0x58, 0x5b, 0x5b, 0x5c, 0xb5, 0x30, 0x00, 0x00, 0x12, 0xb0,
+    0x59, 0x7b, 0x1e, 0x5c, 0x1f, 0x44, 0xd1, 0x5c, 0x5b, 0x5a, 0x5b, 0x82, 0x1f, 0x34, 0x5c, 0xda,
+    0xdb, 0x66, 0x66, 0xd4, 0xd3, 0x04, 0x1f, 0x1f, 0x27, 0x43, 0x5b, 0x5b, 0x43, 0x43, 0x44, 0x05,
+    0x04, 0x59, 0x3b, 0x43, 0x0c, 0xbe, 0x00, 0x00, 0xbe, 0xb0, 0x3c, 0x44, 0x7f, 0x0b, 0x45, 0x5d,
+    0x7c, 0x3c, 0x3b, 0x43, 0x5b, 0x5c, 0x3b, 0x7e, 0x0a, 0x63, 0xad, 0x31, 0x17, 0xc9, 0x40, 0xaf,
+    0x1f, 0x44, 0x44, 0x83, 0x43, 0x76, 0x27, 0x44, 0x2a, 0x81, 0x5d, 0x7b, 0x5c, 0xda, 0x5f, 0x00,
+    0x00, 0xb9, 0xd3, 0x5c, 0x0b, 0x69, 0x86, 0xe8, 0x66, 0x9e, 0x20, 0x3b, 0x5b, 0x42, 0x5b, 0x5c,
+    0x1e, 0xda, 0x72, 0x6d, 0xe2, 0x51, 0x4d, 0x8c, 0xce, 0x3b, 0x5c, 0x4a, 0x27, 0x27, 0x43, 0x43,
+    0x7b, 0xd2, 0xbc, 0x8d, 0x11, 0x44, 0x1f, 0x20, 0x47, 0x00, 0x00, 0x83, 0x0b, 0x7c, 0xda, 0xe3,
+    0xec, 0x73, 0x72, 0xd5, 0x21, 0x5c, 0x43, 0x5b, 0x43, 0x43, 0x5c, 0x21, 0xc8, 0xa3, 0xef, 0xef,
+    0xba, 0xa7, 0x5e, 0x5c, 0x43, 0x27, 0x43, 0x44, 0x3c, 0x3c, 0x3b, 0x0a, 0x2f, 0xac, 0x81, 0x0b,
+    0x62, 0x20, 0x47, 0x00, 0x00, 0x64, 0x05, 0x44, 0x0b, 0x2a, 0x8a, 0xc0, 0x6b, 0xb1, 0x3d, 0x44,
+    0x43, 0x5b, 0x5b, 0x20, 0xb0, 0x84, 0xef, 0x48, 0xc5, 0x36, 0xa0, 0xeb, 0x3d, 0x83, 0x43, 0x47,
+    0x3b, 0x20, 0x3b, 0x5b, 0xd2, 0xbc, 0x16, 0x2e, 0x45, 0x5c, 0x0b, 0x5f, 0x00, 0x00, 0xbf, 0xb5,
+    0x44, 0x44, 0x45, 0x0c, 0x0c, 0x1a, 0x59, 0x3c, 0x1f, 0x43, 0x1e, 0x7b, 0x05, 0xd7, 0xcb, 0xef,
+    0x90, 0xa2, 0x2d, 0xed, 0x4f, 0xd2, 0x43, 0x4a, 0x62, 0x43, 0x3b, 0x38, 0x3b, 0x5b, 0x3b, 0x21,
+    0x21, 0x45, 0x44, 0x5c, 0xd3, 0x83, 0x00, 0x00, 0x12, 0xb0, 0x5c, 0x43, 0x27, 0x43, 0x5b, 0x58,
+    0x58, 0x3b, 0x44, 0x43, 0x43, 0x3b, 0xce, 0x85, 0x83, 0xef, 0x24, 0x32, 0xbd, 0xd4, 0x44, 0x61,
+    0x4a, 0x27, 0x3b, 0x58, 0x58, 0x56, 0x3a, 0x3b, 0x3c, 0x44, 0x44, 0x43, 0x43, 0x0c, 0xa1, 0x00,
+    0x00, 0x88, 0xce, 0x58, 0x26, 0x61, 0x43, 0x43, 0x5a, 0x58, 0x43, 0x0a, 0x5c, 0x3b, 0x1a, 0x3f,
+    0x83, 0xef, 0x03, 0xbd, 0x96, 0xdb, 0x29, 0x83, 0x43, 0x00, 0x3b, 0x82, 0x58, 0x20, 0x3b, 0x7a,
+    0x1f, 0x1f, 0x62, 0x1f, 0x5c, 0xb5, 0x51, 0x00, 0x00, 0xa9, 0x02, 0x38, 0x5b, 0x61, 0x26, 0x61,
+    0x7a, 0x43, 0x44, 0x5c, 0x1f, 0x3c, 0xb0, 0xe7, 0xef, 0xef, 0x34, 0xd7, 0x95, 0x45, 0x20, 0x83,
+    0x43, 0x01, 0x3b, 0x3b, 0x82, 0x43, 0x08, 0x5b, 0x1e, 0x5b, 0x43, 0x27, 0x62, 0x3b, 0x06, 0x18,
+    0x82, 0x00, 0x19, 0x40, 0x39, 0x5b, 0x49, 0x49, 0x4a, 0x43, 0x27, 0x43, 0x27, 0x5c, 0x0c, 0x4b,
+    0xef, 0xef, 0x4c, 0xb1, 0x21, 0x7c, 0x5b, 0x7a, 0x57, 0x5b, 0x3b, 0x3c, 0x3b, 0x84, 0x43, 0x06,
+    0x3b, 0x5c, 0x3b, 0x44, 0x44, 0x5c, 0x07, 0x83, 0x00, 0x25, 0x65, 0xce, 0x5c, 0x27, 0x62, 0x27,
+    0x4a, 0x4a, 0x43, 0x7e, 0x0a, 0x76, 0xad, 0xee, 0x82, 0xb6, 0x3c, 0x5c, 0x1e, 0x5a, 0x3a, 0x3a,
+    0x58, 0x3b, 0x3c, 0x3c, 0x43, 0x43, 0x2b, 0x2b, 0x27, 0x43, 0x44, 0x28, 0x44, 0x28, 0x06, 0xb9,
+    0x83, 0x00, 0x25, 0xc6, 0x97, 0x46, 0x28, 0x44, 0x43, 0x43, 0x5c, 0x43, 0x5b, 0x1f, 0x2e, 0x53,
+    0xd5, 0xd4, 0x46, 0x21, 0x5d, 0x7a, 0x3a, 0x5c, 0x44, 0x3b, 0x3b, 0x3c, 0x20, 0x43, 0x43, 0x49,
+    0x49, 0x43, 0x27, 0x44, 0x44, 0x20, 0x46, 0x96, 0x6f, 0x84, 0x00, 0x18, 0xbf, 0x78, 0x5d, 0x3b,
+    0x5b, 0x7b, 0x1e, 0x5b, 0x43, 0x44, 0x80, 0xb4, 0x45, 0x44, 0x20, 0x45, 0x28, 0x3a, 0x5b, 0x1f,
+    0x44, 0x43, 0x3b, 0x20, 0x44, 0x83, 0x43, 0x06, 0x5c, 0x27, 0x5c, 0x44, 0x44, 0xb5, 0x64, 0x85,
+    0x00, 0x23, 0x92, 0xdc, 0x3c, 0x58, 0x57, 0x58, 0x7b, 0x5b, 0x5b, 0x5c, 0x1f, 0x5c, 0x3a, 0x1e,
+    0x7b, 0x1f, 0x1e, 0x7a, 0x5b, 0x43, 0x27, 0x5b, 0x43, 0x44, 0x28, 0x43, 0x3b, 0x58, 0x3b, 0x44,
+    0x44, 0x5b, 0x5b, 0x5c, 0xd4, 0x19, 0x86, 0x00, 0x11, 0x50, 0xb0, 0x59, 0x79, 0x58, 0x3b, 0x3b,
+    0x43, 0x28, 0x62, 0x3a, 0x5a, 0x5b, 0x43, 0x5b, 0x5b, 0x43, 0x43, 0x82, 0x5b, 0x0c, 0x43, 0x28,
+    0x44, 0x43, 0x3b, 0x58, 0x58, 0x43, 0x43, 0x3a, 0x9c, 0xd3, 0xe4, 0x88, 0x00, 0x1f, 0x64, 0x22,
+    0x3c, 0x5b, 0x43, 0x43, 0x44, 0x28, 0x44, 0x5b, 0x3a, 0x43, 0x3b, 0x3b, 0x5c, 0xda, 0x0b, 0x3b,
+    0x5a, 0x7a, 0x5c, 0x28, 0x27, 0x5c, 0x5b, 0x3a, 0x5b, 0x7d, 0x1d, 0x5c, 0x06, 0x08, 0x8a, 0x00,
+    0x1e, 0x99, 0x21, 0x5c, 0x3a, 0x43, 0x62, 0x44, 0x27, 0x5b, 0x5b, 0x1f, 0x7b, 0x3b, 0x20, 0x6a,
+    0x89, 0x44, 0x3b, 0x03, 0x3b, 0x5c, 0x44, 0x3b, 0x43, 0x5b, 0x5b, 0x5a, 0x5b, 0x21, 0xb3, 0xaa,
+    0x8a, 0x00, 0x1d, 0xca, 0x40, 0x04, 0x9a, 0x7a, 0x1e, 0x44, 0x44, 0x1e, 0x5b, 0x3b, 0x1f, 0x3c,
+    0x20, 0x55, 0xe9, 0x21, 0x3c, 0x5c, 0x7c, 0x44, 0x1f, 0x58, 0x5b, 0x3c, 0x20, 0x5d, 0xd4, 0xb7,
+    0x33, 0x8c, 0x00, 0x1b, 0xa8, 0x40, 0x01, 0x38, 0x9a, 0x5b, 0x43, 0x62, 0x43, 0x43, 0x5c, 0x44,
+    0x28, 0xe3, 0xab, 0x2e, 0xd2, 0x1f, 0x3b, 0x3b, 0x5b, 0x7a, 0x3b, 0x0a, 0x46, 0x96, 0xd7, 0x70,
+    0x8f, 0x00, 0x18, 0xe1, 0xb1, 0x04, 0x58, 0x7a, 0x5c, 0x28, 0x1f, 0x5b, 0x43, 0x27, 0x52, 0x2e,
+    0x44, 0x43, 0x7e, 0x43, 0x5b, 0x5b, 0x3b, 0x5c, 0x45, 0x78, 0x60, 0xc7, 0x91, 0x00, 0x15, 0x15,
+    0x40, 0xcd, 0x1a, 0x20, 0x45, 0x44, 0x5c, 0x5a, 0x43, 0x0a, 0xd9, 0x27, 0x7e, 0x42, 0x7b, 0x43,
+    0x44, 0x45, 0x95, 0xdc, 0x6c, 0x95, 0x00, 0x12, 0xa4, 0x47, 0xd4, 0xd3, 0x20, 0x3c, 0x7b, 0x3b,
+    0x7f, 0x44, 0x7e, 0x1e, 0x5b, 0x1f, 0x20, 0xd3, 0xd5, 0x13, 0x93, 0x98, 0x00, 0x0d, 0x32, 0x10,
+    0x24, 0xd5, 0xb0, 0xd4, 0x77, 0xb6, 0x98, 0xb6, 0xb6, 0x3f, 0xdf, 0xe7, 0x9e, 0x00, 0x08, 0xaa,
+    0x34, 0xc3, 0x88, 0x68, 0x8b, 0xea, 0x74, 0xcc, 0xb9, 0x00,
+};
 
-#include <stdint.h>
+// 42x42, 658 B (raw 3528 B)
+static const uint8_t image_data_icon_temp[658] = {
+    // ███████████████▒▒▒▒▒▒▒▒▒▒▒▒███████████████
+    // ████████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████████
+    // ██████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████████
+    // █████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // █████▒▒▒▒▒▒▒▒▒▒▒▒▒    ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒░      ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // ████▒▒▒▒▒▒▒▒▒▒▒░   ░░░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // ███▒▒▒▒▒▒▒▒▒▒▒▒  ░▒▒▒▒   ▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒  ░▒▒▒▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒  ▒▒▒▒▒   ░▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒  ▒▒▒░     ▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒  ▒▒▒  ░▒░  ▒▒▒▒▒▒█
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒ ░▒▒  ▒▒▒  ▒▒▒  ▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒  ▒▒  ▒▒▒  ░▒░  ▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒  ▒▒  ▒▒▒▒     ░▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒  ▒▒  ▒▒▒▒░   ▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒  ▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒  ▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒  ▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ▒▒  ▒▒  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒░  ░▒▒  ▒▒░  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒  ░▒░   ░▒▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒░ ░▒▒      ▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒░ ░▒░  ▒▒   ▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // █▒▒▒▒▒▒▒▒▒▒▒  ▒▒  ▒▒▒▒  ▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒  ▒▒  ▒▒▒▒  ▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒  ░▒   ▒▒  ░▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // ██▒▒▒▒▒▒▒▒▒▒░  ▒░      ▒▒░ ░▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒▒  ░▒▒░   ▒▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ███▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ████▒▒▒▒▒▒▒▒▒▒░  ░░▒▒░    ▒▒▒▒▒▒▒▒▒▒▒▒████
+    // ████▒▒▒▒▒▒▒▒▒▒▒░        ░▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // █████▒▒▒▒▒▒▒▒▒▒▒▒░░   ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // █████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
+    // ██████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████████
+    // ████████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████████
+    // ███████████████▒▒▒▒▒▒▒▒▒▒▒▒███████████████
+    0x01, 0x0b, 0x00, 0x00, 0x35, 0x1b, 0xbf, 0x1e, 0x86, 0x3d, 0x04, 0x5a, 0x04, 0x5b, 0x45, 0x5c,
+    0xcf, 0x5e, 0x04, 0x7a, 0x9e, 0x9d, 0x65, 0xdc, 0xff, 0xff, 0x8e, 0x00, 0x8b, 0x08, 0x9a, 0x00,
+    0x91, 0x08, 0x95, 0x00, 0x95, 0x08, 0x92, 0x00, 0x00, 0x04, 0x95, 0x08, 0x00, 0x04, 0x8f, 0x00,
+    0x00, 0x05, 0x99, 0x08, 0x00, 0x05, 0x8c, 0x00, 0x9d, 0x08, 0x8a, 0x00, 0x8b, 0x08, 0x05, 0x06,
+    0x02, 0x0b, 0x0b, 0x02, 0x03, 0x8d, 0x08, 0x88, 0x00, 0x00, 0x05, 0x8a, 0x08, 0x00, 0x03, 0x85,
+    0x0b, 0x00, 0x03, 0x8c, 0x08, 0x00, 0x05, 0x87, 0x00, 0x8a, 0x08, 0x09, 0x03, 0x0b, 0x0b, 0x07,
+    0x0a, 0x0a, 0x09, 0x0b, 0x0b, 0x06, 0x8c, 0x08, 0x86, 0x00, 0x00, 0x04, 0x8a, 0x08, 0x02, 0x02,
+    0x0b, 0x09, 0x83, 0x01, 0x02, 0x07, 0x0b, 0x02, 0x8c, 0x08, 0x00, 0x04, 0x84, 0x00, 0x8c, 0x08,
+    0x02, 0x0b, 0x0b, 0x0a, 0x83, 0x01, 0x02, 0x0a, 0x0b, 0x0b, 0x8e, 0x08, 0x83, 0x00, 0x8c, 0x08,
+    0x01, 0x0b, 0x0b, 0x85, 0x01, 0x01, 0x0b, 0x0b, 0x8e, 0x08, 0x82, 0x00, 0x8d, 0x08, 0x01, 0x0b,
+    0x0b, 0x85, 0x01, 0x01, 0x0b, 0x0b, 0x83, 0x08, 0x04, 0x06, 0x02, 0x0b, 0x02, 0x03, 0x86, 0x08,
+    0x01, 0x00, 0x00, 0x8d, 0x08, 0x01, 0x0b, 0x0b, 0x85, 0x01, 0x01, 0x0b, 0x0b, 0x82, 0x08, 0x00,
+    0x03, 0x84, 0x0b, 0x00, 0x06, 0x85, 0x08, 0x01, 0x00, 0x00, 0x8d, 0x08, 0x01, 0x0b, 0x0b, 0x85,
+    0x01, 0x01, 0x0b, 0x0b, 0x82, 0x08, 0x06, 0x02, 0x0b, 0x03, 0x08, 0x03, 0x0b, 0x02, 0x85, 0x08,
+    0x00, 0x00, 0x8e, 0x08, 0x09, 0x0b, 0x0b, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01, 0x0b, 0x0b, 0x82,
+    0x08, 0x01, 0x0b, 0x0b, 0x82, 0x08, 0x01, 0x0b, 0x0b, 0x95, 0x08, 0x09, 0x0b, 0x0b, 0x01, 0x01,
+    0x0b, 0x0b, 0x01, 0x01, 0x0b, 0x0b, 0x82, 0x08, 0x06, 0x02, 0x0b, 0x03, 0x08, 0x03, 0x0b, 0x02,
+    0x95, 0x08, 0x09, 0x0b, 0x0b, 0x01, 0x01, 0x0b, 0x0b, 0x01, 0x01, 0x0b, 0x0b, 0x82, 0x08, 0x00,
+    0x06, 0x84, 0x0b, 0x00, 0x03, 0x95, 0x08, 0x09, 0x0b, 0x0b, 0x01, 0x01, 0x0b, 0x0b, 0x01, 0x01,
+    0x0b, 0x0b, 0x83, 0x08, 0x04, 0x03, 0x02, 0x0b, 0x02, 0x06, 0x96, 0x08, 0x09, 0x0b, 0x0b, 0x01,
+    0x01, 0x0b, 0x0b, 0x01, 0x01, 0x0b, 0x0b, 0x9f, 0x08, 0x09, 0x0b, 0x0b, 0x01, 0x01, 0x0b, 0x0b,
+    0x01, 0x01, 0x0b, 0x0b, 0x9f, 0x08, 0x09, 0x0b, 0x0b, 0x01, 0x01, 0x0b, 0x0b, 0x01, 0x01, 0x0b,
+    0x0b, 0x9e, 0x08, 0x0b, 0x03, 0x0b, 0x0b, 0x01, 0x01, 0x0b, 0x0b, 0x01, 0x01, 0x07, 0x0b, 0x03,
+    0x9c, 0x08, 0x0d, 0x03, 0x0b, 0x0b, 0x0a, 0x01, 0x01, 0x0b, 0x0b, 0x01, 0x01, 0x0a, 0x0b, 0x0b,
+    0x03, 0x9b, 0x08, 0x0e, 0x0b, 0x0b, 0x0a, 0x01, 0x0a, 0x07, 0x0b, 0x0b, 0x09, 0x01, 0x01, 0x0a,
+    0x0b, 0x0b, 0x06, 0x99, 0x08, 0x04, 0x03, 0x0b, 0x09, 0x01, 0x01, 0x85, 0x0b, 0x04, 0x01, 0x01,
+    0x07, 0x0b, 0x06, 0x99, 0x08, 0x0f, 0x03, 0x0b, 0x0a, 0x01, 0x09, 0x0b, 0x02, 0x06, 0x06, 0x02,
+    0x0b, 0x07, 0x01, 0x0a, 0x0b, 0x02, 0x8d, 0x08, 0x00, 0x00, 0x8a, 0x08, 0x0f, 0x0b, 0x0b, 0x01,
+    0x01, 0x07, 0x0b, 0x06, 0x08, 0x08, 0x06, 0x0b, 0x07, 0x01, 0x01, 0x0b, 0x0b, 0x8c, 0x08, 0x01,
+    0x00, 0x00, 0x8a, 0x08, 0x0f, 0x02, 0x0b, 0x01, 0x01, 0x0b, 0x0b, 0x06, 0x08, 0x08, 0x06, 0x0b,
+    0x0b, 0x01, 0x01, 0x0b, 0x02, 0x8c, 0x08, 0x01, 0x00, 0x00, 0x8a, 0x08, 0x0f, 0x02, 0x0b, 0x0a,
+    0x01, 0x07, 0x0b, 0x02, 0x06, 0x06, 0x02, 0x0b, 0x09, 0x01, 0x0a, 0x0b, 0x02, 0x8c, 0x08, 0x82,
+    0x00, 0x89, 0x08, 0x04, 0x03, 0x0b, 0x07, 0x01, 0x0a, 0x84, 0x0b, 0x05, 0x07, 0x01, 0x01, 0x09,
+    0x0b, 0x03, 0x8b, 0x08, 0x83, 0x00, 0x8a, 0x08, 0x0d, 0x0b, 0x0b, 0x0a, 0x01, 0x01, 0x09, 0x0b,
+    0x07, 0x07, 0x01, 0x01, 0x0a, 0x0b, 0x0b, 0x8c, 0x08, 0x84, 0x00, 0x00, 0x04, 0x88, 0x08, 0x03,
+    0x03, 0x0b, 0x0b, 0x0a, 0x85, 0x01, 0x03, 0x0a, 0x0b, 0x0b, 0x03, 0x8a, 0x08, 0x00, 0x04, 0x86,
+    0x00, 0x89, 0x08, 0x0b, 0x03, 0x0b, 0x0b, 0x09, 0x0a, 0x01, 0x01, 0x0a, 0x07, 0x0b, 0x0b, 0x02,
+    0x8b, 0x08, 0x87, 0x00, 0x00, 0x05, 0x89, 0x08, 0x00, 0x03, 0x87, 0x0b, 0x00, 0x03, 0x8b, 0x08,
+    0x00, 0x05, 0x88, 0x00, 0x8b, 0x08, 0x06, 0x03, 0x03, 0x0b, 0x02, 0x02, 0x03, 0x06, 0x8c, 0x08,
+    0x8a, 0x00, 0x9d, 0x08, 0x8c, 0x00, 0x00, 0x05, 0x99, 0x08, 0x00, 0x05, 0x8f, 0x00, 0x00, 0x04,
+    0x95, 0x08, 0x00, 0x04, 0x92, 0x00, 0x95, 0x08, 0x95, 0x00, 0x91, 0x08, 0x9a, 0x00, 0x8b, 0x08,
+    0x8e, 0x00,
+};
 
-static const uint16_t image_data_bleutooth[1764] = {
-    // ██████████████████▓▓▓▓▓▓██████████████████
-    // ██████████████▓▒▒▒▒▒▒▒▒▒▒▒▓▓██████████████
-    // ████████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓████████████
-    // ██████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██████████
-    // ████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
-    // ███████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓███████
-    // ██████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██████
-    // █████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█████
-    // ████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+// 42x42, 625 B (raw 3528 B)
+static const uint8_t image_data_icon_more[625] = {
+    // ███████████████▒▒▒▒▒▒▒▒▒▒▒▒███████████████
+    // ████████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████████
+    // ██████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████████
+    // █████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒      ░▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // ███▒▒▒▒▒▒▒▒▒▒▒▒           ░░▒▒▒▒▒▒▒▒▒▒▒███
+    // ██▒▒▒▒▒▒▒▒▒▒▒░    ░░▒▒░░░   ░▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒██
+    // █▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒▒▒░   ▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ░▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ▒▒▒▒▒▒▒▒▒█
+    // ▒▒▒▒▒▒▒▒▒░ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒   ▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒░ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒  ░▒▒▒░░▒▒▒▒░░▒▒▒░░▒▒▒▒░  ▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒  ▒▒▒▒   ▒▒░  ░▒▒   ▒▒▒▒  ▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒  ▒▒▒▒   ▒▒░  ░▒▒   ▒▒▒▒  ▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒  ░▒▒▒▒░░▒▒▒░░▒▒▒▒░░▒▒▒░  ▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ ░▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒   ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ ░▒▒▒▒▒▒▒▒▒
+    // █▒▒▒▒▒▒▒▒▒  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒   ░▒▒▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒█
+    // ██▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒▒░   ░░░▒▒░░    ░▒▒▒▒▒▒▒▒▒▒▒██
+    // ███▒▒▒▒▒▒▒▒▒▒▒░░           ▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒░      ▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
     // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
-    // ███▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓███
-    // ███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
-    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██
-    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
-    // █▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▓██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
-    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▒▒▒██▒▓██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
-    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██▒▒██▒▒██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
-    // ▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███▒██▒██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
-    // ▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓
-    // ▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓
-    // ▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓
-    // ▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓
-    // ▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓
-    // ▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
-    // ▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▓▒██▒███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
-    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█▓▒▒██▒▒██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
-    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓▒▒▒██▒███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
-    // █▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
-    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
-    // ██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██
-    // ███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
-    // ███▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓███
-    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓████
     // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
-    // █████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
-    // ██████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
-    // ███████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████
-    // █████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█████████
-    // ██████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██████████
-    // ████████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓████████████
-    // ███████████████▓▒▒▒▒▒▒▒▒▒▒▓███████████████
-    // ███████████████████▓▓▓████████████████████
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdff7, 0x1fd7, 0x9fb6, 0xff9d, 0xbf8d, 0x7f7d, 0x7f7d, 0xbf8d, 0xff9d, 0xdfc6, 0x5fdf, 0xdff7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdff7, 0x1fd7, 0xbf8d, 0xbf54, 0x1f3c, 0xff2b, 0xdf2b, 0xdf23, 0xdf23, 0xdf23, 0xdf23, 0xdf2b, 0xff2b, 0x5f44, 0x1f6d, 0xff9d, 0x1fd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdff7, 0x9fb6, 0x1f6d, 0x1f3c, 0xdf23, 0xdf23, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0xdf23, 0x1f3c, 0x7f7d, 0x1fd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fd7, 0x1f6d, 0xff2b, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0x1f3c, 0x7f7d, 0x5fdf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdff7, 0x3fa6, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0x5f44, 0x9fb6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdff7, 0xbf8d, 0xff2b, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f3c, 0x3fa6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdff7, 0x7f7d, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xff2b, 0xff9d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xdff7, 0xbf8d, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xff2b, 0x3fa6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x3fa6, 0xff2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f3c, 0xdfc6, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x1fd7, 0x1f3c, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0xbf54, 0x5fdf, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xdff7, 0x1f6d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xbf54, 0xbf54, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0xbf8d, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x9fb6, 0xff2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x5fdf, 0x5fdf, 0x1f6d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f3c, 0x1fd7, 0x0000, 0x0000, 
-    0x0000, 0xdff7, 0xbf54, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x9fef, 0xffff, 0x5fdf, 0x1f6d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x7f7d, 0x0000, 0x0000, 
-    0x0000, 0xdfc6, 0xff2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x9fef, 0xffff, 0xffff, 0x5fdf, 0x1f6d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f3c, 0x5fdf, 0x0000, 
-    0x0000, 0x7f7d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0xdf23, 0xdf23, 0x5f44, 0x9fef, 0x1fd7, 0x3fa6, 0xffff, 0x5fdf, 0x1f6d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0x3fa6, 0x0000, 
-    0x9fef, 0xbf54, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f6d, 0xff9d, 0x5f44, 0xdf23, 0x5f44, 0x9fef, 0x1fd7, 0x1f3c, 0xff9d, 0xffff, 0x5fdf, 0xbf54, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f6d, 0xdff7, 
-    0x1fd7, 0x1f3c, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0x3fa6, 0xffff, 0xdfc6, 0x1f3c, 0x5f44, 0x9fef, 0x1fd7, 0xff2b, 0xbf54, 0x9fef, 0xffff, 0x7f7d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x5fdf, 
-    0x3fa6, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0xdfc6, 0xffff, 0xdfc6, 0xbf54, 0x9fef, 0x1fd7, 0xbf54, 0x1fd7, 0xffff, 0x3fa6, 0x1f3c, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0x1f3c, 0xdfc6, 
-    0xbf8d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0xdfc6, 0xffff, 0x1fd7, 0xdff7, 0x9fef, 0x5fdf, 0xffff, 0x3fa6, 0x1f3c, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xff2b, 0x3fa6, 
-    0x7f7d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0xdfc6, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fa6, 0x1f3c, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xff9d, 
-    0x1f6d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x1fd7, 0xffff, 0xffff, 0x9fb6, 0xff2b, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xff9d, 
-    0x1f6d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xbf54, 0x5fdf, 0xffff, 0xffff, 0xdfc6, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xff9d, 
-    0x7f7d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xbf54, 0x1fd7, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfc6, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xff9d, 
-    0xbf8d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xbf54, 0x5fdf, 0xffff, 0xdfc6, 0x9fef, 0x5fdf, 0xdfc6, 0xffff, 0xdfc6, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xff2b, 0x9fb6, 
-    0x3fa6, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xbf54, 0x5fdf, 0xffff, 0x3fa6, 0xbf54, 0x9fef, 0x1fd7, 0x5f44, 0xdfc6, 0xffff, 0xdfc6, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f3c, 0x1fd7, 
-    0x1fd7, 0x1f3c, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0x3fa6, 0xffff, 0x3fa6, 0xff2b, 0x5f44, 0x9fef, 0x1fd7, 0xff2b, 0xbf54, 0x9fef, 0xffff, 0xbf8d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xbf54, 0x9fef, 
-    0x9fef, 0xbf54, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xbf54, 0x7f7d, 0x1f3c, 0xdf23, 0x5f44, 0x9fef, 0x1fd7, 0x5f44, 0x9fb6, 0xffff, 0x1fd7, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x7f7d, 0x0000, 
-    0x0000, 0xbf8d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0xdf2b, 0xdf23, 0x5f44, 0x9fef, 0x5fdf, 0x9fb6, 0xffff, 0x1fd7, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x9fb6, 0x0000, 
-    0x0000, 0x1fd7, 0x1f3c, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x9fef, 0xffff, 0xffff, 0x1fd7, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x5fdf, 0x0000, 
-    0x0000, 0xdff7, 0x1f6d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x9fef, 0xffff, 0x1fd7, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xbf8d, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xdfc6, 0xff2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f3c, 0x1fd7, 0x1fd7, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x5fdf, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xdff7, 0x7f7d, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0x5f44, 0x1f3c, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xff9d, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x5fdf, 0x5f44, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f6d, 0x9fef, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x9fb6, 0x1f3c, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x1fd7, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xff9d, 0xff2b, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f3c, 0x9fb6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdff7, 0xff9d, 0xff2b, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x1f3c, 0x9fb6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3fa6, 0x1f3c, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0x5f44, 0x9fb6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdfc6, 0xbf54, 0xdf23, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf2b, 0x1f6d, 0x1fd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9fef, 0xbf8d, 0x1f3c, 0xdf23, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0x5f44, 0x3fa6, 0xdff7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1fd7, 0xbf8d, 0x5f44, 0xdf2b, 0xdf23, 0xdf23, 0xdf23, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf2b, 0xdf23, 0xdf23, 0xdf23, 0xff2b, 0xbf54, 0xff9d, 0x5fdf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5fdf, 0x9fb6, 0x7f7d, 0xbf54, 0x1f3c, 0xff2b, 0xff2b, 0xdf2b, 0xdf2b, 0xff2b, 0xff2b, 0x5f44, 0xbf54, 0xbf8d, 0x9fb6, 0x9fef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9fef, 0x1fd7, 0xdfc6, 0x3fa6, 0x3fa6, 0x3fa6, 0x9fb6, 0xdfc6, 0x5fdf, 0xdff7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // █████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
+    // ██████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████████
+    // ████████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████████
+    // ███████████████▒▒▒▒▒▒▒▒▒▒▒▒███████████████
+    0x01, 0x0a, 0x00, 0x00, 0xdf, 0x3d, 0xbe, 0x5b, 0x9d, 0x99, 0x7c, 0xb6, 0x5b, 0xd4, 0x5b, 0xf4,
+    0x84, 0xf7, 0xad, 0xfa, 0xd6, 0xfd, 0xff, 0xff, 0x8e, 0x00, 0x02, 0x06, 0x05, 0x06, 0x85, 0x05,
+    0x02, 0x06, 0x05, 0x06, 0x9a, 0x00, 0x91, 0x05, 0x95, 0x00, 0x01, 0x05, 0x06, 0x91, 0x05, 0x01,
+    0x06, 0x05, 0x92, 0x00, 0x97, 0x05, 0x8f, 0x00, 0x9b, 0x05, 0x8c, 0x00, 0x00, 0x06, 0x9b, 0x05,
+    0x00, 0x06, 0x8a, 0x00, 0x00, 0x06, 0x9d, 0x05, 0x00, 0x06, 0x88, 0x00, 0xa1, 0x05, 0x87, 0x00,
+    0x8b, 0x05, 0x08, 0x07, 0x07, 0x09, 0x09, 0x0a, 0x0a, 0x09, 0x09, 0x08, 0x8c, 0x05, 0x86, 0x00,
+    0x8a, 0x05, 0x01, 0x07, 0x09, 0x89, 0x0a, 0x01, 0x08, 0x08, 0x8a, 0x05, 0x84, 0x00, 0x8a, 0x05,
+    0x00, 0x08, 0x82, 0x0a, 0x07, 0x01, 0x02, 0x03, 0x04, 0x04, 0x03, 0x02, 0x02, 0x82, 0x0a, 0x00,
+    0x08, 0x8a, 0x05, 0x83, 0x00, 0x00, 0x06, 0x88, 0x05, 0x03, 0x09, 0x0a, 0x0a, 0x01, 0x89, 0x04,
+    0x03, 0x02, 0x0a, 0x0a, 0x08, 0x88, 0x05, 0x00, 0x06, 0x82, 0x00, 0x89, 0x05, 0x03, 0x08, 0x0a,
+    0x0a, 0x03, 0x8b, 0x04, 0x03, 0x02, 0x0a, 0x0a, 0x09, 0x89, 0x05, 0x01, 0x00, 0x00, 0x88, 0x05,
+    0x02, 0x08, 0x0a, 0x0a, 0x8f, 0x04, 0x02, 0x0a, 0x0a, 0x08, 0x88, 0x05, 0x01, 0x00, 0x00, 0x87,
+    0x05, 0x03, 0x08, 0x0a, 0x0a, 0x02, 0x8f, 0x04, 0x03, 0x03, 0x0a, 0x0a, 0x07, 0x87, 0x05, 0x01,
+    0x00, 0x06, 0x87, 0x05, 0x02, 0x08, 0x0a, 0x02, 0x91, 0x04, 0x02, 0x01, 0x0a, 0x09, 0x87, 0x05,
+    0x00, 0x06, 0x88, 0x05, 0x01, 0x0a, 0x0a, 0x93, 0x04, 0x02, 0x0a, 0x0a, 0x07, 0x87, 0x05, 0x00,
+    0x06, 0x86, 0x05, 0x02, 0x08, 0x0a, 0x02, 0x93, 0x04, 0x02, 0x01, 0x0a, 0x07, 0x86, 0x05, 0x00,
+    0x06, 0x87, 0x05, 0x02, 0x09, 0x0a, 0x02, 0x93, 0x04, 0x02, 0x02, 0x0a, 0x09, 0x8f, 0x05, 0x02,
+    0x09, 0x0a, 0x03, 0x82, 0x04, 0x01, 0x03, 0x03, 0x83, 0x04, 0x01, 0x03, 0x02, 0x82, 0x04, 0x01,
+    0x03, 0x03, 0x83, 0x04, 0x02, 0x03, 0x0a, 0x09, 0x8f, 0x05, 0x01, 0x0a, 0x0a, 0x83, 0x04, 0x0d,
+    0x01, 0x0a, 0x01, 0x04, 0x04, 0x02, 0x0a, 0x0a, 0x03, 0x04, 0x04, 0x01, 0x0a, 0x01, 0x83, 0x04,
+    0x01, 0x0a, 0x0a, 0x8f, 0x05, 0x01, 0x0a, 0x0a, 0x83, 0x04, 0x0d, 0x01, 0x0a, 0x01, 0x04, 0x04,
+    0x03, 0x0a, 0x0a, 0x02, 0x04, 0x04, 0x01, 0x0a, 0x01, 0x83, 0x04, 0x01, 0x0a, 0x0a, 0x8f, 0x05,
+    0x02, 0x09, 0x0a, 0x03, 0x83, 0x04, 0x01, 0x03, 0x03, 0x82, 0x04, 0x01, 0x02, 0x03, 0x83, 0x04,
+    0x01, 0x03, 0x03, 0x82, 0x04, 0x02, 0x03, 0x0a, 0x09, 0x8f, 0x05, 0x02, 0x09, 0x0a, 0x02, 0x93,
+    0x04, 0x02, 0x02, 0x0a, 0x09, 0x87, 0x05, 0x00, 0x06, 0x86, 0x05, 0x02, 0x07, 0x0a, 0x01, 0x93,
+    0x04, 0x02, 0x02, 0x0a, 0x08, 0x86, 0x05, 0x00, 0x06, 0x87, 0x05, 0x02, 0x07, 0x0a, 0x0a, 0x93,
+    0x04, 0x01, 0x0a, 0x0a, 0x88, 0x05, 0x00, 0x06, 0x87, 0x05, 0x02, 0x09, 0x0a, 0x01, 0x91, 0x04,
+    0x02, 0x02, 0x0a, 0x08, 0x87, 0x05, 0x01, 0x06, 0x00, 0x87, 0x05, 0x03, 0x07, 0x0a, 0x0a, 0x03,
+    0x8f, 0x04, 0x03, 0x02, 0x0a, 0x0a, 0x08, 0x87, 0x05, 0x01, 0x00, 0x00, 0x88, 0x05, 0x02, 0x08,
+    0x0a, 0x0a, 0x8e, 0x04, 0x03, 0x03, 0x0a, 0x0a, 0x08, 0x88, 0x05, 0x01, 0x00, 0x00, 0x89, 0x05,
+    0x03, 0x09, 0x0a, 0x0a, 0x02, 0x8b, 0x04, 0x03, 0x02, 0x0a, 0x0a, 0x08, 0x89, 0x05, 0x82, 0x00,
+    0x00, 0x06, 0x88, 0x05, 0x03, 0x08, 0x0a, 0x0a, 0x02, 0x89, 0x04, 0x03, 0x01, 0x0a, 0x0a, 0x09,
+    0x88, 0x05, 0x00, 0x06, 0x83, 0x00, 0x8a, 0x05, 0x00, 0x08, 0x82, 0x0a, 0x07, 0x02, 0x02, 0x03,
+    0x04, 0x04, 0x03, 0x02, 0x01, 0x82, 0x0a, 0x00, 0x08, 0x8a, 0x05, 0x84, 0x00, 0x8a, 0x05, 0x01,
+    0x08, 0x08, 0x89, 0x0a, 0x01, 0x09, 0x07, 0x8a, 0x05, 0x86, 0x00, 0x8c, 0x05, 0x08, 0x08, 0x09,
+    0x09, 0x0a, 0x0a, 0x09, 0x09, 0x07, 0x07, 0x8b, 0x05, 0x87, 0x00, 0xa1, 0x05, 0x88, 0x00, 0x00,
+    0x06, 0x9d, 0x05, 0x00, 0x06, 0x8a, 0x00, 0x00, 0x06, 0x9b, 0x05, 0x00, 0x06, 0x8c, 0x00, 0x9b,
+    0x05, 0x8f, 0x00, 0x97, 0x05, 0x92, 0x00, 0x01, 0x05, 0x06, 0x91, 0x05, 0x01, 0x06, 0x05, 0x95,
+    0x00, 0x91, 0x05, 0x9a, 0x00, 0x02, 0x06, 0x05, 0x06, 0x85, 0x05, 0x02, 0x06, 0x05, 0x06, 0x8e,
+    0x00,
 };
 
-const uint16_t image_data_icon_temp[1764] = {
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙
-    // ∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙
-    // ∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▓██████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙
-    // ∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▓███▓▓▓██▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙
-    // ∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒██▓▒▒▒▒███▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙
-    // ∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒██▓▒▒▒▒▓██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙
-    // ∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙
-    // ∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒██▒▒▒▒▒███▓▒▒▒▒▒▒▒∙
-    // ∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒██▒▒▒▓█████▒▒▒▒▒▒▒∙
-    // ∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒██▒▒▒██▓▒▓██▒▒▒▒▒▒∙
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒█▓▒▒██▒▒▒██▒▒▒██▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒██▒▒██▒▒▒██▓▒▓██▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒██▒▒██▒▒▒▒█████▓▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒██▒▒██▒▒▒▒▓███▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒██▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒██▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒██▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██▒▒██▒▒██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▓██▓▒▒██▒▒▓██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒██▓▒▓███▓▒▒▓██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▓█▓▒▒██████▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▓█▓▒▓██▒▒███▒▓██▒▒▒▒▒▒▒▒▒▒▒▒▒▒
-    // ∙▒▒▒▒▒▒▒▒▒▒▒██▒▒██▒▒▒▒██▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒∙
-    // ∙▒▒▒▒▒▒▒▒▒▒▒██▒▒██▒▒▒▒██▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒∙
-    // ∙▒▒▒▒▒▒▒▒▒▒▒██▓▒███▒▒██▓▒▓██▒▒▒▒▒▒▒▒▒▒▒▒▒∙
-    // ∙∙▒▒▒▒▒▒▒▒▒▒▓██▒▓██████▒▒▓█▓▒▒▒▒▒▒▒▒▒▒▒▒∙∙
-    // ∙∙▒▒▒▒▒▒▒▒▒▒▒██▓▒▒▓███▒▒▓██▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙
-    // ∙∙∙▒▒▒▒▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙
-    // ∙∙∙∙▒▒▒▒▒▒▒▒▒▒▓██▓▓▒▒▓████▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙
-    // ∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▓████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙
-    // ∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▓▓███▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙
-    // ∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5b04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5b04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5c45, 0x1ebf, 0xffff, 0xffff, 0x1ebf, 0x3d86, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5b04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3d86, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5b04, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0xffff, 0x5ecf, 0xdc65, 0xdc65, 0x9d9e, 0xffff, 0xffff, 0x5c45, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x5a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x1ebf, 0xffff, 0x9d9e, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x5ecf, 0xffff, 0x1ebf, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5a04, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0xdc65, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0xdc65, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 
-    0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5c45, 0x1ebf, 0xffff, 0x1ebf, 0x3d86, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 
-    0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5c45, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 
-    0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x1ebf, 0xffff, 0x3d86, 0x7a04, 0x3d86, 0xffff, 0x1ebf, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0x5ecf, 0x9d9e, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x1ebf, 0xffff, 0x3d86, 0x7a04, 0x3d86, 0xffff, 0x1ebf, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x5c45, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3d86, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0x1ebf, 0xffff, 0x1ebf, 0x5c45, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x1b35, 0x1b35, 0x5ecf, 0xffff, 0x3d86, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0xffff, 0xdc65, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xdc65, 0xffff, 0xffff, 0x3d86, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0xdc65, 0x1b35, 0xdc65, 0x5ecf, 0xffff, 0xffff, 0x9d9e, 0x1b35, 0x1b35, 0xdc65, 0xffff, 0xffff, 0x5c45, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0x9d9e, 0x1b35, 0x1b35, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1b35, 0x1b35, 0x5ecf, 0xffff, 0x5c45, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0xdc65, 0x1b35, 0x9d9e, 0xffff, 0x1ebf, 0x5c45, 0x5c45, 0x1ebf, 0xffff, 0x5ecf, 0x1b35, 0xdc65, 0xffff, 0x1ebf, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 
-    0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0x1b35, 0x1b35, 0x5ecf, 0xffff, 0x5c45, 0x7a04, 0x7a04, 0x5c45, 0xffff, 0x5ecf, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 
-    0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x1ebf, 0xffff, 0x1b35, 0x1b35, 0xffff, 0xffff, 0x5c45, 0x7a04, 0x7a04, 0x5c45, 0xffff, 0xffff, 0x1b35, 0x1b35, 0xffff, 0x1ebf, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 
-    0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x1ebf, 0xffff, 0xdc65, 0x1b35, 0x5ecf, 0xffff, 0x1ebf, 0x5c45, 0x5c45, 0x1ebf, 0xffff, 0x9d9e, 0x1b35, 0xdc65, 0xffff, 0x1ebf, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 
-    0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0x5ecf, 0x1b35, 0xdc65, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5ecf, 0x1b35, 0x1b35, 0x9d9e, 0xffff, 0x3d86, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0xffff, 0xffff, 0xdc65, 0x1b35, 0x1b35, 0x9d9e, 0xffff, 0x5ecf, 0x5ecf, 0x1b35, 0x1b35, 0xdc65, 0xffff, 0xffff, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x5a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0xffff, 0xdc65, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0x1b35, 0xdc65, 0xffff, 0xffff, 0x3d86, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5a04, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0xffff, 0x9d9e, 0xdc65, 0x1b35, 0x1b35, 0xdc65, 0x5ecf, 0xffff, 0xffff, 0x1ebf, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5b04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3d86, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5b04, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x3d86, 0x3d86, 0xffff, 0x1ebf, 0x1ebf, 0x3d86, 0x5c45, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5b04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5b04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x5a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x7a04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+// 42x42, 553 B (raw 3528 B)
+static const uint8_t image_data_icon_wifi[553] = {
+    // ███████████████▒▒▒▒▒▒▒▒▒▒▒▒███████████████
+    // ████████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████████
+    // ██████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████████
+    // █████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // ███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒░░         ░▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒░                ░▒▒▒▒▒▒▒▒▒▒██
+    // █▒▒▒▒▒▒▒▒▒░     ░░░▒▒▒▒░░░     ░▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒░   ░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒░    ░▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒░  ░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░    ▒▒▒▒▒▒█
+    // ▒▒▒▒▒▒   ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒
+    // ▒▒▒▒▒▒  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ▒▒▒▒▒▒
+    // ▒▒▒▒▒▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ░▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒   ▒▒▒▒▒▒░░░     ░░▒▒▒▒▒▒   ▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒  ░▒▒▒░            ░▒▒▒░  ▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒░  ░░      ░░░░░     ░░  ░▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒░      ░░░░░░░░░░░     ░▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒░   ░░░░░░░░░░░░░░   ░▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒░  ░░░░░░░░░░░░░░  ░▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒   ░░░░░░░░░░░░   ▒▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒   ░░░░░░░░░░   ▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒░   ░░░░░░░░   ░▒▒▒▒▒▒▒▒▒▒▒▒▒
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒░   ░░░░░░░  ░▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ░░░░░░  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ░░░░  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒   ░░   ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒      ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░    ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ ░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // █████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
+    // ██████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████████
+    // ████████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████████
+    // ███████████████▒▒▒▒▒▒▒▒▒▒▒▒███████████████
+    0x01, 0x0b, 0x00, 0x00, 0xec, 0x05, 0xf5, 0x0b, 0xf6, 0x12, 0xff, 0x19, 0xec, 0x24, 0xec, 0x25,
+    0xff, 0x3a, 0xf6, 0x75, 0xf5, 0xaf, 0xec, 0xea, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x01, 0x89, 0x06,
+    0x00, 0x01, 0x9a, 0x00, 0x91, 0x06, 0x95, 0x00, 0x95, 0x06, 0x92, 0x00, 0x97, 0x06, 0x8f, 0x00,
+    0x00, 0x05, 0x99, 0x06, 0x00, 0x05, 0x8c, 0x00, 0x00, 0x01, 0x9b, 0x06, 0x00, 0x01, 0x8a, 0x00,
+    0x00, 0x01, 0x9d, 0x06, 0x00, 0x01, 0x88, 0x00, 0x00, 0x05, 0x9f, 0x06, 0x00, 0x05, 0x87, 0x00,
+    0xa1, 0x06, 0x86, 0x00, 0xa3, 0x06, 0x84, 0x00, 0x8c, 0x06, 0x03, 0x03, 0x03, 0x04, 0x04, 0x83,
+    0x0b, 0x82, 0x04, 0x00, 0x02, 0x8c, 0x06, 0x83, 0x00, 0x89, 0x06, 0x01, 0x03, 0x04, 0x8d, 0x0b,
+    0x01, 0x04, 0x02, 0x89, 0x06, 0x82, 0x00, 0x88, 0x06, 0x00, 0x03, 0x83, 0x0b, 0x03, 0x04, 0x03,
+    0x02, 0x02, 0x83, 0x06, 0x03, 0x02, 0x02, 0x03, 0x04, 0x83, 0x0b, 0x00, 0x03, 0x88, 0x06, 0x01,
+    0x00, 0x00, 0x86, 0x06, 0x00, 0x03, 0x82, 0x0b, 0x01, 0x03, 0x03, 0x8d, 0x06, 0x01, 0x02, 0x04,
+    0x82, 0x0b, 0x00, 0x02, 0x86, 0x06, 0x01, 0x00, 0x00, 0x85, 0x06, 0x04, 0x03, 0x0b, 0x0b, 0x03,
+    0x02, 0x91, 0x06, 0x04, 0x02, 0x04, 0x0b, 0x0b, 0x04, 0x85, 0x06, 0x01, 0x00, 0x01, 0x84, 0x06,
+    0x03, 0x04, 0x0b, 0x0b, 0x03, 0x95, 0x06, 0x03, 0x03, 0x0b, 0x0b, 0x03, 0x84, 0x06, 0x00, 0x01,
+    0x85, 0x06, 0x02, 0x0b, 0x0b, 0x02, 0x97, 0x06, 0x02, 0x02, 0x0b, 0x04, 0x8b, 0x06, 0x02, 0x03,
+    0x0b, 0x0b, 0x97, 0x06, 0x02, 0x04, 0x0b, 0x03, 0x8c, 0x06, 0x02, 0x04, 0x0b, 0x04, 0x85, 0x06,
+    0x09, 0x02, 0x03, 0x03, 0x04, 0x0b, 0x0b, 0x04, 0x04, 0x03, 0x02, 0x85, 0x06, 0x02, 0x04, 0x0b,
+    0x04, 0x8e, 0x06, 0x02, 0x0b, 0x0b, 0x03, 0x82, 0x06, 0x00, 0x03, 0x8a, 0x0b, 0x01, 0x04, 0x02,
+    0x82, 0x06, 0x02, 0x03, 0x0b, 0x04, 0x8f, 0x06, 0x04, 0x02, 0x0b, 0x0b, 0x03, 0x03, 0x83, 0x0b,
+    0x10, 0x08, 0x08, 0x09, 0x0a, 0x0a, 0x09, 0x09, 0x08, 0x07, 0x0b, 0x0b, 0x04, 0x02, 0x03, 0x0b,
+    0x0b, 0x02, 0x90, 0x06, 0x00, 0x03, 0x84, 0x0b, 0x00, 0x08, 0x89, 0x0a, 0x01, 0x09, 0x07, 0x83,
+    0x0b, 0x00, 0x02, 0x92, 0x06, 0x03, 0x03, 0x0b, 0x0b, 0x07, 0x8d, 0x0a, 0x03, 0x08, 0x0b, 0x0b,
+    0x03, 0x94, 0x06, 0x02, 0x03, 0x0b, 0x0b, 0x8d, 0x0a, 0x02, 0x07, 0x0b, 0x03, 0x96, 0x06, 0x02,
+    0x04, 0x0b, 0x07, 0x8b, 0x0a, 0x02, 0x07, 0x0b, 0x04, 0x98, 0x06, 0x02, 0x0b, 0x0b, 0x08, 0x89,
+    0x0a, 0x02, 0x08, 0x0b, 0x0b, 0x8c, 0x06, 0x00, 0x01, 0x8b, 0x06, 0x03, 0x02, 0x0b, 0x0b, 0x08,
+    0x87, 0x0a, 0x03, 0x08, 0x0b, 0x0b, 0x02, 0x8b, 0x06, 0x01, 0x01, 0x00, 0x8c, 0x06, 0x03, 0x03,
+    0x0b, 0x0b, 0x08, 0x85, 0x0a, 0x03, 0x09, 0x0b, 0x0b, 0x03, 0x8c, 0x06, 0x01, 0x00, 0x00, 0x8d,
+    0x06, 0x03, 0x03, 0x0b, 0x0b, 0x09, 0x83, 0x0a, 0x03, 0x09, 0x0b, 0x0b, 0x03, 0x8d, 0x06, 0x01,
+    0x00, 0x00, 0x8e, 0x06, 0x02, 0x03, 0x0b, 0x07, 0x83, 0x0a, 0x02, 0x07, 0x0b, 0x03, 0x8e, 0x06,
+    0x82, 0x00, 0x8e, 0x06, 0x07, 0x04, 0x0b, 0x08, 0x0a, 0x0a, 0x07, 0x0b, 0x04, 0x8e, 0x06, 0x83,
+    0x00, 0x8f, 0x06, 0x05, 0x0b, 0x0b, 0x08, 0x08, 0x0b, 0x0b, 0x8f, 0x06, 0x84, 0x00, 0x8e, 0x06,
+    0x00, 0x02, 0x83, 0x0b, 0x00, 0x02, 0x8e, 0x06, 0x86, 0x00, 0x8e, 0x06, 0x03, 0x02, 0x04, 0x03,
+    0x03, 0x8e, 0x06, 0x87, 0x00, 0x00, 0x05, 0x9f, 0x06, 0x00, 0x05, 0x88, 0x00, 0x00, 0x01, 0x9d,
+    0x06, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x01, 0x9b, 0x06, 0x00, 0x01, 0x8c, 0x00, 0x00, 0x05, 0x99,
+    0x06, 0x00, 0x05, 0x8f, 0x00, 0x97, 0x06, 0x92, 0x00, 0x95, 0x06, 0x95, 0x00, 0x91, 0x06, 0x9a,
+    0x00, 0x00, 0x01, 0x89, 0x06, 0x00, 0x01, 0x8e, 0x00,
 };
 
-static const uint16_t image_data_icon_more[1764] = {
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙
-    // ∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙
-    // ∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙
-    // ∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████▓▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙
-    // ∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒███████████▓▓▒▒▒▒▒▒▒▒▒▒▒∙∙∙
-    // ∙∙▒▒▒▒▒▒▒▒▒▒▒▓████▓▓▒▒▓▓▓███▓▒▒▒▒▒▒▒▒▒▒▒∙∙
-    // ∙∙▒▒▒▒▒▒▒▒▒▒████▒▒▒▒▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▒▒▒▒∙∙
-    // ∙▒▒▒▒▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▒▒▒▒▒▒▓███▒▒▒▒▒▒▒▒▒▒∙
-    // ∙▒▒▒▒▒▒▒▒▒▓██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▓▒▒▒▒▒▒▒▒▒∙
-    // ∙▒▒▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██▒▒▒▒▒▒▒▒▒∙
-    // ▒▒▒▒▒▒▒▒▒▓█▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▓█▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒██▓▒▒▒▓▓▒▒▒▒▓▓▒▒▒▓▓▒▒▒▒▓██▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒██▒▒▒▒███▒▒▓██▓▒▒███▒▒▒▒██▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒██▒▒▒▒███▒▒▓██▓▒▒███▒▒▒▒██▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒██▓▒▒▒▒▓▓▒▒▒▓▓▒▒▒▒▓▓▒▒▒▓██▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█▓▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▒▒▒▒▒███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█▓▒▒▒▒▒▒▒▒▒
-    // ∙▒▒▒▒▒▒▒▒▒██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▒▒∙
-    // ∙▒▒▒▒▒▒▒▒▒▓██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▒▒▒∙
-    // ∙▒▒▒▒▒▒▒▒▒▒███▓▒▒▒▒▒▒▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▒▒▒▒∙
-    // ∙∙▒▒▒▒▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▒▒▒▒████▒▒▒▒▒▒▒▒▒▒∙∙
-    // ∙∙▒▒▒▒▒▒▒▒▒▒▒▓███▓▓▓▒▒▓▓████▓▒▒▒▒▒▒▒▒▒▒▒∙∙
-    // ∙∙∙▒▒▒▒▒▒▒▒▒▒▒▓▓███████████▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙
-    // ∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▓██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙
-    // ∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙
-    // ∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙
-    // ∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf45b, 0xd45b, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0xd45b, 0xf45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf784, 0xf784, 0xfdd6, 0xfdd6, 0xffff, 0xffff, 0xfdd6, 0xfdd6, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf784, 0xfdd6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfaad, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xffff, 0xffff, 0xffff, 0x3ddf, 0x5bbe, 0x999d, 0xb67c, 0xb67c, 0x999d, 0x5bbe, 0x5bbe, 0xffff, 0xffff, 0xffff, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfdd6, 0xffff, 0xffff, 0x3ddf, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x5bbe, 0xffff, 0xffff, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0x0000, 0x0000, 
-    0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xffff, 0xffff, 0x999d, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x5bbe, 0xffff, 0xffff, 0xfdd6, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 
-    0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xffff, 0xffff, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xffff, 0xffff, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 
-    0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xffff, 0xffff, 0x5bbe, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x999d, 0xffff, 0xffff, 0xf784, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 
-    0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xffff, 0x5bbe, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x3ddf, 0xffff, 0xfdd6, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 
-    0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xffff, 0xffff, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xffff, 0xffff, 0xf784, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 
-    0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xffff, 0x5bbe, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x3ddf, 0xffff, 0xf784, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 
-    0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfdd6, 0xffff, 0x5bbe, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x5bbe, 0xffff, 0xfdd6, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 
-    0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfdd6, 0xffff, 0x999d, 0xb67c, 0xb67c, 0xb67c, 0x999d, 0x999d, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x999d, 0x5bbe, 0xb67c, 0xb67c, 0xb67c, 0x999d, 0x999d, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x999d, 0xffff, 0xfdd6, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 
-    0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xffff, 0xffff, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x3ddf, 0xffff, 0x3ddf, 0xb67c, 0xb67c, 0x5bbe, 0xffff, 0xffff, 0x999d, 0xb67c, 0xb67c, 0x3ddf, 0xffff, 0x3ddf, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xffff, 0xffff, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 
-    0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xffff, 0xffff, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x3ddf, 0xffff, 0x3ddf, 0xb67c, 0xb67c, 0x999d, 0xffff, 0xffff, 0x5bbe, 0xb67c, 0xb67c, 0x3ddf, 0xffff, 0x3ddf, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xffff, 0xffff, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 
-    0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfdd6, 0xffff, 0x999d, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x999d, 0x999d, 0xb67c, 0xb67c, 0xb67c, 0x5bbe, 0x999d, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x999d, 0x999d, 0xb67c, 0xb67c, 0xb67c, 0x999d, 0xffff, 0xfdd6, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 
-    0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfdd6, 0xffff, 0x5bbe, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x5bbe, 0xffff, 0xfdd6, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 
-    0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf784, 0xffff, 0x3ddf, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x5bbe, 0xffff, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 
-    0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf784, 0xffff, 0xffff, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xffff, 0xffff, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 
-    0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfdd6, 0xffff, 0x3ddf, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x5bbe, 0xffff, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 
-    0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf784, 0xffff, 0xffff, 0x999d, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x5bbe, 0xffff, 0xffff, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 
-    0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xffff, 0xffff, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x999d, 0xffff, 0xffff, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 
-    0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfdd6, 0xffff, 0xffff, 0x5bbe, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x5bbe, 0xffff, 0xffff, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 
-    0x0000, 0x0000, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xffff, 0xffff, 0x5bbe, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0xb67c, 0x3ddf, 0xffff, 0xffff, 0xfdd6, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xffff, 0xffff, 0xffff, 0x5bbe, 0x5bbe, 0x999d, 0xb67c, 0xb67c, 0x999d, 0x5bbe, 0x3ddf, 0xffff, 0xffff, 0xffff, 0xfaad, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xfaad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfdd6, 0xf784, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xfaad, 0xfdd6, 0xfdd6, 0xffff, 0xffff, 0xfdd6, 0xfdd6, 0xf784, 0xf784, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf45b, 0xd45b, 0xf45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xd45b, 0xf45b, 0xd45b, 0xf45b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+// 42x42, 1176 B (raw 3528 B)
+static const uint8_t image_data_targetresize[1176] = {
+    // ██████████████████████████████████████████
+    // ███████████████  ░░░░░░░   ███████████████
+    // ████████████  ░▒▒▒▓▓▓▓▓▓▒▒▒░ █████████████
+    // ███████████ ░▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░ ███████████
+    // █████████ ░▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░ █████████
+    // ████████ ▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░ ████████
+    // ███████ ▒▓▓▓▓▓▓▓▒▒░░░░░░▒▒▓▓▓▓▓▓▓▒ ███████
+    // ██████ ▒▓▓▓▓▓▓▒░          ░▒▓▓▓▓▓▓▒ ██████
+    // █████ ▒▓▓▓▓▓▒░              ░▒▓▓▓▓▓░ █████
+    // ████ ▒▓▓▓▓▓▒    ░░▒▒▒▒▒▒░    ░▒▓▓▓▓▓░█████
+    // ████░▓▓▓▓▓▒   ░▒▒▓▓▓▓▓▓▓▓▒▒    ▒▓▓▓▓▒ ████
+    // ███ ▒▓▓▓▓▒   ░▒▓▓▓▓▒▒▒▒▓▓▓▓▒░  ░▒▓▓▓▓▒ ███
+    // ███░▓▓▓▓▒   ░▓▓▓▒░░    ░▒▒▓▓▒░  ░▓▓▓▓▒░███
+    // ██ ▒▓▓▓▓░  ░▓▓▓▒         ░▒▓▓▒░  ▒▓▓▓▓░ ██
+    // ██░▒▓▓▓▒  ░▒▓▓░    ░░░░    ▒▓▓▒  ░▒▓▓▓▒ ██
+    // ██░▓▓▓▓░  ▒▓▓▒   ░▒▓▓▓▓▒░   ▒▓▓░  ▒▓▓▓▓░██
+    // █ ▒▓▓▓▒   ▒▓▒   ▒▓▓▓▓▓▓▓▓░  ░▓▓▒  ░▓▓▓▓░██
+    // █ ▒▓▓▓▒  ░▓▓▒  ░▓▓▓▓▓▓▓▓▓▒░  ▒▓▓░  ▒▓▓▓▒ █
+    // █ ▒▓▓▓▒  ▒▓▓░  ▒▓▓▓▓▓▓▓▓▓▓▒  ░▓▓░  ▒▓▓▓▒ █
+    // █░▓▓▓▓░  ▒▓▒  ░▓▓▓▓▓▓▓▓▓▓▓▒  ░▓▓▒  ▒▓▓▓▒ █
+    // █░▓▓▓▓░  ▒▓▒  ░▓▓▓▓▓▓▓▓▓▓▓▓░ ░▓▓▒  ▒▓▓▓▒ █
+    // █░▓▓▓▓░  ▒▓▒  ░▓▓▓▓▓▓▓▓▓▓▓▒  ░▓▓▒  ▒▓▓▓▒ █
+    // █░▓▓▓▓░  ▒▓▒  ░▓▓▓▓▓▓▓▓▓▓▓▒  ░▓▓░  ▒▓▓▓▒ █
+    // █ ▒▓▓▓▒  ▒▓▓░  ▒▓▓▓▓▓▓▓▓▓▓▒  ▒▓▓░  ▒▓▓▓▒ █
+    // █ ▒▓▓▓▒  ░▓▓▒  ░▓▓▓▓▓▓▓▓▓▒   ▒▓▒  ░▒▓▓▓▒ █
+    // █ ▒▓▓▓▒░  ▒▓▒░  ░▒▓▓▓▓▓▓▒░  ░▓▓▒  ░▓▓▓▓░██
+    // ██░▓▓▓▓▒  ░▓▓▒   ░▒▒▓▓▒▒   ░▒▓▓░  ▒▓▓▓▒░██
+    // ██ ▒▓▓▓▒   ▒▓▓▒     ░░    ░▒▓▓▒  ░▓▓▓▓▒ ██
+    // ██ ▒▓▓▓▓▒  ░▒▓▓▒░        ░▒▓▓▒   ▒▓▓▓▓░███
+    // ███░▓▓▓▓▒░  ░▒▓▓▓▒░░░░░░▒▓▓▓▒   ░▓▓▓▓▒ ███
+    // ███ ▒▓▓▓▓▒░  ░▒▓▓▓▓▓▒▒▓▓▓▓▓▒   ░▒▓▓▓▓░████
+    // ████ ▒▓▓▓▓▒░   ░▒▓▓▓▓▓▓▓▒▒░   ░▒▓▓▓▓▒ ████
+    // █████░▓▓▓▓▓▒░    ░░▒▒▒▒░░    ░▒▓▓▓▓▒░█████
+    // █████ ░▓▓▓▓▓▓▒             ░▒▓▓▓▓▓▒░██████
+    // ██████ ▒▓▓▓▓▓▓▒▒░        ░▒▒▓▓▓▓▓▓░ ██████
+    // ███████ ░▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▒░ ███████
+    // ████████ ░▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░ ████████
+    // ██████████ ▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░ ██████████
+    // ███████████ ░▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒░  ███████████
+    // █████████████  ░▒▒▒▒▓▓▒▒▒▒░  █████████████
+    // ████████████████    ░░    ████████████████
+    // ██████████████████████████████████████████
+    0x01, 0x13, 0x00, 0x00, 0x1c, 0x18, 0x5d, 0x1a, 0xcf, 0x1e, 0x24, 0x38, 0x9e, 0x3c, 0xd7, 0x5e,
+    0x2c, 0x79, 0x6d, 0x7b, 0xa6, 0x7d, 0x3c, 0x99, 0xe7, 0x9f, 0x7d, 0xbb, 0xb6, 0xbd, 0xf7, 0xbf,
+    0xbe, 0xdd, 0x13, 0xf8, 0x4c, 0xfa, 0x8d, 0xfc, 0xff, 0xff, 0xb8, 0x00, 0x03, 0x0e, 0x06, 0x0d,
+    0x05, 0x82, 0x0c, 0x04, 0x12, 0x05, 0x0f, 0x0b, 0x13, 0x9a, 0x00, 0x05, 0x13, 0x06, 0x12, 0x11,
+    0x07, 0x01, 0x85, 0x10, 0x04, 0x01, 0x07, 0x02, 0x05, 0x0b, 0x97, 0x00, 0x02, 0x03, 0x08, 0x07,
+    0x8d, 0x10, 0x02, 0x0a, 0x12, 0x0b, 0x93, 0x00, 0x02, 0x0e, 0x12, 0x07, 0x91, 0x10, 0x02, 0x0a,
+    0x09, 0x13, 0x90, 0x00, 0x01, 0x06, 0x02, 0x94, 0x10, 0x02, 0x01, 0x0c, 0x0e, 0x8e, 0x00, 0x01,
+    0x03, 0x0a, 0x86, 0x10, 0x09, 0x04, 0x11, 0x08, 0x12, 0x05, 0x05, 0x12, 0x08, 0x0a, 0x01, 0x86,
+    0x10, 0x01, 0x02, 0x0b, 0x8c, 0x00, 0x01, 0x03, 0x0a, 0x85, 0x10, 0x03, 0x0a, 0x12, 0x03, 0x0e,
+    0x85, 0x13, 0x03, 0x0e, 0x0f, 0x0c, 0x07, 0x85, 0x10, 0x01, 0x02, 0x0b, 0x8a, 0x00, 0x01, 0x06,
+    0x0a, 0x84, 0x10, 0x02, 0x04, 0x12, 0x0b, 0x82, 0x13, 0x05, 0x0b, 0x06, 0x03, 0x03, 0x06, 0x0e,
+    0x82, 0x13, 0x02, 0x06, 0x08, 0x01, 0x84, 0x10, 0x01, 0x08, 0x0e, 0x88, 0x00, 0x01, 0x0e, 0x02,
+    0x84, 0x10, 0x07, 0x0a, 0x0f, 0x13, 0x13, 0x0b, 0x09, 0x08, 0x0a, 0x82, 0x04, 0x08, 0x07, 0x0a,
+    0x0c, 0x0f, 0x0e, 0x13, 0x13, 0x09, 0x07, 0x84, 0x10, 0x00, 0x12, 0x88, 0x00, 0x00, 0x05, 0x84,
+    0x10, 0x06, 0x11, 0x06, 0x13, 0x13, 0x09, 0x11, 0x01, 0x87, 0x10, 0x06, 0x01, 0x02, 0x03, 0x13,
+    0x13, 0x0f, 0x07, 0x83, 0x10, 0x01, 0x04, 0x03, 0x86, 0x00, 0x01, 0x06, 0x0a, 0x83, 0x10, 0x05,
+    0x0a, 0x06, 0x13, 0x0e, 0x0c, 0x01, 0x83, 0x10, 0x03, 0x04, 0x07, 0x07, 0x04, 0x83, 0x10, 0x05,
+    0x04, 0x05, 0x13, 0x13, 0x0d, 0x04, 0x83, 0x10, 0x01, 0x02, 0x13, 0x85, 0x00, 0x00, 0x12, 0x83,
+    0x10, 0x04, 0x04, 0x0f, 0x13, 0x0e, 0x08, 0x82, 0x10, 0x10, 0x04, 0x08, 0x09, 0x06, 0x0b, 0x0b,
+    0x03, 0x05, 0x02, 0x01, 0x10, 0x10, 0x01, 0x12, 0x13, 0x13, 0x12, 0x83, 0x10, 0x01, 0x01, 0x0d,
+    0x84, 0x00, 0x01, 0x0b, 0x0a, 0x83, 0x10, 0x03, 0x0c, 0x13, 0x13, 0x0c, 0x82, 0x10, 0x01, 0x11,
+    0x0f, 0x86, 0x13, 0x09, 0x0e, 0x09, 0x0a, 0x10, 0x10, 0x04, 0x09, 0x13, 0x0e, 0x11, 0x83, 0x10,
+    0x01, 0x08, 0x13, 0x83, 0x00, 0x01, 0x09, 0x01, 0x82, 0x10, 0x1b, 0x07, 0x06, 0x13, 0x0d, 0x04,
+    0x10, 0x10, 0x08, 0x0b, 0x13, 0x13, 0x03, 0x12, 0x0c, 0x0c, 0x05, 0x06, 0x13, 0x13, 0x03, 0x0a,
+    0x10, 0x10, 0x0a, 0x06, 0x13, 0x0d, 0x01, 0x82, 0x10, 0x01, 0x07, 0x06, 0x83, 0x00, 0x00, 0x08,
+    0x83, 0x10, 0x0b, 0x0c, 0x13, 0x0e, 0x11, 0x10, 0x10, 0x11, 0x0b, 0x13, 0x0b, 0x08, 0x04, 0x83,
+    0x10, 0x0b, 0x07, 0x12, 0x0e, 0x13, 0x03, 0x07, 0x10, 0x10, 0x0c, 0x13, 0x0e, 0x11, 0x83, 0x10,
+    0x00, 0x09, 0x82, 0x00, 0x01, 0x0e, 0x0a, 0x82, 0x10, 0x0a, 0x01, 0x0f, 0x13, 0x0f, 0x01, 0x10,
+    0x04, 0x0f, 0x13, 0x0b, 0x11, 0x87, 0x10, 0x09, 0x0c, 0x13, 0x13, 0x12, 0x10, 0x10, 0x0a, 0x0b,
+    0x13, 0x12, 0x83, 0x10, 0x00, 0x08, 0x82, 0x00, 0x01, 0x06, 0x04, 0x82, 0x10, 0x09, 0x0a, 0x0b,
+    0x13, 0x0c, 0x10, 0x10, 0x02, 0x13, 0x13, 0x0c, 0x88, 0x10, 0x0a, 0x01, 0x09, 0x13, 0x0b, 0x07,
+    0x10, 0x10, 0x09, 0x13, 0x0f, 0x01, 0x82, 0x10, 0x05, 0x11, 0x0e, 0x00, 0x00, 0x0f, 0x01, 0x82,
+    0x10, 0x09, 0x02, 0x13, 0x0e, 0x11, 0x10, 0x10, 0x05, 0x13, 0x03, 0x04, 0x89, 0x10, 0x09, 0x11,
+    0x0e, 0x13, 0x08, 0x10, 0x10, 0x0c, 0x13, 0x0b, 0x07, 0x82, 0x10, 0x04, 0x07, 0x0b, 0x00, 0x00,
+    0x09, 0x83, 0x10, 0x08, 0x08, 0x13, 0x0b, 0x07, 0x10, 0x04, 0x03, 0x13, 0x05, 0x8a, 0x10, 0x09,
+    0x04, 0x03, 0x13, 0x05, 0x10, 0x10, 0x02, 0x13, 0x0e, 0x0a, 0x82, 0x10, 0x04, 0x04, 0x06, 0x00,
+    0x00, 0x05, 0x83, 0x10, 0x08, 0x0c, 0x13, 0x06, 0x07, 0x10, 0x04, 0x06, 0x13, 0x0c, 0x8b, 0x10,
+    0x08, 0x0d, 0x13, 0x09, 0x10, 0x10, 0x11, 0x13, 0x0e, 0x11, 0x82, 0x10, 0x04, 0x04, 0x03, 0x00,
+    0x00, 0x09, 0x83, 0x10, 0x08, 0x0c, 0x13, 0x06, 0x07, 0x10, 0x04, 0x06, 0x13, 0x12, 0x8a, 0x10,
+    0x09, 0x01, 0x0f, 0x13, 0x09, 0x10, 0x10, 0x11, 0x13, 0x0e, 0x11, 0x82, 0x10, 0x04, 0x04, 0x03,
+    0x00, 0x00, 0x0d, 0x83, 0x10, 0x08, 0x08, 0x13, 0x0b, 0x0a, 0x10, 0x01, 0x0f, 0x13, 0x09, 0x8a,
+    0x10, 0x09, 0x07, 0x06, 0x13, 0x12, 0x10, 0x10, 0x08, 0x13, 0x0b, 0x0a, 0x82, 0x10, 0x05, 0x07,
+    0x06, 0x00, 0x00, 0x0f, 0x01, 0x82, 0x10, 0x09, 0x11, 0x0e, 0x13, 0x02, 0x10, 0x10, 0x12, 0x13,
+    0x0b, 0x0a, 0x89, 0x10, 0x09, 0x02, 0x13, 0x13, 0x02, 0x10, 0x10, 0x12, 0x13, 0x06, 0x07, 0x82,
+    0x10, 0x05, 0x0a, 0x0b, 0x00, 0x00, 0x06, 0x07, 0x82, 0x10, 0x09, 0x07, 0x06, 0x13, 0x12, 0x10,
+    0x10, 0x11, 0x0e, 0x13, 0x05, 0x88, 0x10, 0x0a, 0x04, 0x0f, 0x13, 0x03, 0x04, 0x10, 0x01, 0x0f,
+    0x13, 0x0d, 0x01, 0x82, 0x10, 0x05, 0x11, 0x13, 0x00, 0x00, 0x0e, 0x11, 0x82, 0x10, 0x0b, 0x01,
+    0x09, 0x13, 0x03, 0x04, 0x10, 0x01, 0x05, 0x13, 0x13, 0x0c, 0x01, 0x85, 0x10, 0x0a, 0x04, 0x09,
+    0x13, 0x13, 0x08, 0x10, 0x10, 0x11, 0x0e, 0x13, 0x0c, 0x83, 0x10, 0x00, 0x0c, 0x83, 0x00, 0x00,
+    0x0c, 0x83, 0x10, 0x1b, 0x02, 0x13, 0x13, 0x08, 0x10, 0x10, 0x07, 0x03, 0x13, 0x13, 0x09, 0x11,
+    0x01, 0x10, 0x10, 0x04, 0x02, 0x0f, 0x13, 0x13, 0x09, 0x01, 0x10, 0x10, 0x05, 0x13, 0x0b, 0x0a,
+    0x82, 0x10, 0x01, 0x01, 0x0d, 0x83, 0x00, 0x01, 0x0f, 0x01, 0x82, 0x10, 0x1a, 0x04, 0x0f, 0x13,
+    0x06, 0x07, 0x10, 0x10, 0x0a, 0x0f, 0x13, 0x13, 0x0e, 0x03, 0x0d, 0x0d, 0x03, 0x0e, 0x13, 0x13,
+    0x09, 0x04, 0x10, 0x10, 0x02, 0x0e, 0x13, 0x05, 0x83, 0x10, 0x01, 0x0a, 0x0b, 0x83, 0x00, 0x01,
+    0x0e, 0x11, 0x83, 0x10, 0x09, 0x02, 0x0e, 0x13, 0x09, 0x01, 0x10, 0x10, 0x07, 0x12, 0x0b, 0x85,
+    0x13, 0x09, 0x06, 0x0c, 0x04, 0x10, 0x10, 0x0a, 0x03, 0x13, 0x06, 0x0a, 0x83, 0x10, 0x00, 0x0c,
+    0x85, 0x00, 0x00, 0x09, 0x83, 0x10, 0x05, 0x01, 0x05, 0x13, 0x13, 0x05, 0x01, 0x82, 0x10, 0x07,
+    0x0a, 0x0c, 0x09, 0x0d, 0x0d, 0x05, 0x08, 0x07, 0x82, 0x10, 0x04, 0x07, 0x0f, 0x13, 0x0e, 0x08,
+    0x83, 0x10, 0x01, 0x07, 0x03, 0x85, 0x00, 0x01, 0x0e, 0x11, 0x83, 0x10, 0x05, 0x04, 0x0d, 0x13,
+    0x13, 0x09, 0x0a, 0x84, 0x10, 0x01, 0x01, 0x01, 0x84, 0x10, 0x05, 0x11, 0x03, 0x13, 0x13, 0x12,
+    0x01, 0x83, 0x10, 0x00, 0x0c, 0x87, 0x00, 0x01, 0x0f, 0x04, 0x83, 0x10, 0x06, 0x07, 0x0d, 0x13,
+    0x13, 0x06, 0x0c, 0x07, 0x86, 0x10, 0x07, 0x01, 0x0a, 0x12, 0x0b, 0x13, 0x13, 0x12, 0x01, 0x83,
+    0x10, 0x01, 0x0a, 0x0b, 0x88, 0x00, 0x00, 0x12, 0x84, 0x10, 0x13, 0x04, 0x12, 0x0e, 0x13, 0x13,
+    0x06, 0x05, 0x08, 0x11, 0x0a, 0x0a, 0x11, 0x0c, 0x09, 0x0b, 0x13, 0x13, 0x0b, 0x0c, 0x01, 0x83,
+    0x10, 0x01, 0x04, 0x0d, 0x89, 0x00, 0x01, 0x0e, 0x08, 0x85, 0x10, 0x02, 0x02, 0x0f, 0x0e, 0x83,
+    0x13, 0x01, 0x0e, 0x0e, 0x83, 0x13, 0x02, 0x0e, 0x09, 0x0a, 0x84, 0x10, 0x01, 0x01, 0x12, 0x8b,
+    0x00, 0x01, 0x0b, 0x02, 0x85, 0x10, 0x04, 0x01, 0x02, 0x05, 0x03, 0x0e, 0x82, 0x13, 0x05, 0x0e,
+    0x0b, 0x03, 0x12, 0x11, 0x01, 0x85, 0x10, 0x01, 0x0c, 0x13, 0x8c, 0x00, 0x01, 0x0b, 0x08, 0x87,
+    0x10, 0x01, 0x04, 0x0a, 0x82, 0x02, 0x02, 0x11, 0x0a, 0x04, 0x86, 0x10, 0x02, 0x01, 0x12, 0x13,
+    0x8e, 0x00, 0x02, 0x0e, 0x12, 0x04, 0x93, 0x10, 0x02, 0x07, 0x09, 0x13, 0x91, 0x00, 0x02, 0x0f,
+    0x02, 0x01, 0x8f, 0x10, 0x02, 0x01, 0x08, 0x06, 0x94, 0x00, 0x03, 0x0e, 0x09, 0x02, 0x04, 0x8b,
+    0x10, 0x03, 0x04, 0x08, 0x0f, 0x13, 0x97, 0x00, 0x0f, 0x0e, 0x03, 0x12, 0x02, 0x07, 0x04, 0x01,
+    0x10, 0x10, 0x01, 0x04, 0x0a, 0x02, 0x05, 0x06, 0x13, 0x9c, 0x00, 0x09, 0x13, 0x0b, 0x03, 0x0f,
+    0x0d, 0x0d, 0x0f, 0x06, 0x0b, 0x13, 0xb9, 0x00,
 };
 
-static const uint16_t image_data_icon_wifi[1764] = {
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▓▒▓▓▓▓▓▓▓▓▒▓∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙
-    // ∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙
-    // ∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙
-    // ∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙
-    // ∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙
-    // ∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓███████████▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙
-    // ∙∙▓▓▓▓▓▓▓▓▓▓█████████████████▓▓▓▓▓▓▓▓▓▓▓∙∙
-    // ∙▓▓▓▓▓▓▓▓▓███████▓▓▓▓▓▓▓▓███████▓▓▓▓▓▓▓▓▓∙
-    // ∙▓▓▓▓▓▓▓██████▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓████▓▓▓▓▓▓▓▓∙
-    // ∙▓▓▓▓▓▓████▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓████▓▓▓▓▓▓∙
-    // ▓▓▓▓▓▓████▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓████▓▓▓▓▓▓
-    // ▒▓▓▓▓▓██▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓██▓▓▓▓▓▒
-    // ▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓
-    // ▓▓▓▓▓▓▓███▓▓▓▓▓▓▓████████▓▓▓▓▓▓▓███▓▓▓▓▓▓▓
-    // ▓▓▓▓▓▓▓▓███▓▓▓█████████████▓▓▓▓███▓▓▓▓▓▓▓▓
-    // ▓▓▓▓▓▓▓▓▓██████████▓▓▓▓▓█████▓███▓▓▓▓▓▓▓▓▓
-    // ▓▓▓▓▓▓▓▓▓███████▓▓▓▓▓▓▓▓▓▓▓█████▓▓▓▓▓▓▓▓▓▓
-    // ▓▓▓▓▓▓▓▓▓▓████▓▓▓▓▓▓▓▓▓▓▓▓▓▓████▓▓▓▓▓▓▓▓▓▓
-    // ▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓
-    // ▓▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓
-    // ▒▓▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓▒
-    // ▓▓▓▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓▓▓
-    // ∙▓▓▓▓▓▓▓▓▓▓▓▓▓████▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓▓∙
-    // ∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙
-    // ∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙
-    // ∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓███▓▓███▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙
-    // ∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓██████▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙
-    // ∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓████▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙
-    // ∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓███▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙
-    // ∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙
-    // ∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙
-    // ∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▓▒▓▓▓▓▓▓▓▓▒▓∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x05ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x24ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x05ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x05ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x24ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x24ec, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0x12f6, 0x19ff, 0x19ff, 0xffff, 0xffff, 0xffff, 0xffff, 0x19ff, 0x19ff, 0x19ff, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0x19ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x19ff, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 
-    0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0xffff, 0xffff, 0x19ff, 0x12f6, 0x0bf5, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0bf5, 0x0bf5, 0x12f6, 0x19ff, 0xffff, 0xffff, 0xffff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 
-    0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0xffff, 0x12f6, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0bf5, 0x19ff, 0xffff, 0xffff, 0xffff, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 
-    0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0x12f6, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0bf5, 0x19ff, 0xffff, 0xffff, 0x19ff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 
-    0x05ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x19ff, 0xffff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x05ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0xffff, 0xffff, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0bf5, 0xffff, 0x19ff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x19ff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x19ff, 0xffff, 0x19ff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0bf5, 0x12f6, 0x12f6, 0x19ff, 0xffff, 0xffff, 0x19ff, 0x19ff, 0x12f6, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x19ff, 0xffff, 0x19ff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0xffff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x19ff, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0x19ff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0bf5, 0xffff, 0xffff, 0x12f6, 0x12f6, 0xffff, 0xffff, 0xffff, 0xffff, 0x75f6, 0x75f6, 0xaff5, 0xeaec, 0xeaec, 0xaff5, 0xaff5, 0x75f6, 0x3aff, 0xffff, 0xffff, 0x19ff, 0x0bf5, 0x12f6, 0xffff, 0xffff, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75f6, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xaff5, 0x3aff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0x3aff, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0x75f6, 0xffff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0x3aff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x19ff, 0xffff, 0x3aff, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0x3aff, 0xffff, 0x19ff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0xffff, 0xffff, 0x75f6, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0x75f6, 0xffff, 0xffff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 
-    0x05ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0bf5, 0xffff, 0xffff, 0x75f6, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0x75f6, 0xffff, 0xffff, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x05ec, 
-    0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0x75f6, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xaff5, 0xffff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 
-    0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0xffff, 0xaff5, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0xaff5, 0xffff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 
-    0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x12f6, 0xffff, 0x3aff, 0xeaec, 0xeaec, 0xeaec, 0xeaec, 0x3aff, 0xffff, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 
-    0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x19ff, 0xffff, 0x75f6, 0xeaec, 0xeaec, 0x3aff, 0xffff, 0x19ff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0xffff, 0xffff, 0x75f6, 0x75f6, 0xffff, 0xffff, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0bf5, 0xffff, 0xffff, 0xffff, 0xffff, 0x0bf5, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0bf5, 0x19ff, 0x12f6, 0x12f6, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x24ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x24ec, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x05ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x05ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x24ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x25ec, 0x05ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+// 42x42, 1349 B (raw 3528 B)
+static const uint8_t image_data_gps[1349] = {
+    // █████████████▓▒▒▒▓████████████████████████
+    // ███████████▓▒▒▒▒▒▒▒▓██████████████████████
+    // ██████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓████████████████
+    // ██████████▒▒▒▒▒▒▒▒▒▒▒░    ░▒▓█████████████
+    // █████████▓▒▒▒▒░  ░▒▒▒▒░      ░▓███████████
+    // █████████▒▒▒▒░    ▒▒▒▒░        ▒██████████
+    // ████████▓▒▒▒▒░    ▒▒▒▒░       ░░░▓████████
+    // ███████▓▒░▒▒▒▒   ░▒▒▒▒░       ░░░░▓███████
+    // ██████▓▒░░▒▒▒▒░░░▒▒▒▒▒░      ░░░░░░▓██████
+    // █████▓▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒       ░░░░░░░▓█████
+    // █████▒▒▒▒▒░▒▒▒▒▒▒▒▒▒▒░       ░░░░░░░░█████
+    // ████▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒         ░░░░░░░▒████
+    // ███▓▒▒▒▒▒▒▒░▒▒▒▒▒▒▒▒░         ░░░░░░░░▓███
+    // ███▒▒▒▒▒▒▒▒░▒▒▒▒▒▒▒▒           ░░░░░░░▒███
+    // ██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░           ░░░░░░░░▓██
+    // ██▒▒▒▒▒▒▒▒▒▒░▒▒▒▒▒▒░           ░░░░░░░░▒██
+    // ██▒▒▒▒▒▒▒▒▒░░░▒▒▒▒░░░░░░░░░░    ░░░░░░░░██
+    // █▓▒▒▒▒▒▒▒░░   ▒▒▒▒░ ░░░░░░░░    ░░░░░░░░▓█
+    // █▓░░░░        ░▒▒░  ░░░░░       ░░░░░░░░▓█
+    // █░            ░▒▒░░  ░░        ░░░░░░░░░▒█
+    // █░             ▒░░░            ░░░░░░░░░▒█
+    // █░             ░░             ░░░░░░░░░░▒█
+    // █░                           ░░░░░░░░░░░▒█
+    // █░                          ░░░░░░░░░░░░▒█
+    // █▒                         ░░░░░░░░░░░░░▒█
+    // █▒                         ░░░░░░░░░░░░░▓█
+    // █▓                         ░░░░░░░░░░░░░▓█
+    // ██░                       ░░░░░░░░░░░░░░██
+    // ██░                       ░░░░░░░░░░░░░▒██
+    // ███                       ░░░░░░░░░░░░░▓██
+    // ███░                       ░░         ░███
+    // ███▒                                  ▒███
+    // ████░                                ░████
+    // █████                                ▓████
+    // █████▒                              ▒█████
+    // ███████                            ▒██████
+    // ███████▒                          ▒███████
+    // ████████▒                        ▒████████
+    // ██████████░                    ░▓█████████
+    // ███████████▒░                 ▒███████████
+    // █████████████▒░            ░▒█████████████
+    // ████████████████▒░░    ░░▒▓███████████████
+    0x01, 0x84, 0x00, 0x00, 0x22, 0x0a, 0x5d, 0x0c, 0x63, 0x0c, 0xfb, 0x0e, 0x84, 0x10, 0x3c, 0x14,
+    0xc6, 0x18, 0x8d, 0x19, 0xe6, 0x19, 0x4d, 0x1a, 0xdf, 0x1c, 0xe7, 0x1c, 0x00, 0x20, 0x10, 0x20,
+    0x21, 0x24, 0x3b, 0x28, 0x42, 0x29, 0x8a, 0x29, 0xd3, 0x2e, 0x6e, 0x2f, 0xfc, 0x32, 0xbf, 0x37,
+    0xc6, 0x39, 0xfe, 0x39, 0x85, 0x3a, 0xc6, 0x3a, 0xe7, 0x3d, 0x08, 0x41, 0x19, 0x43, 0x29, 0x45,
+    0xe2, 0x4b, 0xfa, 0x4b, 0x65, 0x4d, 0xe3, 0x4e, 0x4b, 0x4f, 0xf3, 0x4f, 0x84, 0x50, 0xa4, 0x51,
+    0xad, 0x55, 0xf5, 0x56, 0xc7, 0x58, 0xce, 0x59, 0x7d, 0x5a, 0xc6, 0x5a, 0xce, 0x5a, 0xe7, 0x5d,
+    0xef, 0x5d, 0x08, 0x61, 0x28, 0x62, 0x51, 0x66, 0x6e, 0x6f, 0x76, 0x6f, 0xfb, 0x6f, 0xec, 0x73,
+    0xcc, 0x75, 0xcd, 0x76, 0x44, 0x77, 0xce, 0x7a, 0xcf, 0x7a, 0xe6, 0x7a, 0x55, 0x7c, 0xef, 0x7e,
+    0x20, 0x82, 0x32, 0x86, 0x52, 0x8a, 0xa2, 0x8b, 0xfa, 0x8c, 0x2a, 0x8d, 0x7e, 0x90, 0xf3, 0x90,
+    0xd5, 0x97, 0xed, 0x97, 0xce, 0x9b, 0xdf, 0x9b, 0x55, 0x9d, 0xae, 0x9d, 0x96, 0x9e, 0xf7, 0x9e,
+    0xdf, 0x9f, 0x10, 0xa2, 0x32, 0xa6, 0x61, 0xa7, 0xb9, 0xa8, 0x54, 0xab, 0x5c, 0xac, 0x2a, 0xad,
+    0xfa, 0xad, 0x73, 0xae, 0x8e, 0xb2, 0x94, 0xb2, 0x94, 0xb3, 0xec, 0xb4, 0xd6, 0xbb, 0xe6, 0xbb,
+    0xf6, 0xbb, 0xe7, 0xbc, 0x55, 0xbd, 0xa6, 0xbe, 0xf7, 0xbe, 0x08, 0xc3, 0x32, 0xc7, 0x43, 0xc9,
+    0xfb, 0xd1, 0x3b, 0xd3, 0x9e, 0xd3, 0xac, 0xd7, 0xb5, 0xd7, 0xd6, 0xdb, 0xde, 0xdb, 0x65, 0xdd,
+    0xef, 0xde, 0xf7, 0xdf, 0xff, 0xdf, 0x18, 0xe3, 0x68, 0xe4, 0xd2, 0xed, 0xea, 0xed, 0xfa, 0xed,
+    0x6d, 0xee, 0xf2, 0xee, 0x75, 0xef, 0x7b, 0xef, 0xe3, 0xf1, 0xcb, 0xf3, 0xa6, 0xf5, 0xec, 0xf5,
+    0xbd, 0xf7, 0x8c, 0xf9, 0xde, 0xfc, 0xf6, 0xfc, 0xb6, 0xfe, 0xff, 0xff, 0x8b, 0x00, 0x07, 0x3f,
+    0x12, 0x74, 0x75, 0x1f, 0x53, 0x73, 0x0e, 0xa0, 0x00, 0x02, 0x32, 0x22, 0x04, 0x83, 0x57, 0x03,
+    0x43, 0x53, 0x31, 0x0d, 0x9d, 0x00, 0x02, 0x32, 0x22, 0x76, 0x85, 0x57, 0x07, 0x43, 0x1f, 0x26,
+    0x5b, 0x25, 0x03, 0x11, 0x72, 0x97, 0x00, 0x02, 0x3f, 0x13, 0x76, 0x82, 0x57, 0x01, 0x04, 0x04,
+    0x82, 0x57, 0x08, 0x20, 0x7b, 0x81, 0x0c, 0x0c, 0x6d, 0x07, 0x5b, 0x11, 0x95, 0x00, 0x08, 0x52,
+    0x35, 0x57, 0x57, 0x76, 0x7e, 0x5f, 0x5f, 0x15, 0x82, 0x57, 0x02, 0x20, 0x09, 0x1b, 0x83, 0x0c,
+    0x03, 0x0b, 0x7f, 0x03, 0x30, 0x92, 0x00, 0x0e, 0x42, 0x04, 0x57, 0x57, 0x15, 0x4e, 0x63, 0x63,
+    0x5f, 0x24, 0x57, 0x57, 0x20, 0x7e, 0x1b, 0x83, 0x0c, 0x04, 0x3e, 0x84, 0x3b, 0x55, 0x1d, 0x90,
+    0x00, 0x05, 0x01, 0x7c, 0x76, 0x57, 0x57, 0x5c, 0x82, 0x63, 0x06, 0x1b, 0x46, 0x57, 0x57, 0x20,
+    0x36, 0x1b, 0x82, 0x0c, 0x06, 0x1b, 0x71, 0x6f, 0x59, 0x33, 0x77, 0x40, 0x8e, 0x00, 0x1c, 0x44,
+    0x3d, 0x37, 0x76, 0x57, 0x57, 0x46, 0x82, 0x63, 0x63, 0x09, 0x04, 0x57, 0x57, 0x20, 0x5c, 0x1b,
+    0x0c, 0x0c, 0x0b, 0x2f, 0x84, 0x16, 0x33, 0x34, 0x34, 0x14, 0x10, 0x0d, 0x8b, 0x00, 0x04, 0x56,
+    0x3d, 0x61, 0x6a, 0x04, 0x82, 0x57, 0x03, 0x67, 0x28, 0x7e, 0x24, 0x82, 0x57, 0x02, 0x20, 0x48,
+    0x1b, 0x82, 0x0c, 0x03, 0x4e, 0x84, 0x69, 0x33, 0x83, 0x34, 0x01, 0x10, 0x0d, 0x89, 0x00, 0x05,
+    0x01, 0x3d, 0x4b, 0x61, 0x2b, 0x46, 0x88, 0x57, 0x02, 0x43, 0x78, 0x5e, 0x83, 0x0c, 0x03, 0x4e,
+    0x71, 0x69, 0x33, 0x83, 0x34, 0x01, 0x14, 0x51, 0x89, 0x00, 0x00, 0x0a, 0x83, 0x4b, 0x01, 0x37,
+    0x76, 0x87, 0x57, 0x02, 0x20, 0x7e, 0x1b, 0x83, 0x0c, 0x03, 0x4e, 0x84, 0x7d, 0x33, 0x84, 0x34,
+    0x01, 0x77, 0x1d, 0x87, 0x00, 0x00, 0x06, 0x83, 0x4b, 0x02, 0x61, 0x19, 0x24, 0x86, 0x57, 0x02,
+    0x43, 0x78, 0x3c, 0x83, 0x0c, 0x03, 0x0b, 0x2f, 0x84, 0x29, 0x86, 0x34, 0x01, 0x02, 0x30, 0x85,
+    0x00, 0x00, 0x01, 0x86, 0x4b, 0x00, 0x37, 0x86, 0x57, 0x02, 0x20, 0x5c, 0x1b, 0x84, 0x0c, 0x04,
+    0x1b, 0x71, 0x6f, 0x59, 0x33, 0x85, 0x34, 0x00, 0x65, 0x85, 0x00, 0x00, 0x39, 0x86, 0x4b, 0x01,
+    0x08, 0x24, 0x85, 0x57, 0x01, 0x78, 0x3c, 0x86, 0x0c, 0x02, 0x4e, 0x84, 0x29, 0x86, 0x34, 0x01,
+    0x21, 0x64, 0x83, 0x00, 0x00, 0x01, 0x88, 0x4b, 0x00, 0x7c, 0x84, 0x57, 0x02, 0x43, 0x5c, 0x1b,
+    0x86, 0x0c, 0x04, 0x1b, 0x71, 0x6f, 0x59, 0x33, 0x85, 0x34, 0x00, 0x51, 0x83, 0x00, 0x00, 0x68,
+    0x88, 0x4b, 0x01, 0x80, 0x04, 0x83, 0x57, 0x03, 0x78, 0x09, 0x6c, 0x5d, 0x83, 0x49, 0x06, 0x5d,
+    0x6c, 0x0b, 0x4e, 0x84, 0x7d, 0x33, 0x85, 0x34, 0x00, 0x54, 0x83, 0x00, 0x00, 0x0a, 0x87, 0x4b,
+    0x02, 0x6e, 0x4c, 0x15, 0x82, 0x57, 0x02, 0x43, 0x36, 0x3a, 0x87, 0x17, 0x03, 0x49, 0x2f, 0x84,
+    0x29, 0x86, 0x34, 0x04, 0x77, 0x1d, 0x00, 0x00, 0x01, 0x86, 0x4b, 0x0a, 0x6e, 0x62, 0x4f, 0x84,
+    0x18, 0x76, 0x57, 0x57, 0x78, 0x09, 0x5d, 0x86, 0x17, 0x04, 0x2d, 0x6c, 0x2e, 0x84, 0x3b, 0x87,
+    0x34, 0x07, 0x40, 0x00, 0x00, 0x23, 0x4d, 0x4d, 0x62, 0x62, 0x82, 0x83, 0x0b, 0x4f, 0x84, 0x84,
+    0x4e, 0x81, 0x67, 0x57, 0x57, 0x7b, 0x49, 0x6c, 0x3a, 0x82, 0x17, 0x08, 0x2c, 0x49, 0x6c, 0x0b,
+    0x0c, 0x2f, 0x84, 0x16, 0x33, 0x86, 0x34, 0x03, 0x66, 0x00, 0x00, 0x27, 0x87, 0x84, 0x0e, 0x4e,
+    0x1b, 0x0c, 0x0c, 0x48, 0x57, 0x78, 0x38, 0x2c, 0x5d, 0x5d, 0x2c, 0x3a, 0x6c, 0x81, 0x82, 0x0c,
+    0x04, 0x1b, 0x63, 0x84, 0x69, 0x33, 0x86, 0x34, 0x05, 0x54, 0x00, 0x00, 0x27, 0x3e, 0x3e, 0x82,
+    0x2f, 0x02, 0x2e, 0x2e, 0x1b, 0x83, 0x0c, 0x08, 0x5e, 0x46, 0x7b, 0x17, 0x1a, 0x6c, 0x3e, 0x2f,
+    0x0b, 0x84, 0x0c, 0x03, 0x2f, 0x84, 0x4a, 0x45, 0x87, 0x34, 0x03, 0x02, 0x00, 0x00, 0x27, 0x82,
+    0x0b, 0x01, 0x0c, 0x0b, 0x87, 0x0c, 0x10, 0x48, 0x47, 0x5d, 0x81, 0x1b, 0x71, 0x71, 0x2f, 0x2f,
+    0x1b, 0x0c, 0x0c, 0x2f, 0x84, 0x6f, 0x69, 0x33, 0x87, 0x34, 0x03, 0x02, 0x00, 0x00, 0x27, 0x8c,
+    0x0c, 0x01, 0x0b, 0x0b, 0x82, 0x0c, 0x00, 0x4e, 0x82, 0x84, 0x05, 0x71, 0x4e, 0x3e, 0x84, 0x6f,
+    0x7d, 0x89, 0x34, 0x03, 0x02, 0x00, 0x00, 0x27, 0x90, 0x0c, 0x09, 0x1b, 0x71, 0x84, 0x63, 0x4e,
+    0x71, 0x84, 0x84, 0x60, 0x69, 0x8a, 0x34, 0x03, 0x02, 0x00, 0x00, 0x5b, 0x84, 0x0c, 0x02, 0x1b,
+    0x2e, 0x1b, 0x88, 0x0c, 0x09, 0x3e, 0x84, 0x4e, 0x0c, 0x0b, 0x2f, 0x84, 0x60, 0x59, 0x33, 0x8a,
+    0x34, 0x03, 0x54, 0x00, 0x00, 0x7a, 0x84, 0x0c, 0x02, 0x2e, 0x71, 0x4e, 0x87, 0x0c, 0x09, 0x0b,
+    0x4e, 0x84, 0x2e, 0x0b, 0x0c, 0x1b, 0x71, 0x60, 0x45, 0x8b, 0x34, 0x03, 0x66, 0x00, 0x00, 0x41,
+    0x84, 0x0c, 0x03, 0x1b, 0x70, 0x71, 0x2e, 0x86, 0x0c, 0x08, 0x1b, 0x63, 0x84, 0x4e, 0x0c, 0x0c,
+    0x2f, 0x84, 0x3b, 0x8c, 0x34, 0x04, 0x65, 0x00, 0x00, 0x1e, 0x2a, 0x84, 0x0c, 0x02, 0x2f, 0x84,
+    0x63, 0x84, 0x0c, 0x02, 0x1b, 0x4e, 0x71, 0x82, 0x84, 0x05, 0x63, 0x4e, 0x71, 0x70, 0x69, 0x33,
+    0x8a, 0x34, 0x05, 0x14, 0x1d, 0x00, 0x00, 0x1c, 0x27, 0x84, 0x0c, 0x0d, 0x1b, 0x63, 0x84, 0x2f,
+    0x0b, 0x0c, 0x1b, 0x3e, 0x71, 0x84, 0x71, 0x3e, 0x2f, 0x63, 0x82, 0x84, 0x01, 0x4a, 0x45, 0x87,
+    0x34, 0x05, 0x33, 0x33, 0x34, 0x34, 0x02, 0x30, 0x83, 0x00, 0x84, 0x0c, 0x12, 0x0b, 0x2f, 0x84,
+    0x63, 0x1b, 0x2f, 0x70, 0x84, 0x71, 0x4e, 0x1b, 0x0c, 0x0c, 0x1b, 0x2e, 0x2e, 0x63, 0x84, 0x7d,
+    0x82, 0x33, 0x01, 0x34, 0x34, 0x82, 0x45, 0x04, 0x59, 0x59, 0x34, 0x34, 0x10, 0x84, 0x00, 0x00,
+    0x07, 0x85, 0x0c, 0x06, 0x63, 0x84, 0x70, 0x84, 0x84, 0x4e, 0x1b, 0x85, 0x0c, 0x10, 0x0b, 0x2e,
+    0x84, 0x60, 0x7d, 0x7d, 0x16, 0x29, 0x3b, 0x4a, 0x60, 0x6f, 0x70, 0x6f, 0x16, 0x79, 0x1d, 0x84,
+    0x00, 0x00, 0x58, 0x84, 0x0c, 0x05, 0x2e, 0x63, 0x84, 0x84, 0x63, 0x2e, 0x89, 0x0c, 0x00, 0x63,
+    0x85, 0x84, 0x06, 0x71, 0x71, 0x70, 0x63, 0x71, 0x84, 0x25, 0x85, 0x00, 0x09, 0x50, 0x6b, 0x0c,
+    0x0c, 0x1b, 0x63, 0x84, 0x84, 0x63, 0x2e, 0x8b, 0x0c, 0x05, 0x1b, 0x71, 0x84, 0x4e, 0x2f, 0x2f,
+    0x83, 0x1b, 0x03, 0x0c, 0x1b, 0x2a, 0x0f, 0x87, 0x00, 0x07, 0x6d, 0x4e, 0x71, 0x84, 0x63, 0x2f,
+    0x1b, 0x0b, 0x8c, 0x0c, 0x04, 0x4e, 0x84, 0x4e, 0x0b, 0x0b, 0x84, 0x0c, 0x01, 0x6d, 0x41, 0x88,
+    0x00, 0x04, 0x05, 0x84, 0x70, 0x2f, 0x1b, 0x8f, 0x0c, 0x03, 0x2f, 0x84, 0x71, 0x1b, 0x85, 0x0c,
+    0x01, 0x7a, 0x0d, 0x8a, 0x00, 0x01, 0x1b, 0x0b, 0x8d, 0x0c, 0x06, 0x0b, 0x1b, 0x4e, 0x71, 0x84,
+    0x84, 0x4e, 0x84, 0x0c, 0x01, 0x5b, 0x30, 0x8b, 0x00, 0x00, 0x25, 0x8d, 0x0c, 0x08, 0x1b, 0x2f,
+    0x70, 0x84, 0x71, 0x4e, 0x70, 0x84, 0x2e, 0x82, 0x0c, 0x01, 0x5b, 0x50, 0x8d, 0x00, 0x01, 0x58,
+    0x6d, 0x8a, 0x0c, 0x0d, 0x1b, 0x63, 0x84, 0x84, 0x4e, 0x1b, 0x0b, 0x2f, 0x84, 0x63, 0x0c, 0x6d,
+    0x7a, 0x30, 0x90, 0x00, 0x00, 0x6b, 0x8a, 0x0c, 0x02, 0x4e, 0x63, 0x2e, 0x82, 0x0c, 0x05, 0x1b,
+    0x63, 0x84, 0x2a, 0x41, 0x0d, 0x92, 0x00, 0x01, 0x7a, 0x2a, 0x88, 0x0c, 0x02, 0x1b, 0x1b, 0x0b,
+    0x83, 0x0c, 0x02, 0x6d, 0x5a, 0x1e, 0x95, 0x00, 0x03, 0x1e, 0x58, 0x6b, 0x6d, 0x89, 0x0c, 0x03,
+    0x6d, 0x6b, 0x58, 0x1e, 0x9b, 0x00, 0x0b, 0x7a, 0x27, 0x2a, 0x6d, 0x0b, 0x0b, 0x6d, 0x2a, 0x27,
+    0x7a, 0x11, 0x50, 0x8d, 0x00,
 };
 
+// 42x42, 799 B (raw 3528 B)
+static const uint8_t image_data_bleutooth[799] = {
+    // ███████████████  ░░░░░░░   ███████████████
+    // ████████████  ░▒▒▒▒▒▒▒▒▒▒▒▒░ █████████████
+    // ██████████ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ ███████████
+    // █████████ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ █████████
+    // ███████ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░████████
+    // ██████ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░███████
+    // █████ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░██████
+    // ████ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█████
+    // ████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ████
+    // ███ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ███
+    // ██ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░███
+    // ██░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ██
+    // █ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒   ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░██
+    // █ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ █
+    // █░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█
+    //  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░▒▒▒  ▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ 
+    //  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ▒▒  ▒▒  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒ 
+    // ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒   ▒  ▒  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ 
+    // ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒       ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░
+    // ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒     ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒   ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░
+    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░
+    // ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒      ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░
+    // ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒        ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░
+    // ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ░▒  ▒   ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ 
+    //  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ ░▒▒  ▒▒  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒ 
+    //  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░▒▒▒  ▒░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█
+    // █░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ░  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█
+    // █ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ █
+    // █ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒   ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░██
+    // ██ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ██
+    // ██ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░███
+    // ███ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ███
+    // ████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ████
+    // █████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░█████
+    // █████ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░██████
+    // ███████░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░███████
+    // ████████ ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒ ████████
+    // █████████ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ █████████
+    // ███████████ ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░ ███████████
+    // █████████████ ░░▒▒▒▒▒▒▒▒▒▒░░ █████████████
+    // ████████████████   ░░░░   ████████████████
+    0x01, 0x12, 0x00, 0x00, 0x3c, 0x1f, 0x6d, 0x1f, 0xd7, 0x1f, 0xa6, 0x3f, 0x44, 0x5f, 0xdf, 0x5f,
+    0x7d, 0x7f, 0xb6, 0x9f, 0xef, 0x9f, 0x54, 0xbf, 0x8d, 0xbf, 0x23, 0xdf, 0x2b, 0xdf, 0xc6, 0xdf,
+    0xf7, 0xdf, 0x2b, 0xff, 0x9d, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x0b, 0x0f, 0x03, 0x08, 0x11, 0x0b,
+    0x07, 0x07, 0x0b, 0x11, 0x0e, 0x06, 0x0f, 0x9a, 0x00, 0x06, 0x0f, 0x03, 0x0b, 0x0a, 0x01, 0x10,
+    0x0d, 0x83, 0x0c, 0x05, 0x0d, 0x10, 0x05, 0x02, 0x11, 0x03, 0x96, 0x00, 0x03, 0x0f, 0x08, 0x02,
+    0x01, 0x82, 0x0c, 0x87, 0x0d, 0x82, 0x0c, 0x02, 0x01, 0x07, 0x03, 0x93, 0x00, 0x03, 0x03, 0x02,
+    0x10, 0x0c, 0x8e, 0x0d, 0x04, 0x0c, 0x0c, 0x01, 0x07, 0x06, 0x8f, 0x00, 0x03, 0x0f, 0x04, 0x05,
+    0x0c, 0x92, 0x0d, 0x03, 0x0c, 0x0c, 0x05, 0x08, 0x8d, 0x00, 0x03, 0x0f, 0x0b, 0x10, 0x0c, 0x95,
+    0x0d, 0x02, 0x0c, 0x01, 0x04, 0x8b, 0x00, 0x01, 0x0f, 0x07, 0x99, 0x0d, 0x02, 0x0c, 0x10, 0x11,
+    0x89, 0x00, 0x01, 0x0f, 0x0b, 0x9b, 0x0d, 0x02, 0x0c, 0x10, 0x04, 0x88, 0x00, 0x01, 0x04, 0x10,
+    0x9c, 0x0d, 0x02, 0x0c, 0x01, 0x0e, 0x86, 0x00, 0x02, 0x03, 0x01, 0x0c, 0x8d, 0x0d, 0x01, 0x0c,
+    0x0c, 0x8c, 0x0d, 0x03, 0x0c, 0x0c, 0x0a, 0x06, 0x84, 0x00, 0x02, 0x0f, 0x02, 0x0c, 0x8e, 0x0d,
+    0x02, 0x0a, 0x0a, 0x0c, 0x8c, 0x0d, 0x02, 0x0c, 0x0c, 0x0b, 0x84, 0x00, 0x01, 0x08, 0x10, 0x8d,
+    0x0d, 0x05, 0x0c, 0x05, 0x06, 0x06, 0x02, 0x0c, 0x8c, 0x0d, 0x02, 0x0c, 0x01, 0x03, 0x82, 0x00,
+    0x02, 0x0f, 0x0a, 0x0c, 0x8d, 0x0d, 0x06, 0x0c, 0x05, 0x09, 0x12, 0x06, 0x02, 0x0c, 0x8c, 0x0d,
+    0x01, 0x0c, 0x07, 0x82, 0x00, 0x01, 0x0e, 0x10, 0x8e, 0x0d, 0x07, 0x0c, 0x05, 0x09, 0x12, 0x12,
+    0x06, 0x02, 0x0c, 0x8b, 0x0d, 0x06, 0x0c, 0x01, 0x06, 0x00, 0x00, 0x07, 0x0c, 0x8b, 0x0d, 0x83,
+    0x0c, 0x07, 0x05, 0x09, 0x03, 0x04, 0x12, 0x06, 0x02, 0x0c, 0x8c, 0x0d, 0x04, 0x04, 0x00, 0x09,
+    0x0a, 0x0c, 0x8a, 0x0d, 0x0d, 0x0c, 0x02, 0x11, 0x05, 0x0c, 0x05, 0x09, 0x03, 0x01, 0x11, 0x12,
+    0x06, 0x0a, 0x0c, 0x8a, 0x0d, 0x04, 0x0c, 0x02, 0x0f, 0x03, 0x01, 0x8c, 0x0d, 0x0c, 0x04, 0x12,
+    0x0e, 0x01, 0x05, 0x09, 0x03, 0x10, 0x0a, 0x09, 0x12, 0x07, 0x0c, 0x8a, 0x0d, 0x03, 0x0c, 0x05,
+    0x06, 0x04, 0x8c, 0x0d, 0x0d, 0x0c, 0x05, 0x0e, 0x12, 0x0e, 0x0a, 0x09, 0x03, 0x0a, 0x03, 0x12,
+    0x04, 0x01, 0x0c, 0x8b, 0x0d, 0x03, 0x01, 0x0e, 0x0b, 0x0c, 0x8c, 0x0d, 0x0b, 0x0c, 0x05, 0x0e,
+    0x12, 0x03, 0x0f, 0x09, 0x06, 0x12, 0x04, 0x01, 0x0c, 0x8c, 0x0d, 0x03, 0x10, 0x04, 0x07, 0x0c,
+    0x8d, 0x0d, 0x02, 0x0c, 0x05, 0x0e, 0x83, 0x12, 0x02, 0x04, 0x01, 0x0c, 0x8e, 0x0d, 0x02, 0x11,
+    0x02, 0x0c, 0x8e, 0x0d, 0x07, 0x0c, 0x05, 0x03, 0x12, 0x12, 0x08, 0x10, 0x0c, 0x8f, 0x0d, 0x02,
+    0x11, 0x02, 0x0c, 0x8e, 0x0d, 0x07, 0x0c, 0x0a, 0x06, 0x12, 0x12, 0x0e, 0x05, 0x0c, 0x8e, 0x0d,
+    0x03, 0x0c, 0x11, 0x07, 0x0c, 0x8d, 0x0d, 0x02, 0x0c, 0x0a, 0x03, 0x83, 0x12, 0x02, 0x0e, 0x05,
+    0x0c, 0x8e, 0x0d, 0x02, 0x11, 0x0b, 0x0c, 0x8c, 0x0d, 0x0b, 0x0c, 0x0a, 0x06, 0x12, 0x0e, 0x09,
+    0x06, 0x0e, 0x12, 0x0e, 0x05, 0x0c, 0x8c, 0x0d, 0x02, 0x10, 0x08, 0x04, 0x8c, 0x0d, 0x0d, 0x0c,
+    0x0a, 0x06, 0x12, 0x04, 0x0a, 0x09, 0x03, 0x05, 0x0e, 0x12, 0x0e, 0x05, 0x0c, 0x8a, 0x0d, 0x05,
+    0x0c, 0x01, 0x03, 0x03, 0x01, 0x0c, 0x8b, 0x0d, 0x0c, 0x04, 0x12, 0x04, 0x10, 0x05, 0x09, 0x03,
+    0x10, 0x0a, 0x09, 0x12, 0x0b, 0x0c, 0x8a, 0x0d, 0x05, 0x0c, 0x0a, 0x09, 0x09, 0x0a, 0x0c, 0x8a,
+    0x0d, 0x0d, 0x0c, 0x0a, 0x07, 0x01, 0x0c, 0x05, 0x09, 0x03, 0x05, 0x08, 0x12, 0x03, 0x05, 0x0c,
+    0x8a, 0x0d, 0x05, 0x0c, 0x07, 0x00, 0x00, 0x0b, 0x0c, 0x8b, 0x0d, 0x0b, 0x0c, 0x0c, 0x0d, 0x0c,
+    0x05, 0x09, 0x06, 0x08, 0x12, 0x03, 0x05, 0x0c, 0x8b, 0x0d, 0x06, 0x0c, 0x08, 0x00, 0x00, 0x03,
+    0x01, 0x0c, 0x8d, 0x0d, 0x07, 0x0c, 0x05, 0x09, 0x12, 0x12, 0x03, 0x05, 0x0c, 0x8b, 0x0d, 0x07,
+    0x0c, 0x05, 0x06, 0x00, 0x00, 0x0f, 0x02, 0x0c, 0x8d, 0x0d, 0x06, 0x0c, 0x05, 0x09, 0x12, 0x03,
+    0x05, 0x0c, 0x8c, 0x0d, 0x01, 0x0c, 0x0b, 0x83, 0x00, 0x01, 0x0e, 0x10, 0x8d, 0x0d, 0x05, 0x0c,
+    0x01, 0x03, 0x03, 0x05, 0x0c, 0x8c, 0x0d, 0x02, 0x0c, 0x05, 0x06, 0x83, 0x00, 0x02, 0x0f, 0x07,
+    0x0c, 0x8e, 0x0d, 0x02, 0x05, 0x01, 0x0c, 0x8e, 0x0d, 0x00, 0x11, 0x85, 0x00, 0x02, 0x06, 0x05,
+    0x0c, 0x8d, 0x0d, 0x01, 0x0c, 0x0c, 0x8d, 0x0d, 0x02, 0x0c, 0x02, 0x09, 0x86, 0x00, 0x02, 0x08,
+    0x01, 0x0c, 0x9b, 0x0d, 0x02, 0x0c, 0x05, 0x03, 0x88, 0x00, 0x02, 0x11, 0x10, 0x0c, 0x99, 0x0d,
+    0x02, 0x0c, 0x01, 0x08, 0x89, 0x00, 0x03, 0x0f, 0x11, 0x10, 0x0c, 0x97, 0x0d, 0x02, 0x0c, 0x01,
+    0x08, 0x8c, 0x00, 0x02, 0x04, 0x01, 0x0c, 0x95, 0x0d, 0x02, 0x0c, 0x05, 0x08, 0x8e, 0x00, 0x03,
+    0x0e, 0x0a, 0x0c, 0x0c, 0x91, 0x0d, 0x03, 0x0c, 0x0d, 0x02, 0x03, 0x90, 0x00, 0x04, 0x09, 0x0b,
+    0x01, 0x0c, 0x0c, 0x8d, 0x0d, 0x04, 0x0c, 0x0c, 0x05, 0x04, 0x0f, 0x93, 0x00, 0x03, 0x03, 0x0b,
+    0x05, 0x0d, 0x82, 0x0c, 0x85, 0x0d, 0x82, 0x0c, 0x03, 0x10, 0x0a, 0x11, 0x06, 0x97, 0x00, 0x0f,
+    0x06, 0x08, 0x07, 0x0a, 0x01, 0x10, 0x10, 0x0d, 0x0d, 0x10, 0x10, 0x05, 0x0a, 0x0b, 0x08, 0x09,
+    0x9c, 0x00, 0x02, 0x09, 0x03, 0x0e, 0x82, 0x04, 0x03, 0x08, 0x0e, 0x06, 0x0f, 0x8f, 0x00,
+};
 
-static const uint16_t image_data_compass[1806] = {
-    // ███████████████████▓▓▓▓███████████████████
-    // ███████████████▓▒▒▒▒▒▒▒▒▒▒▓▓██████████████
+// 42x42, 604 B (raw 3528 B)
+static const uint8_t image_data_backtrack[604] = {
+    // ██████████████████████████████████████████
+    // ███████████████▓▒▒▒▒▒▒▒▒▒▒▓███████████████
     // ████████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓████████████
     // ██████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██████████
-    // █████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
-    // ████████▒▒▒▒▒▒▒▒▒▒▒▒█▓▓▒▒▒▒▒▒▒▒▒▒▒████████
-    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▓██▓▒▒▒▒▒▒▒▒▒▒▒▒███████
-    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // █████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█████████
+    // ████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
     // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
-    // ████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓████
-    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
-    // ███▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
-    // ███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
-    // ██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██
-    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
-    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
-    // █▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
-    // █▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
-    // █▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██▓█▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
-    // █▓▒▒▒▓▓▓▓▒▒▒▒▒▒▒▒▒█▓▓▓▓█▒▒▒▒▒▒▒▒▒▒▓█▓▒▒▒▒█
-    // █▒▒▒▒▓███▒▒▒▒▒▒▒▒▒█▓██▓█▒▒▒▒▒▒▒▒▒▒▓█▒▒▒▒▒█
-    // █▒▒▒▒▒▓▓▓▒▒▒▒▒▒▒▒▓█▓██▓█▒▒▒▒▒▒▒▒▒▒▓▓▓▒▒▒▒█
-    // █▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███▓▓█▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
-    // █▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
-    // █▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
-    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▓███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
-    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
-    // ██▓▒▒▒▒▒▒▒▒▒▒▒██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██
-    // ███▒▒▒▒▒▒▒▒▒▒▓▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
-    // ███▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
-    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
-    // ████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓████
+    // ████▓▒▒▒▒▒▒▒▒▒▒▒▒▒░    ░▒▒▒▒▒▒▒▒▒▒▒▒▒▓████
+    // ███▓▒▒▒▒▒▒▒▒▒▒▒▒░        ░▒▒▒▒▒▒▒▒▒▒▒▒▓███
+    // ███▒▒▒▒▒▒▒▒▒▒▒▒░          ░▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ██▓▒▒▒▒▒▒▒▒▒▒▒░            ░▒▒▒▒▒▒▒▒▒▒▒▓██
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒     ▒▒▒▒     ▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒▒░    ▒▒▒▒▒▒    ░▒▒▒▒▒▒▒▒▒▒▒██
+    // █▓▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▓█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒░          ░▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒          ▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒        ▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒░      ░▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒░    ░▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▓▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▓█
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▓██
+    // ███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒███
+    // ███▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▓███
+    // ████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒▒▒▓████
     // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
-    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
-    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒█▓▒▒▒▒▒▒▒▒▒▒▒▒▒███████
-    // ████████▒▒▒▒▒▒▒▒▒▒▒▒▓█▓▒▒▒▒▒▒▒▒▒▒▒████████
-    // █████████▓▒▒▒▒▒▒▒▒▒▒▓▓▒▒▒▒▒▒▒▒▒▒▒█████████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // ████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████
+    // █████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█████████
     // ██████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██████████
     // ████████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓████████████
-    // ███████████████▓▒▒▒▒▒▒▒▒▒▒▓▓██████████████
-    // ███████████████████▓▓▓▓███████████████████
-    // ██████████████████████████████████████████
-    // ██████████████████████████████████████████
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffbf, 0x7d9f, 0x1b8f, 0xda86, 0xfb86, 0xfb86, 0x7d9f, 0xdfaf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3dbf, 0xf885, 0x5665, 0x144d, 0xf33c, 0x133d, 0xd33c, 0xf33c, 0xf33c, 0xd33c, 0xf44c, 0x555d, 0xd77d, 0xbba6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9a96, 0x5455, 0xd23c, 0xf33c, 0xf434, 0x5535, 0x542d, 0x7535, 0x7535, 0x3435, 0x553d, 0x3535, 0x3535, 0x353d, 0x143d, 0xd334, 0x344d, 0x9986, 0xdfc7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdbae, 0x345d, 0xf234, 0x5435, 0x542d, 0x542d, 0x7535, 0x3425, 0x952d, 0x5425, 0x142d, 0x3535, 0x352d, 0x5535, 0x5635, 0x552d, 0x552d, 0x9535, 0x5435, 0x922c, 0x344d, 0xdb96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1776, 0xd23c, 0x3435, 0x742d, 0x7425, 0x952d, 0x752d, 0x752d, 0x752d, 0x342d, 0xb645, 0x553d, 0x5545, 0x753d, 0x342d, 0x552d, 0x3525, 0x552d, 0x7535, 0x7535, 0x7535, 0x343d, 0xb234, 0xb665, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9fc7, 0x3455, 0x343d, 0x142d, 0x552d, 0x952d, 0x7525, 0x3425, 0x542d, 0x5425, 0x742d, 0x5435, 0x964d, 0xbf9f, 0x9a76, 0x5966, 0x142d, 0x342d, 0xb635, 0x7635, 0x552d, 0x7535, 0x7535, 0x342d, 0x553d, 0xd22c, 0x144d, 0x9ec7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdfc7, 0x3455, 0x1335, 0x5535, 0x752d, 0x762d, 0x552d, 0x352d, 0x352d, 0x552d, 0x9535, 0x742d, 0xf234, 0xd75d, 0x9ea7, 0xffb7, 0xf75d, 0x3335, 0x9535, 0x5425, 0x5425, 0x552d, 0x752d, 0x552d, 0x5535, 0x5535, 0xb63d, 0xf334, 0xb244, 0xbebf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3355, 0x1335, 0x5535, 0x552d, 0x562d, 0x562d, 0x352d, 0x5535, 0x5535, 0x342d, 0x542d, 0x7435, 0xf334, 0xd65d, 0xb665, 0xd765, 0x175e, 0x132d, 0x742d, 0x952d, 0x752d, 0x752d, 0x752d, 0x542d, 0x342d, 0x552d, 0x5525, 0x7535, 0x5445, 0x9144, 0xbec7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7565, 0x3335, 0x7435, 0x5535, 0x3535, 0x3635, 0x3535, 0x3535, 0x552d, 0x542d, 0x752d, 0x552d, 0x552d, 0x5535, 0x3435, 0x1435, 0x1335, 0x3435, 0x542d, 0x742d, 0x742d, 0x552d, 0x752d, 0x752d, 0x5425, 0x552d, 0x752d, 0x5525, 0x752d, 0x5435, 0xf334, 0x545d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x7996, 0x1345, 0x542d, 0x7425, 0x5535, 0x3535, 0x3535, 0x3535, 0x552d, 0x552d, 0x742d, 0x752d, 0x552d, 0x552d, 0x552d, 0x552d, 0x5435, 0x342d, 0x542d, 0x542d, 0x752d, 0x552d, 0x552d, 0x552d, 0x752d, 0x752d, 0x552d, 0x552d, 0x762d, 0x5525, 0x552d, 0x543d, 0xf23c, 0xf67d, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x7ecf, 0xf34c, 0x1335, 0x9535, 0x542d, 0x5535, 0x5535, 0x552d, 0x552d, 0x552d, 0x542d, 0x542d, 0x552d, 0x562d, 0x562d, 0x552d, 0x552d, 0x5535, 0x5535, 0x552d, 0x552d, 0x752d, 0x752d, 0x552d, 0x552d, 0x552d, 0x552d, 0x5535, 0x3535, 0x562d, 0x762d, 0x352d, 0x753d, 0x3335, 0xb13c, 0x3cbf, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xf785, 0xf33c, 0x7535, 0x7535, 0x552d, 0x552d, 0x552d, 0x752d, 0x742d, 0x542d, 0x542d, 0x542d, 0x552d, 0x562d, 0x552d, 0x552d, 0x552d, 0x5535, 0x5535, 0x552d, 0x552d, 0x552d, 0x752d, 0x7535, 0x3535, 0x352d, 0x352d, 0x5535, 0x5535, 0x552d, 0x5635, 0x3535, 0x3435, 0x9535, 0x333d, 0x756d, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xdebf, 0xd244, 0x5435, 0x752d, 0x552d, 0x752d, 0x7525, 0x7525, 0x542d, 0x542d, 0x542d, 0x542d, 0x5535, 0x3535, 0x3535, 0x552d, 0x552d, 0x552d, 0x542d, 0x542d, 0x752d, 0x752d, 0x752d, 0x552d, 0x3535, 0x1435, 0x342d, 0x542d, 0x5535, 0x542d, 0x7535, 0x342d, 0x553d, 0x5535, 0x342d, 0x953d, 0xd23c, 0x5db7, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x9986, 0xd234, 0x552d, 0x762d, 0x552d, 0x552d, 0x5525, 0x742d, 0x542d, 0x542d, 0x542d, 0x552d, 0x552d, 0x3535, 0x3535, 0x5535, 0x552d, 0x542d, 0x542d, 0x542d, 0x742d, 0x752d, 0x752d, 0x352d, 0x142d, 0x142d, 0x552d, 0x7535, 0x752d, 0x542d, 0x752d, 0x7535, 0x3535, 0x5535, 0x552d, 0x752d, 0xf334, 0xf775, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x545d, 0x343d, 0x3535, 0x7635, 0x5635, 0x352d, 0x352d, 0x542d, 0x542d, 0x542d, 0x552d, 0x552d, 0x562d, 0x562d, 0x5535, 0x5535, 0x742d, 0x752d, 0x552d, 0x552d, 0x552d, 0x5535, 0x352d, 0x142d, 0x1425, 0x3425, 0x7525, 0x752d, 0x552d, 0x542d, 0x542d, 0x9535, 0x352d, 0x552d, 0x7635, 0x752d, 0x542d, 0x1445, 0xbfd7, 0x0000, 
-    0x0000, 0x7dc7, 0xf24c, 0x543d, 0x352d, 0x352d, 0x352d, 0x562d, 0x5535, 0x5435, 0x542d, 0x742d, 0x752d, 0x752d, 0x562d, 0x552d, 0x5535, 0x5435, 0x542d, 0x752d, 0x7535, 0x5535, 0x5535, 0x342d, 0xf424, 0xf424, 0x1425, 0x552d, 0x7525, 0x5525, 0x552d, 0x5535, 0x7535, 0x342d, 0x752d, 0x552d, 0x3525, 0x762d, 0x952d, 0xf334, 0x1db7, 0x0000, 
-    0x0000, 0xbaae, 0xd23c, 0x5435, 0x342d, 0x9635, 0x3525, 0x7535, 0x342d, 0x752d, 0x7535, 0x342d, 0x952d, 0x3425, 0x542d, 0x5535, 0x552d, 0x542d, 0x5535, 0x5435, 0xf32c, 0xf32c, 0xf32c, 0xf32c, 0xf324, 0x1425, 0x352d, 0x5535, 0x752d, 0x5525, 0x552d, 0x752d, 0x552d, 0x552d, 0x542d, 0x742d, 0x752d, 0x752d, 0x7535, 0xd334, 0x398e, 0x0000, 
-    0x0000, 0x188e, 0xd234, 0x7435, 0x9535, 0x3425, 0x7535, 0x342d, 0x5535, 0xf324, 0x7535, 0x752d, 0x7525, 0x752d, 0x342d, 0x342d, 0x342d, 0x7535, 0xf434, 0xf43c, 0x796e, 0x796e, 0xf33c, 0xf334, 0x132d, 0x342d, 0x342d, 0x352d, 0x552d, 0x752d, 0x752d, 0x552d, 0x552d, 0x5535, 0x1335, 0x132d, 0x7435, 0x542d, 0x552d, 0x143d, 0xd775, 0x0000, 
-    0x0000, 0xd775, 0xd234, 0x5435, 0x5535, 0x963d, 0x1435, 0x553d, 0x753d, 0x953d, 0x5435, 0x542d, 0x552d, 0x752d, 0x7535, 0x542d, 0x9635, 0x142d, 0x765d, 0xbfb7, 0x3c9f, 0x1c9f, 0xdfb7, 0x5455, 0xd22c, 0x342d, 0x5535, 0x5535, 0x552d, 0x552d, 0x552d, 0x552d, 0x352d, 0x5535, 0x3545, 0x964d, 0x753d, 0x9535, 0x7535, 0xf434, 0x7565, 0x0000, 
-    0x0000, 0xd66d, 0xf334, 0x7535, 0x1435, 0x7a66, 0x9a76, 0xfc86, 0x796e, 0xb64d, 0x3435, 0x542d, 0x752d, 0x5525, 0x752d, 0x7535, 0x3425, 0xf434, 0x7ea7, 0x7a9e, 0xf78d, 0x5996, 0x588e, 0x9da7, 0xf234, 0x542d, 0x7535, 0x5635, 0x352d, 0x352d, 0x552d, 0x552d, 0x9535, 0xf32c, 0xd765, 0x9e9f, 0x185e, 0x5535, 0x342d, 0x3435, 0x555d, 0x0000, 
-    0x0000, 0x966d, 0x1435, 0x953d, 0xf434, 0xf865, 0xffb7, 0x7eaf, 0x7ea7, 0xf344, 0x343d, 0x7535, 0x552d, 0x752d, 0x552d, 0x552d, 0x7535, 0x343d, 0xdfaf, 0xb785, 0xffff, 0xffff, 0xd67d, 0xbda7, 0x7545, 0x7535, 0x552d, 0x352d, 0x552d, 0x5535, 0x5435, 0x5435, 0x542d, 0x142d, 0x3976, 0xbfa7, 0x964d, 0x1435, 0x7635, 0x3435, 0x555d, 0x0000, 
-    0x0000, 0x766d, 0x1335, 0x5535, 0x1435, 0x3545, 0x9b86, 0xd875, 0x7a7e, 0xd23c, 0x543d, 0x5535, 0x552d, 0x752d, 0x752d, 0x3435, 0xd234, 0x9986, 0xffff, 0x557d, 0xdbbe, 0x3cc7, 0xb675, 0xffaf, 0x543d, 0x552d, 0x552d, 0x552d, 0x552d, 0x542d, 0x3435, 0x542d, 0x752d, 0xf32c, 0xd765, 0x1c8f, 0x395e, 0x553d, 0x7535, 0x1435, 0x7565, 0x0000, 
-    0x0000, 0xd77d, 0xd334, 0x5535, 0x5535, 0x553d, 0x143d, 0x143d, 0x3335, 0x7435, 0x5435, 0x342d, 0x552d, 0x3425, 0x9535, 0x1335, 0xf354, 0xdfcf, 0xffff, 0x9edf, 0xb695, 0x3896, 0xffbf, 0x596e, 0xf32c, 0x552d, 0x5635, 0x7635, 0x552d, 0x542d, 0x532d, 0x542d, 0x752d, 0x542d, 0x343d, 0x343d, 0x553d, 0x5535, 0x7535, 0xf334, 0x966d, 0x0000, 
-    0x0000, 0x188e, 0xd234, 0x7535, 0x552d, 0x352d, 0x552d, 0x752d, 0x742d, 0x742d, 0x542d, 0x5535, 0x552d, 0x552d, 0x542d, 0xf234, 0x999e, 0xffff, 0xffff, 0xffff, 0xffff, 0x3ca7, 0xd76d, 0xf33c, 0x5535, 0x762d, 0x5635, 0x352d, 0x542d, 0x742d, 0x742d, 0x732d, 0x5425, 0x542d, 0x5435, 0x5535, 0x5535, 0x552d, 0x552d, 0x143d, 0xb67d, 0x0000, 
-    0x0000, 0x9a9e, 0xf234, 0x742d, 0x3525, 0x762d, 0x552d, 0x552d, 0x7525, 0x742d, 0x552d, 0x142d, 0x7535, 0x542d, 0x3335, 0x544d, 0xffff, 0xffff, 0xffff, 0xffff, 0xd76d, 0xb23c, 0xf43c, 0x353d, 0x552d, 0x552d, 0x552d, 0x552d, 0x542d, 0x742d, 0x742d, 0x742d, 0x542d, 0x952d, 0x342d, 0x342d, 0x7635, 0x342d, 0x7535, 0xd334, 0x5996, 0x0000, 
-    0x0000, 0xbec7, 0x123d, 0x532d, 0x752d, 0x762d, 0x3525, 0x762d, 0x952d, 0x552d, 0x5535, 0x7535, 0x342d, 0x5435, 0xd234, 0xfb96, 0xffff, 0xffff, 0x3cb7, 0xf354, 0xb234, 0x553d, 0x3435, 0x552d, 0x552d, 0x552d, 0x552d, 0x542d, 0x542d, 0x552d, 0x552d, 0x552d, 0x752d, 0x3425, 0x752d, 0x552d, 0x352d, 0x7635, 0x542d, 0x133d, 0x1cb7, 0x0000, 
-    0x0000, 0x0000, 0x5455, 0x5335, 0x752d, 0x562d, 0x562d, 0x5635, 0x552d, 0x352d, 0x552d, 0x352d, 0x7535, 0x143d, 0x5665, 0xffff, 0xffff, 0x5886, 0xd23c, 0x343d, 0x953d, 0x752d, 0x952d, 0x7425, 0x752d, 0x542d, 0x5435, 0x542d, 0x552d, 0x552d, 0x552d, 0x552d, 0x552d, 0x542d, 0x7535, 0x542d, 0x5535, 0x5535, 0x7535, 0x1345, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x7886, 0xf234, 0x7535, 0x352d, 0x7635, 0x352d, 0x5635, 0x5635, 0x552d, 0x9635, 0x142d, 0x922c, 0xbfb7, 0xffc7, 0x9665, 0xd33c, 0x5435, 0x7535, 0x3425, 0x7525, 0x5425, 0x5425, 0x742d, 0x542d, 0x5435, 0x5435, 0x552d, 0x552d, 0x362d, 0x362d, 0x352d, 0x552d, 0x5535, 0x3535, 0x5535, 0x3535, 0x133d, 0xd66d, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xdebf, 0xb244, 0x5545, 0x3535, 0x5535, 0x552d, 0x552d, 0x7535, 0x552d, 0x752d, 0x342d, 0x395e, 0x5d8f, 0xf344, 0xf33c, 0x5545, 0x343d, 0x753d, 0x952d, 0x5425, 0x7535, 0x5535, 0x542d, 0x542d, 0x5435, 0x3435, 0x552d, 0x552d, 0x562d, 0x562d, 0x552d, 0x352d, 0x5535, 0x5535, 0x3435, 0x5545, 0xb23c, 0x7db7, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xd77d, 0x923c, 0x753d, 0x542d, 0x752d, 0x9535, 0x3425, 0x752d, 0x552d, 0x5535, 0x9645, 0xd32c, 0x553d, 0x5535, 0x3435, 0x553d, 0x3535, 0x5425, 0x752d, 0x342d, 0x5535, 0x552d, 0x542d, 0x3435, 0x5535, 0x552d, 0x552d, 0x552d, 0x552d, 0x7535, 0x352d, 0x7535, 0x5535, 0x5535, 0xd334, 0x766d, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x9fcf, 0xf44c, 0x5435, 0x742d, 0x7425, 0x742d, 0x9535, 0x752d, 0x752d, 0x7535, 0x342d, 0x7535, 0x5425, 0x3425, 0x9535, 0x342d, 0x3425, 0x952d, 0x752d, 0x552d, 0x352d, 0x752d, 0x552d, 0x5535, 0x3535, 0x552d, 0x542d, 0x742d, 0x542d, 0x5535, 0x5535, 0x752d, 0x752d, 0x7535, 0xf33c, 0x1db7, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x598e, 0xd234, 0x7435, 0x942d, 0x742d, 0x542d, 0x542d, 0x552d, 0x3535, 0x7635, 0x5425, 0x7525, 0x752d, 0x552d, 0x752d, 0x752d, 0x552d, 0x552d, 0x752d, 0x752d, 0x752d, 0x552d, 0x3535, 0x5535, 0x552d, 0x542d, 0x742d, 0x742d, 0x552d, 0x552d, 0x5425, 0xb63d, 0xf334, 0xf875, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x766d, 0x3445, 0x5435, 0x752d, 0x552d, 0x552d, 0x5535, 0x3535, 0x5535, 0x752d, 0x5425, 0x552d, 0x542d, 0x542d, 0x7535, 0xf434, 0x1435, 0x542d, 0x7525, 0x952d, 0x7535, 0x3535, 0x352d, 0x7535, 0x752d, 0x5425, 0x752d, 0x9625, 0x341d, 0x7535, 0x133d, 0x135d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb34c, 0x343d, 0x7535, 0x5425, 0x552d, 0x7635, 0x5535, 0x352d, 0x752d, 0x752d, 0x342d, 0x9535, 0x542d, 0x3435, 0x7a6e, 0x9b76, 0x5535, 0x542d, 0x1325, 0x542d, 0x7535, 0x5535, 0x542d, 0x552d, 0x752d, 0x752d, 0x7525, 0x752d, 0x343d, 0xd24c, 0xbecf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdfc7, 0x5455, 0x132d, 0xb535, 0x952d, 0x3425, 0x5535, 0x5535, 0x3425, 0x752d, 0x542d, 0x342d, 0x5435, 0x3435, 0x5e97, 0xfc8e, 0x343d, 0x5435, 0x7535, 0x953d, 0x5535, 0x342d, 0x742d, 0x752d, 0x5435, 0x3435, 0x753d, 0xf33c, 0xd34c, 0x3caf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbebf, 0x5455, 0x1235, 0x532d, 0xb535, 0x752d, 0x552d, 0x7635, 0x552d, 0x552d, 0x7535, 0x5535, 0x3535, 0xf865, 0xbf9f, 0x395e, 0xf32c, 0x342d, 0x542d, 0x542d, 0x752d, 0x952d, 0x542d, 0x142d, 0x5545, 0xb23c, 0xf354, 0x7dbf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf785, 0xd23c, 0x132d, 0x742d, 0x952d, 0x7535, 0x3535, 0x342d, 0x752d, 0x552d, 0x352d, 0x5a5e, 0x395e, 0x5535, 0x552d, 0x9635, 0x552d, 0x752d, 0x752d, 0x542d, 0x7535, 0x553d, 0x923c, 0x756d, 0xdecf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ba7, 0x5455, 0xf22c, 0x3335, 0x3435, 0x553d, 0x5535, 0x7535, 0x7525, 0x552d, 0x142d, 0xf42c, 0x352d, 0x9635, 0x5525, 0x9535, 0x552d, 0x5535, 0x553d, 0xb234, 0xf44c, 0x7a96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xba9e, 0x555d, 0xf33c, 0xf334, 0x3435, 0x5435, 0x9535, 0x542d, 0x963d, 0x5535, 0x9635, 0x3425, 0x752d, 0x342d, 0x3435, 0xf334, 0xf344, 0x1986, 0x9fd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ca7, 0x1776, 0x3455, 0xf344, 0xd234, 0xf33c, 0x9234, 0xd33c, 0xb334, 0xd33c, 0xd33c, 0x544d, 0xf76d, 0xfb96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbecf, 0x3cb7, 0xdba6, 0x9a9e, 0x799e, 0x9bae, 0xfcb6, 0x7ecf, 0xdfdf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-static const uint16_t image_data_targetresize[1764] = {
-    // ██████████████████████████████████████████
-    // █████████████████▓▓▓▓▓▓▓██████████████████
-    // ██████████████▓▒▒▒░░░░░░▒▒▒▓██████████████
-    // ████████████▓▒░░░░░░░░░░░░░░▒▓████████████
-    // ██████████▓▒░░░░░░░░░░░░░░░░░░▒▓██████████
-    // █████████▒░░░░░░░░░░░░░░░░░░░░░▒▓█████████
-    // ████████▒░░░░░░░▒▒▓▓▓▓▓▓▒▒░░░░░░░▒████████
-    // ███████▒░░░░░░▒▓██████████▓▒░░░░░░▒███████
-    // ██████▒░░░░░▒▓██████████████▓▒░░░░░▓██████
-    // █████▒░░░░░▒████▓▓▒▒▒▒▒▒▓████▓▒░░░░░▓█████
-    // ████▓░░░░░▒███▓▒▒░░░░░░░░▒▒████▒░░░░▒█████
-    // ████▒░░░░▒███▓▒░░░░▒▒▒▒░░░░▒▓██▓▒░░░░▒████
-    // ███▓░░░░▒███▓░░░▒▓▓████▓▒▒░░▒▓██▓░░░░▒▓███
-    // ███▒░░░░▓██▓░░░▒█████████▓▒░░▒▓██▒░░░░▓███
-    // ██▓▒░░░▒██▓▒░░▓████▓▓▓▓████▒░░▒██▓▒░░░▒███
-    // ██▓░░░░▓██▒░░▒███▓▒░░░░▒▓███▒░░▓██▒░░░░▓██
-    // ██▒░░░▒███▒░▒███▒░░░░░░░░▓██▓░░▒██▓░░░░▓██
-    // ██▒░░░▒██▓░░▒██▓░░░░░░░░░▒▓██▒░░▓██▒░░░▒██
-    // ██▒░░░▒██▒░░▓██▒░░░░░░░░░░▒██▓░░▓██▒░░░▒██
-    // █▓░░░░▓██▒░▒██▓░░░░░░░░░░░▒██▓░░▒██▒░░░▒██
-    // █▓░░░░▓██▒░▒██▓░░░░░░░░░░░░▓█▓░░▒██▒░░░▒██
-    // █▓░░░░▓██▒░▒██▓░░░░░░░░░░░▒██▓░░▒██▒░░░▒██
-    // █▓░░░░▓██▒░▒██▓░░░░░░░░░░░▒██▓░░▓██▒░░░▒██
-    // ██▒░░░▒██▒░░▓██▒░░░░░░░░░░▒██▒░░▓██▒░░░▒██
-    // ██▒░░░▒██▓░░▒██▓░░░░░░░░░▒███▒░▒██▓▒░░░▒██
-    // ██▒░░░▒▓██▒░▒▓██▓▒░░░░░░▒▓██▓░░▒██▓░░░░▓██
-    // ██▓░░░░▒██▓░░▒███▓▒▒░░▒▒███▓▒░░▓██▒░░░▒▓██
-    // ███▒░░░▒███▒░░▒█████▓▓████▓▒░░▒██▓░░░░▒███
-    // ███▒░░░░▒██▓▒░░▒▓████████▓▒░░▒███▒░░░░▓███
-    // ███▓░░░░▒▓██▓▒░░░▒▓▓▓▓▓▓▒░░░▒███▓░░░░▒████
-    // ████▒░░░░▒▓██▓▒░░░░░▒▒░░░░░▒███▓▒░░░░▓████
-    // █████▒░░░░▒▓███▓▒░░░░░░░▒▒▓███▓▒░░░░▒█████
-    // █████▓░░░░░▒▓████▓▓▒▒▒▒▓▓████▓▒░░░░▒▓█████
-    // ██████▓░░░░░░▒█████████████▓▒░░░░░▒▓██████
-    // ███████▒░░░░░░▒▒▓████████▓▒▒░░░░░░▓███████
-    // ████████▓░░░░░░░░▒▒▒▒▒▒▒▒░░░░░░░▒▓████████
-    // █████████▓▒░░░░░░░░░░░░░░░░░░░░▒▓█████████
-    // ███████████▒▒░░░░░░░░░░░░░░░░▒▓███████████
-    // ████████████▓▒▒░░░░░░░░░░░░▒▓█████████████
-    // ███████████████▓▒▒▒▒░░▒▒▒▒▓███████████████
-    // ████████████████████▓▓████████████████████
+    // ███████████████▓▒▒▒▒▒▒▒▒▒▒▓███████████████
     // ██████████████████████████████████████████
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbff7, 0x5ed7, 0xbdb6, 0x3c9e, 0xbb7d, 0xbb7d, 0xbb7d, 0xfc8d, 0x3c9e, 0xddbe, 0x9fe7, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x5ed7, 0xfc8d, 0xfa4c, 0x792c, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0x792c, 0x1a5d, 0x3c9e, 0x9fe7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ecf, 0x7b6d, 0x792c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x993c, 0xfc8d, 0x9fe7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbff7, 0xfc8d, 0x792c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x993c, 0x7da6, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5ed7, 0x1a5d, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0xbb7d, 0xbff7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ecf, 0x993c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0xfa4c, 0x7b6d, 0xfc8d, 0x3c9e, 0x3c9e, 0xfc8d, 0x7b6d, 0x993c, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x1a5d, 0x9fe7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ecf, 0x993c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x993c, 0xfc8d, 0x1ecf, 0xbff7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbff7, 0xddbe, 0xbb7d, 0x792c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x1a5d, 0x9fe7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5ed7, 0x993c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0xfc8d, 0x9fe7, 0xffff, 0xffff, 0xffff, 0x9fe7, 0x5ed7, 0x1ecf, 0x1ecf, 0x5ed7, 0xbff7, 0xffff, 0xffff, 0xffff, 0x5ed7, 0x7b6d, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x7b6d, 0xbff7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xbff7, 0x1a5d, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x993c, 0xddbe, 0xffff, 0xffff, 0x9fe7, 0x7da6, 0x7b6d, 0x993c, 0x3824, 0x3824, 0x3824, 0x792c, 0x993c, 0xbb7d, 0xddbe, 0xbff7, 0xffff, 0xffff, 0x7da6, 0x792c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xfc8d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x3c9e, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xfa4c, 0x5ed7, 0xffff, 0xffff, 0x7da6, 0xfa4c, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0x1a5d, 0x1ecf, 0xffff, 0xffff, 0xddbe, 0x792c, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0x1ecf, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x5ed7, 0x993c, 0xf813, 0xf813, 0xf813, 0xf813, 0x993c, 0x5ed7, 0xffff, 0xbff7, 0xbb7d, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0x792c, 0x792c, 0x3824, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0x3c9e, 0xffff, 0xffff, 0xbdb6, 0x3824, 0xf813, 0xf813, 0xf813, 0xf813, 0x1a5d, 0xffff, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xfc8d, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0xddbe, 0xffff, 0xbff7, 0x7b6d, 0xf813, 0xf813, 0xf813, 0x3824, 0x7b6d, 0x7da6, 0x5ed7, 0x9fe7, 0x9fe7, 0x1ecf, 0x3c9e, 0x1a5d, 0x181c, 0xf813, 0xf813, 0x181c, 0xfc8d, 0xffff, 0xffff, 0xfc8d, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0xbdb6, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x9fe7, 0x993c, 0xf813, 0xf813, 0xf813, 0xf813, 0xbb7d, 0xffff, 0xffff, 0xbb7d, 0xf813, 0xf813, 0xf813, 0xfa4c, 0xddbe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbff7, 0x7da6, 0x993c, 0xf813, 0xf813, 0x3824, 0x7da6, 0xffff, 0xbff7, 0xfa4c, 0xf813, 0xf813, 0xf813, 0xf813, 0x7b6d, 0xffff, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x7da6, 0x181c, 0xf813, 0xf813, 0xf813, 0x792c, 0x5ed7, 0xffff, 0xbdb6, 0x3824, 0xf813, 0xf813, 0x7b6d, 0x9fe7, 0xffff, 0xffff, 0x1ecf, 0xfc8d, 0xbb7d, 0xbb7d, 0x3c9e, 0x5ed7, 0xffff, 0xffff, 0x1ecf, 0x993c, 0xf813, 0xf813, 0x993c, 0x5ed7, 0xffff, 0xbdb6, 0x181c, 0xf813, 0xf813, 0xf813, 0x792c, 0x5ed7, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x7b6d, 0xf813, 0xf813, 0xf813, 0xf813, 0xbb7d, 0xffff, 0xbff7, 0xfa4c, 0xf813, 0xf813, 0xfa4c, 0x9fe7, 0xffff, 0x9fe7, 0x7b6d, 0x3824, 0xf813, 0xf813, 0xf813, 0xf813, 0x792c, 0xfc8d, 0xbff7, 0xffff, 0x1ecf, 0x792c, 0xf813, 0xf813, 0xbb7d, 0xffff, 0xbff7, 0xfa4c, 0xf813, 0xf813, 0xf813, 0xf813, 0x7da6, 0x0000, 0x0000, 
-    0x0000, 0xbff7, 0x993c, 0xf813, 0xf813, 0xf813, 0x181c, 0xddbe, 0xffff, 0xddbe, 0x181c, 0xf813, 0x3824, 0xddbe, 0xffff, 0x9fe7, 0xfa4c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xbb7d, 0xffff, 0xffff, 0xfc8d, 0xf813, 0xf813, 0x993c, 0x9fe7, 0xffff, 0xfc8d, 0xf813, 0xf813, 0xf813, 0xf813, 0x7b6d, 0x0000, 0x0000, 
-    0x0000, 0x5ed7, 0x3824, 0xf813, 0xf813, 0xf813, 0x993c, 0x9fe7, 0xffff, 0xbb7d, 0xf813, 0xf813, 0x1a5d, 0xffff, 0xffff, 0xbb7d, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0x7da6, 0xffff, 0x9fe7, 0x792c, 0xf813, 0xf813, 0x7da6, 0xffff, 0xddbe, 0x181c, 0xf813, 0xf813, 0xf813, 0xfa4c, 0xbff7, 0x0000, 
-    0x0000, 0xddbe, 0x181c, 0xf813, 0xf813, 0xf813, 0x1a5d, 0xffff, 0xbff7, 0xfa4c, 0xf813, 0xf813, 0x3c9e, 0xffff, 0x1ecf, 0x3824, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xfa4c, 0xbff7, 0xffff, 0x7b6d, 0xf813, 0xf813, 0xbb7d, 0xffff, 0x9fe7, 0x792c, 0xf813, 0xf813, 0xf813, 0x792c, 0x9fe7, 0x0000, 
-    0x0000, 0x7da6, 0xf813, 0xf813, 0xf813, 0xf813, 0x7b6d, 0xffff, 0x9fe7, 0x792c, 0xf813, 0x3824, 0x1ecf, 0xffff, 0x3c9e, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0x1ecf, 0xffff, 0x3c9e, 0xf813, 0xf813, 0x1a5d, 0xffff, 0xbff7, 0x993c, 0xf813, 0xf813, 0xf813, 0x3824, 0x5ed7, 0x0000, 
-    0x0000, 0x3c9e, 0xf813, 0xf813, 0xf813, 0xf813, 0xbb7d, 0xffff, 0x5ed7, 0x792c, 0xf813, 0x3824, 0x5ed7, 0xffff, 0xbb7d, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xbdb6, 0xffff, 0x7da6, 0xf813, 0xf813, 0xfa4c, 0xffff, 0xbff7, 0xfa4c, 0xf813, 0xf813, 0xf813, 0x3824, 0x1ecf, 0x0000, 
-    0x0000, 0x7da6, 0xf813, 0xf813, 0xf813, 0xf813, 0xbb7d, 0xffff, 0x5ed7, 0x792c, 0xf813, 0x3824, 0x5ed7, 0xffff, 0xfc8d, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0xddbe, 0xffff, 0x7da6, 0xf813, 0xf813, 0xfa4c, 0xffff, 0xbff7, 0xfa4c, 0xf813, 0xf813, 0xf813, 0x3824, 0x1ecf, 0x0000, 
-    0x0000, 0xbdb6, 0xf813, 0xf813, 0xf813, 0xf813, 0x7b6d, 0xffff, 0x9fe7, 0x993c, 0xf813, 0x181c, 0xddbe, 0xffff, 0x7da6, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x792c, 0x5ed7, 0xffff, 0xfc8d, 0xf813, 0xf813, 0x7b6d, 0xffff, 0x9fe7, 0x993c, 0xf813, 0xf813, 0xf813, 0x792c, 0x5ed7, 0x0000, 
-    0x0000, 0xddbe, 0x181c, 0xf813, 0xf813, 0xf813, 0xfa4c, 0xbff7, 0xffff, 0x1a5d, 0xf813, 0xf813, 0xfc8d, 0xffff, 0x9fe7, 0x993c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x1a5d, 0xffff, 0xffff, 0x1a5d, 0xf813, 0xf813, 0xfc8d, 0xffff, 0x5ed7, 0x792c, 0xf813, 0xf813, 0xf813, 0x993c, 0x9fe7, 0x0000, 
-    0x0000, 0x5ed7, 0x792c, 0xf813, 0xf813, 0xf813, 0x792c, 0x5ed7, 0xffff, 0xfc8d, 0xf813, 0xf813, 0xfa4c, 0xbff7, 0xffff, 0x3c9e, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0xddbe, 0xffff, 0x1ecf, 0x3824, 0xf813, 0x181c, 0xddbe, 0xffff, 0xbdb6, 0x181c, 0xf813, 0xf813, 0xf813, 0xfa4c, 0xffff, 0x0000, 
-    0x0000, 0xbff7, 0xfa4c, 0xf813, 0xf813, 0xf813, 0x181c, 0x7da6, 0xffff, 0x1ecf, 0x3824, 0xf813, 0x181c, 0x3c9e, 0xffff, 0xffff, 0xbb7d, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0x7da6, 0xffff, 0xffff, 0x7b6d, 0xf813, 0xf813, 0xfa4c, 0xbff7, 0xffff, 0xbb7d, 0xf813, 0xf813, 0xf813, 0xf813, 0xbb7d, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xbb7d, 0xf813, 0xf813, 0xf813, 0xf813, 0x1a5d, 0xffff, 0xffff, 0x7b6d, 0xf813, 0xf813, 0x792c, 0x1ecf, 0xffff, 0xffff, 0x7da6, 0xfa4c, 0x181c, 0xf813, 0xf813, 0x3824, 0x1a5d, 0xddbe, 0xffff, 0xffff, 0x7da6, 0x181c, 0xf813, 0xf813, 0x3c9e, 0xffff, 0x9fe7, 0x993c, 0xf813, 0xf813, 0xf813, 0x181c, 0xbdb6, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xddbe, 0x181c, 0xf813, 0xf813, 0xf813, 0x3824, 0xddbe, 0xffff, 0x5ed7, 0x792c, 0xf813, 0xf813, 0x993c, 0xddbe, 0xffff, 0xffff, 0xbff7, 0x1ecf, 0xbdb6, 0xbdb6, 0x1ecf, 0xbff7, 0xffff, 0xffff, 0x7da6, 0x3824, 0xf813, 0xf813, 0x1a5d, 0xbff7, 0xffff, 0x3c9e, 0xf813, 0xf813, 0xf813, 0xf813, 0x993c, 0x9fe7, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xbff7, 0xfa4c, 0xf813, 0xf813, 0xf813, 0xf813, 0x1a5d, 0xbff7, 0xffff, 0x7da6, 0x181c, 0xf813, 0xf813, 0x792c, 0xfc8d, 0x9fe7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5ed7, 0xbb7d, 0x3824, 0xf813, 0xf813, 0x993c, 0x1ecf, 0xffff, 0x5ed7, 0x993c, 0xf813, 0xf813, 0xf813, 0xf813, 0xbb7d, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x7da6, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0x3c9e, 0xffff, 0xffff, 0x3c9e, 0x181c, 0xf813, 0xf813, 0xf813, 0x993c, 0xbb7d, 0x7da6, 0xbdb6, 0xbdb6, 0x3c9e, 0x7b6d, 0x792c, 0xf813, 0xf813, 0xf813, 0x792c, 0xddbe, 0xffff, 0xbff7, 0x7b6d, 0xf813, 0xf813, 0xf813, 0xf813, 0x792c, 0x1ecf, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xbff7, 0xfa4c, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0xbdb6, 0xffff, 0xffff, 0x7da6, 0x993c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xfa4c, 0x1ecf, 0xffff, 0xffff, 0xfc8d, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0xbb7d, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xddbe, 0x3824, 0xf813, 0xf813, 0xf813, 0xf813, 0x792c, 0xbdb6, 0xffff, 0xffff, 0x5ed7, 0xbb7d, 0x792c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0x993c, 0xfc8d, 0x9fe7, 0xffff, 0xffff, 0xfc8d, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0x993c, 0x9fe7, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfc8d, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0xfc8d, 0xbff7, 0xffff, 0xffff, 0x5ed7, 0x3c9e, 0x7b6d, 0xfa4c, 0x993c, 0x993c, 0xfa4c, 0xbb7d, 0x7da6, 0x9fe7, 0xffff, 0xffff, 0x9fe7, 0xbb7d, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0xbdb6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbff7, 0x7b6d, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x1a5d, 0xddbe, 0xbff7, 0xffff, 0xffff, 0xffff, 0xffff, 0xbff7, 0xbff7, 0xffff, 0xffff, 0xffff, 0xffff, 0xbff7, 0x7da6, 0x993c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0xfc8d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9fe7, 0x1a5d, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0x1a5d, 0x3c9e, 0x1ecf, 0xbff7, 0xffff, 0xffff, 0xffff, 0xbff7, 0x9fe7, 0x1ecf, 0xfc8d, 0xfa4c, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xbb7d, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9fe7, 0x7b6d, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0x993c, 0x1a5d, 0x1a5d, 0x1a5d, 0xfa4c, 0x993c, 0x3824, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0xfc8d, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbff7, 0xfc8d, 0x3824, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x792c, 0x7da6, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xddbe, 0x1a5d, 0x181c, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x181c, 0x7b6d, 0x5ed7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbff7, 0x7da6, 0x1a5d, 0x3824, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0xf813, 0x3824, 0x7b6d, 0xddbe, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbff7, 0x1ecf, 0xfc8d, 0x1a5d, 0x792c, 0x3824, 0x181c, 0xf813, 0xf813, 0x181c, 0x3824, 0x993c, 0x1a5d, 0x3c9e, 0x5ed7, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x9fe7, 0x1ecf, 0xddbe, 0xbdb6, 0xbdb6, 0xddbe, 0x5ed7, 0x9fe7, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+    0x01, 0x12, 0x00, 0x00, 0x10, 0x02, 0x31, 0x08, 0x31, 0x0a, 0x41, 0x0c, 0x62, 0x12, 0x83, 0x18,
+    0x93, 0x18, 0xc5, 0x1c, 0x20, 0x86, 0x51, 0x8e, 0x72, 0x96, 0x82, 0x98, 0x93, 0x9a, 0xb4, 0x9a,
+    0xc5, 0x9c, 0xd6, 0x9c, 0xe6, 0x9c, 0xf7, 0x9e, 0x90, 0x00, 0x01, 0x09, 0x09, 0x83, 0x04, 0x01,
+    0x09, 0x09, 0x9d, 0x00, 0x02, 0x01, 0x03, 0x05, 0x89, 0x0c, 0x02, 0x05, 0x03, 0x01, 0x97, 0x00,
+    0x01, 0x01, 0x0a, 0x8f, 0x0c, 0x01, 0x0a, 0x01, 0x94, 0x00, 0x00, 0x0a, 0x93, 0x0c, 0x00, 0x0a,
+    0x91, 0x00, 0x01, 0x09, 0x0b, 0x95, 0x0c, 0x01, 0x0b, 0x09, 0x8e, 0x00, 0x00, 0x02, 0x99, 0x0c,
+    0x00, 0x02, 0x8c, 0x00, 0x00, 0x02, 0x9b, 0x0c, 0x00, 0x02, 0x8a, 0x00, 0x00, 0x02, 0x9d, 0x0c,
+    0x00, 0x02, 0x88, 0x00, 0x00, 0x09, 0x9f, 0x0c, 0x00, 0x09, 0x87, 0x00, 0x00, 0x0b, 0x8b, 0x0c,
+    0x07, 0x07, 0x0e, 0x10, 0x12, 0x12, 0x10, 0x0e, 0x07, 0x8b, 0x0c, 0x00, 0x0b, 0x86, 0x00, 0x00,
+    0x0a, 0x8b, 0x0c, 0x00, 0x08, 0x87, 0x12, 0x00, 0x08, 0x8b, 0x0c, 0x00, 0x0a, 0x84, 0x00, 0x00,
+    0x01, 0x8b, 0x0c, 0x00, 0x0f, 0x89, 0x12, 0x00, 0x0f, 0x8b, 0x0c, 0x00, 0x01, 0x83, 0x00, 0x00,
+    0x0a, 0x8a, 0x0c, 0x00, 0x08, 0x8b, 0x12, 0x00, 0x08, 0x8a, 0x0c, 0x00, 0x0a, 0x82, 0x00, 0x00,
+    0x01, 0x8a, 0x0c, 0x00, 0x07, 0x83, 0x12, 0x05, 0x10, 0x0d, 0x0c, 0x0c, 0x0d, 0x10, 0x83, 0x12,
+    0x00, 0x07, 0x8a, 0x0c, 0x03, 0x01, 0x00, 0x00, 0x03, 0x8a, 0x0c, 0x00, 0x0e, 0x82, 0x12, 0x00,
+    0x10, 0x85, 0x0c, 0x00, 0x10, 0x82, 0x12, 0x00, 0x0e, 0x8a, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x05,
+    0x8a, 0x0c, 0x00, 0x10, 0x82, 0x12, 0x00, 0x0d, 0x85, 0x0c, 0x00, 0x0d, 0x82, 0x12, 0x00, 0x10,
+    0x8a, 0x0c, 0x02, 0x05, 0x00, 0x00, 0x8b, 0x0c, 0x83, 0x12, 0x87, 0x0c, 0x83, 0x12, 0x8b, 0x0c,
+    0x01, 0x00, 0x09, 0x8b, 0x0c, 0x83, 0x12, 0x87, 0x0c, 0x83, 0x12, 0x8b, 0x0c, 0x01, 0x09, 0x09,
+    0x8b, 0x0c, 0x83, 0x12, 0x87, 0x0c, 0x83, 0x12, 0x8b, 0x0c, 0x01, 0x09, 0x04, 0x8b, 0x0c, 0x83,
+    0x12, 0x87, 0x0c, 0x83, 0x12, 0x8b, 0x0c, 0x01, 0x04, 0x04, 0x8b, 0x0c, 0x83, 0x12, 0x87, 0x0c,
+    0x83, 0x12, 0x8b, 0x0c, 0x01, 0x04, 0x04, 0x87, 0x0c, 0x00, 0x0f, 0x89, 0x12, 0x00, 0x0f, 0x83,
+    0x0c, 0x83, 0x12, 0x8b, 0x0c, 0x01, 0x04, 0x04, 0x87, 0x0c, 0x01, 0x06, 0x11, 0x87, 0x12, 0x01,
+    0x11, 0x06, 0x83, 0x0c, 0x83, 0x12, 0x8b, 0x0c, 0x01, 0x04, 0x09, 0x88, 0x0c, 0x00, 0x0d, 0x87,
+    0x12, 0x00, 0x0d, 0x84, 0x0c, 0x83, 0x12, 0x8b, 0x0c, 0x01, 0x09, 0x09, 0x89, 0x0c, 0x00, 0x0e,
+    0x85, 0x12, 0x00, 0x0e, 0x85, 0x0c, 0x83, 0x12, 0x8b, 0x0c, 0x01, 0x09, 0x00, 0x8a, 0x0c, 0x00,
+    0x0f, 0x83, 0x12, 0x00, 0x0f, 0x86, 0x0c, 0x83, 0x12, 0x8b, 0x0c, 0x02, 0x00, 0x00, 0x05, 0x89,
+    0x0c, 0x05, 0x06, 0x11, 0x12, 0x12, 0x11, 0x06, 0x86, 0x0c, 0x83, 0x12, 0x8a, 0x0c, 0x03, 0x05,
+    0x00, 0x00, 0x03, 0x8a, 0x0c, 0x03, 0x0d, 0x12, 0x12, 0x0d, 0x87, 0x0c, 0x83, 0x12, 0x8a, 0x0c,
+    0x03, 0x03, 0x00, 0x00, 0x01, 0x8b, 0x0c, 0x01, 0x0e, 0x0e, 0x88, 0x0c, 0x83, 0x12, 0x8a, 0x0c,
+    0x00, 0x01, 0x82, 0x00, 0x00, 0x0a, 0x95, 0x0c, 0x83, 0x12, 0x89, 0x0c, 0x00, 0x0a, 0x83, 0x00,
+    0x00, 0x01, 0x95, 0x0c, 0x83, 0x12, 0x89, 0x0c, 0x00, 0x01, 0x84, 0x00, 0x00, 0x0a, 0x94, 0x0c,
+    0x03, 0x11, 0x12, 0x12, 0x11, 0x88, 0x0c, 0x00, 0x0a, 0x86, 0x00, 0x00, 0x0b, 0x93, 0x0c, 0x03,
+    0x0d, 0x11, 0x11, 0x0d, 0x87, 0x0c, 0x00, 0x0b, 0x87, 0x00, 0x00, 0x09, 0x9f, 0x0c, 0x00, 0x09,
+    0x88, 0x00, 0x00, 0x02, 0x9d, 0x0c, 0x00, 0x02, 0x8a, 0x00, 0x00, 0x02, 0x9b, 0x0c, 0x00, 0x02,
+    0x8c, 0x00, 0x00, 0x02, 0x99, 0x0c, 0x00, 0x02, 0x8e, 0x00, 0x01, 0x09, 0x0b, 0x95, 0x0c, 0x01,
+    0x0b, 0x09, 0x91, 0x00, 0x00, 0x0a, 0x93, 0x0c, 0x00, 0x0a, 0x94, 0x00, 0x01, 0x01, 0x0a, 0x8f,
+    0x0c, 0x01, 0x0a, 0x01, 0x97, 0x00, 0x02, 0x01, 0x03, 0x05, 0x89, 0x0c, 0x02, 0x05, 0x03, 0x01,
+    0x9d, 0x00, 0x01, 0x09, 0x09, 0x83, 0x04, 0x01, 0x09, 0x09, 0x90, 0x00,
 };
 
-static const uint16_t image_data_gps[1764] = {
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙░▒▒▒▒░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙░▒▓▒▒▒▒▒▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙░▒▒▒▒▒▒▒▒▒▒▒▒▒░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙▒▒▒▒▒▓▓▒▒▒▒▓████▓▒░∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙░▓▒▒▒▓██▓▒▒▒▒███████▓░∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙▒▓▒▒▓████▓▒▒▒▓████████▒∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙░▓▒▒▒▓████▓▒▒▒▓███████▓▓▒░∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙░▒▓▒▒▒▓████▓▒▒▒▓███████▓▓▓▓░∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙░▒▓▓▓▒▒▒▓▓▓▓▒▒▒▒▓██████▓▓▓▓▓▓░∙∙∙∙∙∙
-    // ∙∙∙∙∙░▒▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒███████▓▓▓▓▓▓▓░∙∙∙∙∙
-    // ∙∙∙∙∙▒▓▓▓▓▓▒▒▒▒▒▒▒▒▒▒▓███████▓▓▓▓▓▓▓▒∙∙∙∙∙
-    // ∙∙∙∙▒▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▒█████████▓▓▓▓▓▓▓▒∙∙∙∙
-    // ∙∙∙░▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▓█████████▓▓▓▓▓▓▓▓░∙∙∙
-    // ∙∙∙▒▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒███████████▓▓▓▓▓▓▓▒∙∙∙
-    // ∙∙░▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▓███████████▓▓▓▓▓▓▓▓░∙∙
-    // ∙∙▒▓▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒████████████▓▓▓▓▓▓▓▓▒∙∙
-    // ∙∙▒▓▓▓▓▓▓▓▓▓▓▓▒▒▒▒▓█▓▓▓▓▓▓▓▓████▓▓▓▓▓▓▓▒∙∙
-    // ∙░▓▓▓▓▓▓▓▓▓███▒▒▒▒██▓▓▓▓▓▓▓▓████▓▓▓▓▓▓▓▓░∙
-    // ∙░▓▓▓▓████████▓▒▒▓███▓▓▓▓███████▓▓▓▓▓▓▓▓░∙
-    // ∙▓████████████▓▒▒▓▓██▓█████████▓▓▓▓▓▓▓▓▓▒∙
-    // ∙▓█████████████▓▓▓▓████████████▓▓▓▓▓▓▓▓▓▒∙
-    // ∙▓█████████████▓▓█████████████▓▓▓▓▓▓▓▓▓▓▒∙
-    // ∙▓███████████████████████████▓▓▓▓▓▓▓▓▓▓▓▒∙
-    // ∙▓██████████████████████████▓▓▓▓▓▓▓▓▓▓▓▓▒∙
-    // ∙▒█████████████████████████▓▓▓▓▓▓▓▓▓▓▓▓▓▒∙
-    // ∙▒█████████████████████████▓▓▓▓▓▓▓▓▓▓▓▓▓░∙
-    // ∙░█████████████████████████▓▓▓▓▓▓▓▓▓▓▓▓▓░∙
-    // ∙∙▓███████████████████████▓▓▓▓▓▓▓▓▓▓▓▓▓▓∙∙
-    // ∙∙▓███████████████████████▓▓▓▓▓▓▓▓▓▓▓▓▓▒∙∙
-    // ∙∙∙███████████████████████▓▓▓▓▓▓▓▓▓▓▓▓▓░∙∙
-    // ∙∙∙▓███████████████████████▓▓█████████▓∙∙∙
-    // ∙∙∙▒██████████████████████████████████▒∙∙∙
-    // ∙∙∙∙▓████████████████████████████████▓∙∙∙∙
-    // ∙∙∙∙∙████████████████████████████████░∙∙∙∙
-    // ∙∙∙∙∙▒██████████████████████████████▒∙∙∙∙∙
-    // ∙∙∙∙∙∙∙████████████████████████████▒∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙▒██████████████████████████▒∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙▒████████████████████████▒∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙▓████████████████████▓░∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙▒▓█████████████████▒∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙▒▓████████████▓▒∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒▓▓████▓▓▒░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8220, 0x298a, 0xedd2, 0xedea, 0x4be2, 0xa8b9, 0xe468, 0x2010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6651, 0x4ee3, 0x0efb, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0x8cfa, 0xa8b9, 0x6228, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6651, 0x4ee3, 0xedfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0x8cfa, 0x4be2, 0x51a4, 0xb394, 0x5084, 0x0c63, 0x2942, 0xe318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8220, 0x2ed3, 0xedfa, 0xadfa, 0xadfa, 0xadfa, 0x0efb, 0x0efb, 0xadfa, 0xadfa, 0xadfa, 0x4bfa, 0xf1e3, 0xfcde, 0x1ce7, 0x1ce7, 0xdbde, 0x18c6, 0xb394, 0x2942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa761, 0x6ffb, 0xadfa, 0xadfa, 0xedfa, 0xf5ec, 0xbbf6, 0xbbf6, 0x32fc, 0xadfa, 0xadfa, 0xadfa, 0x4bfa, 0x19e6, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1cdf, 0xf7bd, 0x0c63, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8ba2, 0x0efb, 0xadfa, 0xadfa, 0x32fc, 0x9ef7, 0xbef7, 0xbef7, 0xbbf6, 0x4ff3, 0xadfa, 0xadfa, 0x4bfa, 0xf5ec, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x7eef, 0xffff, 0x7acf, 0xac5c, 0x4319, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a22, 0xf3cb, 0xedfa, 0xadfa, 0xadfa, 0xb4ec, 0xbef7, 0xbef7, 0xbef7, 0x3de7, 0x90f3, 0xadfa, 0xadfa, 0x4bfa, 0x73ec, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xdfff, 0xdeef, 0xb28e, 0x6f6e, 0xee6d, 0x8632, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8d2a, 0x7c55, 0x75cc, 0xedfa, 0xadfa, 0xadfa, 0x90f3, 0xfcf6, 0xbef7, 0xbef7, 0x19e6, 0x0efb, 0xadfa, 0xadfa, 0x4bfa, 0xb4ec, 0x3de7, 0x1ce7, 0x1ce7, 0x1cdf, 0x5def, 0xffff, 0x37bf, 0x6f6e, 0x6f76, 0x6f76, 0x2f6e, 0x283b, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad2a, 0x7c55, 0xbd55, 0xd7ac, 0x0efb, 0xadfa, 0xadfa, 0xadfa, 0xd1fb, 0x56f5, 0xf5ec, 0x4ff3, 0xadfa, 0xadfa, 0xadfa, 0x4bfa, 0x97ed, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x9ef7, 0xffff, 0xd39e, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x283b, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a22, 0x7c55, 0x9d55, 0xbd55, 0x5a7d, 0x90f3, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0x8cfa, 0xeef2, 0xbbe6, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x9ef7, 0xdfff, 0xd39e, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x2f6e, 0xa632, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a4d, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x75cc, 0xedfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0x4bfa, 0xf5ec, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x9ef7, 0xffff, 0xf5a6, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xee6d, 0x4319, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x143c, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0xbd55, 0x3a85, 0x4ff3, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0x8cfa, 0xeef2, 0x7ae6, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1cdf, 0x5def, 0xffff, 0x58c7, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x0c5d, 0x6108, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0a22, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x75cc, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0x4bfa, 0xb4ec, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xdfff, 0xdeef, 0xb28e, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xc732, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x7744, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x198d, 0x4ff3, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xeef2, 0x7ae6, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x9ef7, 0xffff, 0x58c7, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x4d65, 0xc308, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0a22, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0xf3cb, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0x8cfa, 0xb4ec, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xdfff, 0xdeef, 0xb28e, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xa632, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xd33b, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0xf98c, 0x0efb, 0xadfa, 0xadfa, 0xadfa, 0xadfa, 0xeef2, 0x19e6, 0xdbd6, 0xbbd6, 0x9bce, 0x9bce, 0x9bce, 0x9bce, 0xbbd6, 0xdbd6, 0x1cdf, 0x9ef7, 0xffff, 0xf5a6, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xab54, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x1a4d, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0xdd65, 0x9dae, 0x32fc, 0xadfa, 0xadfa, 0xadfa, 0x8cfa, 0x73ec, 0x7ace, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x9bce, 0x5def, 0xffff, 0x58c7, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xee6d, 0x4319, 0x0000, 
-    0x0000, 0x0a22, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0x9d55, 0xdd65, 0xbea6, 0x9fdf, 0xffff, 0x39fe, 0xedfa, 0xadfa, 0xadfa, 0xeef2, 0x19e6, 0xbbd6, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x39c6, 0x5ace, 0xdbd6, 0x5de7, 0xffff, 0x7acf, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x8632, 0x0000, 
-    0x0000, 0x4f4b, 0x9e96, 0x9e96, 0xbea6, 0xbea6, 0xfeb6, 0xfeb6, 0xfeb6, 0x9fdf, 0xffff, 0xffff, 0x9ef7, 0xfcde, 0xd1fb, 0xadfa, 0xadfa, 0xf1e3, 0x9bce, 0xdbd6, 0x7ace, 0x39c6, 0x39c6, 0x39c6, 0x5ac6, 0x9bce, 0xdbd6, 0x1cdf, 0x1ce7, 0x5def, 0xffff, 0x37bf, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xc943, 0x0000, 
-    0x0000, 0x55ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9ef7, 0x3de7, 0x1ce7, 0x1ce7, 0x97ed, 0xadfa, 0xeef2, 0x76cd, 0x5ac6, 0xbbd6, 0xbbd6, 0x5ac6, 0x7ace, 0xdbd6, 0xfcde, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xbef7, 0xffff, 0xd39e, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xab54, 0x0000, 
-    0x0000, 0x55ad, 0x7eef, 0x7eef, 0x5def, 0x5def, 0x5def, 0x5de7, 0x5de7, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xbbe6, 0x90f3, 0xf1e3, 0x39c6, 0x3ac6, 0xdbd6, 0x7eef, 0x5def, 0x1cdf, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x5def, 0xffff, 0x9bdf, 0x907e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x0c5d, 0x0000, 
-    0x0000, 0x55ad, 0x1cdf, 0x1cdf, 0x1cdf, 0x1ce7, 0x1cdf, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x97ed, 0x97d5, 0xbbd6, 0xfcde, 0x3de7, 0xdfff, 0xdfff, 0x5def, 0x5def, 0x3de7, 0x1ce7, 0x1ce7, 0x5def, 0xffff, 0xdeef, 0xd39e, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x0c5d, 0x0000, 
-    0x0000, 0x55ad, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1cdf, 0x1cdf, 0x1ce7, 0x1ce7, 0x1ce7, 0x9ef7, 0xffff, 0xffff, 0xffff, 0xdfff, 0x9ef7, 0x7eef, 0xffff, 0xdeef, 0xf5a6, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x0c5d, 0x0000, 
-    0x0000, 0x55ad, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xdfff, 0xffff, 0xbef7, 0x9ef7, 0xdfff, 0xffff, 0xffff, 0xbce7, 0xd39e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x0c5d, 0x0000, 
-    0x0000, 0xb394, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0x5de7, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x7eef, 0xffff, 0x9ef7, 0x1ce7, 0x1cdf, 0x5def, 0xffff, 0xbce7, 0xb28e, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xab54, 0x0000, 
-    0x0000, 0xef7b, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x5de7, 0xdfff, 0x9ef7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1cdf, 0x9ef7, 0xffff, 0x5de7, 0x1cdf, 0x1ce7, 0x3de7, 0xdfff, 0xbce7, 0x907e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xc943, 0x0000, 
-    0x0000, 0x8a52, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xdff7, 0xdfff, 0x5de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xbef7, 0xffff, 0x9ef7, 0x1ce7, 0x1ce7, 0x5def, 0xffff, 0x7acf, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0xc732, 0x0000, 
-    0x0000, 0x4529, 0x59ce, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x5def, 0xffff, 0xbef7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0x9ef7, 0xdfff, 0xffff, 0xffff, 0xffff, 0xbef7, 0x9ef7, 0xdfff, 0xdff7, 0xd39e, 0x6f6e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x2f6e, 0x4319, 0x0000, 
-    0x0000, 0x4108, 0x55ad, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xbef7, 0xffff, 0x5def, 0x1cdf, 0x1ce7, 0x3de7, 0x7eef, 0xdfff, 0xffff, 0xdfff, 0x7eef, 0x5def, 0xbef7, 0xffff, 0xffff, 0xffff, 0x9bdf, 0x907e, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f76, 0x6f6e, 0x6f6e, 0x6f76, 0x6f76, 0x0c5d, 0x6108, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1cdf, 0x5def, 0xffff, 0xbef7, 0x3de7, 0x5def, 0xdff7, 0xffff, 0xdfff, 0x9ef7, 0x3de7, 0x1ce7, 0x1ce7, 0x3de7, 0x5de7, 0x5de7, 0xbef7, 0xffff, 0xf5a6, 0x6f6e, 0x6f6e, 0x6f6e, 0x6f76, 0x6f76, 0x907e, 0x907e, 0x907e, 0xb28e, 0xb28e, 0x6f76, 0x6f76, 0x283b, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x18c6, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xbef7, 0xffff, 0xdff7, 0xffff, 0xffff, 0x9ef7, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1cdf, 0x5de7, 0xffff, 0xbce7, 0xf5a6, 0xf5a6, 0x37bf, 0x58c7, 0x7acf, 0x9bdf, 0xbce7, 0xdeef, 0xdff7, 0xdeef, 0x37bf, 0xef75, 0x4319, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xae73, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x5de7, 0xbef7, 0xffff, 0xffff, 0xbef7, 0x5de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xbef7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xdff7, 0xbef7, 0xdfff, 0xffff, 0x5084, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xa210, 0xd7b5, 0x1ce7, 0x1ce7, 0x3de7, 0xbef7, 0xffff, 0xffff, 0xbef7, 0x5de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xdfff, 0xffff, 0x9ef7, 0x5def, 0x5def, 0x3de7, 0x3de7, 0x3de7, 0x3de7, 0x1ce7, 0x3de7, 0x59ce, 0x2421, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdbde, 0x9ef7, 0xdfff, 0xffff, 0xbef7, 0x5def, 0x3de7, 0x1cdf, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x9ef7, 0xffff, 0x9ef7, 0x1cdf, 0x1cdf, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xdbde, 0x8a52, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084, 0xffff, 0xdff7, 0x5def, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x5def, 0xffff, 0xdfff, 0x3de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xef7b, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3de7, 0x1cdf, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1cdf, 0x3de7, 0x9ef7, 0xdfff, 0xffff, 0xffff, 0x9ef7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xb394, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5084, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0x5def, 0xdff7, 0xffff, 0xdfff, 0x9ef7, 0xdff7, 0xffff, 0x5de7, 0x1ce7, 0x1ce7, 0x1ce7, 0xb394, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae73, 0xdbde, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xbef7, 0xffff, 0xffff, 0x9ef7, 0x3de7, 0x1cdf, 0x5def, 0xffff, 0xbef7, 0x1ce7, 0xdbde, 0xef7b, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd7b5, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x9ef7, 0xbef7, 0x5de7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0xbef7, 0xffff, 0x59ce, 0x8a52, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7b, 0x59ce, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x3de7, 0x3de7, 0x1cdf, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xdbde, 0xb294, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0xae73, 0xd7b5, 0xdbde, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0x1ce7, 0xdbde, 0xd7b5, 0xae73, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7b, 0x55ad, 0x59ce, 0xdbde, 0x1cdf, 0x1cdf, 0xdbde, 0x59ce, 0x55ad, 0xef7b, 0x2942, 0xa210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+// 42x42, 641 B (raw 3528 B)
+static const uint8_t image_data_diagnostics[641] = {
+    // ███████████████████▓▓▓▓███████████████████
+    // ███████████████▓▒▒▒▒▒▒▒▒▒▒▓███████████████
+    // ████████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓████████████
+    // ██████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██████████
+    // █████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
+    // ████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // ███▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓███
+    // ███▒▒▒▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ██▓▒▒▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // █▓▒▒▒▒▒▒▒▒▒▒▒▒░    ░▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒      ▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒      ▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒░      ▒▒▒▒     ▒▒▒▒▒▒▒▒▒▒▒▒█
+    // ▓▒▒▒▒▒▒▒▒▒▒▒▒   ░   ░▒▒░     ░▒▒▒▒▒▒▒▒▒▒▒▓
+    // ▓▒▒▒▒▒▒░        ▒░   ▒▒           ░▒▒▒▒▒▒▓
+    // ▓▒▒▒▒▒░         ▒░   ▒▒            ░▒▒▒▒▒▓
+    // ▓▒▒▒▒▒░        ░▒▒   ░░   ▒░       ░▒▒▒▒▒▓
+    // █▒▒▒▒▒▒░      ░▒▒▒   ░░   ▒▒░     ░▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░      ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒      ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█
+    // █▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒      ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓█
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒      ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░    ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██
+    // ██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██
+    // ███▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒    ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███
+    // ███▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░  ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓███
+    // ████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████
+    // █████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████
+    // ██████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒██████
+    // ███████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒███████
+    // ████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒████████
+    // █████████▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒█████████
+    // ██████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓██████████
+    // ████████████▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓████████████
+    // ███████████████▓▒▒▒▒▒▒▒▒▒▒▓███████████████
+    // ███████████████████▓▓▓▓███████████████████
+    0x01, 0x17, 0x00, 0x00, 0x01, 0x02, 0x12, 0x04, 0x13, 0x06, 0x35, 0x0c, 0x45, 0x0e, 0x76, 0x12,
+    0x86, 0x14, 0x96, 0x14, 0xc7, 0x1a, 0xd7, 0x1a, 0x00, 0x80, 0x01, 0x82, 0x11, 0x84, 0x12, 0x86,
+    0x23, 0x88, 0x24, 0x8a, 0x55, 0x8e, 0x65, 0x90, 0xa6, 0x96, 0xb6, 0x98, 0xd7, 0x9c, 0xe7, 0x9c,
+    0xf7, 0x9e, 0x90, 0x00, 0x01, 0x01, 0x0c, 0x83, 0x0e, 0x01, 0x0c, 0x01, 0x9d, 0x00, 0x02, 0x0b,
+    0x02, 0x0f, 0x89, 0x04, 0x02, 0x0f, 0x02, 0x0b, 0x97, 0x00, 0x01, 0x0b, 0x03, 0x8f, 0x04, 0x01,
+    0x03, 0x0b, 0x94, 0x00, 0x00, 0x03, 0x93, 0x04, 0x00, 0x03, 0x91, 0x00, 0x01, 0x01, 0x10, 0x95,
+    0x04, 0x01, 0x10, 0x01, 0x8e, 0x00, 0x00, 0x0d, 0x99, 0x04, 0x00, 0x0d, 0x8c, 0x00, 0x00, 0x0d,
+    0x9b, 0x04, 0x00, 0x0d, 0x8a, 0x00, 0x00, 0x0d, 0x9d, 0x04, 0x00, 0x0d, 0x88, 0x00, 0x00, 0x01,
+    0x9f, 0x04, 0x00, 0x01, 0x87, 0x00, 0x00, 0x10, 0x9f, 0x04, 0x00, 0x10, 0x86, 0x00, 0x00, 0x03,
+    0xa1, 0x04, 0x00, 0x03, 0x84, 0x00, 0x00, 0x0b, 0x8c, 0x04, 0x01, 0x13, 0x13, 0x94, 0x04, 0x00,
+    0x0b, 0x83, 0x00, 0x00, 0x03, 0x8b, 0x04, 0x03, 0x13, 0x17, 0x17, 0x13, 0x93, 0x04, 0x00, 0x03,
+    0x82, 0x00, 0x00, 0x0b, 0x8c, 0x04, 0x03, 0x16, 0x17, 0x17, 0x15, 0x94, 0x04, 0x03, 0x0b, 0x00,
+    0x00, 0x02, 0x8b, 0x04, 0x00, 0x12, 0x83, 0x17, 0x00, 0x11, 0x93, 0x04, 0x03, 0x02, 0x00, 0x00,
+    0x0f, 0x8b, 0x04, 0x00, 0x13, 0x83, 0x17, 0x00, 0x07, 0x84, 0x04, 0x01, 0x13, 0x13, 0x8c, 0x04,
+    0x02, 0x0f, 0x00, 0x00, 0x8c, 0x04, 0x00, 0x16, 0x83, 0x17, 0x00, 0x09, 0x83, 0x04, 0x03, 0x13,
+    0x17, 0x17, 0x14, 0x8c, 0x04, 0x01, 0x00, 0x01, 0x8b, 0x04, 0x00, 0x12, 0x85, 0x17, 0x83, 0x04,
+    0x00, 0x16, 0x82, 0x17, 0x00, 0x12, 0x8b, 0x04, 0x01, 0x01, 0x0c, 0x8b, 0x04, 0x00, 0x13, 0x85,
+    0x17, 0x03, 0x12, 0x04, 0x04, 0x11, 0x83, 0x17, 0x00, 0x15, 0x8b, 0x04, 0x01, 0x0c, 0x0e, 0x8b,
+    0x04, 0x0a, 0x16, 0x17, 0x17, 0x13, 0x16, 0x17, 0x17, 0x13, 0x04, 0x04, 0x08, 0x84, 0x17, 0x00,
+    0x08, 0x8a, 0x04, 0x01, 0x0e, 0x0e, 0x85, 0x04, 0x00, 0x13, 0x83, 0x09, 0x00, 0x0a, 0x82, 0x17,
+    0x07, 0x12, 0x14, 0x17, 0x17, 0x15, 0x04, 0x04, 0x0a, 0x84, 0x17, 0x00, 0x16, 0x83, 0x09, 0x00,
+    0x13, 0x85, 0x04, 0x01, 0x0e, 0x0e, 0x84, 0x04, 0x00, 0x13, 0x87, 0x17, 0x02, 0x16, 0x04, 0x06,
+    0x82, 0x17, 0x01, 0x05, 0x04, 0x82, 0x17, 0x00, 0x09, 0x87, 0x17, 0x00, 0x13, 0x84, 0x04, 0x01,
+    0x0e, 0x0e, 0x84, 0x04, 0x00, 0x13, 0x87, 0x17, 0x02, 0x13, 0x04, 0x05, 0x82, 0x17, 0x01, 0x06,
+    0x06, 0x82, 0x17, 0x01, 0x11, 0x14, 0x86, 0x17, 0x00, 0x13, 0x84, 0x04, 0x01, 0x0e, 0x0c, 0x85,
+    0x04, 0x00, 0x13, 0x85, 0x09, 0x00, 0x13, 0x82, 0x04, 0x0a, 0x15, 0x17, 0x17, 0x14, 0x13, 0x17,
+    0x17, 0x16, 0x04, 0x04, 0x13, 0x84, 0x09, 0x00, 0x13, 0x85, 0x04, 0x01, 0x0c, 0x01, 0x90, 0x04,
+    0x07, 0x13, 0x17, 0x17, 0x16, 0x16, 0x17, 0x17, 0x13, 0x8e, 0x04, 0x01, 0x01, 0x00, 0x90, 0x04,
+    0x00, 0x12, 0x85, 0x17, 0x00, 0x06, 0x8e, 0x04, 0x02, 0x00, 0x00, 0x0f, 0x90, 0x04, 0x85, 0x17,
+    0x8e, 0x04, 0x03, 0x0f, 0x00, 0x00, 0x02, 0x90, 0x04, 0x00, 0x09, 0x83, 0x17, 0x00, 0x0a, 0x8e,
+    0x04, 0x03, 0x02, 0x00, 0x00, 0x0b, 0x90, 0x04, 0x00, 0x07, 0x83, 0x17, 0x00, 0x08, 0x8e, 0x04,
+    0x00, 0x0b, 0x82, 0x00, 0x00, 0x03, 0x8f, 0x04, 0x00, 0x11, 0x83, 0x17, 0x00, 0x11, 0x8d, 0x04,
+    0x00, 0x03, 0x83, 0x00, 0x00, 0x0b, 0x90, 0x04, 0x03, 0x15, 0x17, 0x17, 0x16, 0x8e, 0x04, 0x00,
+    0x0b, 0x84, 0x00, 0x00, 0x03, 0x8f, 0x04, 0x03, 0x13, 0x17, 0x17, 0x13, 0x8d, 0x04, 0x00, 0x03,
+    0x86, 0x00, 0x00, 0x10, 0x8f, 0x04, 0x01, 0x13, 0x13, 0x8d, 0x04, 0x00, 0x10, 0x87, 0x00, 0x00,
+    0x01, 0x9f, 0x04, 0x00, 0x01, 0x88, 0x00, 0x00, 0x0d, 0x9d, 0x04, 0x00, 0x0d, 0x8a, 0x00, 0x00,
+    0x0d, 0x9b, 0x04, 0x00, 0x0d, 0x8c, 0x00, 0x00, 0x0d, 0x99, 0x04, 0x00, 0x0d, 0x8e, 0x00, 0x01,
+    0x01, 0x10, 0x95, 0x04, 0x01, 0x10, 0x01, 0x91, 0x00, 0x00, 0x03, 0x93, 0x04, 0x00, 0x03, 0x94,
+    0x00, 0x01, 0x0b, 0x03, 0x8f, 0x04, 0x01, 0x03, 0x0b, 0x97, 0x00, 0x02, 0x0b, 0x02, 0x0f, 0x89,
+    0x04, 0x02, 0x0f, 0x02, 0x0b, 0x9d, 0x00, 0x01, 0x01, 0x0c, 0x83, 0x0e, 0x01, 0x0c, 0x01, 0x90,
+    0x00,
 };
 
-const tImage icon_compass = { (void*)image_data_compass, 42, 42,16 };
-const tImage icon_temp = { (void*)image_data_icon_temp, 42, 42, 16 };
-const tImage icon_more = { (void*)image_data_icon_more, 42, 42, 16 };
-const tImage icon_wifi = { (void*)image_data_icon_wifi, 42, 42, 16 };
-const tImage icon_target = { (void*)image_data_targetresize, 42, 42, 16 };
-const tImage icon_gps = { (void*)image_data_gps, 42, 42, 16 };
-const tImage icon_bluetooth = { (void*)image_data_bleutooth, 42, 42, 16 };
+const tImage icon_compass = { (void*)image_data_compass, 42, 42, 16, ICON_ENC_PAL8_RLE };
+const tImage icon_temp = { (void*)image_data_icon_temp, 42, 42, 16, ICON_ENC_PAL8_RLE };
+const tImage icon_more = { (void*)image_data_icon_more, 42, 42, 16, ICON_ENC_PAL8_RLE };
+const tImage icon_wifi = { (void*)image_data_icon_wifi, 42, 42, 16, ICON_ENC_PAL8_RLE };
+const tImage icon_target = { (void*)image_data_targetresize, 42, 42, 16, ICON_ENC_PAL8_RLE };
+const tImage icon_gps = { (void*)image_data_gps, 42, 42, 16, ICON_ENC_PAL8_RLE };
+const tImage icon_bluetooth = { (void*)image_data_bleutooth, 42, 42, 16, ICON_ENC_PAL8_RLE };
+const tImage icon_backtrack = { (void*)image_data_backtrack, 42, 42, 16, ICON_ENC_PAL8_RLE };
+const tImage icon_diagnostics = { (void*)image_data_diagnostics, 42, 42, 16, ICON_ENC_PAL8_RLE };
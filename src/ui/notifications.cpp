@@ -0,0 +1,187 @@
+#include "ui/notifications.h"
+#include "ui/page_stack.h"
+#include "ui/animation.h"
+#include "log.h"
+
+// Pop-in/out animation of the box
+static const uint32_t POPUP_IN_MS = 180;
+static const uint32_t POPUP_OUT_MS = 140;
+static const float POPUP_OVERSHOOT = 1.12f; // OutBack peak; the invalidated area allows for it
+
+// Overlay palette indices
+static const uint8_t IDX_TRANSPARENT = 0, IDX_BOX = 1, IDX_BORDER = 2, IDX_TEXT = 3;
+
+struct Notification {
+    char message[NOTIFY_MAX_LEN + 1];
+    uint32_t durationMs;
+    uint16_t fg, bg;
+    NotifyPriority priority;
+};
+
+// Queue, shared with the posting tasks
+static Notification g_queue[NOTIFY_QUEUE_LEN];
+static size_t g_queued = 0;
+static portMUX_TYPE g_queueMux = portMUX_INITIALIZER_UNLOCKED;
+
+// On screen; main loop only
+static Notification g_current;
+static bool g_showing = false;
+static uint32_t g_shownAt = 0;
+static uint32_t g_endAt = 0;
+static Tween g_scale;
+static bool g_openDrawn = false;                 // the frame after pop-in (scale exactly 1) was invalidated
+static int16_t g_w = 0;                          // box width
+static uint16_t g_palette[4];                    // byte-swapped RGB565
+static uint8_t g_overlay[NOTIFY_MAX_W * NOTIFY_H / 4];
+static M5Canvas g_raster;                        // points into g_overlay while the box is drawn
+
+static uint16_t swap16(uint16_t v) { return (uint16_t)((v >> 8) | (v << 8)); }
+
+void showPopupNotification(const char* message, uint32_t durationMs, uint16_t color, uint16_t bgColor,
+                           NotifyPriority priority) {
+    Notification n;
+    snprintf(n.message, sizeof(n.message), "%s", message);
+    n.durationMs = durationMs;
+    n.fg = color;
+    n.bg = bgColor;
+    n.priority = priority;
+
+    bool dropped = false;
+    portENTER_CRITICAL(&g_queueMux);
+    if (g_queued == NOTIFY_QUEUE_LEN) {
+        // Full: the oldest of the lowest priority makes room, unless the new one ranks below it
+        size_t victim = 0;
+        for (size_t i = 1; i < g_queued; i++) {
+            if (g_queue[i].priority < g_queue[victim].priority) victim = i;
+        }
+        if (g_queue[victim].priority <= priority) {
+            memmove(&g_queue[victim], &g_queue[victim + 1], (g_queued - victim - 1) * sizeof(Notification));
+            g_queued--;
+        }
+        dropped = true;
+    }
+    if (g_queued < NOTIFY_QUEUE_LEN) {
+        // Behind everything of the same or higher priority
+        size_t pos = g_queued;
+        while (pos > 0 && g_queue[pos - 1].priority < priority) pos--;
+        memmove(&g_queue[pos + 1], &g_queue[pos], (g_queued - pos) * sizeof(Notification));
+        g_queue[pos] = n;
+        g_queued++;
+    }
+    portEXIT_CRITICAL(&g_queueMux);
+
+    if (dropped) LOGW("ui", "notification queue full, dropped one");
+    LOGI("ui", "popup: %s", n.message);
+}
+
+static bool takeNext(Notification &out) {
+    bool got = false;
+    portENTER_CRITICAL(&g_queueMux);
+    if (g_queued) {
+        out = g_queue[0];
+        memmove(&g_queue[0], &g_queue[1], (g_queued - 1) * sizeof(Notification));
+        g_queued--;
+        got = true;
+    }
+    portEXIT_CRITICAL(&g_queueMux);
+    return got;
+}
+
+// Priority of the first waiting notification, or -1 if none
+static int nextPriority() {
+    portENTER_CRITICAL(&g_queueMux);
+    int p = g_queued ? (int)g_queue[0].priority : -1;
+    portEXIT_CRITICAL(&g_queueMux);
+    return p;
+}
+
+// Box, border and text into the 2-bit overlay, once per notification
+static void rasterize(const Notification &n) {
+    g_raster.setTextSize(2);
+    int w = g_raster.textWidth(n.message) + 40;
+    if (w > NOTIFY_MAX_W) w = NOTIFY_MAX_W;
+    w = (w + 3) & ~3;
+    g_w = (int16_t)w;
+
+    g_raster.setBuffer(g_overlay, w, NOTIFY_H, lgfx::palette_2bit);
+    if (!g_raster.hasPalette()) g_raster.createPalette(); // kept across setBuffer()/deleteSprite()
+    g_raster.fillSprite(IDX_TRANSPARENT);
+    g_raster.fillRoundRect(0, 0, w, NOTIFY_H, 15, IDX_BOX);
+    g_raster.drawRoundRect(0, 0, w, NOTIFY_H, 15, IDX_BORDER);
+    g_raster.drawRoundRect(1, 1, w - 2, NOTIFY_H - 2, 14, IDX_BORDER);
+    g_raster.setTextDatum(MC_DATUM);
+    g_raster.setTextColor(IDX_TEXT);
+    g_raster.drawString(n.message, w / 2, NOTIFY_H / 2);
+    g_raster.deleteSprite(); // detaches the overlay buffer, which the sprite does not own
+
+    g_palette[IDX_TRANSPARENT] = 0;
+    g_palette[IDX_BOX] = swap16(n.bg);
+    g_palette[IDX_BORDER] = swap16(TFT_WHITE);
+    g_palette[IDX_TEXT] = swap16(n.fg);
+}
+
+// Screen area the box can cover, overshoot included
+static void invalidateOverlay() {
+    int w = (int)(g_w * POPUP_OVERSHOOT) + 2;
+    int h = (int)(NOTIFY_H * POPUP_OVERSHOOT) + 2;
+    pageInvalidateRect((canvas.width() - w) / 2, (canvas.height() - h) / 2, w, h);
+}
+
+static float currentScale(uint32_t now) {
+    float scale = g_scale.value();
+    uint32_t remaining = g_endAt - now;
+    if (remaining < POPUP_OUT_MS) scale *= ease(Ease::OutCubic, (float)remaining / POPUP_OUT_MS);
+    return scale;
+}
+
+void notifyService() {
+    uint32_t now = millis();
+    if (g_showing) {
+        int waiting = nextPriority();
+        if (waiting > (int)g_current.priority) {
+            // Preempted: pop out now
+            if ((int32_t)(g_endAt - (now + POPUP_OUT_MS)) > 0) g_endAt = now + POPUP_OUT_MS;
+        } else if (waiting == (int)g_current.priority) {
+            // Same priority waiting: shorten to the minimum (lower ones wait their turn)
+            uint32_t minEnd = g_shownAt + NOTIFY_MIN_SHOW_MS;
+            if ((int32_t)(minEnd - now) < (int32_t)POPUP_OUT_MS) minEnd = now + POPUP_OUT_MS;
+            if ((int32_t)(g_endAt - minEnd) > 0) g_endAt = minEnd;
+        }
+        if ((int32_t)(now - g_endAt) >= 0) {
+            g_showing = false;
+            invalidateOverlay(); // hide: the page is repainted under it
+        } else if (!g_scale.done() || g_endAt - now < POPUP_OUT_MS) {
+            invalidateOverlay(); // popping in or out
+        } else if (!g_openDrawn) {
+            g_openDrawn = true;
+            invalidateOverlay(); // once more at full size; then nothing until it goes away
+        }
+    }
+    if (!g_showing && takeNext(g_current)) {
+        rasterize(g_current);
+        g_showing = true;
+        g_shownAt = now;
+        g_openDrawn = false;
+        g_endAt = now + g_current.durationMs;
+        g_scale.start(0.5f, 1.0f, POPUP_IN_MS, Ease::OutBack);
+        invalidateOverlay();
+    }
+}
+
+void drawNotification(M5Canvas& canvas) {
+    if (!g_showing) return;
+    float scale = currentScale(millis());
+    if (scale * NOTIFY_H < 32) return; // too small to read as a box
+    if (scale == 1.0f) {
+        canvas.pushImage((canvas.width() - g_w) / 2, (canvas.height() - NOTIFY_H) / 2, g_w, NOTIFY_H, g_overlay,
+            (uint32_t)IDX_TRANSPARENT, lgfx::palette_2bit, (const lgfx::swap565_t*)g_palette);
+    } else {
+        canvas.pushImageRotateZoom(canvas.width() / 2.0f, canvas.height() / 2.0f, g_w / 2.0f, NOTIFY_H / 2.0f,
+            0.0f, scale, scale, g_w, NOTIFY_H, g_overlay, (uint32_t)IDX_TRANSPARENT, lgfx::palette_2bit,
+            (const lgfx::swap565_t*)g_palette);
+    }
+}
+
+bool notifyPending() {
+    return g_showing || nextPriority() >= 0;
+}
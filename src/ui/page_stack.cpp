@@ -0,0 +1,115 @@
+#include "ui/page_stack.h"
+#include "ui/animation.h"
+#include "ui/notifications.h"
+#include "input.h"
+
+static const Page *g_stack[PAGE_STACK_DEPTH];
+static int g_depth = 0;
+static DirtyRect g_dirty;
+static uint32_t g_lastUpdate = 0;
+static uint32_t g_lastRender = 0;
+static bool g_changed = false;     // dirty area came from an invalidate, not only the refresh timer
+
+void DirtyRect::add(int rx, int ry, int rw, int rh) {
+    if (rw <= 0 || rh <= 0) return;
+    if (empty()) {
+        x = rx; y = ry; w = rw; h = rh;
+        return;
+    }
+    int x1 = x + w > rx + rw ? x + w : rx + rw;
+    int y1 = y + h > ry + rh ? y + h : ry + rh;
+    if (rx < x) x = rx;
+    if (ry < y) y = ry;
+    w = x1 - x;
+    h = y1 - y;
+}
+
+// The new top page starts from a full redraw behind the iris transition
+static void pageChanged() {
+    inputFlush(); // the rest of a burst was meant for the page that was left
+    pageTransitionStart();
+    pageInvalidate();
+    Serial.printf("Page: %s\n", g_stack[g_depth - 1]->name);
+}
+
+void pageStackInit(const Page *root) {
+    g_depth = 0;
+    g_stack[g_depth++] = root;
+    if (root->onEnter) root->onEnter();
+    g_lastUpdate = millis();
+    pageInvalidate();
+}
+
+void pagePush(const Page *page) {
+    if (g_depth >= PAGE_STACK_DEPTH) {
+        Serial.printf("Page stack full, cannot push %s\n", page->name);
+        return;
+    }
+    g_stack[g_depth++] = page;
+    if (page->onEnter) page->onEnter();
+    pageChanged();
+}
+
+void pagePop() {
+    if (g_depth <= 1) return;
+    const Page *page = g_stack[--g_depth];
+    if (page->onExit) page->onExit();
+    pageChanged();
+}
+
+void pagePopToRoot() {
+    if (g_depth <= 1) return;
+    while (g_depth > 1) {
+        const Page *page = g_stack[--g_depth];
+        if (page->onExit) page->onExit();
+    }
+    pageChanged();
+}
+
+const Page *pageCurrent() {
+    return g_depth ? g_stack[g_depth - 1] : nullptr;
+}
+
+void pageInvalidate() {
+    g_dirty.add(0, 0, canvas.width(), canvas.height());
+    g_changed = true;
+}
+
+void pageInvalidateRect(int x, int y, int w, int h) {
+    g_dirty.add(x, y, w, h);
+    g_changed = true;
+}
+
+FrameResult pageStackService() {
+    if (!g_depth) return FrameResult::None;
+    uint32_t now = millis();
+    uint32_t dt = now - g_lastUpdate;
+    g_lastUpdate = now;
+
+    const Page *page = pageCurrent();
+    if (page->update) page->update(dt); // may push/pop; the new top is drawn below
+    page = pageCurrent();
+
+    if (page->refreshMs && now - g_lastRender >= page->refreshMs) g_dirty.add(0, 0, canvas.width(), canvas.height());
+    if (pageTransitionActive()) pageInvalidate();
+    notifyService(); // invalidates the popup area only when it appears, animates or goes away
+
+    if (g_dirty.empty()) return FrameResult::None; // nothing changed: no render, no SPI transfer
+
+    DirtyRect dirty = g_dirty;
+    FrameResult result = g_changed ? FrameResult::Changed : FrameResult::Refresh;
+    g_dirty.clear();
+    g_changed = false;
+    g_lastRender = now;
+
+    canvas.setClipRect(dirty.x, dirty.y, dirty.w, dirty.h);
+    page->render(canvas, dirty);
+    drawPageTransition(canvas);
+    drawNotification(canvas);
+    canvas.clearClipRect();
+
+    M5Dial.Display.setClipRect(dirty.x, dirty.y, dirty.w, dirty.h);
+    canvas.pushSprite(0, 0);
+    M5Dial.Display.clearClipRect();
+    return result;
+}
@@ -0,0 +1,140 @@
+#include "ui/text_cache.h"
+#include "log.h"
+#include <string.h>
+
+struct TextEntry {
+    char text[TEXT_CACHE_MAX_LEN + 1];
+    const lgfx::IFont *font;
+    float size;
+    uint16_t fg;
+    int32_t bg;
+    uint16_t offset;      // into g_arena
+    int16_t w, h;
+    uint32_t lastUse;     // frame stamp for LRU
+    bool used;
+};
+
+static uint8_t g_arena[TEXT_CACHE_BYTES];
+static size_t g_arenaUsed = 0;
+static TextEntry g_entries[TEXT_CACHE_ENTRIES];
+static uint32_t g_stamp = 0;
+static TextCacheStats g_stats = {};
+static M5Canvas g_raster;   // points into the arena while a label is rasterized
+
+static size_t bitmapBytes(int w, int h) {
+    return (size_t)((w + 7) / 8) * h; // 1 bpp, rows padded to a byte (LovyanGFX layout)
+}
+
+static uint16_t swap16(uint16_t c) {
+    return (uint16_t)((c >> 8) | (c << 8));
+}
+
+// Top-left corner for the datum; mirrors drawString for the nine box datums
+static void anchor(uint8_t datum, int w, int h, int &x, int &y) {
+    switch (datum) {
+    case TC_DATUM: x -= w / 2; break;
+    case TR_DATUM: x -= w; break;
+    case ML_DATUM: y -= h / 2; break;
+    case MC_DATUM: x -= w / 2; y -= h / 2; break;
+    case MR_DATUM: x -= w; y -= h / 2; break;
+    case BL_DATUM: y -= h; break;
+    case BC_DATUM: x -= w / 2; y -= h; break;
+    case BR_DATUM: x -= w; y -= h; break;
+    default: break; // TL_DATUM
+    }
+}
+
+static TextEntry *find(const char *text, const lgfx::IFont *font, float size, uint16_t fg, int32_t bg) {
+    for (TextEntry &e : g_entries) {
+        if (e.used && e.font == font && e.size == size && e.fg == fg && e.bg == bg && strcmp(e.text, text) == 0) {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+static void resetArena() {
+    for (TextEntry &e : g_entries) e.used = false;
+    g_arenaUsed = 0;
+    g_stats.resets++;
+    LOGD("text", "label cache full, cleared");
+}
+
+// Rasterizes text into a new entry; nullptr if it can never fit
+static TextEntry *add(const char *text, const lgfx::IFont *font, float size, uint16_t fg, int32_t bg) {
+    g_raster.setFont(font);
+    g_raster.setTextSize(size);
+    int w = g_raster.textWidth(text);
+    int h = g_raster.fontHeight();
+    size_t bytes = bitmapBytes(w, h);
+    if (w <= 0 || h <= 0 || bytes > TEXT_CACHE_BYTES / 4) return nullptr; // huge labels are drawn directly
+
+    if (g_arenaUsed + bytes > TEXT_CACHE_BYTES) resetArena();
+    TextEntry *slot = nullptr;
+    for (TextEntry &e : g_entries) {
+        if (!e.used) { slot = &e; break; }
+        if (!slot || e.lastUse < slot->lastUse) slot = &e; // least recently used
+    }
+    // A replaced entry's bitmap stays in the arena until the next reset
+
+    slot->used = true;
+    strcpy(slot->text, text);
+    slot->font = font;
+    slot->size = size;
+    slot->fg = fg;
+    slot->bg = bg;
+    slot->offset = (uint16_t)g_arenaUsed;
+    slot->w = (int16_t)w;
+    slot->h = (int16_t)h;
+    g_arenaUsed += bytes;
+
+    // Index 0 = background, 1 = glyph pixels. The palette outlives setBuffer()/deleteSprite(), so it
+    // is allocated on the first miss only.
+    g_raster.setBuffer(g_arena + slot->offset, w, h, lgfx::palette_1bit);
+    if (!g_raster.hasPalette()) g_raster.createPalette();
+    g_raster.fillSprite(0);
+    g_raster.setTextColor(1);
+    g_raster.setTextDatum(TL_DATUM);
+    g_raster.drawString(text, 0, 0);
+    g_raster.deleteSprite(); // detaches the arena, which the sprite does not own
+    return slot;
+}
+
+void drawTextCached(M5Canvas &canvas, const char *text, int x, int y, uint8_t datum, float size,
+                    uint16_t fg, int32_t bg) {
+    if (!text || !*text) return;
+    const lgfx::IFont *font = canvas.getFont();
+    TextEntry *e = nullptr;
+    if (strlen(text) <= TEXT_CACHE_MAX_LEN) {
+        e = find(text, font, size, fg, bg);
+        if (e) g_stats.hits++;
+        else {
+            g_stats.misses++;
+            e = add(text, font, size, fg, bg);
+        }
+    }
+
+    if (!e) { // too long or too large for the cache
+        canvas.setTextDatum(datum);
+        canvas.setTextSize(size);
+        if (bg == TEXT_TRANSPARENT) canvas.setTextColor(fg);
+        else canvas.setTextColor(fg, (uint16_t)bg);
+        canvas.drawString(text, x, y);
+        return;
+    }
+
+    e->lastUse = ++g_stamp;
+    anchor(datum, e->w, e->h, x, y);
+    uint16_t palette[2] = { swap16(bg == TEXT_TRANSPARENT ? 0 : (uint16_t)bg), swap16(fg) };
+    if (bg == TEXT_TRANSPARENT) {
+        canvas.pushImage(x, y, e->w, e->h, g_arena + e->offset, 0u, lgfx::palette_1bit, (const lgfx::swap565_t*)palette);
+    } else {
+        canvas.pushImage(x, y, e->w, e->h, g_arena + e->offset, lgfx::palette_1bit, (const lgfx::swap565_t*)palette);
+    }
+}
+
+TextCacheStats textCacheStats() {
+    TextCacheStats s = g_stats;
+    s.bytesUsed = g_arenaUsed;
+    return s;
+}
@@ -0,0 +1,20 @@
+#ifndef TEST_SHIM_ARDUINO_H
+#define TEST_SHIM_ARDUINO_H
+
+// Just enough of Arduino.h for the hardware-independent modules built by [env:native].
+// Tests set g_testMillis to drive time; micros() is the real clock, for benchmark timings.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+inline uint32_t g_testMillis = 0;
+inline uint32_t millis() { return g_testMillis; }
+inline uint32_t micros() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#endif // TEST_SHIM_ARDUINO_H
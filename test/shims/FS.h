@@ -0,0 +1,121 @@
+#ifndef TEST_SHIM_FS_H
+#define TEST_SHIM_FS_H
+
+// In-memory stand-in for the Arduino fs::FS / fs::File API, with fault injection.
+// Writes land in the file immediately, like LittleFS appends, so a cut-off write leaves a short file.
+//
+//   fs::FS fs;
+//   fs.writeBudget = 10;   // the next 10 bytes succeed, then the "power fails": every later
+//                          // write, rename and remove fails until fs.powerRestored()
+//   fs.failRename = true;  // rename fails, everything else works
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+class FS;
+
+class File {
+public:
+    File() {}
+    File(FS *fs, const std::string &path, bool writable) : fs_(fs), path_(path), writable_(writable) {}
+
+    explicit operator bool() const { return fs_ != nullptr; }
+    inline size_t write(const uint8_t *buf, size_t len);
+    size_t write(uint8_t b) { return write(&b, 1); }
+    inline size_t read(uint8_t *buf, size_t len);
+    int read() { uint8_t b; return read(&b, 1) == 1 ? b : -1; }
+    inline size_t size() const;
+    int available() const { return (int)(size() - pos_); }
+    void close() { fs_ = nullptr; }
+
+private:
+    FS *fs_ = nullptr;
+    std::string path_;
+    bool writable_ = false;
+    size_t pos_ = 0;
+};
+
+class FS {
+public:
+    std::map<std::string, std::vector<uint8_t>> files;
+    long writeBudget = -1;          // bytes left before power loss, -1 = unlimited
+    bool failRename = false;
+
+    bool powerLost() const { return writeBudget == 0; }
+    void powerRestored() { writeBudget = -1; }
+
+    File open(const char *path, const char *mode = FILE_READ, bool create = false) {
+        (void)create;
+        if (mode[0] == 'r') {
+            if (!files.count(path)) return File();
+            return File(this, path, false);
+        }
+        if (powerLost()) return File();
+        if (mode[0] == 'w' || !files.count(path)) files[path].clear();
+        return File(this, path, true);
+    }
+    bool exists(const char *path) { return files.count(path) != 0; }
+    bool remove(const char *path) {
+        if (powerLost()) return false;
+        return files.erase(path) != 0;
+    }
+    bool rename(const char *from, const char *to) {
+        if (powerLost() || failRename || !files.count(from)) return false;
+        std::vector<uint8_t> data = files[from];
+        files.erase(from);
+        files[to] = data;
+        return true;
+    }
+    // Test helpers
+    std::string contents(const char *path) {
+        auto it = files.find(path);
+        return it == files.end() ? std::string() : std::string(it->second.begin(), it->second.end());
+    }
+    void put(const char *path, const char *text) { files[path].assign(text, text + strlen(text)); }
+};
+
+inline size_t File::write(const uint8_t *buf, size_t len) {
+    if (!fs_ || !writable_) return 0;
+    size_t n = len;
+    if (fs_->writeBudget >= 0 && (long)n > fs_->writeBudget) n = (size_t)fs_->writeBudget;
+    if (fs_->writeBudget > 0) fs_->writeBudget -= (long)n;
+    std::vector<uint8_t> &data = fs_->files[path_];
+    data.insert(data.end(), buf, buf + n);
+    return n;
+}
+
+inline size_t File::read(uint8_t *buf, size_t len) {
+    if (!fs_) return 0;
+    const std::vector<uint8_t> &data = fs_->files[path_];
+    size_t n = pos_ < data.size() ? data.size() - pos_ : 0;
+    if (n > len) n = len;
+    memcpy(buf, data.data() + pos_, n);
+    pos_ += n;
+    return n;
+}
+
+inline size_t File::size() const {
+    if (!fs_) return 0;
+    auto it = fs_->files.find(path_);
+    return it == fs_->files.end() ? 0 : it->second.size();
+}
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+
+// What storageFs() returns in the native tests (test/shims/shims.cpp)
+extern fs::FS g_testFs;
+
+#endif // TEST_SHIM_FS_H
@@ -0,0 +1,9 @@
+// Definitions the native env links into every test binary (see build_src_filter in platformio.ini)
+#include "storage.h"
+#include "log.h"
+
+fs::FS g_testFs;
+
+fs::FS &storageFs() { return g_testFs; }
+
+void logWrite(char, const char *, const char *, ...) {}
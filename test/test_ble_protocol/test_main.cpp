@@ -0,0 +1,284 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <stdio.h>
+#include "ble_protocol.h"
+#include "ble_scenarios.h"
+
+// The protocol unit driven the way checkBLEStatus() drives it on the device: each main loop pass
+// drains the inbound queue, applies the commands, sends one queued notification and builds one
+// locations chunk. The fake central writes BLE_SCENARIOS traffic in bursts between passes.
+
+static const uint32_t LOOP_MS = 5; // simulated main loop period
+
+// ---- Fake app state (what bluetooth.cpp applies commands to) ----
+static LocationStore store; // static: large
+static bool targetSet;
+static double targetLat, targetLon;
+static uint32_t positions;
+static bool locationsChanged;
+
+// ---- Fake central: notifications received ----
+static uint32_t notifyCount[(size_t)BleChar::Count];
+static uint32_t notifyBytes;
+static uint32_t syncReceived;      // locations received in order since the last chunk 0
+static bool syncInOrder, lastChunkFinal;
+
+static void apply(const BleCommand &cmd) {
+    switch (cmd.kind) {
+        case BleCommand::Kind::Target:
+            targetSet = true; targetLat = cmd.lat; targetLon = cmd.lon;
+            break;
+        case BleCommand::Kind::AddLocation:
+            if (store.add(cmd.name, cmd.lat, cmd.lon)) locationsChanged = true;
+            break;
+        case BleCommand::Kind::Position:
+            positions++;
+            break;
+        default:
+            break;
+    }
+}
+
+static void receive(const BLEOutbound::Msg &m) {
+    notifyCount[(size_t)m.ch]++;
+    notifyBytes += m.len;
+    if (m.ch != BleChar::LocationsList) return;
+    JsonDocument doc;
+    TEST_ASSERT_FALSE(deserializeJson(doc, (const char *)m.data, m.len));
+    TEST_ASSERT_TRUE(m.len <= BLEOutbound::MAX_LEN);
+    if (doc["chunk"] == 0) { syncReceived = 0; syncInOrder = true; }
+    if (doc["first"] != syncReceived) syncInOrder = false;
+    JsonArray items = doc["items"];
+    TEST_ASSERT_TRUE(items.size() >= 1 && items.size() <= BLELocationsSync::PER_CHUNK);
+    for (JsonObject o : items) {
+        if (strcmp(o["name"] | "", store.name(syncReceived)) != 0) syncInOrder = false;
+        syncReceived++;
+    }
+    lastChunkFinal = doc["final"];
+}
+
+// One checkBLEStatus() pass, minus heartbeat and telemetry
+static void loopPass() {
+    g_testMillis += LOOP_MS;
+    BLEInbound::Msg msg;
+    BleCommand cmd;
+    while (BLEInbound::dequeue(msg)) {
+        if (bleDecodeInbound(msg, cmd)) apply(cmd);
+    }
+    if (locationsChanged) {
+        locationsChanged = false;
+        BLELocationsSync::start(store.size());
+        char out[BLELocationsSync::CHUNK_MAX];
+        BLELocationsSync::next(store, true, out);
+    }
+    BLEOutbound::Msg out;
+    if (BLEOutbound::dequeue(out)) {
+        g_bleStats.notifies++;
+        receive(out);
+    }
+    if (BLELocationsSync::inProgress()) {
+        char chunk[BLELocationsSync::CHUNK_MAX];
+        BLELocationsSync::next(store, true, chunk);
+    }
+}
+
+static void write(BleChar ch, const uint8_t *buf, size_t len) {
+    // Same mapping as bleOnWrite()
+    BLEInbound::Type t = ch == BleChar::Target ? BLEInbound::Type::Target
+        : ch == BleChar::LocationsModify ? BLEInbound::Type::LocationsModify : BLEInbound::Type::Position;
+    BLEInbound::enqueue(t, (const char *)buf, len);
+}
+
+struct Result {
+    uint32_t loops;
+    uint32_t us;
+};
+
+static Result runScenario(const BleScenario &sc) {
+    uint32_t t0 = micros();
+    Result r = {0, 0};
+    uint16_t sent = 0;
+    while (sent < sc.count) {
+        for (uint8_t b = 0; b < sc.burst && sent < sc.count; ++b) {
+            uint8_t buf[BLE_SCENARIO_MAX_WRITE];
+            BleChar ch;
+            size_t len = sc.build(sent++, millis(), ch, buf);
+            write(ch, buf, len);
+        }
+        loopPass();
+        r.loops++;
+    }
+    // Drain: stop once a pass produces no notification and processes nothing
+    uint32_t idlePasses = 0;
+    while (idlePasses < 20 && r.loops < 100000) {
+        BleProtocolStats before = getBleProtocolStats();
+        loopPass();
+        r.loops++;
+        BleProtocolStats after = getBleProtocolStats();
+        bool progress = after.notifies != before.notifies || after.inboundProcessed != before.inboundProcessed;
+        idlePasses = progress ? 0 : idlePasses + 1;
+    }
+    r.us = micros() - t0;
+
+    BleProtocolStats st = getBleProtocolStats();
+    float secs = r.us / 1e6f;
+    printf("[bench] %s\n", sc.name);
+    printf("[bench]   %u writes in %lu loop passes, %.1f ms\n", (unsigned)sent, (unsigned long)r.loops, r.us / 1000.0f);
+    printf("[bench]   processed %lu (%.0f msg/s), drops in %lu out %lu, parse errors %lu\n",
+        (unsigned long)st.inboundProcessed, secs > 0 ? st.inboundProcessed / secs : 0.0f,
+        (unsigned long)st.inboundDrops, (unsigned long)st.outboundDrops, (unsigned long)st.rxParseErrors);
+    printf("[bench]   queue high-water in %u/%u out %u/%u\n",
+        st.inboundHighWater, st.queueSize - 1, st.outboundHighWater, st.queueSize - 1);
+    printf("[bench]   json parse avg %lu us max %lu us (%lu parses)\n",
+        (unsigned long)(st.parseCount ? st.parseUsTotal / st.parseCount : 0), (unsigned long)st.parseUsMax,
+        (unsigned long)st.parseCount);
+    printf("[bench]   notifies %lu (%lu B): target %lu list %lu\n", (unsigned long)st.notifies, (unsigned long)notifyBytes,
+        (unsigned long)notifyCount[(size_t)BleChar::Target], (unsigned long)notifyCount[(size_t)BleChar::LocationsList]);
+    return r;
+}
+
+static const BleScenario &scenario(const char *name) {
+    for (size_t i = 0; i < BLE_SCENARIO_COUNT; ++i) {
+        if (strcmp(BLE_SCENARIOS[i].name, name) == 0) return BLE_SCENARIOS[i];
+    }
+    TEST_FAIL_MESSAGE("unknown scenario");
+    return BLE_SCENARIOS[0];
+}
+
+void setUp() {
+    BLEInbound::Msg in;
+    while (BLEInbound::dequeue(in)) {}
+    BLEOutbound::clear();
+    BLELocationsSync::start(0);
+    char out[BLELocationsSync::CHUNK_MAX];
+    BLELocationsSync::next(store, true, out); // ends the (empty) sync
+    resetBleProtocolStats();
+    store.clear();
+    targetSet = false;
+    positions = 0;
+    locationsChanged = false;
+    memset(notifyCount, 0, sizeof(notifyCount));
+    notifyBytes = 0;
+    syncReceived = 0;
+    syncInOrder = lastChunkFinal = false;
+}
+void tearDown() {}
+
+static void test_bulk_add_500_locations() {
+    runScenario(scenario("bulk add 500 locations"));
+    BleProtocolStats st = getBleProtocolStats();
+    TEST_ASSERT_EQUAL_UINT32(500, st.inboundProcessed);
+    TEST_ASSERT_EQUAL_UINT32(0, st.inboundDrops);
+    TEST_ASSERT_EQUAL_UINT32(0, st.outboundDrops);
+    TEST_ASSERT_EQUAL_UINT32(0, st.rxParseErrors);
+    TEST_ASSERT_EQUAL(500, store.size());
+    TEST_ASSERT_EQUAL_STRING("Bench 499", store.name(499));
+    TEST_ASSERT_TRUE(st.outboundHighWater <= st.queueSize - 1);
+    // The last sync (started by the last add) ran to completion, every location in order
+    TEST_ASSERT_FALSE(BLELocationsSync::inProgress());
+    TEST_ASSERT_TRUE(lastChunkFinal);
+    TEST_ASSERT_TRUE(syncInOrder);
+    TEST_ASSERT_EQUAL_UINT32(500, syncReceived);
+}
+
+static void test_rapid_target_writes() {
+    runScenario(scenario("rapid target writes"));
+    BleProtocolStats st = getBleProtocolStats();
+    TEST_ASSERT_EQUAL_UINT32(200, st.inboundProcessed);
+    TEST_ASSERT_EQUAL_UINT32(0, st.inboundDrops);
+    TEST_ASSERT_EQUAL_UINT32(0, st.rxParseErrors);
+    TEST_ASSERT_TRUE(targetSet);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 51.4 + 199 * 0.0001, targetLat); // last write wins
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 5.4 + 199 * 0.0001, targetLon);
+    TEST_ASSERT_TRUE(st.inboundHighWater <= 4);
+}
+
+static void test_position_flood() {
+    runScenario(scenario("position flood"));
+    BleProtocolStats st = getBleProtocolStats();
+    TEST_ASSERT_EQUAL_UINT32(1000, st.inboundProcessed);
+    TEST_ASSERT_EQUAL_UINT32(0, st.inboundDrops);
+    TEST_ASSERT_EQUAL_UINT32(0, st.rxParseErrors);
+    TEST_ASSERT_EQUAL_UINT32(1000, positions);
+    TEST_ASSERT_EQUAL_UINT32(500, g_bleStats.binaryPosPackets);
+    TEST_ASSERT_EQUAL_UINT32(500, g_bleStats.jsonPosPackets);
+    TEST_ASSERT_EQUAL_UINT32(500, st.parseCount); // binary frames skip the JSON parser
+}
+
+static void test_inbound_overflow_is_counted() {
+    const char *msg = "{\"lat\":1,\"lon\":2}";
+    for (int i = 0; i < BLEInbound::QSIZE + 2; ++i) {
+        BLEInbound::enqueue(BLEInbound::Type::Position, msg, strlen(msg));
+    }
+    BleProtocolStats st = getBleProtocolStats();
+    TEST_ASSERT_EQUAL_UINT8(BLEInbound::QSIZE - 1, st.inboundHighWater);
+    TEST_ASSERT_EQUAL_UINT32(3, st.inboundDrops);
+}
+
+static void test_chunk_waits_for_a_free_slot() {
+    store.add("A", 1, 1);
+    store.add("B", 2, 2);
+    store.add("C", 3, 3);
+    store.add("D", 4, 4);
+    const uint8_t filler[1] = {0};
+    while (BLEOutbound::freeSlots() > 0) BLEOutbound::enqueue(BleChar::Ready, filler, 1);
+
+    char out[BLELocationsSync::CHUNK_MAX];
+    BLELocationsSync::start(store.size());
+    TEST_ASSERT_EQUAL(0, BLELocationsSync::next(store, true, out)); // nothing built, nothing lost
+    TEST_ASSERT_EQUAL_UINT32(0, getBleProtocolStats().outboundDrops);
+
+    BLEOutbound::Msg m;
+    BLEOutbound::dequeue(m);
+    TEST_ASSERT_TRUE(BLELocationsSync::next(store, true, out) > 0);
+    TEST_ASSERT_NOT_NULL(strstr(out, "\"chunk\":0"));
+    BLEOutbound::dequeue(m);
+    TEST_ASSERT_TRUE(BLELocationsSync::next(store, true, out) > 0);
+    TEST_ASSERT_NOT_NULL(strstr(out, "\"first\":3"));
+    TEST_ASSERT_NOT_NULL(strstr(out, "\"final\":true"));
+    BLELocationsSync::next(store, true, out);
+    TEST_ASSERT_FALSE(BLELocationsSync::inProgress());
+}
+
+static void test_long_name_is_cut_to_fit() {
+    char name[101];
+    memset(name, 'x', 100);
+    name[100] = '\0';
+    store.add(name, -33.1234567, -151.1234567);
+    store.add(name, -33.1234567, -151.1234567);
+
+    char out[BLELocationsSync::CHUNK_MAX];
+    BLELocationsSync::start(store.size());
+    size_t n = BLELocationsSync::next(store, true, out);
+    TEST_ASSERT_TRUE(n > 0 && n <= BLEOutbound::MAX_LEN);
+    TEST_ASSERT_NOT_NULL(strstr(out, "\"first\":0"));
+    TEST_ASSERT_NOT_NULL(strstr(out, "\"final\":false")); // one per chunk
+    TEST_ASSERT_NOT_NULL(strstr(out, "xxxxxxxxxx"));
+    n = BLELocationsSync::next(store, true, out);
+    TEST_ASSERT_TRUE(n > 0 && n <= BLEOutbound::MAX_LEN);
+    TEST_ASSERT_NOT_NULL(strstr(out, "\"first\":1"));
+    TEST_ASSERT_NOT_NULL(strstr(out, "\"final\":true"));
+    TEST_ASSERT_EQUAL_UINT32(0, getBleProtocolStats().outboundDrops);
+}
+
+static void test_decode_rejects_out_of_range() {
+    const char *bad = "{\"lat\":91,\"lon\":2}";
+    BLEInbound::enqueue(BLEInbound::Type::Target, bad, strlen(bad));
+    BLEInbound::Msg msg;
+    TEST_ASSERT_TRUE(BLEInbound::dequeue(msg));
+    BleCommand cmd;
+    TEST_ASSERT_FALSE(bleDecodeInbound(msg, cmd));
+    TEST_ASSERT_TRUE(cmd.kind == BleCommand::Kind::None);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_bulk_add_500_locations);
+    RUN_TEST(test_rapid_target_writes);
+    RUN_TEST(test_position_flood);
+    RUN_TEST(test_inbound_overflow_is_counted);
+    RUN_TEST(test_chunk_waits_for_a_free_slot);
+    RUN_TEST(test_long_name_is_cut_to_fit);
+    RUN_TEST(test_decode_rejects_out_of_range);
+    return UNITY_END();
+}
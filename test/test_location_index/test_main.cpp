@@ -0,0 +1,83 @@
+#include <unity.h>
+#include <algorithm>
+#include "location_index.h"
+
+static LocationStore store;
+static LocationIndex locIndex;
+static uint32_t seed;
+
+static double uniform(double lo, double hi) {
+    seed = seed * 1664525u + 1013904223u;
+    return lo + (hi - lo) * (seed >> 8) / 16777216.0;
+}
+
+void setUp() {
+    store.clear();
+    seed = 12345;
+}
+void tearDown() {}
+
+static void fillRandom(size_t n, double lat0, double lon0, double spread) {
+    for (size_t i = 0; i < n; i++) {
+        store.add("p", lat0 + uniform(-spread, spread), lon0 + uniform(-spread, spread));
+    }
+}
+
+static void test_nearest_matches_brute_force() {
+    fillRandom(500, 52.0, 5.0, 0.5);
+    const double qLat = 52.1, qLon = 4.9;
+    uint16_t got[10];
+    TEST_ASSERT_EQUAL(10, locIndex.nearest(store, qLat, qLon, 10, got));
+
+    uint16_t all[500];
+    for (uint16_t i = 0; i < 500; i++) all[i] = i;
+    std::sort(all, all + 500, [&](uint16_t a, uint16_t b) {
+        return LocationIndex::distanceM(store, a, qLat, qLon) < LocationIndex::distanceM(store, b, qLat, qLon);
+    });
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(all, got, 10);
+}
+
+static void test_nearest_with_fewer_entries_than_asked() {
+    store.add("a", 1, 1);
+    store.add("b", 2, 2);
+    uint16_t got[5];
+    TEST_ASSERT_EQUAL(2, locIndex.nearest(store, 0, 0, 5, got));
+    TEST_ASSERT_EQUAL(0, got[0]);
+    TEST_ASSERT_EQUAL(1, got[1]);
+}
+
+static void test_within_radius() {
+    fillRandom(300, 52.0, 5.0, 0.2);
+    const float radius = 5000.0f;
+    size_t expected = 0;
+    for (size_t i = 0; i < store.size(); i++) {
+        if (LocationIndex::distanceM(store, i, 52.0, 5.0) <= radius) expected++;
+    }
+    TEST_ASSERT_TRUE(expected > 0);
+    TEST_ASSERT_EQUAL(expected, locIndex.within(store, 52.0, 5.0, radius, nullptr, 0));
+}
+
+static void test_index_follows_store_edits() {
+    store.add("far", 10, 10);
+    uint16_t got[1];
+    locIndex.nearest(store, 0, 0, 1, got);
+    TEST_ASSERT_EQUAL(0, got[0]);
+    store.add("near", 0.001, 0.001);
+    locIndex.nearest(store, 0, 0, 1, got);
+    TEST_ASSERT_EQUAL(1, got[0]);
+}
+
+static void test_distance_across_antimeridian() {
+    store.add("east", 0.0, 179.999);
+    TEST_ASSERT_FLOAT_WITHIN(5.0f, 222.4f, LocationIndex::distanceM(store, 0, 0.0, -179.999));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_nearest_matches_brute_force);
+    RUN_TEST(test_nearest_with_fewer_entries_than_asked);
+    RUN_TEST(test_within_radius);
+    RUN_TEST(test_index_follows_store_edits);
+    RUN_TEST(test_distance_across_antimeridian);
+    return UNITY_END();
+}
@@ -0,0 +1,84 @@
+#include <unity.h>
+#include "location_record.h"
+
+static LocationStore store;
+
+void setUp() { store.clear(); }
+void tearDown() {}
+
+static void test_crc_matches_ieee() {
+    // Same CRC-32 as zlib (and the ESP32 ROM routine): body "123456789" followed by zeros
+    DbRecord r;
+    memset(&r, 0, sizeof(r));
+    memcpy(&r, "123456789", 9);
+    TEST_ASSERT_EQUAL_UINT32(0x285969DBu, locationRecordCrc(r));
+}
+
+static void test_replay_add_update_remove() {
+    DbRecord r;
+    locationRecordFill(r, DB_OP_ADD, 0, "Home", 52.0907, 5.1214);
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Applied);
+    locationRecordFill(r, DB_OP_ADD, 0, "Work", 1.0, 2.0);
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Applied);
+    locationRecordFill(r, DB_OP_UPDATE, 1, "Office", 3.0, 4.0);
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Applied);
+    locationRecordFill(r, DB_OP_REMOVE, 0, nullptr, 0, 0);
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Applied);
+
+    TEST_ASSERT_EQUAL(1, store.size());
+    TEST_ASSERT_EQUAL_STRING("Office", store.name(0));
+    TEST_ASSERT_EQUAL_INT32(30000000, store.latE7(0));
+}
+
+static void test_full_length_name() {
+    char name[LOCATION_NAME_MAX_LEN + 1];
+    memset(name, 'n', LOCATION_NAME_MAX_LEN);
+    name[LOCATION_NAME_MAX_LEN] = '\0';
+    DbRecord r;
+    locationRecordFill(r, DB_OP_ADD, 0, name, 0, 0);
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Applied);
+    TEST_ASSERT_EQUAL_STRING(name, store.name(0));
+}
+
+static void test_flipped_bit_is_corrupt() {
+    DbRecord r;
+    locationRecordFill(r, DB_OP_ADD, 0, "Home", 52.0, 5.0);
+    r.latE7 ^= 0x100;
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Corrupt);
+    TEST_ASSERT_EQUAL(0, store.size());
+}
+
+static void test_intact_but_invalid_is_rejected() {
+    DbRecord r;
+    locationRecordFill(r, DB_OP_REMOVE, 3, nullptr, 0, 0); // no entry 3
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Rejected);
+    locationRecordFill(r, (DbOp)9, 0, "x", 0, 0);           // unknown op
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Rejected);
+}
+
+static void test_full_store_rejects_without_corruption() {
+    char name[8];
+    DbRecord r;
+    for (size_t i = 0; i < LOCATION_STORE_MAX; i++) {
+        snprintf(name, sizeof(name), "%u", (unsigned)i);
+        locationRecordFill(r, DB_OP_ADD, 0, name, 0, 0);
+        TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Applied);
+    }
+    locationRecordFill(r, DB_OP_ADD, 0, "overflow", 0, 0);
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Rejected);
+    // Later records still apply
+    locationRecordFill(r, DB_OP_REMOVE, 0, nullptr, 0, 0);
+    TEST_ASSERT_TRUE(locationRecordApply(store, r) == DbReplay::Applied);
+    TEST_ASSERT_EQUAL(LOCATION_STORE_MAX - 1, store.size());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_crc_matches_ieee);
+    RUN_TEST(test_replay_add_update_remove);
+    RUN_TEST(test_full_length_name);
+    RUN_TEST(test_flipped_bit_is_corrupt);
+    RUN_TEST(test_intact_but_invalid_is_rejected);
+    RUN_TEST(test_full_store_rejects_without_corruption);
+    return UNITY_END();
+}
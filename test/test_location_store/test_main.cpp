@@ -0,0 +1,89 @@
+#include <unity.h>
+#include "location_store.h"
+
+static LocationStore store;
+
+void setUp() { store.clear(); }
+void tearDown() {}
+
+static void test_add_and_read_back() {
+    TEST_ASSERT_TRUE(store.add("Home", 52.0907, 5.1214));
+    TEST_ASSERT_TRUE(store.add("Work", -33.8688, 151.2093));
+    TEST_ASSERT_EQUAL(2, store.size());
+    TEST_ASSERT_EQUAL_STRING("Work", store.name(1));
+    TEST_ASSERT_EQUAL_INT32(-338688000, store.latE7(1));
+    TEST_ASSERT_EQUAL_INT32(1512093000, store.lonE7(1));
+    TEST_ASSERT_EQUAL(strlen("Home") + 1 + strlen("Work") + 1, store.poolUsed());
+}
+
+static void test_long_names_are_truncated() {
+    char name[80];
+    memset(name, 'x', sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    TEST_ASSERT_TRUE(store.add(name, 0, 0));
+    TEST_ASSERT_EQUAL(LOCATION_NAME_MAX_LEN, strlen(store.name(0)));
+}
+
+static void test_remove_compacts_pool() {
+    store.add("a", 1, 1);
+    store.add("bbbb", 2, 2);
+    store.add("cc", 3, 3);
+    size_t before = store.poolUsed();
+    TEST_ASSERT_TRUE(store.remove(1));
+    TEST_ASSERT_EQUAL(before - 5, store.poolUsed());
+    TEST_ASSERT_EQUAL(2, store.size());
+    TEST_ASSERT_EQUAL_STRING("a", store.name(0));
+    TEST_ASSERT_EQUAL_STRING("cc", store.name(1));
+    TEST_ASSERT_EQUAL_INT32(30000000, store.latE7(1));
+    TEST_ASSERT_FALSE(store.remove(2));
+}
+
+static void test_update_renames_in_place() {
+    store.add("first", 1, 1);
+    store.add("second", 2, 2);
+    TEST_ASSERT_TRUE(store.update(0, "renamed first", 5, 6));
+    TEST_ASSERT_EQUAL_STRING("renamed first", store.name(0));
+    TEST_ASSERT_EQUAL_STRING("second", store.name(1));
+    TEST_ASSERT_EQUAL_INT32(50000000, store.latE7(0));
+    TEST_ASSERT_FALSE(store.update(2, "x", 0, 0));
+}
+
+static void test_update_with_own_name() {
+    store.add("alpha", 1, 1);
+    store.add("beta", 2, 2);
+    // The source string lives in the pool and moves during the rename
+    TEST_ASSERT_TRUE(store.update(0, store.name(1), 1, 1));
+    TEST_ASSERT_EQUAL_STRING("beta", store.name(0));
+    TEST_ASSERT_EQUAL_STRING("beta", store.name(1));
+}
+
+static void test_full_store_rejects_add() {
+    char name[8];
+    for (size_t i = 0; i < LOCATION_STORE_MAX; i++) {
+        snprintf(name, sizeof(name), "%u", (unsigned)i);
+        TEST_ASSERT_TRUE(store.add(name, 0, 0));
+    }
+    TEST_ASSERT_FALSE(store.add("one more", 0, 0));
+    TEST_ASSERT_EQUAL(LOCATION_STORE_MAX, store.size());
+}
+
+static void test_revision_changes_on_edit() {
+    uint32_t r0 = store.revision();
+    store.add("x", 0, 0);
+    uint32_t r1 = store.revision();
+    TEST_ASSERT_TRUE(r1 != r0);
+    store.update(0, "y", 0, 0);
+    TEST_ASSERT_TRUE(store.revision() != r1);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_add_and_read_back);
+    RUN_TEST(test_long_names_are_truncated);
+    RUN_TEST(test_remove_compacts_pool);
+    RUN_TEST(test_update_renames_in_place);
+    RUN_TEST(test_update_with_own_name);
+    RUN_TEST(test_full_store_rejects_add);
+    RUN_TEST(test_revision_changes_on_edit);
+    return UNITY_END();
+}
@@ -0,0 +1,89 @@
+#include <unity.h>
+#include <Arduino.h>
+#include "position_source.h"
+
+// Both sources are refreshed in every test; the old ones expire when time jumps ahead
+static uint32_t now;
+
+void setUp() {
+    now += 60000;
+    g_testMillis = now;
+}
+void tearDown() {}
+
+static const double LAT = 52.0, LON = 5.0;
+static const double FAR_LAT = 52.001; // ~111 m north
+
+static void test_single_source() {
+    positionUpdateGps(LAT, LON, 5.0f, now);
+    double lat = 0, lon = 0;
+    float err;
+    TEST_ASSERT_TRUE(positionSelect(lat, lon, &err) == PositionSource::Gps);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, LAT, lat);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 5.0f, err);
+}
+
+static void test_expected_error_grows_with_age() {
+    positionUpdateBle(LAT, LON, 10.0f, now);
+    g_testMillis = now + 4000;
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 16.0f, positionExpectedError(PositionSource::Ble));
+    g_testMillis = now + 31000; // past the BLE age limit
+    TEST_ASSERT_TRUE(positionExpectedError(PositionSource::Ble) < 0.0f);
+}
+
+static void test_consistent_sources_blend() {
+    positionUpdateGps(LAT, LON, 10.0f, now);
+    positionUpdateBle(LAT + 0.00002, LON, 10.0f, now); // ~2 m apart
+    double lat, lon;
+    float err;
+    TEST_ASSERT_TRUE(positionSelect(lat, lon, &err) == PositionSource::Blended);
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, LAT + 0.00001, lat); // equal weights
+    TEST_ASSERT_TRUE(err < 10.0f);
+}
+
+static void test_disagreeing_sources_pick_the_better() {
+    positionUpdateGps(LAT, LON, 30.0f, now);
+    positionUpdateBle(FAR_LAT, LON, 5.0f, now);
+    double lat, lon;
+    TEST_ASSERT_TRUE(positionSelect(lat, lon) == PositionSource::Ble);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, FAR_LAT, lat);
+}
+
+static void test_hysteresis_survives_a_blend() {
+    double lat, lon;
+    // GPS is preferred while clearly better
+    positionUpdateGps(LAT, LON, 10.0f, now);
+    positionUpdateBle(FAR_LAT, LON, 40.0f, now);
+    TEST_ASSERT_TRUE(positionSelect(lat, lon) == PositionSource::Gps);
+    // Agreement for a while
+    positionUpdateBle(LAT, LON, 10.0f, now);
+    TEST_ASSERT_TRUE(positionSelect(lat, lon) == PositionSource::Blended);
+    // BLE slightly better but disagreeing: within the switch margin, so GPS stays
+    positionUpdateBle(FAR_LAT, LON, 9.0f, now);
+    TEST_ASSERT_TRUE(positionSelect(lat, lon) == PositionSource::Gps);
+    // Clearly better: switch
+    positionUpdateBle(FAR_LAT, LON, 7.0f, now);
+    TEST_ASSERT_TRUE(positionSelect(lat, lon) == PositionSource::Ble);
+}
+
+static void test_phone_clock_offset_uses_fastest_packet() {
+    // Phone clock 1000 ms behind. Latency is only known relative to the fastest packet seen.
+    uint32_t t1 = positionPhoneTimeToLocal(now - 1000 - 80, now);
+    TEST_ASSERT_EQUAL_UINT32(now, t1);
+    uint32_t t2 = positionPhoneTimeToLocal(now + 500 - 1000 - 20, now + 500);
+    TEST_ASSERT_EQUAL_UINT32(now + 500, t2);
+    // A packet 180 ms slower than that one is dated back by the difference
+    uint32_t t3 = positionPhoneTimeToLocal(now + 900 - 1000 - 200, now + 900);
+    TEST_ASSERT_EQUAL_UINT32(now + 900 - 180, t3);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_single_source);
+    RUN_TEST(test_expected_error_grows_with_age);
+    RUN_TEST(test_consistent_sources_blend);
+    RUN_TEST(test_disagreeing_sources_pick_the_better);
+    RUN_TEST(test_hysteresis_survives_a_blend);
+    RUN_TEST(test_phone_clock_offset_uses_fastest_packet);
+    return UNITY_END();
+}
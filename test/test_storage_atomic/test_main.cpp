@@ -0,0 +1,73 @@
+#include <unity.h>
+#include "storage.h"
+
+static fs::FS &testFs = g_testFs; // storageFs(), see test/shims/shims.cpp
+
+static const uint8_t NEW_DATA[] = "new contents";
+static const size_t NEW_LEN = sizeof(NEW_DATA) - 1;
+
+void setUp() {
+    testFs = fs::FS();
+    testFs.put("/data.json", "old contents");
+}
+void tearDown() {}
+
+static void test_write_atomic_replaces_file() {
+    TEST_ASSERT_TRUE(storageWriteAtomic("/data.json", NEW_DATA, NEW_LEN));
+    TEST_ASSERT_EQUAL_STRING("new contents", testFs.contents("/data.json").c_str());
+    TEST_ASSERT_FALSE(testFs.exists("/data.json.tmp"));
+}
+
+static void test_short_write_keeps_old_file() {
+    testFs.writeBudget = 4;     // power fails part way through the temp file
+    TEST_ASSERT_FALSE(storageWriteAtomic("/data.json", NEW_DATA, NEW_LEN));
+    TEST_ASSERT_EQUAL_STRING("old contents", testFs.contents("/data.json").c_str());
+}
+
+static void test_stale_temp_file_after_power_loss_is_overwritten() {
+    testFs.writeBudget = 4;
+    storageWriteAtomic("/data.json", NEW_DATA, NEW_LEN);
+    TEST_ASSERT_TRUE(testFs.exists("/data.json.tmp")); // the cleanup could not run either
+
+    testFs.powerRestored();
+    TEST_ASSERT_TRUE(storageWriteAtomic("/data.json", NEW_DATA, NEW_LEN));
+    TEST_ASSERT_EQUAL_STRING("new contents", testFs.contents("/data.json").c_str());
+    TEST_ASSERT_FALSE(testFs.exists("/data.json.tmp"));
+}
+
+static void test_rename_failure_keeps_old_file_and_drops_temp() {
+    testFs.failRename = true;
+    TEST_ASSERT_FALSE(storageWriteAtomic("/data.json", NEW_DATA, NEW_LEN));
+    TEST_ASSERT_EQUAL_STRING("old contents", testFs.contents("/data.json").c_str());
+    TEST_ASSERT_FALSE(testFs.exists("/data.json.tmp"));
+}
+
+static void test_rename_failure_keeps_source() {
+    // Track rotation renames the live file; a failure must not lose it
+    testFs.put("/track.bin", "live");
+    testFs.failRename = true;
+    TEST_ASSERT_FALSE(storageRename("/track.bin", "/track.old.bin"));
+    TEST_ASSERT_EQUAL_STRING("live", testFs.contents("/track.bin").c_str());
+
+    testFs.failRename = false;
+    TEST_ASSERT_TRUE(storageRename("/track.bin", "/track.old.bin"));
+    TEST_ASSERT_FALSE(testFs.exists("/track.bin"));
+    TEST_ASSERT_EQUAL_STRING("live", testFs.contents("/track.old.bin").c_str());
+}
+
+static void test_replace_overwrites_existing_target() {
+    testFs.put("/data.json.tmp", "replacement");
+    TEST_ASSERT_TRUE(storageReplace("/data.json.tmp", "/data.json"));
+    TEST_ASSERT_EQUAL_STRING("replacement", testFs.contents("/data.json").c_str());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_write_atomic_replaces_file);
+    RUN_TEST(test_short_write_keeps_old_file);
+    RUN_TEST(test_stale_temp_file_after_power_loss_is_overwritten);
+    RUN_TEST(test_rename_failure_keeps_old_file_and_drops_temp);
+    RUN_TEST(test_rename_failure_keeps_source);
+    RUN_TEST(test_replace_overwrites_existing_target);
+    return UNITY_END();
+}
@@ -0,0 +1,132 @@
+#include <unity.h>
+#include "track_codec.h"
+
+void setUp() {}
+void tearDown() {}
+
+// Point offset from (52.0, 5.0) by the given meters north/east
+static TrackPoint offsetM(float northM, float eastM, uint32_t t) {
+    const float mPerE6 = 0.111195f;
+    const float cosLat = 0.615661f; // cos(52 deg)
+    TrackPoint p = { 52000000 + (int32_t)lroundf(northM / mPerE6), 5000000 + (int32_t)lroundf(eastM / (mPerE6 * cosLat)), t };
+    return p;
+}
+
+static void test_zigzag_round_trip() {
+    const int32_t values[] = { 0, 1, -1, 63, -64, 1000000, -1000000, INT32_MAX, INT32_MIN };
+    for (int32_t v : values) TEST_ASSERT_EQUAL_INT32(v, trackUnzigzag(trackZigzag(v)));
+    TEST_ASSERT_EQUAL_UINT32(1, trackZigzag(-1));
+    TEST_ASSERT_EQUAL_UINT32(2, trackZigzag(1));
+}
+
+static void test_varint_lengths() {
+    uint8_t buf[8];
+    TEST_ASSERT_EQUAL(1, trackPutVarint(buf, 0x7F));
+    TEST_ASSERT_EQUAL(2, trackPutVarint(buf, 0x80));
+    TEST_ASSERT_EQUAL_UINT8(0x80, buf[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x01, buf[1]);
+    TEST_ASSERT_EQUAL(5, trackPutVarint(buf, UINT32_MAX));
+}
+
+static void test_encode_decode_segments() {
+    TrackPoint pts[] = {
+        offsetM(0, 0, 10), offsetM(20, 5, 20), offsetM(45, -30, 35), // segment 1
+        offsetM(500, 500, 900), offsetM(480, 510, 905),              // segment 2 (after rotation)
+    };
+    uint8_t file[128];
+    size_t len = 0;
+    for (size_t i = 0; i < 5; i++) {
+        bool start = (i == 0 || i == 3);
+        size_t n = trackEncodeVertex(file + len, pts[i], start ? nullptr : &pts[i - 1]);
+        TEST_ASSERT_TRUE(n <= TRACK_RECORD_MAX);
+        if (!start) TEST_ASSERT_TRUE(n <= 7); // short deltas stay small
+        len += n;
+    }
+    TrackDecoder dec;
+    size_t found = 0;
+    int32_t lat, lon;
+    for (size_t i = 0; i < len; i++) {
+        if (dec.push(file[i], lat, lon)) {
+            TEST_ASSERT_EQUAL_INT32(pts[found].latE6, lat);
+            TEST_ASSERT_EQUAL_INT32(pts[found].lonE6, lon);
+            found++;
+        }
+    }
+    TEST_ASSERT_EQUAL(5, found);
+}
+
+static void test_truncated_tail_yields_no_vertex() {
+    uint8_t file[TRACK_RECORD_MAX];
+    TrackPoint p = offsetM(100, 100, 1);
+    size_t n = trackEncodeVertex(file, p, nullptr);
+    TrackDecoder dec;
+    int32_t lat, lon;
+    for (size_t i = 0; i + 1 < n; i++) TEST_ASSERT_FALSE(dec.push(file[i], lat, lon));
+}
+
+static void test_straight_line_keeps_only_ends() {
+    TrackSimplifier s;
+    TrackPoint kept;
+    int keptCount = 0;
+    for (int i = 0; i <= 40; i++) {
+        if (s.add(offsetM(i * 5.0f, 0, i), kept)) keptCount++;
+    }
+    TEST_ASSERT_EQUAL(1, keptCount); // only the first fix
+    TEST_ASSERT_TRUE(s.flush(kept));
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 0.0f, trackPointDistM(kept, offsetM(200, 0, 40)));
+}
+
+static void test_corner_is_kept() {
+    TrackSimplifier s;
+    TrackPoint kept, corner = offsetM(100, 0, 20);
+    s.add(offsetM(0, 0, 0), kept);
+    bool keptCorner = false;
+    for (int i = 1; i <= 20; i++) {
+        if (s.add(offsetM(i * 5.0f, 0, i), kept)) keptCorner = trackPointDistM(kept, corner) < 1.0f;
+    }
+    for (int i = 1; i <= 10 && !keptCorner; i++) {
+        if (s.add(offsetM(100, i * 5.0f, 20 + i), kept)) keptCorner = trackPointDistM(kept, corner) < 1.0f;
+    }
+    TEST_ASSERT_TRUE(keptCorner);
+}
+
+static void test_jitter_below_min_step_is_ignored() {
+    TrackSimplifier s;
+    TrackPoint kept;
+    s.add(offsetM(0, 0, 0), kept);
+    for (int i = 0; i < 20; i++) {
+        TEST_ASSERT_FALSE(s.add(offsetM((i & 1) ? 1.0f : -1.0f, 0.5f, i), kept));
+    }
+    TEST_ASSERT_FALSE(s.flush(kept)); // nothing was accepted into the window
+}
+
+static void test_full_window_forces_a_vertex() {
+    TrackSimplifier s;
+    TrackPoint kept;
+    s.add(offsetM(0, 0, 0), kept);
+    int keptCount = 0;
+    for (int i = 1; i <= TRACK_WINDOW_MAX + 1; i++) {
+        if (s.add(offsetM(i * 5.0f, 0, i), kept)) keptCount++;
+    }
+    TEST_ASSERT_EQUAL(1, keptCount);
+}
+
+static void test_segment_distance() {
+    TrackPoint a = offsetM(0, 0, 0), b = offsetM(100, 0, 0);
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, 10.0f, trackSegmentDistM(offsetM(50, 10, 0), a, b));
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, 20.0f, trackSegmentDistM(offsetM(-20, 0, 0), a, b)); // beyond the end
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_zigzag_round_trip);
+    RUN_TEST(test_varint_lengths);
+    RUN_TEST(test_encode_decode_segments);
+    RUN_TEST(test_truncated_tail_yields_no_vertex);
+    RUN_TEST(test_straight_line_keeps_only_ends);
+    RUN_TEST(test_corner_is_kept);
+    RUN_TEST(test_jitter_below_min_step_is_ignored);
+    RUN_TEST(test_full_window_forces_a_vertex);
+    RUN_TEST(test_segment_distance);
+    return UNITY_END();
+}
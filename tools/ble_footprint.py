@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Build the Bluedroid and NimBLE firmware and write their footprint report (docs/ble_footprint.md).
+
+Flash and static RAM come from the size summary that "pio run" prints for each env. Heap and
+timing come from the boot logs of both builds, from the lines setupBLE() and the first GATT
+access log:
+    [<millis>][I][ble] stack 'nimble' init: <ms> ms, heap used <B> B (free <B> B, min free <B> B)
+    [<millis>][I][ble] connection setup took <ms> ms (nimble)
+Connect and disconnect the phone a few times before saving a log; every setup line is counted.
+Values the run did not provide are written as "not measured".
+
+Usage:
+    # Save a boot log of each build (flash it, connect the app, then stop the monitor)
+    pio run -e m5stack-stamps3 -t upload && pio device monitor | tee bluedroid.log
+    pio run -e m5stack-stamps3-nimble -t upload && pio device monitor | tee nimble.log
+    # Build both envs and write the report
+    tools/ble_footprint.py --log m5stack-stamps3=bluedroid.log --log m5stack-stamps3-nimble=nimble.log
+    # Without a device: sizes only
+    tools/ble_footprint.py
+"""
+
+import argparse
+import os
+import re
+import statistics
+import subprocess
+import sys
+
+ENVS = [("m5stack-stamps3", "Bluedroid"), ("m5stack-stamps3-nimble", "NimBLE")]
+SIZE_RE = re.compile(r"^(RAM|Flash):.*\(used (\d+) bytes from (\d+) bytes\)")
+INIT_RE = re.compile(r"stack '(\w+)' init: (\d+) ms, heap used (-?\d+) B \(free (\d+) B, min free (\d+) B\)")
+SETUP_RE = re.compile(r"connection setup took (\d+) ms")
+NOT_MEASURED = "not measured"
+
+
+def build_sizes(env):
+    """Runs pio run for env. Returns {"RAM": (used, total), "Flash": (used, total)}."""
+    try:
+        out = subprocess.run(["pio", "run", "-e", env], capture_output=True, text=True)
+    except FileNotFoundError:
+        sys.exit("pio not found; install PlatformIO Core or pass --no-build")
+    if out.returncode != 0:
+        sys.stderr.write(out.stdout + out.stderr)
+        sys.exit("pio run -e %s failed" % env)
+    sizes = {}
+    for line in out.stdout.splitlines():
+        m = SIZE_RE.match(line.strip())
+        if m:
+            sizes[m.group(1)] = (int(m.group(2)), int(m.group(3)))
+    return sizes
+
+
+def parse_log(path):
+    """Returns (init values or None, list of connection setup times in ms)."""
+    init, setups = None, []
+    with open(path, encoding="ascii", errors="replace") as f:
+        for line in f:
+            m = INIT_RE.search(line)
+            if m:
+                init = {"stack": m.group(1), "init_ms": int(m.group(2)), "heap_used": int(m.group(3)),
+                        "free": int(m.group(4)), "min_free": int(m.group(5))}
+            m = SETUP_RE.search(line)
+            if m:
+                setups.append(int(m.group(1)))
+    return init, setups
+
+
+def size_cell(sizes, kind):
+    if kind not in sizes:
+        return NOT_MEASURED
+    used, total = sizes[kind]
+    return "%d B (%.1f%% of %d B)" % (used, 100.0 * used / total, total)
+
+
+def report(rows):
+    lines = [
+        "# BLE stack footprint",
+        "",
+        "Written by tools/ble_footprint.py; run it again after changing the BLE backends.",
+        "Flash and static RAM are the `pio run` size summary. Heap and times are the boot log lines",
+        "of setupBLE() (stack init) and of the first GATT access after a connect (connection setup).",
+        "",
+        "| | " + " | ".join(name for _, name, _, _, _ in rows) + " |",
+        "|---|" + "---|" * len(rows),
+    ]
+
+    def row(label, cell):
+        lines.append("| %s | %s |" % (label, " | ".join(cell(r) for r in rows)))
+
+    def init_value(key, unit):
+        return lambda r: "%d %s" % (r[3][key], unit) if r[3] else NOT_MEASURED
+
+    def setup_value(fn):
+        return lambda r: "%d ms" % fn(r[4]) if r[4] else NOT_MEASURED
+
+    row("Env", lambda r: "`%s`" % r[0])
+    row("Flash", lambda r: size_cell(r[2], "Flash"))
+    row("Static RAM", lambda r: size_cell(r[2], "RAM"))
+    row("Heap used by stack init", init_value("heap_used", "B"))
+    row("Free heap after init", init_value("free", "B"))
+    row("Min free heap at init", init_value("min_free", "B"))
+    row("Stack init time", init_value("init_ms", "ms"))
+    row("Connection setup, median", setup_value(lambda s: statistics.median(s)))
+    row("Connection setup, max", setup_value(max))
+    row("Connections logged", lambda r: str(len(r[4])) if r[4] else NOT_MEASURED)
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--log", action="append", default=[], metavar="ENV=PATH", help="boot log of the build of ENV")
+    ap.add_argument("--no-build", action="store_true", help="skip pio run (report the logs only)")
+    ap.add_argument("-o", "--output", default=os.path.join("docs", "ble_footprint.md"))
+    args = ap.parse_args()
+
+    logs = {}
+    for item in args.log:
+        env, sep, path = item.partition("=")
+        if not sep or env not in dict(ENVS):
+            sys.exit("--log expects ENV=PATH with ENV one of %s" % ", ".join(e for e, _ in ENVS))
+        logs[env] = path
+
+    rows = []
+    for env, name in ENVS:
+        sizes = {} if args.no_build else build_sizes(env)
+        init, setups = parse_log(logs[env]) if env in logs else (None, [])
+        rows.append((env, name, sizes, init, setups))
+
+    text = report(rows)
+    os.makedirs(os.path.dirname(args.output) or ".", exist_ok=True)
+    with open(args.output, "w") as f:
+        f.write(text)
+    sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+"""Decode screen captures from the serial console and compare them with reference images.
+
+Flash the capture build (pio run -e m5stack-stamps3-capture -t upload). Then send "cap all" and
+decode the frames. The frame format is described in include/capture.h.
+
+Each frame becomes <name>.png in the output directory. Render times go to render_times.csv next
+to them.
+
+The reference images are in test/golden/: the compass at the fixed "cap all" headings, the menu
+and the settings page (default settings). These pages draw no live data, so with --golden every
+frame that has a reference must match it pixel for pixel. The script exits with status 1 when one
+differs (a <name>.diff.png marks the pixels) or when a reference page was not captured. Pages
+with live data (GPS info, Bluetooth, diagnostics, saved locations) have no reference; they are
+saved and listed, not compared. Render times more than --slower percent above the golden
+render_times.csv, if there is one, are reported but do not fail the run.
+
+Usage:
+    # Straight from the device (needs pyserial)
+    tools/capture_to_png.py --port /dev/ttyACM0 -o captures/
+    # From a saved monitor log (pio device monitor | tee monitor.log, then type "cap all")
+    tools/capture_to_png.py monitor.log -o captures/
+    # Check a build against the references: fails if any frame differs
+    tools/capture_to_png.py --port /dev/ttyACM0 -o captures/ --golden test/golden/
+    # Accept an intended rendering change: rewrites the references that differ
+    tools/capture_to_png.py --port /dev/ttyACM0 -o captures/ --golden test/golden/ --update
+"""
+
+import argparse
+import base64
+import csv
+import os
+import struct
+import sys
+import time
+import zlib
+
+
+def rgb565_to_rgb(hi, lo):
+    v = (hi << 8) | lo
+    r, g, b = v >> 11, (v >> 5) & 0x3F, v & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def decode_frame(width, height, payload):
+    """payload: RLE triples (run - 1, RGB565 high byte, low byte). Returns RGB bytes."""
+    out = bytearray()
+    for i in range(0, len(payload) - 2, 3):
+        out += bytes(rgb565_to_rgb(payload[i + 1], payload[i + 2])) * (payload[i] + 1)
+    if len(out) != width * height * 3:
+        raise ValueError("frame has %d pixels, expected %d" % (len(out) // 3, width * height))
+    return bytes(out)
+
+
+def parse_lines(lines):
+    """Yields (name, width, height, render_us, rgb) for every complete frame in the log lines."""
+    frame = None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("CAP BEGIN "):
+            name, w, h, us = line.split()[2:6]
+            frame = {"name": name, "w": int(w), "h": int(h), "us": int(us), "data": bytearray()}
+        elif line.startswith("CAP END") and frame:
+            yield frame["name"], frame["w"], frame["h"], frame["us"], decode_frame(frame["w"], frame["h"], frame["data"])
+            frame = None
+        elif line.startswith("CAP ERROR"):
+            sys.exit(line[4:])
+        elif line.startswith("CAP DONE"):
+            return
+        elif line.startswith("CAP ") and frame:
+            frame["data"] += base64.b64decode(line[4:])
+
+
+def serial_lines(port, baud, command):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is required for --port (pip install pyserial), or pass a monitor log")
+    with serial.Serial(port, baud, timeout=10) as s:
+        time.sleep(0.2)
+        s.reset_input_buffer()
+        s.write((command + "\n").encode())
+        while True:
+            raw = s.readline()
+            if not raw:
+                sys.exit("no response from the device; is it running the capture build?")
+            line = raw.decode("ascii", "replace")
+            yield line
+            if command == "cap" and line.startswith("CAP END"):
+                return
+
+
+def write_png(path, width, height, rgb):
+    rows = b"".join(b"\x00" + rgb[y * width * 3:(y + 1) * width * 3] for y in range(height))
+
+    def chunk(kind, data):
+        return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data) & 0xFFFFFFFF)
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(rows, 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def read_png(path):
+    """Reads the PNGs written by write_png (8-bit RGB, no row filters). Returns (w, h, rgb)."""
+    data = open(path, "rb").read()
+    pos, width, height, idat = 8, 0, 0, b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, color = struct.unpack(">IIBB", body[:10])
+            if (depth, color) != (8, 2):
+                sys.exit("%s: not written by this tool (8-bit RGB expected)" % path)
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + length
+    raw = zlib.decompress(idat)
+    stride = width * 3 + 1
+    if any(raw[y * stride] != 0 for y in range(height)):
+        sys.exit("%s: filtered rows are not supported, regenerate the golden image" % path)
+    return width, height, b"".join(raw[y * stride + 1:(y + 1) * stride] for y in range(height))
+
+
+def compare(rgb, golden):
+    """Returns the differing pixel count and an RGB image with the differences in red."""
+    diff = bytearray(len(rgb))
+    count = 0
+    for i in range(0, len(rgb), 3):
+        if rgb[i:i + 3] != golden[i:i + 3]:
+            count += 1
+            diff[i] = 255
+        else:
+            grey = sum(rgb[i:i + 3]) // 12  # dimmed page underneath for orientation
+            diff[i:i + 3] = bytes((grey, grey, grey))
+    return count, bytes(diff)
+
+
+def load_times(path):
+    if not os.path.exists(path):
+        return {}
+    with open(path, newline="") as f:
+        return {row["page"]: int(row["render_us"]) for row in csv.DictReader(f)}
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("log", nargs="?", help="monitor log containing CAP lines (instead of --port)")
+    ap.add_argument("--port", help="serial port of the device; sends the command and reads the frames")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--command", default="cap all", choices=["cap", "cap all"])
+    ap.add_argument("-o", "--output", required=True, help="directory for the PNGs and render_times.csv")
+    ap.add_argument("--golden", help="directory with reference PNGs and render_times.csv")
+    ap.add_argument("--tolerance", type=float, default=0.0, help="fraction of pixels allowed to differ")
+    ap.add_argument("--update", action="store_true", help="overwrite the references with the captured frames")
+    ap.add_argument("--slower", type=float, default=25.0, help="render time increase reported, percent")
+    args = ap.parse_args()
+
+    if args.port:
+        lines = serial_lines(args.port, args.baud, args.command)
+    elif args.log:
+        lines = open(args.log, encoding="ascii", errors="replace")
+    else:
+        sys.exit("pass a monitor log or --port")
+
+    os.makedirs(args.output, exist_ok=True)
+    golden_times = load_times(os.path.join(args.golden, "render_times.csv")) if args.golden else {}
+    golden_pages = set()
+    if args.golden:
+        golden_pages = {f[:-4] for f in os.listdir(args.golden) if f.endswith(".png") and not f.endswith(".diff.png")}
+    times = []
+    failed = False
+    for name, width, height, us, rgb in parse_lines(lines):
+        write_png(os.path.join(args.output, name + ".png"), width, height, rgb)
+        times.append((name, us))
+        status = ""
+        if args.golden:
+            golden_path = os.path.join(args.golden, name + ".png")
+            differs = False
+            if name not in golden_pages:
+                status = "live data, not compared"
+            else:
+                gw, gh, golden = read_png(golden_path)
+                if (gw, gh) != (width, height):
+                    status, differs = "size %dx%d, golden %dx%d" % (width, height, gw, gh), True
+                else:
+                    count, diff = compare(rgb, golden)
+                    share = count / float(width * height)
+                    status = "%d px differ (%.2f%%)" % (count, share * 100)
+                    if count:
+                        write_png(os.path.join(args.output, name + ".diff.png"), width, height, diff)
+                    differs = share > args.tolerance
+            if differs and args.update:
+                write_png(golden_path, width, height, rgb)
+                status += " updated"
+            elif differs:
+                status, failed = status + " FAIL", True
+            base = golden_times.get(name)
+            if base and us > base * (1 + args.slower / 100.0):
+                status += ", render %d us (golden %d us)" % (us, base)
+        print("%-16s %7d us  %s" % (name, us, status))
+
+    captured = {name for name, _ in times}
+    if args.command == "cap all":
+        for name in sorted(golden_pages - captured):
+            print("%-16s %7s     not captured FAIL" % (name, "-"))
+            failed = True
+
+    if not times:
+        sys.exit("no complete frames found")
+    with open(os.path.join(args.output, "render_times.csv"), "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(["page", "render_us"])
+        writer.writerows(times)
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""Convert menu icons to palettized, run-length encoded tImage sources (src/ui/icons.cpp).
+
+Blob layout (ICON_ENC_PAL8_RLE, decoded by src/ui/icon_atlas.cpp):
+    byte 0       flags (bit 0: palette index 0 is transparent)
+    byte 1       palette entries - 1
+    2 * n bytes  palette, byte-swapped RGB565 words (same order as the raw arrays), little endian
+    rest         RLE over palette indices, row-major:
+                   0x80 | (len - 1), index        -> run of len (1..128) copies of index
+                   (len - 1), index * len         -> len (1..128) literal indices
+
+Usage:
+    # PNGs (needs Pillow); transparent pixels (alpha < 128) become palette index 0
+    tools/icon_converter.py png icons/compass.png icons/gps.png -o src/ui/icons.cpp
+
+    # Re-encode the raw uint16_t arrays of an existing icons.cpp (black is treated as transparent)
+    tools/icon_converter.py cpp src/ui/icons.cpp -o src/ui/icons.cpp
+"""
+
+import argparse
+import os
+import re
+import sys
+
+TRANSPARENT = 0x0000  # black corners of the existing icons; drawn over a black canvas anyway
+
+
+def swap16(v):
+    return ((v & 0xFF) << 8) | (v >> 8)
+
+
+def rgb888_to_swapped565(r, g, b):
+    return swap16(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+
+
+def luminance(swapped):
+    v = swap16(swapped)
+    r, g, b = (v >> 11) << 3, ((v >> 5) & 0x3F) << 2, (v & 0x1F) << 3
+    return (299 * r + 587 * g + 114 * b) // 1000
+
+
+def rle_encode(indices):
+    out = bytearray()
+    i, n = 0, len(indices)
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and indices[i + run] == indices[i]:
+            run += 1
+        if run >= 3:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(indices[i])
+            i += run
+        else:
+            literal.extend(indices[i:i + run])
+            i += run
+    flush_literal()
+    return bytes(out)
+
+
+def encode_icon(pixels):
+    """pixels: byte-swapped RGB565 words, row-major. Returns the blob."""
+    colors = sorted(set(pixels) - {TRANSPARENT})
+    has_transparent = TRANSPARENT in pixels
+    palette = ([TRANSPARENT] if has_transparent else []) + colors
+    if len(palette) > 256:
+        raise ValueError("icon has %d colors, at most 256 fit a palettized icon" % len(palette))
+    lookup = {c: i for i, c in enumerate(palette)}
+    blob = bytearray([1 if has_transparent else 0, len(palette) - 1])
+    for c in palette:
+        blob += bytes([c & 0xFF, c >> 8])
+    blob += rle_encode([lookup[p] for p in pixels])
+    return bytes(blob)
+
+
+def preview(pixels, width, height):
+    shades = "█▓▒░ "  # dark -> light, like the converter output it replaces
+    lines = []
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        lines.append("".join(shades[min(4, luminance(p) * 5 // 256)] for p in row))
+    return lines
+
+
+def load_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("Pillow is required for PNG input (pip install pillow)")
+    img = Image.open(path).convert("RGBA")
+    pixels = []
+    for r, g, b, a in img.getdata():
+        pixels.append(TRANSPARENT if a < 128 else rgb888_to_swapped565(r, g, b))
+    name = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+    return {"icon": "icon_" + name, "array": "image_data_" + name,
+            "width": img.width, "height": img.height, "pixels": pixels}
+
+
+def load_cpp(path):
+    src = open(path, encoding="utf-8").read()
+    arrays = {}
+    for m in re.finditer(r"uint16_t\s+(\w+)\[\d+\]\s*=\s*\{(.*?)\};", src, re.S):
+        body = re.sub(r"//.*", "", m.group(2))
+        arrays[m.group(1)] = [int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", body)]
+    icons = []
+    for m in re.finditer(r"const\s+tImage\s+(\w+)\s*=\s*\{\s*\(void\s*\*\)\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*16\s*\}", src):
+        name, array, w, h = m.group(1), m.group(2), int(m.group(3)), int(m.group(4))
+        if array not in arrays:
+            continue  # already converted
+        pixels = arrays[array][:w * h]  # some arrays carry an extra row
+        icons.append({"icon": name, "array": array, "width": w, "height": h, "pixels": pixels})
+    return icons
+
+
+def emit(icons, source_note):
+    out = []
+    out.append("// Generated by tools/icon_converter.py from %s, do not edit by hand." % source_note)
+    out.append("// Palettized + RLE (ICON_ENC_PAL8_RLE); decoded once by ui/icon_atlas.cpp.")
+    out.append('#include "icons.h"')
+    out.append("")
+    raw_total = enc_total = 0
+    for icon in icons:
+        blob = encode_icon(icon["pixels"])
+        raw_total += icon["width"] * icon["height"] * 2
+        enc_total += len(blob)
+        out.append("// %dx%d, %d B (raw %d B)" % (icon["width"], icon["height"], len(blob),
+                                                  icon["width"] * icon["height"] * 2))
+        out.append("static const uint8_t %s[%d] = {" % (icon["array"], len(blob)))
+        for line in preview(icon["pixels"], icon["width"], icon["height"]):
+            out.append("    // " + line)
+        for i in range(0, len(blob), 16):
+            out.append("    " + ", ".join("0x%02x" % b for b in blob[i:i + 16]) + ",")
+        out.append("};")
+        out.append("")
+    for icon in icons:
+        out.append("const tImage %s = { (void*)%s, %d, %d, 16, ICON_ENC_PAL8_RLE };"
+                   % (icon["icon"], icon["array"], icon["width"], icon["height"]))
+    out.append("")
+    print("%d icons: %d B raw -> %d B encoded" % (len(icons), raw_total, enc_total), file=sys.stderr)
+    return "\n".join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("mode", choices=["png", "cpp"])
+    ap.add_argument("inputs", nargs="+")
+    ap.add_argument("-o", "--output", required=True)
+    args = ap.parse_args()
+
+    if args.mode == "png":
+        icons = [load_png(p) for p in args.inputs]
+    else:
+        icons = [i for p in args.inputs for i in load_cpp(p)]
+    if not icons:
+        sys.exit("no raw 16-bit icons found")
+    text = emit(icons, ", ".join(os.path.basename(p) for p in args.inputs))
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,431 @@
+#!/usr/bin/env python3
+"""Render a TrueType font for the glyph atlas (src/ui/glyph_atlas.cpp) or as a VLW smooth font.
+
+Output depends on the extension of -o:
+    .h      PROGMEM header compiled into the firmware: glyph table and 4-bit alpha maps, rows
+            padded to whole bytes, high nibble first (the atlas format, no conversion at boot)
+    .vlw    VLW smooth font as written by Processing and read by LovyanGFX's loadFont(); all
+            integers 32-bit big endian:
+                header       glyph count, version (11), size, 0, ascent, descent
+                per glyph    code, height, width, xAdvance, dY (top above baseline), dX (left offset), 0
+                bitmaps      width * height 8-bit alpha per glyph, in header order
+
+The outlines are rasterized here (quadratic TrueType outlines only, no hinting), so the tool needs
+nothing beyond Python 3 and the output does not depend on the installed imaging libraries.
+
+Usage (the committed UI fonts, rendered from Lato 1.x, SIL Open Font License):
+    tools/vlw_font.py Lato-Regular.ttf 20 --name font_label -o include/ui/font_label.h
+    tools/vlw_font.py Lato-Regular.ttf 28 --chars "0123456789°" --name font_heading -o include/ui/font_heading.h
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+ASCII = "".join(chr(c) for c in range(32, 127)) + "°"
+
+
+# ---- TrueType reader ----
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        count = self.u16(4)
+        self.tables = {}
+        for i in range(count):
+            tag, _, off, length = struct.unpack_from(">4sIII", self.data, 12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (off, length)
+        for tag in ("head", "hhea", "hmtx", "loca", "glyf", "cmap", "maxp"):
+            if tag not in self.tables:
+                sys.exit("%s: no '%s' table (only TrueType outlines are supported)" % (path, tag))
+        head = self.tables["head"][0]
+        self.units_per_em = self.u16(head + 18)
+        self.long_loca = self.i16(head + 50) == 1
+        hhea = self.tables["hhea"][0]
+        self.ascender = self.i16(hhea + 4)
+        self.descender = self.i16(hhea + 6)
+        self.num_hmetrics = self.u16(hhea + 34)
+        self.num_glyphs = self.u16(self.tables["maxp"][0] + 4)
+        self.cmap = self.read_cmap()
+
+    def u8(self, o): return self.data[o]
+    def i8(self, o): return struct.unpack_from(">b", self.data, o)[0]
+    def u16(self, o): return struct.unpack_from(">H", self.data, o)[0]
+    def i16(self, o): return struct.unpack_from(">h", self.data, o)[0]
+    def u32(self, o): return struct.unpack_from(">I", self.data, o)[0]
+
+    def copyright(self):
+        if "name" not in self.tables:
+            return ""
+        off = self.tables["name"][0]
+        count, strings = self.u16(off + 2), off + self.u16(off + 4)
+        for i in range(count):
+            platform, _, _, name_id, length, at = struct.unpack_from(">6H", self.data, off + 6 + 12 * i)
+            if name_id == 0 and platform == 3:
+                return self.data[strings + at:strings + at + length].decode("utf-16-be")
+        return ""
+
+    def read_cmap(self):
+        off = self.tables["cmap"][0]
+        best = None
+        for i in range(self.u16(off + 2)):
+            platform, encoding, sub = struct.unpack_from(">HHI", self.data, off + 4 + 8 * i)
+            fmt = self.u16(off + sub)
+            if platform in (0, 3) and fmt in (4, 12) and (best is None or fmt > best[0]):
+                best = (fmt, off + sub)
+        if best is None:
+            sys.exit("no Unicode cmap")
+        fmt, at = best
+        cmap = {}
+        if fmt == 4:
+            segs = self.u16(at + 6) // 2
+            ends, starts = at + 14, at + 16 + 2 * segs
+            deltas, ranges = starts + 2 * segs, starts + 4 * segs
+            for s in range(segs):
+                start, end = self.u16(starts + 2 * s), self.u16(ends + 2 * s)
+                delta, roff = self.u16(deltas + 2 * s), self.u16(ranges + 2 * s)
+                for c in range(start, min(end, 0xFFFE) + 1):
+                    if roff == 0:
+                        g = (c + delta) & 0xFFFF
+                    else:
+                        g = self.u16(ranges + 2 * s + roff + 2 * (c - start))
+                        g = (g + delta) & 0xFFFF if g else 0
+                    if g:
+                        cmap[c] = g
+        else:
+            for i in range(self.u32(at + 12)):
+                start, end, glyph = struct.unpack_from(">III", self.data, at + 16 + 12 * i)
+                for c in range(start, min(end, 0x2FFFF) + 1):
+                    cmap[c] = glyph + c - start
+        return cmap
+
+    def advance(self, glyph):
+        off = self.tables["hmtx"][0]
+        return self.u16(off + 4 * min(glyph, self.num_hmetrics - 1))
+
+    def glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            return self.u32(loca + 4 * glyph), self.u32(loca + 4 * glyph + 4)
+        return 2 * self.u16(loca + 2 * glyph), 2 * self.u16(loca + 2 * glyph + 2)
+
+    def contours(self, glyph, depth=0):
+        """Contours of a glyph as lists of (x, y, on_curve) in font units, composites resolved."""
+        start, end = self.glyph_range(glyph)
+        if start == end:
+            return []
+        at = self.tables["glyf"][0] + start
+        n = self.i16(at)
+        if n < 0:
+            return self.composite(at + 10, depth)
+        end_pts = [self.u16(at + 10 + 2 * i) for i in range(n)]
+        points = end_pts[-1] + 1 if n else 0
+        p = at + 10 + 2 * n
+        p += 2 + self.u16(p)  # skip instructions
+        flags = []
+        while len(flags) < points:
+            f = self.u8(p); p += 1
+            flags.append(f)
+            if f & 8:
+                flags.extend([f] * self.u8(p)); p += 1
+        xs, ys = [], []
+        for coords, short, same in ((xs, 2, 16), (ys, 4, 32)):
+            v = 0
+            for f in flags[:points]:
+                if f & short:
+                    d = self.u8(p); p += 1
+                    v += d if f & same else -d
+                elif not f & same:
+                    v += self.i16(p); p += 2
+                coords.append(v)
+        result, first = [], 0
+        for last in end_pts:
+            result.append([(xs[i], ys[i], bool(flags[i] & 1)) for i in range(first, last + 1)])
+            first = last + 1
+        return result
+
+    def composite(self, p, depth):
+        result = []
+        while depth < 8:
+            flags, glyph = self.u16(p), self.u16(p + 2); p += 4
+            if flags & 1:
+                dx, dy = self.i16(p), self.i16(p + 2); p += 4
+            else:
+                dx, dy = self.i8(p), self.i8(p + 1); p += 2
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = self.i16(p) / 16384.0; p += 2
+            elif flags & 0x40:
+                a, d = self.i16(p) / 16384.0, self.i16(p + 2) / 16384.0; p += 4
+            elif flags & 0x80:
+                a, b, c, d = (self.i16(p + 2 * i) / 16384.0 for i in range(4)); p += 8
+            if not flags & 2:
+                dx = dy = 0  # point matching offsets are not supported
+            for contour in self.contours(glyph, depth + 1):
+                result.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+            if not flags & 0x20:
+                break
+        return result
+
+
+# ---- Rasterizer ----
+
+def flatten(contour, scale):
+    """Line segments ((x0, y0), (x1, y1)) of one contour, scaled to pixels (y up)."""
+    pts = [(x * scale, y * scale, on) for x, y, on in contour]
+    if not pts:
+        return []
+    # Start on an on-curve point; between two off-curve points the on-curve point is implied
+    if not pts[0][2]:
+        if pts[-1][2]:
+            pts = [pts[-1]] + pts[:-1]
+        else:
+            mid = ((pts[0][0] + pts[-1][0]) / 2, (pts[0][1] + pts[-1][1]) / 2, True)
+            pts = [mid] + pts
+    segments = []
+    start = cur = pts[0][:2]
+    ctrl = None
+    for x, y, on in pts[1:] + [pts[0]]:
+        if on:
+            if ctrl is None:
+                segments.append((cur, (x, y)))
+            else:
+                segments += quad(cur, ctrl, (x, y))
+                ctrl = None
+            cur = (x, y)
+        else:
+            if ctrl is not None:
+                mid = ((ctrl[0] + x) / 2, (ctrl[1] + y) / 2)
+                segments += quad(cur, ctrl, mid)
+                cur = mid
+            ctrl = (x, y)
+    if ctrl is not None:
+        segments += quad(cur, ctrl, start)
+    return segments
+
+
+def quad(p0, p1, p2):
+    # Enough steps to keep the chords within ~0.1 px of the curve
+    dd = math.hypot(p0[0] - 2 * p1[0] + p2[0], p0[1] - 2 * p1[1] + p2[1])
+    n = max(1, int(math.ceil(math.sqrt(dd / 0.8))))
+    out, prev = [], p0
+    for i in range(1, n + 1):
+        t = i / n
+        u = 1 - t
+        pt = (u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0], u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1])
+        out.append((prev, pt))
+        prev = pt
+    return out
+
+
+def rasterize(segments, w, h):
+    """Exact area coverage (signed area accumulation, nonzero-ish: overlaps clamp to full)."""
+    stride = w + 2
+    acc = [0.0] * (stride * h + 1)
+    for (ax, ay), (bx, by) in segments:
+        if ay == by:
+            continue
+        direction = 1.0
+        if ay > by:
+            direction, ax, ay, bx, by = -1.0, bx, by, ax, ay
+        dxdy = (bx - ax) / (by - ay)
+        x = ax
+        if ay < 0:
+            x -= ay * dxdy
+        for y in range(max(0, int(ay)), min(h, int(math.ceil(by)))):
+            row = y * stride
+            dy = min(y + 1.0, by) - max(float(y), ay)
+            xnext = x + dxdy * dy
+            d = dy * direction
+            x0, x1 = (x, xnext) if x < xnext else (xnext, x)
+            x0f = math.floor(x0)
+            x0i, x1i = int(x0f), int(math.ceil(x1))
+            if x1i <= x0i + 1:
+                xm = 0.5 * (x + xnext) - x0f
+                acc[row + x0i] += d - d * xm
+                acc[row + x0i + 1] += d * xm
+            else:
+                s = 1.0 / (x1 - x0)
+                x0frac = x0 - x0f
+                a0 = 0.5 * s * (1 - x0frac) ** 2
+                x1frac = x1 - math.ceil(x1) + 1
+                am = 0.5 * s * x1frac * x1frac
+                acc[row + x0i] += d * a0
+                if x1i == x0i + 2:
+                    acc[row + x0i + 1] += d * (1 - a0 - am)
+                else:
+                    a1 = s * (1.5 - x0frac)
+                    acc[row + x0i + 1] += d * (a1 - a0)
+                    for xi in range(x0i + 2, x1i - 1):
+                        acc[row + xi] += d * s
+                    a2 = a1 + (x1i - x0i - 3) * s
+                    acc[row + x1i - 1] += d * (1 - a2 - am)
+                acc[row + x1i] += d * am
+            x = xnext
+    alpha = bytearray(w * h)
+    for y in range(h):
+        total = 0.0
+        for x in range(w):
+            total += acc[y * stride + x]
+            alpha[y * w + x] = min(255, int(abs(total) * 255 + 0.5))
+    return bytes(alpha)
+
+
+def render(ttf, size, chars):
+    font = TrueType(ttf)
+    scale = size / font.units_per_em
+    ascent = int(math.ceil(font.ascender * scale))
+    descent = int(math.ceil(-font.descender * scale))
+    glyphs = []
+    for ch in sorted(set(chars)):
+        gid = font.cmap.get(ord(ch))
+        if gid is None:
+            print("warning: %r is not in the font" % ch, file=sys.stderr)
+            continue
+        advance = int(round(font.advance(gid) * scale))
+        segments = []
+        for contour in font.contours(gid):
+            segments += flatten(contour, scale)
+        w = h = dx = dy = 0
+        alpha = b""
+        if segments:
+            xs = [p[0] for s in segments for p in s]
+            ys = [p[1] for s in segments for p in s]
+            dx, right = int(math.floor(min(xs))), int(math.ceil(max(xs)))
+            dy, bottom = int(math.ceil(max(ys))), int(math.floor(min(ys)))
+            w, h = right - dx, dy - bottom
+            # Pixel space: origin at the top left of the box, y down
+            pixel = [((ax - dx, dy - ay), (bx - dx, dy - by)) for (ax, ay), (bx, by) in segments]
+            alpha = rasterize(pixel, w, h)
+        glyphs.append({"code": ord(ch), "w": w, "h": h, "advance": advance,
+                       "dy": dy, "dx": dx, "alpha": alpha})
+    return glyphs, ascent, descent, font.copyright()
+
+
+# ---- Output ----
+
+def encode_vlw(glyphs, size, ascent, descent):
+    out = bytearray(struct.pack(">6i", len(glyphs), 11, size, 0, ascent, descent))
+    for g in glyphs:
+        out += struct.pack(">7i", g["code"], g["h"], g["w"], g["advance"], g["dy"], g["dx"], 0)
+    for g in glyphs:
+        out += g["alpha"]
+    return bytes(out)
+
+
+def quantize(g):
+    """4-bit alpha, rows padded to whole bytes, high nibble first (same rounding as before)."""
+    stride = (g["w"] + 1) // 2
+    out = bytearray(stride * g["h"])
+    for y in range(g["h"]):
+        for x in range(g["w"]):
+            level = (g["alpha"][y * g["w"] + x] * 15 + 127) // 255
+            out[y * stride + x // 2] |= level if x & 1 else level << 4
+    return bytes(out)
+
+
+def preview(g, bits):
+    """Comment lines drawing the glyph, like the icon sources."""
+    shades = " ░▒▓█"
+    stride = (g["w"] + 1) // 2
+    lines = []
+    for y in range(g["h"]):
+        row = ""
+        for x in range(g["w"]):
+            b = bits[y * stride + x // 2]
+            level = b & 15 if x & 1 else b >> 4
+            row += shades[(level * 4 + 7) // 15]
+        lines.append("    // " + row.rstrip())
+    return lines
+
+
+def encode_header(glyphs, size, ascent, descent, name, source, notice, command):
+    guard = name.upper() + "_H"
+    bits = bytearray()
+    table, art = [], []
+    for g in glyphs:
+        q = quantize(g)
+        char = chr(g["code"])
+        label = {" ": "space", "\\": "backslash"}.get(char, char)  # a trailing \ would continue the comment
+        table.append("    { 0x%02X, %2d, %2d, %3d, %3d, %2d, %5d },  // %s"
+                     % (g["code"], g["w"], g["h"], g["dx"], g["dy"], g["advance"], len(bits), label))
+        if q:
+            art.append("    // U+%04X '%s' at %d" % (g["code"], label, len(bits)))
+            art += preview(g, q)
+        bits += q
+    lines = [
+        "#ifndef " + guard,
+        "#define " + guard,
+        "",
+        "// Generated by tools/vlw_font.py from %s at %d px, do not edit by hand:" % (source, size),
+        "//   " + command,
+    ]
+    if notice:
+        lines.append("// Font: " + notice)
+    lines += [
+        "// %d glyphs, ascent %d, descent %d, %d B of 4-bit alpha maps (read from flash by ui/glyph_atlas.cpp)"
+        % (len(glyphs), ascent, descent, len(bits)),
+        "",
+        "static const uint8_t %s_bits[%d] PROGMEM = {" % (name, max(1, len(bits))),
+    ]
+    lines += art
+    for i in range(0, len(bits), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in bits[i:i + 16]) + ",")
+    if not bits:
+        lines.append("    0x00,")
+    lines += [
+        "};",
+        "",
+        "static const GlyphData %s_glyphs[%d] PROGMEM = {" % (name, len(glyphs)),
+        "    // code, w, h, dx, dy, advance, offset",
+    ]
+    lines += table
+    lines += [
+        "};",
+        "",
+        "static const GlyphFont %s = { %s_glyphs, %d, %s_bits, %d, %d };"
+        % (name, name, len(glyphs), name, ascent, descent),
+        "",
+        "#endif // " + guard,
+        "",
+    ]
+    return "\n".join(lines), len(bits)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("ttf")
+    ap.add_argument("size", type=int, help="pixel size")
+    ap.add_argument("--chars", default=ASCII, help="characters to include (default: printable ASCII and °)")
+    ap.add_argument("--name", help="C symbol of the font in a .h output (default: output file name)")
+    ap.add_argument("-o", "--output", required=True, help="output file, .h or .vlw")
+    args = ap.parse_args()
+
+    glyphs, ascent, descent, notice = render(args.ttf, args.size, args.chars)
+    os.makedirs(os.path.dirname(args.output) or ".", exist_ok=True)
+    if args.output.endswith(".h"):
+        name = args.name or os.path.splitext(os.path.basename(args.output))[0]
+        command = "tools/vlw_font.py %s %d%s --name %s -o %s" % (
+            os.path.basename(args.ttf), args.size,
+            "" if args.chars == ASCII else ' --chars "%s"' % args.chars, name, args.output)
+        if sum(((g["w"] + 1) // 2) * g["h"] for g in glyphs) > 0xFFFF:
+            sys.exit("alpha maps exceed the 16-bit glyph offsets, use fewer characters or a smaller size")
+        text, size = encode_header(glyphs, args.size, ascent, descent, name,
+                                   os.path.basename(args.ttf), notice, command)
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(text)
+        print("%d glyphs, ascent %d, descent %d: %d B of alpha maps in flash"
+              % (len(glyphs), ascent, descent, size), file=sys.stderr)
+    else:
+        blob = encode_vlw(glyphs, args.size, ascent, descent)
+        with open(args.output, "wb") as f:
+            f.write(blob)
+        print("%d glyphs, ascent %d, descent %d: %d B file"
+              % (len(glyphs), ascent, descent, len(blob)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()